@@ -0,0 +1,165 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file checkpoint.hpp
+
+#if !defined(HPX_COMPONENT_STORAGE_CHECKPOINT_OCT_02_2015_0214PM)
+#define HPX_COMPONENT_STORAGE_CHECKPOINT_OCT_02_2015_0214PM
+
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/naming.hpp>
+#include <hpx/include/traits.hpp>
+
+#include <hpx/components/component_storage/server/checkpoint.hpp>
+
+#include <map>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/lexical_cast.hpp>
+
+namespace hpx { namespace components
+{
+    /// Return the name of the file which holds the part of the checkpoint
+    /// \a basename written by the given locality.
+    inline std::string get_checkpoint_filename(std::string const& basename,
+        boost::uint32_t locality_id)
+    {
+        return basename + "." + boost::lexical_cast<std::string>(locality_id);
+    }
+
+    /// \cond NOINTERNAL
+    namespace detail
+    {
+        template <typename Component>
+        future<void> checkpoint_localities(
+            std::vector<future<naming::id_type> > && localities,
+            std::vector<naming::id_type> const& ids,
+            std::string const& basename)
+        {
+            // group the objects by the locality they live on
+            typedef std::pair<naming::id_type, std::vector<naming::id_type> >
+                group_type;
+            std::map<boost::uint32_t, group_type> groups;
+
+            for (std::size_t i = 0; i != ids.size(); ++i)
+            {
+                naming::id_type locality = localities[i].get();
+                group_type& group =
+                    groups[naming::get_locality_id_from_id(locality)];
+
+                group.first = locality;
+                group.second.push_back(ids[i]);
+            }
+
+            // write all parts of the checkpoint concurrently
+            typedef server::checkpoint_here_action<Component> action_type;
+
+            std::vector<future<void> > writes;
+            writes.reserve(groups.size());
+            for (auto const& g : groups)
+            {
+                writes.push_back(hpx::async<action_type>(g.second.first,
+                    g.second.second, get_checkpoint_filename(basename, g.first)));
+            }
+
+            return when_all(writes).then(
+                [](future<std::vector<future<void> > > && f)
+                {
+                    // rethrow errors
+                    std::vector<future<void> > writes = f.get();
+                    for (future<void>& w : writes)
+                        w.get();
+                });
+        }
+    }
+    /// \endcond
+
+    /// Write a checkpoint of the given components
+    ///
+    /// The function \a checkpoint<Component> serializes all components
+    /// referenced by \a ids directly into memory mapped files, one file per
+    /// locality the components live on (see \a get_checkpoint_filename). All
+    /// localities write their files concurrently. On each locality the
+    /// components are serialized concurrently, the file itself is written
+    /// by a thread of the io pool.
+    ///
+    /// \param ids             [in] The global ids of the components to
+    ///                        checkpoint.
+    /// \param basename        [in] The base name of the files to create.
+    ///
+    /// \tparam  The only template argument specifies the component type of the
+    ///          components to checkpoint.
+    ///
+    /// \returns A future which becomes ready once all files were written.
+    ///          The components must not be modified before this future
+    ///          becomes ready.
+    ///
+    template <typename Component>
+#if defined(DOXYGEN)
+    future<void>
+#else
+    inline typename std::enable_if<
+        traits::is_component<Component>::value, future<void>
+    >::type
+#endif
+    checkpoint(std::vector<naming::id_type> const& ids,
+        std::string const& basename)
+    {
+        std::vector<future<naming::id_type> > localities;
+        localities.reserve(ids.size());
+        for (naming::id_type const& id : ids)
+            localities.push_back(hpx::get_colocation_id(id));
+
+        return when_all(localities).then(
+            [ids, basename](
+                future<std::vector<future<naming::id_type> > > && f)
+            {
+                return detail::checkpoint_localities<Component>(
+                    f.get(), ids, basename);
+            });
+    }
+
+    /// Restore the components stored in the given checkpoint file
+    ///
+    /// The function \a restore<Component> maps the given checkpoint file on
+    /// the specified locality and recreates each of the stored components as
+    /// a new component instance on this locality. The file is read by a
+    /// thread of the io pool, the components are deserialized concurrently.
+    ///
+    /// \param locality        [in] The locality where the components should
+    ///                        be recreated, this locality has to be able to
+    ///                        access the given file.
+    /// \param filename        [in] The name of the checkpoint file to read.
+    ///
+    /// \tparam  The only template argument specifies the component type of the
+    ///          components to restore.
+    ///
+    /// \returns A future representing the global ids of the restored
+    ///          component instances, in the order they were stored in the
+    ///          file.
+    ///
+    /// \note    Use \a checkpoint_reader to deserialize individual
+    ///          components from a checkpoint file on demand.
+    ///
+    template <typename Component>
+#if defined(DOXYGEN)
+    future<std::vector<naming::id_type> >
+#else
+    inline typename std::enable_if<
+        traits::is_component<Component>::value,
+        future<std::vector<naming::id_type> >
+    >::type
+#endif
+    restore(naming::id_type const& locality, std::string const& filename)
+    {
+        typedef server::restore_here_action<Component> action_type;
+        return hpx::async<action_type>(locality, filename);
+    }
+}}
+
+#endif
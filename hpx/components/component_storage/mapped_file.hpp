@@ -0,0 +1,274 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_COMPONENT_STORAGE_MAPPED_FILE_OCT_02_2015_1118AM)
+#define HPX_COMPONENT_STORAGE_MAPPED_FILE_OCT_02_2015_1118AM
+
+#include <hpx/config.hpp>
+#include <hpx/exception.hpp>
+#include <hpx/util/assert.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <string>
+
+#include <boost/filesystem/operations.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/system/error_code.hpp>
+
+namespace hpx { namespace components { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // A file mapped into memory. Files opened for writing grow on demand,
+    // the logical size is tracked separately from the size of the mapped
+    // file (which is grown geometrically to limit the number of remappings).
+    class mapped_file : boost::noncopyable
+    {
+    public:
+        enum open_mode
+        {
+            read_only,
+            create
+        };
+
+        enum { initial_capacity = 0x10000 };
+
+        mapped_file(std::string const& filename, open_mode mode)
+          : filename_(filename), size_(0), capacity_(0)
+          , writable_(mode == create)
+        {
+            using namespace boost::interprocess;
+            try {
+                if (writable_)
+                {
+                    // create (or truncate) the file
+                    std::filebuf fb;
+                    if (!fb.open(filename_.c_str(), std::ios_base::in |
+                            std::ios_base::out | std::ios_base::trunc |
+                            std::ios_base::binary))
+                    {
+                        HPX_THROW_EXCEPTION(filesystem_error,
+                            "mapped_file::mapped_file",
+                            "could not create file: " + filename_);
+                    }
+                    fb.close();
+
+                    remap(initial_capacity);
+                }
+                else
+                {
+                    file_mapping(filename_.c_str(), boost::interprocess::read_only)
+                        .swap(file_);
+                    mapped_region(file_, boost::interprocess::read_only)
+                        .swap(region_);
+
+                    size_ = capacity_ = region_.get_size();
+                }
+            }
+            catch (interprocess_exception const& e) {
+                HPX_THROW_EXCEPTION(filesystem_error,
+                    "mapped_file::mapped_file",
+                    "could not map file: " + filename_ + " (" + e.what() + ")");
+            }
+        }
+
+        ~mapped_file()
+        {
+            try {
+                close();
+            }
+            catch (...) {
+                ;   // there is nothing we can do here
+            }
+        }
+
+        // unmap the file, files opened for writing are truncated to their
+        // logical size
+        void close()
+        {
+            using namespace boost::interprocess;
+
+            if (region_.get_size() == 0)
+                return;         // already closed
+
+            if (writable_)
+                region_.flush();
+            mapped_region().swap(region_);
+            file_mapping().swap(file_);
+            capacity_ = 0;
+
+            if (writable_)
+            {
+                boost::system::error_code ec;
+                boost::filesystem::resize_file(filename_, size_, ec);
+                if (ec)
+                {
+                    HPX_THROW_EXCEPTION(filesystem_error,
+                        "mapped_file::close",
+                        "could not truncate file: " + filename_ + " (" +
+                            ec.message() + ")");
+                }
+            }
+        }
+
+        // initiate writing all modified pages back to the file, this does
+        // not wait for the operation to finish
+        void flush()
+        {
+            if (region_.get_size() != 0)
+                region_.flush();
+        }
+
+        std::size_t size() const
+        {
+            return size_;
+        }
+
+        void resize(std::size_t size)
+        {
+            HPX_ASSERT(writable_);
+            if (size > capacity_)
+                remap((std::max)(size, 2 * capacity_));
+            size_ = size;
+        }
+
+        char* data()
+        {
+            return static_cast<char*>(region_.get_address());
+        }
+        char const* data() const
+        {
+            return static_cast<char const*>(region_.get_address());
+        }
+
+        char& operator[](std::size_t i)
+        {
+            HPX_ASSERT(i < capacity_);
+            return data()[i];
+        }
+        char const& operator[](std::size_t i) const
+        {
+            HPX_ASSERT(i < capacity_);
+            return data()[i];
+        }
+
+        std::string const& get_filename() const
+        {
+            return filename_;
+        }
+
+    private:
+        // grow the file to the given size and map it again
+        void remap(std::size_t capacity)
+        {
+            using namespace boost::interprocess;
+
+            // release the current mapping first
+            if (region_.get_size() != 0)
+                region_.flush();
+            mapped_region().swap(region_);
+            file_mapping().swap(file_);
+
+            {
+                std::filebuf fb;
+                if (!fb.open(filename_.c_str(), std::ios_base::in |
+                        std::ios_base::out | std::ios_base::binary))
+                {
+                    HPX_THROW_EXCEPTION(filesystem_error,
+                        "mapped_file::remap",
+                        "could not open file: " + filename_);
+                }
+
+                fb.pubseekoff(capacity - 1, std::ios_base::beg);
+                if (fb.sputc(0) == std::filebuf::traits_type::eof())
+                {
+                    HPX_THROW_EXCEPTION(filesystem_error,
+                        "mapped_file::remap",
+                        "could not grow file: " + filename_);
+                }
+            }
+
+            file_mapping(filename_.c_str(), read_write).swap(file_);
+            mapped_region(file_, read_write, 0, capacity).swap(region_);
+
+            capacity_ = capacity;
+        }
+
+        std::string filename_;
+        std::size_t size_;
+        std::size_t capacity_;
+        bool writable_;
+
+        boost::interprocess::file_mapping file_;
+        boost::interprocess::mapped_region region_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Expose the part of a mapped file starting at the given offset as a
+    // container usable with the serialization archives. This allows to
+    // serialize objects straight into (and out of) the mapped memory.
+    template <typename File>
+    class mapped_file_view
+    {
+    public:
+        mapped_file_view(File& file, std::size_t offset)
+          : file_(file), offset_(offset)
+        {
+            HPX_ASSERT(offset <= file.size());
+        }
+
+        std::size_t size() const
+        {
+            return file_.size() - offset_;
+        }
+
+        void resize(std::size_t size)
+        {
+            file_.resize(offset_ + size);
+        }
+
+        char& operator[](std::size_t i)
+        {
+            return file_[offset_ + i];
+        }
+        char const& operator[](std::size_t i) const
+        {
+            return file_[offset_ + i];
+        }
+
+    private:
+        File& file_;
+        std::size_t offset_;
+    };
+
+    // read-only view of a part of a mapped file
+    class const_mapped_file_view
+    {
+    public:
+        const_mapped_file_view(char const* data, std::size_t size)
+          : data_(data), size_(size)
+        {}
+
+        std::size_t size() const
+        {
+            return size_;
+        }
+
+        char const& operator[](std::size_t i) const
+        {
+            HPX_ASSERT(i < size_);
+            return data_[i];
+        }
+
+    private:
+        char const* data_;
+        std::size_t size_;
+    };
+}}}
+
+#endif
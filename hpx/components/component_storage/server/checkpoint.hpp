@@ -0,0 +1,438 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_COMPONENT_STORAGE_SERVER_CHECKPOINT_OCT_02_2015_1145AM)
+#define HPX_COMPONENT_STORAGE_SERVER_CHECKPOINT_OCT_02_2015_1145AM
+
+#include <hpx/include/actions.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/naming.hpp>
+#include <hpx/include/serialization.hpp>
+#include <hpx/include/thread_executors.hpp>
+#include <hpx/include/util.hpp>
+#include <hpx/runtime/get_ptr.hpp>
+#include <hpx/util/unused.hpp>
+
+#include <hpx/components/component_storage/mapped_file.hpp>
+
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/shared_ptr.hpp>
+
+namespace hpx { namespace components
+{
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // A checkpoint file consists of a fixed size header, followed by the
+        // serialized components (each one written by its own archive, which
+        // allows to deserialize them independently), followed by the index
+        // describing where each of the components is stored.
+        struct checkpoint_header
+        {
+            char magic_[8];
+            boost::uint64_t num_entries_;
+            boost::uint64_t index_offset_;
+            boost::uint64_t index_size_;
+        };
+
+        inline char const* checkpoint_magic()
+        {
+            return "HPXCHKPT";
+        }
+
+        struct checkpoint_entry
+        {
+            checkpoint_entry()
+              : offset_(0), size_(0)
+            {}
+
+            checkpoint_entry(naming::gid_type const& id, boost::uint64_t offset,
+                    boost::uint64_t size)
+              : id_(id), offset_(offset), size_(size)
+            {}
+
+            naming::gid_type id_;
+            boost::uint64_t offset_;
+            boost::uint64_t size_;
+
+        private:
+            friend class hpx::serialization::access;
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned)
+            {
+                ar & id_ & offset_ & size_;
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Serialize a component into its own buffer, this allows to
+        // serialize several components concurrently.
+        template <typename Component>
+        std::vector<char> serialize_component(
+            boost::shared_ptr<Component> const& ptr)
+        {
+            std::vector<char> data;
+            {
+                serialization::output_archive archive(data);
+                archive << ptr;
+            }
+            return data;
+        }
+
+        template <typename Component>
+        boost::shared_ptr<Component> deserialize_component(
+            std::vector<char> data)
+        {
+            boost::shared_ptr<Component> ptr;
+            serialization::input_archive archive(data, 0U, data.size(), 0);
+            archive >> ptr;
+            return ptr;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Writes serialized components into a memory mapped file.
+        class checkpoint_writer
+        {
+        public:
+            explicit checkpoint_writer(std::string const& filename)
+              : file_(filename, mapped_file::create)
+            {
+                file_.resize(sizeof(checkpoint_header));
+            }
+
+            void write(naming::gid_type const& id,
+                std::vector<char> const& data)
+            {
+                std::size_t offset = file_.size();
+
+                file_.resize(offset + data.size());
+                if (!data.empty())
+                {
+                    std::memcpy(file_.data() + offset, data.data(),
+                        data.size());
+                }
+
+                entries_.push_back(
+                    checkpoint_entry(id, offset, data.size()));
+            }
+
+            // write the index and the header, and close the file
+            void close()
+            {
+                std::size_t offset = file_.size();
+
+                {
+                    mapped_file_view<mapped_file> view(file_, offset);
+                    serialization::output_archive archive(view);
+                    archive << entries_;
+                }
+
+                checkpoint_header header;
+                std::memcpy(header.magic_, checkpoint_magic(),
+                    sizeof(header.magic_));
+                header.num_entries_ = entries_.size();
+                header.index_offset_ = offset;
+                header.index_size_ = file_.size() - offset;
+
+                std::memcpy(file_.data(), &header, sizeof(header));
+                file_.close();
+            }
+
+        private:
+            mapped_file file_;
+            std::vector<checkpoint_entry> entries_;
+        };
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A checkpoint_reader maps a checkpoint file written by \a checkpoint
+    /// and deserializes the stored components on demand, without recreating
+    /// them as component instances.
+    class checkpoint_reader
+    {
+    public:
+        /// Map the given checkpoint file, this throws a filesystem_error if
+        /// the file is not a complete checkpoint.
+        explicit checkpoint_reader(std::string const& filename)
+          : file_(filename, detail::mapped_file::read_only)
+        {
+            detail::checkpoint_header header;
+            if (file_.size() < sizeof(header))
+            {
+                HPX_THROW_EXCEPTION(filesystem_error,
+                    "checkpoint_reader::checkpoint_reader",
+                    "not a valid checkpoint file: " + filename);
+            }
+
+            std::memcpy(&header, file_.data(), sizeof(header));
+            if (std::memcmp(header.magic_, detail::checkpoint_magic(),
+                    sizeof(header.magic_)) != 0 ||
+                header.index_offset_ + header.index_size_ > file_.size())
+            {
+                HPX_THROW_EXCEPTION(filesystem_error,
+                    "checkpoint_reader::checkpoint_reader",
+                    "not a valid (or incomplete) checkpoint file: " +
+                        filename);
+            }
+
+            detail::const_mapped_file_view view(
+                file_.data() + header.index_offset_,
+                static_cast<std::size_t>(header.index_size_));
+            serialization::input_archive archive(view, 0U, view.size(), 0);
+            archive >> entries_;
+
+            HPX_ASSERT(entries_.size() == header.num_entries_);
+        }
+
+        /// Return the number of stored components
+        std::size_t size() const
+        {
+            return entries_.size();
+        }
+
+        /// Return the ids of the components at the time they were
+        /// checkpointed, in the order they are stored
+        std::vector<naming::gid_type> get_ids() const
+        {
+            std::vector<naming::gid_type> ids;
+            ids.reserve(entries_.size());
+            for (detail::checkpoint_entry const& e : entries_)
+                ids.push_back(e.id_);
+            return ids;
+        }
+
+        /// Return a copy of the serialized data of the component stored at
+        /// the given position
+        std::vector<char> read(std::size_t i) const
+        {
+            HPX_ASSERT(i < entries_.size());
+
+            detail::checkpoint_entry const& e = entries_[i];
+            char const* data = file_.data() + e.offset_;
+            return std::vector<char>(data,
+                data + static_cast<std::size_t>(e.size_));
+        }
+
+        /// Deserialize the component stored at the given position
+        template <typename Component>
+        boost::shared_ptr<Component> load(std::size_t i) const
+        {
+            HPX_ASSERT(i < entries_.size());
+
+            detail::checkpoint_entry const& e = entries_[i];
+            detail::const_mapped_file_view view(file_.data() + e.offset_,
+                static_cast<std::size_t>(e.size_));
+
+            boost::shared_ptr<Component> ptr;
+            serialization::input_archive archive(view, 0U, view.size(), 0);
+            archive >> ptr;
+            return ptr;
+        }
+
+        /// Deserialize the component which was stored for the given id
+        template <typename Component>
+        boost::shared_ptr<Component> load_id(naming::gid_type const& id) const
+        {
+            naming::gid_type gid(naming::detail::get_stripped_gid(id));
+            for (std::size_t i = 0; i != entries_.size(); ++i)
+            {
+                if (entries_[i].id_ == gid)
+                    return load<Component>(i);
+            }
+
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "checkpoint_reader::load_id",
+                "the given id was not stored in this checkpoint");
+            return boost::shared_ptr<Component>();
+        }
+
+    private:
+        detail::mapped_file file_;
+        std::vector<detail::checkpoint_entry> entries_;
+    };
+
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // The file I/O is performed on the io pool, this keeps the worker
+        // threads free while the data is written or read.
+        inline void write_checkpoint(std::string const& filename,
+            std::vector<naming::gid_type> const& ids,
+            std::vector<std::vector<char> > const& data)
+        {
+            HPX_ASSERT(ids.size() == data.size());
+
+            checkpoint_writer writer(filename);
+            for (std::size_t i = 0; i != ids.size(); ++i)
+                writer.write(ids[i], data[i]);
+            writer.close();
+        }
+
+        inline std::vector<std::vector<char> >
+        read_checkpoint(std::string const& filename)
+        {
+            checkpoint_reader reader(filename);
+
+            std::vector<std::vector<char> > data;
+            data.reserve(reader.size());
+            for (std::size_t i = 0; i != reader.size(); ++i)
+                data.push_back(reader.read(i));
+            return data;
+        }
+
+        template <typename Component>
+        naming::id_type restore_component(std::vector<char> data)
+        {
+            boost::shared_ptr<Component> ptr =
+                deserialize_component<Component>(std::move(data));
+
+            return traits::get_remote_result<
+                    naming::id_type, naming::gid_type
+                >::call(hpx::get_runtime_support_ptr()->
+                    copy_create_component<Component>(ptr, false));
+        }
+    }
+
+    namespace server
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // This will be executed on the locality where the objects to
+        // checkpoint live. All objects are serialized concurrently, the
+        // resulting file is written on the io pool.
+        template <typename Component>
+        future<void> checkpoint_here(std::vector<naming::id_type> const& ids,
+            std::string const& filename)
+        {
+            typedef boost::shared_ptr<Component> pointer_type;
+
+            // retrieving the pointers pins the objects while they are being
+            // serialized
+            std::vector<future<std::vector<char> > > parts;
+            parts.reserve(ids.size());
+
+            std::vector<naming::gid_type> gids;
+            gids.reserve(ids.size());
+
+            for (naming::id_type const& id : ids)
+            {
+                parts.push_back(get_ptr<Component>(id).then(
+                    [](future<pointer_type> && f)
+                    {
+                        return components::detail::serialize_component(
+                            f.get());
+                    }));
+                gids.push_back(naming::detail::get_stripped_gid(id.get_gid()));
+            }
+
+            return when_all(parts).then(
+                [gids, filename](
+                    future<std::vector<future<std::vector<char> > > > && f)
+                -> future<void>
+                {
+                    std::vector<future<std::vector<char> > > parts = f.get();
+
+                    // rethrow errors
+                    std::vector<std::vector<char> > data;
+                    data.reserve(parts.size());
+                    for (future<std::vector<char> >& p : parts)
+                        data.push_back(p.get());
+
+                    // the executor waits for its tasks on destruction, keep
+                    // it alive until the file is written
+                    threads::executors::io_pool_executor exec;
+                    return hpx::async(exec,
+                        &components::detail::write_checkpoint,
+                        filename, gids, std::move(data)).then(
+                            [exec](future<void> && f)
+                            {
+                                HPX_UNUSED(exec);
+                                f.get();
+                            });
+                });
+        }
+
+        template <typename Component>
+        struct checkpoint_here_action
+          : ::hpx::actions::action<
+                future<void> (*)(std::vector<naming::id_type> const&,
+                    std::string const&)
+              , &checkpoint_here<Component>
+              , checkpoint_here_action<Component> >
+        {};
+
+        ///////////////////////////////////////////////////////////////////////
+        // Recreate all components stored in the given checkpoint file as new
+        // component instances on this locality. The file is read on the io
+        // pool, all objects are deserialized concurrently.
+        template <typename Component>
+        future<std::vector<naming::id_type> >
+        restore_here(std::string const& filename)
+        {
+            typedef std::vector<std::vector<char> > data_type;
+
+            // the executor waits for its tasks on destruction, keep it alive
+            // until the file is read
+            threads::executors::io_pool_executor exec;
+            future<data_type> data = hpx::async(exec,
+                &components::detail::read_checkpoint, filename);
+
+            return data.then(
+                [exec](future<data_type> && f)
+                -> future<std::vector<naming::id_type> >
+                {
+                    HPX_UNUSED(exec);
+                    data_type data = f.get();
+
+                    std::vector<future<naming::id_type> > ids;
+                    ids.reserve(data.size());
+                    for (std::vector<char>& d : data)
+                    {
+                        ids.push_back(hpx::async(
+                            &components::detail::restore_component<Component>,
+                            std::move(d)));
+                    }
+
+                    return when_all(ids).then(
+                        [](future<std::vector<future<naming::id_type> > > && f)
+                        {
+                            std::vector<future<naming::id_type> > ids =
+                                f.get();
+
+                            // rethrow errors
+                            std::vector<naming::id_type> result;
+                            result.reserve(ids.size());
+                            for (future<naming::id_type>& id : ids)
+                                result.push_back(id.get());
+                            return result;
+                        });
+                });
+        }
+
+        template <typename Component>
+        struct restore_here_action
+          : ::hpx::actions::action<
+                future<std::vector<naming::id_type> > (*)(std::string const&)
+              , &restore_here<Component>
+              , restore_here_action<Component> >
+        {};
+    }
+}}
+
+HPX_REGISTER_PLAIN_ACTION_TEMPLATE(
+    (template <typename Component>),
+    (hpx::components::server::checkpoint_here_action<Component>))
+
+HPX_REGISTER_PLAIN_ACTION_TEMPLATE(
+    (template <typename Component>),
+    (hpx::components::server::restore_here_action<Component>))
+
+#endif
@@ -0,0 +1,678 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/matrix/matrix.hpp
+
+#ifndef HPX_MATRIX_HPP
+#define HPX_MATRIX_HPP
+
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/util.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/serialization.hpp>
+
+#include <hpx/components/containers/matrix/matrix_distribution_policy.hpp>
+#include <hpx/components/containers/matrix/matrix_segmented_iterator.hpp>
+#include <hpx/components/containers/matrix/partition_matrix_component.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/shared_ptr.hpp>
+
+namespace hpx
+{
+    /// hpx::partitioned_matrix is a two-dimensional container which is
+    /// distributed over a set of localities.
+    ///
+    /// The matrix is split into equally sized tiles which are distributed
+    /// over a grid of hpx::server::partition_matrix components using a 2D
+    /// block-cyclic distribution (see \a matrix_distribution_policy). Each
+    /// tile is stored contiguously (in row major order), the tiles are the
+    /// unit of data transfer between localities.
+    ///
+    /// Besides element-wise access the matrix exposes tile-granular access
+    /// (\a get_tile, \a set_tile) transferring whole tiles as
+    /// serialize_buffer instances, and iterators over all tiles, the tiles
+    /// of a row of tiles, or the tiles of a column of tiles. The functions
+    /// \a for_each_tile and \a transform_tiles (see matrix_algorithms.hpp)
+    /// operate on all tiles in place, on the localities they are stored on.
+    ///
+    /// \tparam T   The type of the elements. The type has to be default
+    ///             constructible, copyable, and serializable.
+    ///
+    template <typename T>
+    class partitioned_matrix
+    {
+    public:
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+
+        typedef T value_type;
+        typedef serialization::serialize_buffer<T> tile_type;
+
+        typedef matrix_tile<T, partitioned_matrix> tile;
+        typedef matrix_tile<T, partitioned_matrix const> const_tile;
+
+        typedef matrix_tile_iterator<T, partitioned_matrix> tile_iterator;
+        typedef matrix_tile_iterator<T, partitioned_matrix const>
+            const_tile_iterator;
+
+    private:
+        typedef hpx::server::partition_matrix<T> partition_matrix_server;
+        typedef hpx::partition_matrix<T> partition_matrix_client;
+
+        // Each partition is described by its client object, its locality
+        // id, and (if stored on this locality) the pinned pointer to it.
+        struct partition_data
+        {
+            partition_data(id_type const& part, boost::uint32_t locality_id)
+              : partition_(part), locality_id_(locality_id)
+            {}
+
+            partition_matrix_client partition_;
+            boost::uint32_t locality_id_;
+            boost::shared_ptr<partition_matrix_server> local_data_;
+        };
+
+        typedef std::vector<partition_data> partitions_vector_type;
+
+        size_type rows_;                // overall size of the matrix
+        size_type cols_;
+        size_type tile_rows_;           // size of each tile
+        size_type tile_cols_;
+        size_type grid_rows_;           // size of the grid of partitions
+        size_type grid_cols_;
+
+        // The partitions in row major order of the grid
+        partitions_vector_type partitions_;
+
+        server::matrix_partition_info get_partition_info(
+            std::size_t part) const
+        {
+            return server::matrix_partition_info(rows_, cols_,
+                tile_rows_, tile_cols_, grid_rows_, grid_cols_,
+                part / grid_cols_, part % grid_cols_);
+        }
+
+        // Return the sequence number of the partition holding the given
+        // tile and the index of the tile inside this partition
+        std::pair<std::size_t, std::size_t> get_tile_position(
+            size_type tile_row, size_type tile_col) const
+        {
+            HPX_ASSERT(tile_row < num_tile_rows() && tile_col < num_tile_cols());
+
+            std::size_t part = get_partition(tile_row, tile_col);
+            return std::make_pair(part, get_partition_info(part)
+                .get_local_tile(tile_row, tile_col));
+        }
+
+        // Return the tile position and the offset inside the tile of the
+        // given element
+        std::pair<std::pair<std::size_t, std::size_t>, std::size_t>
+        get_element_position(size_type row, size_type col) const
+        {
+            if (row >= rows_ || col >= cols_)
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "partitioned_matrix::get_element_position",
+                    "element index is out of bounds");
+            }
+
+            return std::make_pair(
+                get_tile_position(row / tile_rows_, col / tile_cols_),
+                (row % tile_rows_) * tile_cols_ + col % tile_cols_);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename DistPolicy, typename Create>
+        void create(DistPolicy const& policy, Create && creator)
+        {
+            std::vector<id_type> localities = policy.get_localities();
+            if (localities.empty())
+                localities.push_back(find_here());
+
+            std::pair<std::size_t, std::size_t> grid =
+                policy.get_grid(localities.size());
+
+            tile_rows_ = policy.get_tile_rows();
+            if (tile_rows_ == 0)
+                tile_rows_ = (rows_ + grid.first - 1) / grid.first;
+            tile_cols_ = policy.get_tile_cols();
+            if (tile_cols_ == 0)
+                tile_cols_ = (cols_ + grid.second - 1) / grid.second;
+
+            // don't create partitions which would not hold any tiles
+            grid_rows_ = (std::min)(grid.first, num_tile_rows());
+            grid_cols_ = (std::min)(grid.second, num_tile_cols());
+
+            std::size_t num_parts = grid_rows_ * grid_cols_;
+
+            // create all partitions concurrently
+            std::vector<future<id_type> > ids;
+            ids.reserve(num_parts);
+            for (std::size_t part = 0; part != num_parts; ++part)
+            {
+                ids.push_back(creator(localities[part % localities.size()],
+                    get_partition_info(part)));
+            }
+            hpx::wait_all(ids);
+
+            // now initialize our data structures
+            boost::uint32_t this_locality = get_locality_id();
+
+            std::vector<future<boost::shared_ptr<partition_matrix_server> > >
+                ptrs(num_parts);
+
+            partitions_.reserve(num_parts);
+            for (std::size_t part = 0; part != num_parts; ++part)
+            {
+                boost::uint32_t locality = naming::get_locality_id_from_id(
+                    localities[part % localities.size()]);
+
+                id_type id = ids[part].get();
+                partitions_.push_back(partition_data(id, locality));
+
+                if (locality == this_locality)
+                    ptrs[part] = get_ptr<partition_matrix_server>(id);
+            }
+
+            for (std::size_t part = 0; part != num_parts; ++part)
+            {
+                if (ptrs[part].valid())
+                    partitions_[part].local_data_ = ptrs[part].get();
+            }
+        }
+
+        template <typename DistPolicy>
+        void create(DistPolicy const& policy)
+        {
+            create(policy,
+                [](id_type const& locality,
+                    server::matrix_partition_info const& info)
+                {
+                    return hpx::new_<partition_matrix_server>(locality, info);
+                });
+        }
+
+        template <typename DistPolicy>
+        void create(T const& val, DistPolicy const& policy)
+        {
+            create(policy,
+                [&val](id_type const& locality,
+                    server::matrix_partition_info const& info)
+                {
+                    return hpx::new_<partition_matrix_server>(
+                        locality, info, val);
+                });
+        }
+
+        // Perform a deep copy from the given matrix
+        void copy_from(partitioned_matrix const& rhs)
+        {
+            typedef typename partition_matrix_client::server_component_type
+                component_type;
+
+            std::vector<future<id_type> > objs;
+            objs.reserve(rhs.partitions_.size());
+            for (partition_data const& p : rhs.partitions_)
+            {
+                objs.push_back(hpx::components::copy<component_type>(
+                    p.partition_.get_gid()));
+            }
+            wait_all(objs);
+
+            boost::uint32_t this_locality = get_locality_id();
+
+            partitions_vector_type partitions;
+            partitions.reserve(objs.size());
+            for (std::size_t i = 0; i != objs.size(); ++i)
+            {
+                partitions.push_back(partition_data(objs[i].get(),
+                    rhs.partitions_[i].locality_id_));
+
+                if (partitions.back().locality_id_ == this_locality)
+                {
+                    partitions.back().local_data_ =
+                        get_ptr<partition_matrix_server>(
+                            partitions.back().partition_.get_gid()).get();
+                }
+            }
+
+            rows_ = rhs.rows_;
+            cols_ = rhs.cols_;
+            tile_rows_ = rhs.tile_rows_;
+            tile_cols_ = rhs.tile_cols_;
+            grid_rows_ = rhs.grid_rows_;
+            grid_cols_ = rhs.grid_cols_;
+            std::swap(partitions_, partitions);
+        }
+
+    public:
+        /// Default constructor which creates an empty matrix
+        partitioned_matrix()
+          : rows_(0), cols_(0), tile_rows_(1), tile_cols_(1),
+            grid_rows_(1), grid_cols_(1)
+        {}
+
+        /// Constructor which creates a matrix of the given size, using the
+        /// default distribution (one tile per locality)
+        ///
+        /// \param rows             The number of rows of the matrix
+        /// \param cols             The number of columns of the matrix
+        ///
+        partitioned_matrix(size_type rows, size_type cols)
+          : rows_(rows), cols_(cols), tile_rows_(1), tile_cols_(1),
+            grid_rows_(1), grid_cols_(1)
+        {
+            if (rows != 0 && cols != 0)
+                create(hpx::matrix_layout);
+        }
+
+        /// Constructor which creates a matrix of the given size where all
+        /// elements are initialized with \a val.
+        ///
+        /// \param rows             The number of rows of the matrix
+        /// \param cols             The number of columns of the matrix
+        /// \param val              Default value for the elements
+        ///
+        partitioned_matrix(size_type rows, size_type cols, T const& val)
+          : rows_(rows), cols_(cols), tile_rows_(1), tile_cols_(1),
+            grid_rows_(1), grid_cols_(1)
+        {
+            if (rows != 0 && cols != 0)
+                create(val, hpx::matrix_layout);
+        }
+
+        /// Constructor which creates a matrix of the given size using the
+        /// given distribution policy.
+        ///
+        /// \param rows             The number of rows of the matrix
+        /// \param cols             The number of columns of the matrix
+        /// \param policy           The distribution policy to use
+        ///
+        template <typename DistPolicy>
+        partitioned_matrix(size_type rows, size_type cols,
+                DistPolicy const& policy,
+                typename std::enable_if<
+                        is_matrix_distribution_policy<DistPolicy>::value
+                    >::type* = 0)
+          : rows_(rows), cols_(cols), tile_rows_(1), tile_cols_(1),
+            grid_rows_(1), grid_cols_(1)
+        {
+            if (rows != 0 && cols != 0)
+                create(policy);
+        }
+
+        /// Constructor which creates a matrix of the given size where all
+        /// elements are initialized with \a val, using the given
+        /// distribution policy.
+        ///
+        /// \param rows             The number of rows of the matrix
+        /// \param cols             The number of columns of the matrix
+        /// \param val              Default value for the elements
+        /// \param policy           The distribution policy to use
+        ///
+        template <typename DistPolicy>
+        partitioned_matrix(size_type rows, size_type cols, T const& val,
+                DistPolicy const& policy,
+                typename std::enable_if<
+                        is_matrix_distribution_policy<DistPolicy>::value
+                    >::type* = 0)
+          : rows_(rows), cols_(cols), tile_rows_(1), tile_cols_(1),
+            grid_rows_(1), grid_cols_(1)
+        {
+            if (rows != 0 && cols != 0)
+                create(val, policy);
+        }
+
+        /// Copy construction performs a deep copy of the right hand side
+        /// matrix.
+        partitioned_matrix(partitioned_matrix const& rhs)
+          : rows_(0), cols_(0), tile_rows_(1), tile_cols_(1),
+            grid_rows_(1), grid_cols_(1)
+        {
+            if (!rhs.partitions_.empty())
+                copy_from(rhs);
+        }
+
+        partitioned_matrix(partitioned_matrix && rhs)
+          : rows_(rhs.rows_), cols_(rhs.cols_),
+            tile_rows_(rhs.tile_rows_), tile_cols_(rhs.tile_cols_),
+            grid_rows_(rhs.grid_rows_), grid_cols_(rhs.grid_cols_),
+            partitions_(std::move(rhs.partitions_))
+        {
+            rhs.rows_ = rhs.cols_ = 0;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Capacity related API's
+        ///////////////////////////////////////////////////////////////////////
+
+        /// Return the number of rows and columns of the matrix
+        size_type rows() const { return rows_; }
+        size_type cols() const { return cols_; }
+
+        /// Return the (maximal) number of rows and columns of each tile
+        size_type tile_rows() const { return tile_rows_; }
+        size_type tile_cols() const { return tile_cols_; }
+
+        /// Return the number of rows and columns of tiles
+        size_type num_tile_rows() const
+        {
+            return (rows_ + tile_rows_ - 1) / tile_rows_;
+        }
+        size_type num_tile_cols() const
+        {
+            return (cols_ + tile_cols_ - 1) / tile_cols_;
+        }
+
+        /// Return the number of valid rows of the tiles in the given row of
+        /// tiles (smaller than tile_rows() for the last row of tiles)
+        size_type get_tile_rows(size_type tile_row) const
+        {
+            return (std::min)(tile_rows_, rows_ - tile_row * tile_rows_);
+        }
+
+        /// Return the number of valid columns of the tiles in the given
+        /// column of tiles (smaller than tile_cols() for the last column of
+        /// tiles)
+        size_type get_tile_cols(size_type tile_col) const
+        {
+            return (std::min)(tile_cols_, cols_ - tile_col * tile_cols_);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Distribution related API's
+        ///////////////////////////////////////////////////////////////////////
+
+        /// Return the number of rows and columns of the grid of partitions
+        size_type grid_rows() const { return grid_rows_; }
+        size_type grid_cols() const { return grid_cols_; }
+
+        /// Return the number of partitions
+        size_type num_partitions() const
+        {
+            return partitions_.size();
+        }
+
+        /// Return the sequence number of the partition holding the given tile
+        std::size_t get_partition(size_type tile_row, size_type tile_col) const
+        {
+            return (tile_row % grid_rows_) * grid_cols_ + tile_col % grid_cols_;
+        }
+
+        /// Return the global id of the given partition
+        id_type get_partition_id(std::size_t part) const
+        {
+            HPX_ASSERT(part < partitions_.size());
+            return partitions_[part].partition_.get_gid();
+        }
+
+        /// Return the locality id the given partition is stored on
+        boost::uint32_t get_partition_locality_id(std::size_t part) const
+        {
+            HPX_ASSERT(part < partitions_.size());
+            return partitions_[part].locality_id_;
+        }
+
+        /// Return the locality id the given tile is stored on
+        boost::uint32_t get_tile_locality_id(size_type tile_row,
+            size_type tile_col) const
+        {
+            return get_partition_locality_id(get_partition(tile_row, tile_col));
+        }
+
+        /// Return a pointer to the given tile if it is stored on this
+        /// locality, a null pointer otherwise.
+        ///
+        /// The tile is stored in row major order, element (r, c) of the
+        /// tile is located at offset r * tile_cols() + c.
+        T* get_local_tile_data(size_type tile_row, size_type tile_col) const
+        {
+            std::pair<std::size_t, std::size_t> pos =
+                get_tile_position(tile_row, tile_col);
+
+            partition_data const& part = partitions_[pos.first];
+            if (!part.local_data_)
+                return 0;
+            return part.local_data_->get_tile_data(pos.second);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Element access API's
+        ///////////////////////////////////////////////////////////////////////
+
+        /// Returns the element at the given position
+        ///
+        /// \param row  Row of the element
+        /// \param col  Column of the element
+        ///
+        /// \return This returns the value as the hpx::future
+        ///
+        future<T> get_value(size_type row, size_type col) const
+        {
+            std::pair<std::pair<std::size_t, std::size_t>, std::size_t> pos =
+                get_element_position(row, col);
+
+            partition_data const& part = partitions_[pos.first.first];
+            if (part.local_data_)
+            {
+                return make_ready_future(part.local_data_->get_value(
+                    pos.first.second, pos.second));
+            }
+            return part.partition_.get_value(pos.first.second, pos.second);
+        }
+
+        /// Returns the element at the given position
+        ///
+        /// \param row  Row of the element
+        /// \param col  Column of the element
+        ///
+        /// \return Returns the value of the element
+        ///
+        T get_value_sync(size_type row, size_type col) const
+        {
+            return get_value(row, col).get();
+        }
+
+        /// Copy the value of \a val to the element at the given position
+        ///
+        /// \param row  Row of the element
+        /// \param col  Column of the element
+        /// \param val  The value to be copied
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once the operation is finished.
+        ///
+        template <typename T_>
+        future<void> set_value(size_type row, size_type col, T_ && val)
+        {
+            std::pair<std::pair<std::size_t, std::size_t>, std::size_t> pos =
+                get_element_position(row, col);
+
+            partition_data& part = partitions_[pos.first.first];
+            if (part.local_data_)
+            {
+                part.local_data_->set_value(pos.first.second, pos.second,
+                    std::forward<T_>(val));
+                return make_ready_future();
+            }
+            return part.partition_.set_value(pos.first.second, pos.second,
+                std::forward<T_>(val));
+        }
+
+        /// Copy the value of \a val to the element at the given position
+        ///
+        /// \param row  Row of the element
+        /// \param col  Column of the element
+        /// \param val  The value to be copied
+        ///
+        template <typename T_>
+        void set_value_sync(size_type row, size_type col, T_ && val)
+        {
+            set_value(row, col, std::forward<T_>(val)).get();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Tile access API's
+        ///////////////////////////////////////////////////////////////////////
+
+        /// Returns a copy of the given tile
+        ///
+        /// The whole tile is transferred at once as a single buffer.
+        ///
+        /// \param tile_row  Row of the tile
+        /// \param tile_col  Column of the tile
+        ///
+        /// \return This returns the tile (tile_rows() * tile_cols() elements
+        ///         in row major order) as the hpx::future
+        ///
+        future<tile_type> get_tile(size_type tile_row, size_type tile_col) const
+        {
+            std::pair<std::size_t, std::size_t> pos =
+                get_tile_position(tile_row, tile_col);
+
+            partition_data const& part = partitions_[pos.first];
+            if (part.local_data_)
+            {
+                return make_ready_future(tile_type(
+                    part.local_data_->get_tile_data(pos.second),
+                    tile_rows_ * tile_cols_, tile_type::copy));
+            }
+            return part.partition_.get_tile(pos.second);
+        }
+
+        /// Returns a copy of the given tile
+        ///
+        /// \param tile_row  Row of the tile
+        /// \param tile_col  Column of the tile
+        ///
+        tile_type get_tile_sync(size_type tile_row, size_type tile_col) const
+        {
+            return get_tile(tile_row, tile_col).get();
+        }
+
+        /// Replace the contents of the given tile
+        ///
+        /// \param tile_row  Row of the tile
+        /// \param tile_col  Column of the tile
+        /// \param data      The new contents of the tile, this has to hold
+        ///                  tile_rows() * tile_cols() elements in row major
+        ///                  order
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once the operation is finished.
+        ///
+        future<void> set_tile(size_type tile_row, size_type tile_col,
+            tile_type const& data)
+        {
+            if (data.size() != tile_rows_ * tile_cols_)
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "partitioned_matrix::set_tile",
+                    "the size of the given data does not match the tile size");
+            }
+
+            std::pair<std::size_t, std::size_t> pos =
+                get_tile_position(tile_row, tile_col);
+
+            partition_data& part = partitions_[pos.first];
+            if (part.local_data_)
+            {
+                part.local_data_->set_tile(pos.second, data);
+                return make_ready_future();
+            }
+            return part.partition_.set_tile(pos.second, data);
+        }
+
+        /// Replace the contents of the given tile
+        ///
+        /// \param tile_row  Row of the tile
+        /// \param tile_col  Column of the tile
+        /// \param data      The new contents of the tile
+        ///
+        void set_tile_sync(size_type tile_row, size_type tile_col,
+            tile_type const& data)
+        {
+            set_tile(tile_row, tile_col, data).get();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Tile iterators
+        ///////////////////////////////////////////////////////////////////////
+
+        /// Return iterators visiting all tiles in row major order
+        tile_iterator tile_begin()
+        {
+            return tile_iterator(this, tile_iterator::all_tiles, 0, 0);
+        }
+        tile_iterator tile_end()
+        {
+            return tile_iterator(this, tile_iterator::all_tiles, 0,
+                partitions_.empty() ? 0 : num_tile_rows() * num_tile_cols());
+        }
+        const_tile_iterator tile_begin() const
+        {
+            return const_tile_iterator(this, const_tile_iterator::all_tiles,
+                0, 0);
+        }
+        const_tile_iterator tile_end() const
+        {
+            return const_tile_iterator(this, const_tile_iterator::all_tiles,
+                0, partitions_.empty() ? 0 : num_tile_rows() * num_tile_cols());
+        }
+
+        /// Return iterators visiting the tiles of the given row of tiles
+        tile_iterator tile_row_begin(size_type tile_row)
+        {
+            return tile_iterator(this, tile_iterator::tile_row, tile_row, 0);
+        }
+        tile_iterator tile_row_end(size_type tile_row)
+        {
+            return tile_iterator(this, tile_iterator::tile_row, tile_row,
+                num_tile_cols());
+        }
+        const_tile_iterator tile_row_begin(size_type tile_row) const
+        {
+            return const_tile_iterator(this, const_tile_iterator::tile_row,
+                tile_row, 0);
+        }
+        const_tile_iterator tile_row_end(size_type tile_row) const
+        {
+            return const_tile_iterator(this, const_tile_iterator::tile_row,
+                tile_row, num_tile_cols());
+        }
+
+        /// Return iterators visiting the tiles of the given column of tiles
+        tile_iterator tile_column_begin(size_type tile_col)
+        {
+            return tile_iterator(this, tile_iterator::tile_column, tile_col, 0);
+        }
+        tile_iterator tile_column_end(size_type tile_col)
+        {
+            return tile_iterator(this, tile_iterator::tile_column, tile_col,
+                num_tile_rows());
+        }
+        const_tile_iterator tile_column_begin(size_type tile_col) const
+        {
+            return const_tile_iterator(this, const_tile_iterator::tile_column,
+                tile_col, 0);
+        }
+        const_tile_iterator tile_column_end(size_type tile_col) const
+        {
+            return const_tile_iterator(this, const_tile_iterator::tile_column,
+                tile_col, num_tile_rows());
+        }
+    };
+}
+
+#include <hpx/components/containers/matrix/matrix_algorithms.hpp>
+
+#endif
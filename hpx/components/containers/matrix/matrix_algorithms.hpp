@@ -0,0 +1,389 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/matrix/matrix_algorithms.hpp
+
+#ifndef HPX_MATRIX_ALGORITHMS_HPP
+#define HPX_MATRIX_ALGORITHMS_HPP
+
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/runtime/get_ptr.hpp>
+
+#include <hpx/components/containers/matrix/matrix.hpp>
+#include <hpx/components/containers/matrix/partition_matrix_component.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+namespace hpx
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// A matrix_tile_view gives direct access to a tile stored on the
+    /// calling locality. It is passed to the functions invoked by
+    /// \a for_each_tile.
+    template <typename T>
+    class matrix_tile_view
+    {
+    public:
+        matrix_tile_view(T* data, std::size_t tile_row, std::size_t tile_col,
+                std::size_t rows, std::size_t cols, std::size_t stride)
+          : data_(data), tile_row_(tile_row), tile_col_(tile_col),
+            rows_(rows), cols_(cols), stride_(stride)
+        {}
+
+        /// Access the element (r, c) of this tile
+        T& operator()(std::size_t r, std::size_t c) const
+        {
+            HPX_ASSERT(r < rows_ && c < cols_);
+            return data_[r * stride_ + c];
+        }
+
+        /// The coordinates of this tile in the grid of tiles
+        std::size_t tile_row() const { return tile_row_; }
+        std::size_t tile_col() const { return tile_col_; }
+
+        /// The number of valid rows and columns of this tile
+        std::size_t rows() const { return rows_; }
+        std::size_t cols() const { return cols_; }
+
+        /// The distance between the first elements of two consecutive rows
+        std::size_t stride() const { return stride_; }
+
+        T* data() const { return data_; }
+
+    private:
+        T* data_;
+        std::size_t tile_row_;
+        std::size_t tile_col_;
+        std::size_t rows_;
+        std::size_t cols_;
+        std::size_t stride_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \cond NOINTERNAL
+    namespace server
+    {
+        template <typename T>
+        matrix_tile_view<T> get_tile_view(partition_matrix<T>& part,
+            std::size_t tile)
+        {
+            matrix_partition_info const& info = part.get_info();
+
+            std::size_t tile_row = info.get_tile_row(tile);
+            std::size_t tile_col = info.get_tile_col(tile);
+
+            return matrix_tile_view<T>(part.get_tile_data(tile),
+                tile_row, tile_col, info.get_tile_rows(tile_row),
+                info.get_tile_cols(tile_col), info.tile_cols_);
+        }
+
+        template <typename T, typename F>
+        void for_each_tile_view(matrix_tile_view<T> view, F f)
+        {
+            f(view);
+        }
+
+        template <typename T, typename U, typename F>
+        void transform_tile_view(matrix_tile_view<T> src,
+            matrix_tile_view<U> dest, F f)
+        {
+            for (std::size_t r = 0; r != src.rows(); ++r)
+            {
+                for (std::size_t c = 0; c != src.cols(); ++c)
+                    dest(r, c) = f(src(r, c));
+            }
+        }
+
+        // This will be executed on the locality where the given partition
+        // lives, all of its tiles are processed concurrently.
+        template <typename T, typename F>
+        void for_each_tile_here(naming::id_type const& part, F const& f)
+        {
+            boost::shared_ptr<partition_matrix<T> > ptr =
+                get_ptr<partition_matrix<T> >(part).get();
+
+            std::size_t num_tiles = ptr->get_num_tiles();
+
+            std::vector<future<void> > tiles;
+            tiles.reserve(num_tiles);
+            for (std::size_t t = 0; t != num_tiles; ++t)
+            {
+                tiles.push_back(hpx::async(&for_each_tile_view<T, F>,
+                    get_tile_view(*ptr, t), f));
+            }
+
+            // rethrow errors
+            wait_all(tiles);
+            for (future<void>& t : tiles)
+                t.get();
+        }
+
+        template <typename T, typename F>
+        struct for_each_tile_action
+          : ::hpx::actions::action<
+                void (*)(naming::id_type const&, F const&)
+              , &for_each_tile_here<T, F>
+              , for_each_tile_action<T, F> >
+        {};
+
+        // This will be executed on the locality where the given partitions
+        // live, both partitions have the same layout.
+        template <typename T, typename U, typename F>
+        void transform_tiles_here(naming::id_type const& src,
+            naming::id_type const& dest, F const& f)
+        {
+            future<boost::shared_ptr<partition_matrix<T> > > src_ptr =
+                get_ptr<partition_matrix<T> >(src);
+            boost::shared_ptr<partition_matrix<U> > dest_ptr =
+                get_ptr<partition_matrix<U> >(dest).get();
+            boost::shared_ptr<partition_matrix<T> > sptr = src_ptr.get();
+
+            std::size_t num_tiles = sptr->get_num_tiles();
+            HPX_ASSERT(num_tiles == dest_ptr->get_num_tiles());
+
+            std::vector<future<void> > tiles;
+            tiles.reserve(num_tiles);
+            for (std::size_t t = 0; t != num_tiles; ++t)
+            {
+                tiles.push_back(hpx::async(&transform_tile_view<T, U, F>,
+                    get_tile_view(*sptr, t), get_tile_view(*dest_ptr, t), f));
+            }
+
+            // rethrow errors
+            wait_all(tiles);
+            for (future<void>& t : tiles)
+                t.get();
+        }
+
+        template <typename T, typename U, typename F>
+        struct transform_tiles_action
+          : ::hpx::actions::action<
+                void (*)(naming::id_type const&, naming::id_type const&,
+                    F const&)
+              , &transform_tiles_here<T, U, F>
+              , transform_tiles_action<T, U, F> >
+        {};
+    }
+
+    namespace detail
+    {
+        inline future<void> wait_all_partitions(
+            std::vector<future<void> > && parts)
+        {
+            return when_all(parts).then(
+                [](future<std::vector<future<void> > > && f)
+                {
+                    // rethrow errors
+                    std::vector<future<void> > parts = f.get();
+                    for (future<void>& p : parts)
+                        p.get();
+                });
+        }
+
+        // Compute the given tile of dest from the tiles of src overlapping
+        // it. The source tiles are fetched as a whole and the resulting tile
+        // is written at once, without waiting for any of the transfers.
+        template <typename T, typename U, typename F>
+        future<void> transform_tile_region(partitioned_matrix<T> const& src,
+            partitioned_matrix<U>& dest, std::size_t tile_row,
+            std::size_t tile_col, F const& f)
+        {
+            typedef typename partitioned_matrix<T>::tile_type src_tile_type;
+            typedef typename partitioned_matrix<U>::tile_type dest_tile_type;
+
+            // the region of the matrix covered by the destination tile
+            std::size_t const row0 = tile_row * dest.tile_rows();
+            std::size_t const col0 = tile_col * dest.tile_cols();
+            std::size_t const row_end = row0 + dest.get_tile_rows(tile_row);
+            std::size_t const col_end = col0 + dest.get_tile_cols(tile_col);
+
+            // the source tiles overlapping this region
+            std::size_t const src_rows = src.tile_rows();
+            std::size_t const src_cols = src.tile_cols();
+            std::size_t const first_row = row0 / src_rows;
+            std::size_t const last_row = (row_end - 1) / src_rows;
+            std::size_t const first_col = col0 / src_cols;
+            std::size_t const last_col = (col_end - 1) / src_cols;
+
+            std::vector<future<src_tile_type> > tiles;
+            tiles.reserve(
+                (last_row - first_row + 1) * (last_col - first_col + 1));
+            for (std::size_t tr = first_row; tr <= last_row; ++tr)
+            {
+                for (std::size_t tc = first_col; tc <= last_col; ++tc)
+                    tiles.push_back(src.get_tile(tr, tc));
+            }
+
+            std::size_t const dest_cols = dest.tile_cols();
+            std::size_t const dest_size = dest.tile_rows() * dest_cols;
+            partitioned_matrix<U>* d = &dest;
+
+            return when_all(tiles).then(
+                [=](future<std::vector<future<src_tile_type> > > && tf)
+                -> future<void>
+                {
+                    std::vector<future<src_tile_type> > src_tiles = tf.get();
+
+                    dest_tile_type data(new U[dest_size](), dest_size,
+                        dest_tile_type::take);
+
+                    std::size_t t = 0;
+                    for (std::size_t tr = first_row; tr <= last_row; ++tr)
+                    {
+                        std::size_t const r_begin =
+                            (std::max)(row0, tr * src_rows);
+                        std::size_t const r_end =
+                            (std::min)(row_end, (tr + 1) * src_rows);
+
+                        for (std::size_t tc = first_col; tc <= last_col;
+                            ++tc, ++t)
+                        {
+                            src_tile_type tile = src_tiles[t].get();
+
+                            std::size_t const c_begin =
+                                (std::max)(col0, tc * src_cols);
+                            std::size_t const c_end =
+                                (std::min)(col_end, (tc + 1) * src_cols);
+
+                            for (std::size_t r = r_begin; r != r_end; ++r)
+                            {
+                                T const* s = tile.data() +
+                                    (r - tr * src_rows) * src_cols;
+                                U* p = data.data() + (r - row0) * dest_cols;
+
+                                for (std::size_t c = c_begin; c != c_end; ++c)
+                                    p[c - col0] = f(s[c - tc * src_cols]);
+                            }
+                        }
+                    }
+
+                    return d->set_tile(tile_row, tile_col, data);
+                });
+        }
+
+        // Transfer the data tile by tile, this is used if the two matrices
+        // are not distributed the same way.
+        template <typename T, typename U, typename F>
+        future<void> transform_elements(partitioned_matrix<T> const& src,
+            partitioned_matrix<U>& dest, F const& f)
+        {
+            std::vector<future<void> > results;
+            results.reserve(dest.num_tile_rows() * dest.num_tile_cols());
+
+            for (std::size_t tr = 0; tr != dest.num_tile_rows(); ++tr)
+            {
+                for (std::size_t tc = 0; tc != dest.num_tile_cols(); ++tc)
+                {
+                    results.push_back(
+                        transform_tile_region(src, dest, tr, tc, f));
+                }
+            }
+            return wait_all_partitions(std::move(results));
+        }
+    }
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Invoke the given function for each tile of the given matrix.
+    ///
+    /// The function is executed on the locality where the tile is stored,
+    /// it is passed a \a matrix_tile_view<T> referencing the tile. All tiles
+    /// are processed concurrently.
+    ///
+    /// \param m    The matrix to process
+    /// \param f    The function to invoke, this has to be serializable
+    ///
+    /// \returns A future which becomes ready once all tiles were processed.
+    ///
+    template <typename T, typename F>
+    future<void> for_each_tile(partitioned_matrix<T>& m, F const& f)
+    {
+        typedef server::for_each_tile_action<T, F> action_type;
+
+        std::vector<future<void> > parts;
+        parts.reserve(m.num_partitions());
+        for (std::size_t p = 0; p != m.num_partitions(); ++p)
+        {
+            parts.push_back(hpx::async<action_type>(
+                naming::get_id_from_locality_id(
+                    m.get_partition_locality_id(p)),
+                m.get_partition_id(p), f));
+        }
+        return detail::wait_all_partitions(std::move(parts));
+    }
+
+    /// Assign the result of applying the given function to each element of
+    /// \a src to the corresponding element of \a dest.
+    ///
+    /// If both matrices are distributed the same way, the function is
+    /// executed on the localities where the tiles are stored, without moving
+    /// any data between localities. Otherwise each tile of \a dest is
+    /// computed from the tiles of \a src overlapping it, which are
+    /// transferred as a whole; \a dest has to be kept alive until the
+    /// returned future becomes ready. Both matrices have to have the same
+    /// number of rows and columns.
+    ///
+    /// \param src  The matrix to read
+    /// \param dest The matrix to write
+    /// \param f    The function to invoke for each element of \a src, this
+    ///             has to be serializable
+    ///
+    /// \returns A future which becomes ready once all elements were
+    ///          processed.
+    ///
+    template <typename T, typename U, typename F>
+    future<void> transform_tiles(partitioned_matrix<T> const& src,
+        partitioned_matrix<U>& dest, F const& f)
+    {
+        if (src.rows() != dest.rows() || src.cols() != dest.cols())
+        {
+            HPX_THROW_EXCEPTION(bad_parameter, "hpx::transform_tiles",
+                "the given matrices do not have the same size");
+        }
+
+        bool same_layout = src.tile_rows() == dest.tile_rows() &&
+            src.tile_cols() == dest.tile_cols() &&
+            src.grid_rows() == dest.grid_rows() &&
+            src.grid_cols() == dest.grid_cols() &&
+            src.num_partitions() == dest.num_partitions();
+
+        for (std::size_t p = 0; same_layout && p != src.num_partitions(); ++p)
+        {
+            same_layout = src.get_partition_locality_id(p) ==
+                dest.get_partition_locality_id(p);
+        }
+
+        if (!same_layout)
+            return detail::transform_elements(src, dest, f);
+
+        typedef server::transform_tiles_action<T, U, F> action_type;
+
+        std::vector<future<void> > parts;
+        parts.reserve(src.num_partitions());
+        for (std::size_t p = 0; p != src.num_partitions(); ++p)
+        {
+            parts.push_back(hpx::async<action_type>(
+                naming::get_id_from_locality_id(
+                    src.get_partition_locality_id(p)),
+                src.get_partition_id(p), dest.get_partition_id(p), f));
+        }
+        return detail::wait_all_partitions(std::move(parts));
+    }
+}
+
+HPX_REGISTER_PLAIN_ACTION_TEMPLATE(
+    (template <typename T, typename F>),
+    (hpx::server::for_each_tile_action<T, F>))
+
+HPX_REGISTER_PLAIN_ACTION_TEMPLATE(
+    (template <typename T, typename U, typename F>),
+    (hpx::server::transform_tiles_action<T, U, F>))
+
+#endif
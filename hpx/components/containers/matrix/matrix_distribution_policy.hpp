@@ -0,0 +1,175 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_MATRIX_DISTRIBUTION_POLICY_HPP
+#define HPX_MATRIX_DISTRIBUTION_POLICY_HPP
+
+#include <hpx/include/util.hpp>
+
+#include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/runtime/serialization/vector.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // This class specifies the 2D block-cyclic distribution policy to use for
+    // the partitioning of the data in a hpx::partitioned_matrix. The matrix
+    // is split into tiles of the given size which are dealt out to a grid of
+    // grid_rows x grid_cols partitions, tile (i, j) is stored in partition
+    // (i % grid_rows, j % grid_cols). Partition (r, c) of the grid is placed
+    // onto locality (r * grid_cols + c) % num_localities.
+    //
+    // If no tile size is given, the tiles are chosen such that each partition
+    // holds exactly one tile (2D block distribution). If no grid is given, a
+    // grid as square as possible is formed from the number of localities.
+    struct matrix_distribution_policy
+    {
+    public:
+        matrix_distribution_policy()
+          : tile_rows_(0), tile_cols_(0), grid_rows_(0), grid_cols_(0)
+        {}
+
+        matrix_distribution_policy operator()(
+            std::vector<id_type> const& localities) const
+        {
+            return matrix_distribution_policy(tile_rows_, tile_cols_,
+                grid_rows_, grid_cols_, localities);
+        }
+
+        matrix_distribution_policy operator()(std::size_t tile_rows,
+            std::size_t tile_cols) const
+        {
+            return matrix_distribution_policy(tile_rows, tile_cols,
+                grid_rows_, grid_cols_, localities_);
+        }
+
+        matrix_distribution_policy operator()(std::size_t tile_rows,
+            std::size_t tile_cols, std::vector<id_type> const& localities) const
+        {
+            return matrix_distribution_policy(tile_rows, tile_cols,
+                grid_rows_, grid_cols_, localities);
+        }
+
+        matrix_distribution_policy operator()(std::size_t tile_rows,
+            std::size_t tile_cols, std::size_t grid_rows,
+            std::size_t grid_cols) const
+        {
+            return matrix_distribution_policy(tile_rows, tile_cols,
+                grid_rows, grid_cols, localities_);
+        }
+
+        matrix_distribution_policy operator()(std::size_t tile_rows,
+            std::size_t tile_cols, std::size_t grid_rows,
+            std::size_t grid_cols, std::vector<id_type> const& localities) const
+        {
+            return matrix_distribution_policy(tile_rows, tile_cols,
+                grid_rows, grid_cols, localities);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        std::vector<id_type> const& get_localities() const
+        {
+            return localities_;
+        }
+
+        // The number of rows and columns of each tile, zero selects a block
+        // distribution.
+        std::size_t get_tile_rows() const
+        {
+            return tile_rows_;
+        }
+        std::size_t get_tile_cols() const
+        {
+            return tile_cols_;
+        }
+
+        // Return the dimensions of the grid of partitions to create if the
+        // matrix is distributed over the given number of localities.
+        std::pair<std::size_t, std::size_t>
+        get_grid(std::size_t num_localities) const
+        {
+            if (grid_rows_ != 0 && grid_cols_ != 0)
+                return std::make_pair(grid_rows_, grid_cols_);
+
+            num_localities = (std::max)(num_localities, std::size_t(1));
+            if (grid_rows_ != 0)
+            {
+                return std::make_pair(grid_rows_,
+                    (num_localities + grid_rows_ - 1) / grid_rows_);
+            }
+            if (grid_cols_ != 0)
+            {
+                return std::make_pair(
+                    (num_localities + grid_cols_ - 1) / grid_cols_, grid_cols_);
+            }
+
+            // the largest divisor not larger than the square root
+            std::size_t rows = 1;
+            for (std::size_t r = 1; r * r <= num_localities; ++r)
+            {
+                if (num_localities % r == 0)
+                    rows = r;
+            }
+            return std::make_pair(rows, num_localities / rows);
+        }
+
+    private:
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive & ar, const unsigned int version)
+        {
+            ar & localities_ & tile_rows_ & tile_cols_ & grid_rows_ &
+                grid_cols_;
+        }
+
+        matrix_distribution_policy(std::size_t tile_rows,
+                std::size_t tile_cols, std::size_t grid_rows,
+                std::size_t grid_cols, std::vector<id_type> const& localities)
+          : localities_(localities),
+            tile_rows_(tile_rows), tile_cols_(tile_cols),
+            grid_rows_(grid_rows), grid_cols_(grid_cols)
+        {}
+
+    private:
+        std::vector<id_type> localities_;   // localities to create tiles on
+        std::size_t tile_rows_;             // number of rows per tile
+        std::size_t tile_cols_;             // number of columns per tile
+        std::size_t grid_rows_;             // rows of the partition grid
+        std::size_t grid_cols_;             // columns of the partition grid
+    };
+
+    static matrix_distribution_policy const matrix_layout;
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+        template <typename T>
+        struct is_matrix_distribution_policy
+          : std::false_type
+        {};
+
+        template <>
+        struct is_matrix_distribution_policy<matrix_distribution_policy>
+          : std::true_type
+        {};
+        // \endcond
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    struct is_matrix_distribution_policy
+      : detail::is_matrix_distribution_policy<typename hpx::util::decay<T>::type>
+    {};
+}
+
+#endif
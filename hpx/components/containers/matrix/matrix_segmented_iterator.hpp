@@ -0,0 +1,197 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_MATRIX_SEGMENTED_ITERATOR_HPP
+#define HPX_MATRIX_SEGMENTED_ITERATOR_HPP
+
+/// \file hpx/components/matrix/matrix_segmented_iterator.hpp
+/// \brief This file contains the implementation of the tile iterators for
+///        hpx::partitioned_matrix.
+
+#include <hpx/include/naming.hpp>
+#include <hpx/include/util.hpp>
+#include <hpx/include/serialization.hpp>
+#include <hpx/runtime/serialization/serialize_buffer.hpp>
+
+#include <cstddef>
+#include <iterator>
+
+#include <boost/cstdint.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+
+namespace hpx
+{
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T> class partitioned_matrix;     // forward declaration
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A matrix_tile references one tile of a hpx::partitioned_matrix, it is
+    /// the value type of the tile iterators. All operations are forwarded
+    /// to the matrix, a (possibly remote) access is performed only once a
+    /// tile is read or written.
+    template <typename T, typename Matrix>
+    class matrix_tile
+    {
+    public:
+        typedef serialization::serialize_buffer<T> tile_type;
+
+        matrix_tile(Matrix* m, std::size_t tile_row, std::size_t tile_col)
+          : m_(m), tile_row_(tile_row), tile_col_(tile_col)
+        {}
+
+        /// The coordinates of this tile in the grid of tiles
+        std::size_t tile_row() const { return tile_row_; }
+        std::size_t tile_col() const { return tile_col_; }
+
+        /// The number of valid rows and columns of this tile (smaller than
+        /// the tile size for tiles at the edges of the matrix)
+        std::size_t rows() const { return m_->get_tile_rows(tile_row_); }
+        std::size_t cols() const { return m_->get_tile_cols(tile_col_); }
+
+        /// The locality this tile is stored on
+        boost::uint32_t get_locality_id() const
+        {
+            return m_->get_tile_locality_id(tile_row_, tile_col_);
+        }
+
+        /// Return a pointer to the tile if it is stored on this locality
+        /// (and a null pointer otherwise)
+        T* local_data() const
+        {
+            return m_->get_local_tile_data(tile_row_, tile_col_);
+        }
+
+        future<tile_type> get() const
+        {
+            return m_->get_tile(tile_row_, tile_col_);
+        }
+        tile_type get_sync() const
+        {
+            return get().get();
+        }
+
+        future<void> set(tile_type const& data) const
+        {
+            return m_->set_tile(tile_row_, tile_col_, data);
+        }
+        void set_sync(tile_type const& data) const
+        {
+            set(data).get();
+        }
+
+    private:
+        Matrix* m_;
+        std::size_t tile_row_;
+        std::size_t tile_col_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// This iterator visits the tiles of a hpx::partitioned_matrix, either
+    /// all of them (in row major order), the tiles of one row of tiles, or
+    /// the tiles of one column of tiles.
+    template <typename T, typename Matrix>
+    class matrix_tile_iterator
+      : public boost::iterator_facade<
+            matrix_tile_iterator<T, Matrix>, matrix_tile<T, Matrix>,
+            std::random_access_iterator_tag, matrix_tile<T, Matrix>
+        >
+    {
+    private:
+        typedef boost::iterator_facade<
+                matrix_tile_iterator<T, Matrix>, matrix_tile<T, Matrix>,
+                std::random_access_iterator_tag, matrix_tile<T, Matrix>
+            > base_type;
+
+    public:
+        enum traversal
+        {
+            all_tiles,          // visit all tiles
+            tile_row,           // visit the tiles of the given row
+            tile_column         // visit the tiles of the given column
+        };
+
+        matrix_tile_iterator()
+          : m_(0), traversal_(all_tiles), fixed_(0), pos_(0)
+        {}
+
+        matrix_tile_iterator(Matrix* m, traversal t, std::size_t fixed,
+                std::size_t pos)
+          : m_(m), traversal_(t), fixed_(fixed), pos_(pos)
+        {}
+
+        /// The coordinates of the referenced tile
+        std::size_t get_tile_row() const
+        {
+            switch (traversal_)
+            {
+            case tile_row:
+                return fixed_;
+            case tile_column:
+                return pos_;
+            default:
+                return pos_ / m_->num_tile_cols();
+            }
+        }
+
+        std::size_t get_tile_col() const
+        {
+            switch (traversal_)
+            {
+            case tile_row:
+                return pos_;
+            case tile_column:
+                return fixed_;
+            default:
+                return pos_ % m_->num_tile_cols();
+            }
+        }
+
+    protected:
+        friend class boost::iterator_core_access;
+
+        bool equal(matrix_tile_iterator const& other) const
+        {
+            return m_ == other.m_ && traversal_ == other.traversal_ &&
+                fixed_ == other.fixed_ && pos_ == other.pos_;
+        }
+
+        typename base_type::reference dereference() const
+        {
+            HPX_ASSERT(m_);
+            return matrix_tile<T, Matrix>(m_, get_tile_row(), get_tile_col());
+        }
+
+        void increment()
+        {
+            ++pos_;
+        }
+
+        void decrement()
+        {
+            --pos_;
+        }
+
+        void advance(std::ptrdiff_t n)
+        {
+            pos_ += n;
+        }
+
+        std::ptrdiff_t distance_to(matrix_tile_iterator const& other) const
+        {
+            HPX_ASSERT(m_ == other.m_ && traversal_ == other.traversal_ &&
+                fixed_ == other.fixed_);
+            return static_cast<std::ptrdiff_t>(other.pos_) -
+                static_cast<std::ptrdiff_t>(pos_);
+        }
+
+    private:
+        Matrix* m_;
+        traversal traversal_;
+        std::size_t fixed_;             // row or column to traverse
+        std::size_t pos_;
+    };
+}
+
+#endif
@@ -0,0 +1,418 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file partition_matrix_component.hpp
+
+#ifndef HPX_PARTITION_MATRIX_COMPONENT_HPP
+#define HPX_PARTITION_MATRIX_COMPONENT_HPP
+
+/// \file hpx/components/matrix/partition_matrix_component.hpp
+///
+/// \brief The partition_matrix as the hpx component is defined here.
+///
+/// A partition_matrix holds all tiles of a hpx::partitioned_matrix which
+/// are assigned to one position of the grid of partitions. The tiles are
+/// transferred as a whole, using serialize_buffer to avoid per-element
+/// overheads.
+
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/util.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/serialization.hpp>
+#include <hpx/runtime/serialization/serialize_buffer.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+namespace hpx { namespace server
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// Describes the position of a partition in the grid of partitions of a
+    /// hpx::partitioned_matrix and the shape of the matrix. This allows to
+    /// map local tile indices to global tile coordinates (and back) without
+    /// any communication.
+    struct matrix_partition_info
+    {
+        matrix_partition_info()
+          : rows_(0), cols_(0), tile_rows_(0), tile_cols_(0),
+            grid_rows_(0), grid_cols_(0), grid_row_(0), grid_col_(0)
+        {}
+
+        matrix_partition_info(std::size_t rows, std::size_t cols,
+                std::size_t tile_rows, std::size_t tile_cols,
+                std::size_t grid_rows, std::size_t grid_cols,
+                std::size_t grid_row, std::size_t grid_col)
+          : rows_(rows), cols_(cols),
+            tile_rows_(tile_rows), tile_cols_(tile_cols),
+            grid_rows_(grid_rows), grid_cols_(grid_cols),
+            grid_row_(grid_row), grid_col_(grid_col)
+        {}
+
+        std::size_t num_tile_rows() const
+        {
+            return (rows_ + tile_rows_ - 1) / tile_rows_;
+        }
+        std::size_t num_tile_cols() const
+        {
+            return (cols_ + tile_cols_ - 1) / tile_cols_;
+        }
+
+        // number of tile rows and columns stored in this partition
+        std::size_t num_local_tile_rows() const
+        {
+            return (num_tile_rows() - grid_row_ + grid_rows_ - 1) / grid_rows_;
+        }
+        std::size_t num_local_tile_cols() const
+        {
+            return (num_tile_cols() - grid_col_ + grid_cols_ - 1) / grid_cols_;
+        }
+        std::size_t num_local_tiles() const
+        {
+            return num_local_tile_rows() * num_local_tile_cols();
+        }
+
+        // number of elements stored for each tile (edge tiles are padded)
+        std::size_t tile_size() const
+        {
+            return tile_rows_ * tile_cols_;
+        }
+
+        // global coordinates of the given local tile
+        std::size_t get_tile_row(std::size_t local_tile) const
+        {
+            return (local_tile / num_local_tile_cols()) * grid_rows_ +
+                grid_row_;
+        }
+        std::size_t get_tile_col(std::size_t local_tile) const
+        {
+            return (local_tile % num_local_tile_cols()) * grid_cols_ +
+                grid_col_;
+        }
+
+        // local index of the tile with the given global coordinates, the
+        // tile has to be stored in this partition
+        std::size_t get_local_tile(std::size_t tile_row,
+            std::size_t tile_col) const
+        {
+            HPX_ASSERT(tile_row % grid_rows_ == grid_row_);
+            HPX_ASSERT(tile_col % grid_cols_ == grid_col_);
+            return (tile_row / grid_rows_) * num_local_tile_cols() +
+                tile_col / grid_cols_;
+        }
+
+        // number of valid rows and columns of the given tile
+        std::size_t get_tile_rows(std::size_t tile_row) const
+        {
+            return (std::min)(tile_rows_, rows_ - tile_row * tile_rows_);
+        }
+        std::size_t get_tile_cols(std::size_t tile_col) const
+        {
+            return (std::min)(tile_cols_, cols_ - tile_col * tile_cols_);
+        }
+
+        std::size_t rows_;              // overall size of the matrix
+        std::size_t cols_;
+        std::size_t tile_rows_;         // size of each tile
+        std::size_t tile_cols_;
+        std::size_t grid_rows_;         // size of the grid of partitions
+        std::size_t grid_cols_;
+        std::size_t grid_row_;          // position of this partition
+        std::size_t grid_col_;
+
+    private:
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned)
+        {
+            ar & rows_ & cols_ & tile_rows_ & tile_cols_ & grid_rows_ &
+                grid_cols_ & grid_row_ & grid_col_;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief This is the component holding the tiles of one partition of a
+    ///        hpx::partitioned_matrix.
+    ///
+    /// Each tile is stored contiguously in row major order, using
+    /// tile_rows x tile_cols elements (tiles at the lower and right edges of
+    /// the matrix are padded).
+    template <typename T>
+    class partition_matrix
+      : public components::simple_component_base<partition_matrix<T> >
+    {
+    public:
+        typedef std::vector<T> data_type;
+        typedef typename data_type::size_type size_type;
+        typedef serialization::serialize_buffer<T> tile_type;
+
+        typedef components::simple_component_base<partition_matrix<T> >
+            base_type;
+
+    private:
+        matrix_partition_info info_;
+        data_type data_;
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        // Constructors
+        ///////////////////////////////////////////////////////////////////////
+        partition_matrix()
+        {
+            HPX_ASSERT(false);  // shouldn't ever be called
+        }
+
+        explicit partition_matrix(matrix_partition_info const& info)
+          : info_(info),
+            data_(info.num_local_tiles() * info.tile_size())
+        {}
+
+        /// Constructor which creates the partition_matrix and initializes
+        /// all elements with \a val.
+        partition_matrix(matrix_partition_info const& info, T const& val)
+          : info_(info),
+            data_(info.num_local_tiles() * info.tile_size(), val)
+        {}
+
+        // support components::copy
+        partition_matrix(partition_matrix const& rhs)
+          : base_type(rhs),
+            info_(rhs.info_),
+            data_(rhs.data_)
+        {}
+
+        partition_matrix operator=(partition_matrix const& rhs)
+        {
+            if (this != &rhs)
+            {
+                this->base_type::operator=(rhs);
+                info_ = rhs.info_;
+                data_ = rhs.data_;
+            }
+            return *this;
+        }
+
+        partition_matrix(partition_matrix && rhs)
+          : base_type(std::move(rhs)),
+            info_(rhs.info_),
+            data_(std::move(rhs.data_))
+        {}
+
+        partition_matrix operator=(partition_matrix && rhs)
+        {
+            if (this != &rhs)
+            {
+                this->base_type::operator=(std::move(rhs));
+                info_ = rhs.info_;
+                data_ = std::move(rhs.data_);
+            }
+            return *this;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        matrix_partition_info const& get_info() const
+        {
+            return info_;
+        }
+
+        /// Return the number of tiles stored in this partition
+        size_type get_num_tiles() const
+        {
+            return info_.num_local_tiles();
+        }
+
+        /// Return a pointer to the first element of the given local tile
+        T* get_tile_data(size_type tile)
+        {
+            HPX_ASSERT(tile < info_.num_local_tiles());
+            return data_.data() + tile * info_.tile_size();
+        }
+        T const* get_tile_data(size_type tile) const
+        {
+            HPX_ASSERT(tile < info_.num_local_tiles());
+            return data_.data() + tile * info_.tile_size();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Element and tile access API's
+        ///////////////////////////////////////////////////////////////////////
+
+        /// Return the element at position \a pos of the given local tile
+        T get_value(size_type tile, size_type pos) const
+        {
+            HPX_ASSERT(pos < info_.tile_size());
+            return get_tile_data(tile)[pos];
+        }
+
+        /// Copy \a val to the element at position \a pos of the given local
+        /// tile
+        void set_value(size_type tile, size_type pos, T const& val)
+        {
+            HPX_ASSERT(pos < info_.tile_size());
+            get_tile_data(tile)[pos] = val;
+        }
+
+        /// Return a copy of the given local tile.
+        ///
+        /// The returned buffer owns its data, it stays valid even if this
+        /// partition is destroyed or migrated before it is consumed. Local
+        /// callers should access the tile through \a get_tile_data instead.
+        tile_type get_tile(size_type tile)
+        {
+            return tile_type(get_tile_data(tile), info_.tile_size(),
+                tile_type::copy);
+        }
+
+        /// Replace the contents of the given local tile
+        void set_tile(size_type tile, tile_type const& data)
+        {
+            HPX_ASSERT(data.size() == info_.tile_size());
+            std::copy(data.data(), data.data() + data.size(),
+                get_tile_data(tile));
+        }
+
+        /// Macros to define HPX component actions for all exported functions.
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_matrix, get_value);
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_matrix, set_value);
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_matrix, get_tile);
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_matrix, set_tile);
+    };
+}}
+
+///////////////////////////////////////////////////////////////////////////////
+#define HPX_REGISTER_MATRIX_DECLARATION(...)                                  \
+    HPX_REGISTER_MATRIX_DECLARATION_(__VA_ARGS__)                             \
+/**/
+#define HPX_REGISTER_MATRIX_DECLARATION_(...)                                 \
+    HPX_UTIL_EXPAND_(BOOST_PP_CAT(                                            \
+        HPX_REGISTER_MATRIX_DECLARATION_, HPX_UTIL_PP_NARG(__VA_ARGS__)       \
+    )(__VA_ARGS__))                                                           \
+/**/
+
+#define HPX_REGISTER_MATRIX_DECLARATION_1(type)                               \
+    HPX_REGISTER_MATRIX_DECLARATION_2(type, type)                             \
+/**/
+#define HPX_REGISTER_MATRIX_DECLARATION_2(type, name)                         \
+    HPX_REGISTER_ACTION_DECLARATION(                                          \
+        hpx::server::partition_matrix<type>::get_value_action,                \
+        BOOST_PP_CAT(__matrix_get_value_action_, name));                      \
+    HPX_REGISTER_ACTION_DECLARATION(                                          \
+        hpx::server::partition_matrix<type>::set_value_action,                \
+        BOOST_PP_CAT(__matrix_set_value_action_, name));                      \
+    HPX_REGISTER_ACTION_DECLARATION(                                          \
+        hpx::server::partition_matrix<type>::get_tile_action,                 \
+        BOOST_PP_CAT(__matrix_get_tile_action_, name));                       \
+    HPX_REGISTER_ACTION_DECLARATION(                                          \
+        hpx::server::partition_matrix<type>::set_tile_action,                 \
+        BOOST_PP_CAT(__matrix_set_tile_action_, name));                       \
+/**/
+
+#define HPX_REGISTER_MATRIX(...)                                              \
+    HPX_REGISTER_MATRIX_(__VA_ARGS__)                                         \
+/**/
+#define HPX_REGISTER_MATRIX_(...)                                             \
+    HPX_UTIL_EXPAND_(BOOST_PP_CAT(                                            \
+        HPX_REGISTER_MATRIX_, HPX_UTIL_PP_NARG(__VA_ARGS__)                   \
+    )(__VA_ARGS__))                                                           \
+/**/
+
+#define HPX_REGISTER_MATRIX_1(type)                                           \
+    HPX_REGISTER_MATRIX_2(type, type)                                         \
+/**/
+#define HPX_REGISTER_MATRIX_2(type, name)                                     \
+    HPX_REGISTER_ACTION(                                                      \
+        ::hpx::server::partition_matrix<type>::get_value_action,              \
+        BOOST_PP_CAT(__matrix_get_value_action_, name));                      \
+    HPX_REGISTER_ACTION(                                                      \
+        ::hpx::server::partition_matrix<type>::set_value_action,              \
+        BOOST_PP_CAT(__matrix_set_value_action_, name));                      \
+    HPX_REGISTER_ACTION(                                                      \
+        ::hpx::server::partition_matrix<type>::get_tile_action,               \
+        BOOST_PP_CAT(__matrix_get_tile_action_, name));                       \
+    HPX_REGISTER_ACTION(                                                      \
+        ::hpx::server::partition_matrix<type>::set_tile_action,               \
+        BOOST_PP_CAT(__matrix_set_tile_action_, name));                       \
+    typedef ::hpx::components::simple_component<                              \
+        ::hpx::server::partition_matrix<type>                                 \
+    > BOOST_PP_CAT(__matrix_, name);                                          \
+    HPX_REGISTER_MINIMAL_COMPONENT_FACTORY(BOOST_PP_CAT(__matrix_, name))     \
+/**/
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx
+{
+    template <typename T>
+    class partition_matrix
+      : public components::client_base<
+            partition_matrix<T>, server::partition_matrix<T>
+        >
+    {
+    private:
+        typedef hpx::server::partition_matrix<T> server_type;
+        typedef hpx::components::client_base<
+                partition_matrix<T>, server::partition_matrix<T>
+            > base_type;
+
+    public:
+        typedef typename server_type::tile_type tile_type;
+
+        partition_matrix() {}
+
+        partition_matrix(id_type const& gid)
+          : base_type(gid)
+        {}
+
+        partition_matrix(hpx::shared_future<id_type> const& gid)
+          : base_type(gid)
+        {}
+
+        // Return the pinned pointer to the underlying component
+        boost::shared_ptr<server::partition_matrix<T> > get_ptr() const
+        {
+            error_code ec(lightweight);
+            return hpx::get_ptr<server::partition_matrix<T> >(
+                this->get_gid()).get(ec);
+        }
+
+        /// Return the element at position \a pos of the given local tile
+        future<T> get_value(std::size_t tile, std::size_t pos) const
+        {
+            HPX_ASSERT(this->get_gid());
+            return hpx::async<typename server_type::get_value_action>(
+                this->get_gid(), tile, pos);
+        }
+
+        /// Copy \a val to the element at position \a pos of the given local
+        /// tile
+        template <typename T_>
+        future<void> set_value(std::size_t tile, std::size_t pos, T_ && val)
+        {
+            HPX_ASSERT(this->get_gid());
+            return hpx::async<typename server_type::set_value_action>(
+                this->get_gid(), tile, pos, std::forward<T_>(val));
+        }
+
+        /// Return the given local tile
+        future<tile_type> get_tile(std::size_t tile) const
+        {
+            HPX_ASSERT(this->get_gid());
+            return hpx::async<typename server_type::get_tile_action>(
+                this->get_gid(), tile);
+        }
+
+        /// Replace the contents of the given local tile
+        future<void> set_tile(std::size_t tile, tile_type const& data)
+        {
+            HPX_ASSERT(this->get_gid());
+            return hpx::async<typename server_type::set_tile_action>(
+                this->get_gid(), tile, data);
+        }
+    };
+}
+
+#endif
@@ -20,12 +20,22 @@
 #include <hpx/include/util.hpp>
 #include <hpx/include/components.hpp>
 #include <hpx/include/actions.hpp>
+#include <hpx/lcos/local/scalable_shared_mutex.hpp>
+#include <hpx/runtime/serialization/map.hpp>
+#include <hpx/runtime/serialization/vector.hpp>
 
+#include <hpx/components/containers/unordered/unordered_distribution_policy.hpp>
+
+#include <cstddef>
 #include <iostream>
 #include <tuple>
 #include <vector>
 #include <string>
 #include <unordered_map>
+#include <utility>
+
+#include <boost/cstdint.hpp>
+#include <boost/thread/locks.hpp>
 
 namespace hpx { namespace server
 {
@@ -33,27 +43,91 @@ namespace hpx { namespace server
     ///
     /// This contain the implementation of the partition_unordered_map's
     /// component functionality.
+    ///
+    /// The elements of a partition are spread over a fixed number of
+    /// independent stripes, each of which is a separate stl unordered_map
+    /// protected by its own reader-writer lock. The stripe of an element is
+    /// selected from the (scrambled) hash of its key. Operations on keys
+    /// which belong to different stripes proceed in parallel, and any number
+    /// of readers may access the same stripe concurrently.
     template <typename Key, typename T, typename Hash = std::hash<Key>,
         typename KeyEqual = std::equal_to<Key> >
     class partition_unordered_map
-      : public components::locking_hook<
-            hpx::components::simple_component_base<
-                partition_unordered_map<Key, T, Hash, KeyEqual> > >
+      : public hpx::components::simple_component_base<
+            partition_unordered_map<Key, T, Hash, KeyEqual> >
     {
     public:
         typedef std::unordered_map<Key, T, Hash, KeyEqual> data_type;
 
         typedef typename data_type::size_type size_type;
-        typedef typename data_type::iterator iterator_type;
-        typedef typename data_type::const_iterator const_iterator_type;
 
-        typedef components::locking_hook<
-                hpx::components::simple_component_base<
-                    partition_unordered_map<Key, T, Hash, KeyEqual> > >
+        typedef hpx::components::simple_component_base<
+                partition_unordered_map<Key, T, Hash, KeyEqual> >
             base_type;
 
+        /// The number of stripes each partition is split into.
+        static const std::size_t num_stripes = 16;
+
     private:
-        data_type partition_unordered_map_;
+        typedef lcos::local::scalable_shared_mutex mutex_type;
+
+        struct stripe
+        {
+            stripe() {}
+
+            mutable mutex_type mtx_;
+            data_type data_;
+        };
+
+        stripe stripes_[num_stripes];
+
+        ///////////////////////////////////////////////////////////////////////
+        // The partition itself was selected from the same hash value, all
+        // keys stored here are congruent modulo the number of partitions.
+        // Scramble the bits of the hash value to still spread those keys
+        // evenly over all stripes.
+        std::size_t get_stripe(Key const& key) const
+        {
+            boost::uint64_t h = stripes_[0].data_.hash_function()(key);
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdULL;
+            h ^= h >> 33;
+            return static_cast<std::size_t>(h % num_stripes);
+        }
+
+        // Group the given keys by the stripe they belong to.
+        void get_stripe_indices(std::vector<Key> const& keys,
+            std::vector<std::size_t> (&indices)[num_stripes]) const
+        {
+            for (std::size_t i = 0; i != keys.size(); ++i)
+                indices[get_stripe(keys[i])].push_back(i);
+        }
+
+        void copy_from(partition_unordered_map const& rhs)
+        {
+            for (std::size_t i = 0; i != num_stripes; ++i)
+            {
+                boost::shared_lock<mutex_type> l(rhs.stripes_[i].mtx_);
+                data_type data(rhs.stripes_[i].data_);
+                l.unlock();
+
+                boost::unique_lock<mutex_type> ll(stripes_[i].mtx_);
+                stripes_[i].data_ = std::move(data);
+            }
+        }
+
+        void move_from(partition_unordered_map& rhs)
+        {
+            for (std::size_t i = 0; i != num_stripes; ++i)
+            {
+                boost::unique_lock<mutex_type> l(rhs.stripes_[i].mtx_);
+                data_type data(std::move(rhs.stripes_[i].data_));
+                l.unlock();
+
+                boost::unique_lock<mutex_type> ll(stripes_[i].mtx_);
+                stripes_[i].data_ = std::move(data);
+            }
+        }
 
     public:
         ///////////////////////////////////////////////////////////////////////
@@ -67,172 +141,184 @@ namespace hpx { namespace server
         }
 
         explicit partition_unordered_map(size_type bucket_count)
-          : partition_unordered_map_(bucket_count)
-        {}
+        {
+            size_type stripe_bucket_count =
+                (bucket_count + num_stripes - 1) / num_stripes;
+            for (std::size_t i = 0; i != num_stripes; ++i)
+                stripes_[i].data_ = data_type(stripe_bucket_count);
+        }
 
         partition_unordered_map(size_type bucket_count, Hash const& hash,
-                KeyEqual const& equal)
-          : partition_unordered_map_(bucket_count, hash, equal)
-        {}
+            KeyEqual const& equal)
+        {
+            size_type stripe_bucket_count =
+                (bucket_count + num_stripes - 1) / num_stripes;
+            for (std::size_t i = 0; i != num_stripes; ++i)
+            {
+                stripes_[i].data_ =
+                    data_type(stripe_bucket_count, hash, equal);
+            }
+        }
 
         // support components::copy
         partition_unordered_map(partition_unordered_map const& rhs)
-          : base_type(rhs),
-            partition_unordered_map_(rhs.partition_unordered_map_)
-        {}
+          : base_type(rhs)
+        {
+            copy_from(rhs);
+        }
 
         partition_unordered_map operator=(partition_unordered_map const& rhs)
         {
             if (this != &rhs)
             {
                 this->base_type::operator=(rhs);
-                partition_unordered_map_ = rhs.partition_unordered_map_;
+                copy_from(rhs);
             }
             return *this;
         }
 
         partition_unordered_map(partition_unordered_map && rhs)
-          : base_type(std::move(rhs)),
-            partition_unordered_map_(std::move(rhs.partition_unordered_map_))
-        {}
+          : base_type(std::move(rhs))
+        {
+            move_from(rhs);
+        }
 
         partition_unordered_map operator=(partition_unordered_map && rhs)
         {
             if (this != &rhs)
             {
                 this->base_type::operator=(std::move(rhs));
-                partition_unordered_map_ = std::move(rhs.partition_unordered_map_);
+                move_from(rhs);
             }
             return *this;
         }
 
-        ///////////////////////////////////////////////////////////////////////
-        iterator_type begin()
-        {
-            return partition_unordered_map_.begin();
-        }
-        const_iterator_type begin() const
-        {
-            return partition_unordered_map_.begin();
-        }
-        const_iterator_type cbegin() const
-        {
-            return partition_unordered_map_.cbegin();
-        }
-
-        iterator_type end()
-        {
-            return partition_unordered_map_.end();
-        }
-        const_iterator_type end() const
-        {
-            return partition_unordered_map_.end();
-        }
-        const_iterator_type cend() const
-        {
-            return partition_unordered_map_.cend();
-        }
-
         ///////////////////////////////////////////////////////////////////////
         // Capacity Related API's in the server class
         ///////////////////////////////////////////////////////////////////////
 
         /// Returns the number of elements
+        ///
+        /// \note The stripes are inspected one after the other, the result
+        ///       is exact only if no concurrent modifications are performed.
+        ///
         size_type size() const
         {
-            return partition_unordered_map_.size();
+            size_type result = 0;
+            for (std::size_t i = 0; i != num_stripes; ++i)
+            {
+                boost::shared_lock<mutex_type> l(stripes_[i].mtx_);
+                result += stripes_[i].data_.size();
+            }
+            return result;
         }
 
         /// Returns the maximum possible number of elements
         size_type max_size() const
         {
-            return partition_unordered_map_.max_size();
-        }
-
-        /// Returns the number of elements that the container has currently
-        /// allocated space for.
-        size_type capacity() const
-        {
-            return partition_unordered_map_.capacity();
+            return stripes_[0].data_.max_size();
         }
 
         /// Checks if the container has no elements, i.e. whether
         /// begin() == end().
         bool empty() const
         {
-            return partition_unordered_map_.empty();
+            for (std::size_t i = 0; i != num_stripes; ++i)
+            {
+                boost::shared_lock<mutex_type> l(stripes_[i].mtx_);
+                if (!stripes_[i].data_.empty())
+                    return false;
+            }
+            return true;
         }
 
         ///////////////////////////////////////////////////////////////////////
         // Element access API's
         ///////////////////////////////////////////////////////////////////////
 
-        /// Return the element at the position \a pos in the partition_unordered_map
-        /// container.
+        /// Return the element with the key \a key in the
+        /// partition_unordered_map container.
         ///
-        /// \param pos Position of the element in the partition_unordered_map
+        /// \param key   Key of the element in the partition_unordered_map
+        /// \param erase Remove the element from the partition_unordered_map
+        ///              after it was retrieved
         ///
-        /// \return Return the value of the element at position represented
-        ///         by \a pos.
+        /// \return Return the value of the element with the key \a key.
         ///
-        struct erase_on_exit
+        T get_value(Key const& key, bool erase)
         {
-            erase_on_exit(data_type& m, typename data_type::iterator& it)
-              : m_(m), it_(it)
-            {}
-            ~erase_on_exit()
+            stripe& s = stripes_[get_stripe(key)];
+
+            if (!erase)
             {
-                m_.erase(it_);
+                boost::shared_lock<mutex_type> l(s.mtx_);
+                typename data_type::const_iterator it = s.data_.find(key);
+                if (it == s.data_.end())
+                {
+                    l.unlock();
+                    HPX_THROW_EXCEPTION(bad_parameter,
+                        "partition_unordered_map::get_value",
+                        "unable to find requested key in this partition of "
+                        "the unordered_map");
+                }
+                return it->second;
             }
 
-            data_type& m_;
-            typename data_type::iterator& it_;
-        };
-
-        T get_value(Key const& key, bool erase)
-        {
-            typename data_type::iterator it = partition_unordered_map_.find(key);
-            if (it == partition_unordered_map_.end())
+            boost::unique_lock<mutex_type> l(s.mtx_);
+            typename data_type::iterator it = s.data_.find(key);
+            if (it == s.data_.end())
             {
+                l.unlock();
                 HPX_THROW_EXCEPTION(bad_parameter,
                     "partition_unordered_map::get_value",
                     "unable to find requested key in this partition of the "
                     "unordered_map");
             }
 
-            if (!erase)
-                return it->second;
-
-            erase_on_exit t(partition_unordered_map_, it);
-            return it->second;
+            T result(std::move(it->second));
+            s.data_.erase(it);
+            return result;
         }
 
-        /// Return the element at the position \a pos in the partition_unordered_map
-        /// container.
+        /// Return the elements with the keys \a keys in the
+        /// partition_unordered_map container.
+        ///
+        /// \param keys Keys of the elements in the partition_unordered_map
         ///
-        /// \param pos Positions of the elements in the partition_unordered_map
+        /// \return Return the values of the elements with the keys \a keys
+        ///         (in the same order).
         ///
-        /// \return Return the values of the elements at position represented
-        ///         by \a pos.
+        /// \note Each of the stripes is locked only once, regardless of how
+        ///       many of the keys belong to it.
         ///
         std::vector<T> get_values(std::vector<Key> const& keys)
         {
-            std::vector<T> result;
-            result.reserve(keys.size());
+            std::vector<std::size_t> indices[num_stripes];
+            get_stripe_indices(keys, indices);
 
-            for (std::size_t i = 0; i != keys.size(); ++i)
+            std::vector<T> result(keys.size());
+            for (std::size_t i = 0; i != num_stripes; ++i)
             {
-                typename data_type::iterator it =
-                    partition_unordered_map_.find(keys[i]);
-                if (it == partition_unordered_map_.end())
+                if (indices[i].empty())
+                    continue;
+
+                stripe const& s = stripes_[i];
+
+                boost::shared_lock<mutex_type> l(s.mtx_);
+                for (std::size_t idx : indices[i])
                 {
-                    HPX_THROW_EXCEPTION(bad_parameter,
-                        "partition_unordered_map::get_values",
-                        "unable to find requested key in this partition of the "
-                        "unordered_map");
-                    break;
+                    typename data_type::const_iterator it =
+                        s.data_.find(keys[idx]);
+                    if (it == s.data_.end())
+                    {
+                        l.unlock();
+                        HPX_THROW_EXCEPTION(bad_parameter,
+                            "partition_unordered_map::get_values",
+                            "unable to find requested key in this partition "
+                            "of the unordered_map");
+                    }
+                    result[idx] = it->second;
                 }
-                result.push_back(it->second);
             }
             return result;
         }
@@ -241,33 +327,50 @@ namespace hpx { namespace server
         // Modifiers API's in server class
         ///////////////////////////////////////////////////////////////////////
 
-        /// Copy the value of \a val in the element at position \a pos in the
+        /// Copy the value of \a val in the element with the key \a key in the
         /// partition_unordered_map container.
         ///
-        /// \param pos   Position of the element in the partition_unordered_map
+        /// \param key   Key of the element in the partition_unordered_map
         ///
         /// \param val   The value to be copied
         ///
-        void set_value(Key const& pos, T const& val)
+        void set_value(Key const& key, T const& val)
         {
-            partition_unordered_map_[pos] = val;
+            stripe& s = stripes_[get_stripe(key)];
+
+            boost::unique_lock<mutex_type> l(s.mtx_);
+            s.data_[key] = val;
         }
 
-        /// Copy the value of \a val for the elements at positions \a pos in
+        /// Copy the value of \a val for the elements with the keys \a keys in
         /// the partition_unordered_map container.
         ///
-        /// \param pos   Positions of the elements in the partition_unordered_map
+        /// \param keys  Keys of the elements in the partition_unordered_map
         ///
-        /// \param val   The value to be copied
+        /// \param val   The values to be copied
+        ///
+        /// \note Each of the stripes is locked only once, regardless of how
+        ///       many of the keys belong to it.
         ///
         void set_values(std::vector<Key> const& keys,
             std::vector<T> const& val)
         {
             HPX_ASSERT(keys.size() == val.size());
-            HPX_ASSERT(keys.size() <= partition_unordered_map_.size());
 
-            for (std::size_t i = 0; i != keys.size(); ++i)
-                partition_unordered_map_[keys[i]] = val[i];
+            std::vector<std::size_t> indices[num_stripes];
+            get_stripe_indices(keys, indices);
+
+            for (std::size_t i = 0; i != num_stripes; ++i)
+            {
+                if (indices[i].empty())
+                    continue;
+
+                stripe& s = stripes_[i];
+
+                boost::unique_lock<mutex_type> l(s.mtx_);
+                for (std::size_t idx : indices[i])
+                    s.data_[keys[idx]] = val[idx];
+            }
         }
 
         /// Remove all elements from the vector leaving the
@@ -275,13 +378,73 @@ namespace hpx { namespace server
         ///
         void clear()
         {
-            partition_unordered_map_.clear();
+            for (std::size_t i = 0; i != num_stripes; ++i)
+            {
+                boost::unique_lock<mutex_type> l(stripes_[i].mtx_);
+                stripes_[i].data_.clear();
+            }
         }
 
         /// Erase the given element
         std::size_t erase(Key const& key)
         {
-            return partition_unordered_map_.erase(key);
+            stripe& s = stripes_[get_stripe(key)];
+
+            boost::unique_lock<mutex_type> l(s.mtx_);
+            return s.data_.erase(key);
+        }
+
+        /// Erase the elements with the given keys
+        ///
+        /// \return Returns the number of elements erased
+        ///
+        std::size_t erase_values(std::vector<Key> const& keys)
+        {
+            std::vector<std::size_t> indices[num_stripes];
+            get_stripe_indices(keys, indices);
+
+            std::size_t result = 0;
+            for (std::size_t i = 0; i != num_stripes; ++i)
+            {
+                if (indices[i].empty())
+                    continue;
+
+                stripe& s = stripes_[i];
+
+                boost::unique_lock<mutex_type> l(s.mtx_);
+                for (std::size_t idx : indices[i])
+                    result += s.data_.erase(keys[idx]);
+            }
+            return result;
+        }
+
+        /// Return copies of all elements which are not owned by the
+        /// partition \a part according to the given hash ring. This is used
+        /// while rebalancing the unordered_map.
+        ///
+        /// \param ring  The hash ring describing the new distribution
+        /// \param part  The sequence number of this partition in the new
+        ///              distribution, size_t(-1) if this partition is about
+        ///              to be removed
+        ///
+        std::vector<std::pair<Key, T> > get_moved_values(
+            hpx::detail::consistent_hash_ring const& ring,
+            std::size_t part) const
+        {
+            std::vector<std::pair<Key, T> > result;
+            for (std::size_t i = 0; i != num_stripes; ++i)
+            {
+                stripe const& s = stripes_[i];
+                typename data_type::hasher hash = s.data_.hash_function();
+
+                boost::shared_lock<mutex_type> l(s.mtx_);
+                for (typename data_type::value_type const& v : s.data_)
+                {
+                    if (ring.get_partition(hash(v.first)) != part)
+                        result.push_back(std::make_pair(v.first, v.second));
+                }
+            }
+            return result;
         }
 
         /// Macros to define HPX component actions for all exported functions.
@@ -294,6 +457,9 @@ namespace hpx { namespace server
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, set_values);
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, erase);
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, erase_values);
+
+        HPX_DEFINE_COMPONENT_ACTION(partition_unordered_map, get_moved_values);
     };
 }}
 
@@ -340,6 +506,13 @@ namespace hpx { namespace server
     HPX_REGISTER_ACTION_DECLARATION(                                          \
         BOOST_PP_CAT(partition_unordered_map, __LINE__)::erase_action,        \
         BOOST_PP_CAT(__unordered_map_erase_action_, name));                   \
+    HPX_REGISTER_ACTION_DECLARATION(                                          \
+        BOOST_PP_CAT(partition_unordered_map, __LINE__)::erase_values_action, \
+        BOOST_PP_CAT(__unordered_map_erase_values_action_, name));            \
+    HPX_REGISTER_ACTION_DECLARATION(                                          \
+        BOOST_PP_CAT(partition_unordered_map, __LINE__)::                     \
+            get_moved_values_action,                                          \
+        BOOST_PP_CAT(__unordered_map_get_moved_values_action_, name));        \
     typedef std::plus<std::size_t>                                            \
         BOOST_PP_CAT(partition_unordered_map_size_reduceop, __LINE__);        \
     typedef BOOST_PP_CAT(partition_unordered_map, __LINE__)::size_action      \
@@ -393,6 +566,13 @@ namespace hpx { namespace server
     HPX_REGISTER_ACTION(                                                      \
         BOOST_PP_CAT(partition_unordered_map, __LINE__)::erase_action,        \
         BOOST_PP_CAT(__unordered_map_erase_action_, name));                   \
+    HPX_REGISTER_ACTION(                                                      \
+        BOOST_PP_CAT(partition_unordered_map, __LINE__)::erase_values_action, \
+        BOOST_PP_CAT(__unordered_map_erase_values_action_, name));            \
+    HPX_REGISTER_ACTION(                                                      \
+        BOOST_PP_CAT(partition_unordered_map, __LINE__)::                     \
+            get_moved_values_action,                                          \
+        BOOST_PP_CAT(__unordered_map_get_moved_values_action_, name));        \
     typedef std::plus<std::size_t>                                            \
         BOOST_PP_CAT(partition_unordered_map_size_reduceop, __LINE__);        \
     typedef BOOST_PP_CAT(partition_unordered_map, __LINE__)::size_action      \
@@ -606,6 +786,40 @@ namespace hpx
             return hpx::async<typename server_type::erase_action>(
                 this->get_gid(), key);
         }
+
+        /// Erase all values with the given keys from the
+        /// partition_unordered_map container.
+        ///
+        /// \param keys Keys of the elements in the partition_unordered_map
+        ///
+        /// \return This returns the hpx::future containing the number of
+        ///         elements erased
+        ///
+        future<std::size_t> erase_values(std::vector<Key> const& keys)
+        {
+            HPX_ASSERT(this->get_gid());
+            return hpx::async<typename server_type::erase_values_action>(
+                this->get_gid(), keys);
+        }
+
+        /// Return copies of all elements which are not owned by the
+        /// partition \a part according to the given hash ring.
+        ///
+        /// \param ring  The hash ring describing the new distribution
+        /// \param part  The sequence number of this partition in the new
+        ///              distribution
+        ///
+        /// \return This returns the hpx::future containing the keys and
+        ///         values of the elements to move
+        ///
+        future<std::vector<std::pair<Key, T> > > get_moved_values(
+            hpx::detail::consistent_hash_ring const& ring,
+            std::size_t part) const
+        {
+            HPX_ASSERT(this->get_gid());
+            return hpx::async<typename server_type::get_moved_values_action>(
+                this->get_gid(), ring, part);
+        }
     };
 }
 
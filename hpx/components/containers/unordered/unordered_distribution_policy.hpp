@@ -9,10 +9,116 @@
 #include <hpx/include/util.hpp>
 #include <hpx/components/containers/distribution_policy.hpp>
 
+#include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/runtime/serialization/vector.hpp>
+
+#include <algorithm>
+#include <cstddef>
 #include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/cstdint.hpp>
 
 namespace hpx
 {
+    ///////////////////////////////////////////////////////////////////////////
+    // This class specifies the consistent hashing distribution policy to use
+    // for the partitioning of the data in a hpx::unordered_map. Each of the
+    // partitions is placed onto a hash ring at a number of (pseudo random)
+    // points, the virtual nodes. A key belongs to the partition owning the
+    // next point on the ring following the hash of the key. Adding or
+    // removing partitions changes the ownership of only those keys which
+    // fall into the ring segments of the affected virtual nodes (see
+    // unordered_map::rebalance).
+    struct consistent_hash_distribution_policy
+    {
+    public:
+        consistent_hash_distribution_policy()
+          : num_partitions_(std::size_t(-1)),
+            num_virtual_nodes_(64)
+        {}
+
+        consistent_hash_distribution_policy operator()(
+            std::size_t num_partitions) const
+        {
+            return consistent_hash_distribution_policy(num_partitions,
+                localities_, num_virtual_nodes_);
+        }
+
+        consistent_hash_distribution_policy operator()(
+            std::vector<id_type> const& localities) const
+        {
+            if (num_partitions_ != std::size_t(-1))
+            {
+                return consistent_hash_distribution_policy(num_partitions_,
+                    localities, num_virtual_nodes_);
+            }
+            return consistent_hash_distribution_policy(localities.size(),
+                localities, num_virtual_nodes_);
+        }
+
+        consistent_hash_distribution_policy operator()(
+            std::size_t num_partitions,
+            std::vector<id_type> const& localities) const
+        {
+            return consistent_hash_distribution_policy(num_partitions,
+                localities, num_virtual_nodes_);
+        }
+
+        /// Return a new policy placing each partition at the given number of
+        /// points onto the hash ring. More virtual nodes spread the keys
+        /// more evenly at the expense of a slightly slower lookup.
+        consistent_hash_distribution_policy virtual_nodes(
+            std::size_t num_virtual_nodes) const
+        {
+            return consistent_hash_distribution_policy(num_partitions_,
+                localities_, (std::max)(num_virtual_nodes, std::size_t(1)));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        std::vector<id_type> const& get_localities() const
+        {
+            return localities_;
+        }
+
+        std::size_t get_num_partitions() const
+        {
+            std::size_t num_parts = (num_partitions_ == std::size_t(-1)) ?
+                localities_.size() : num_partitions_;
+            return (std::max)(num_parts, std::size_t(1));
+        }
+
+        std::size_t get_num_virtual_nodes() const
+        {
+            return num_virtual_nodes_;
+        }
+
+    private:
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive & ar, const unsigned int version)
+        {
+            ar & localities_ & num_partitions_ & num_virtual_nodes_;
+        }
+
+        consistent_hash_distribution_policy(std::size_t num_partitions,
+                std::vector<id_type> const& localities,
+                std::size_t num_virtual_nodes)
+          : localities_(localities),
+            num_partitions_(num_partitions),
+            num_virtual_nodes_(num_virtual_nodes)
+        {}
+
+    private:
+        std::vector<id_type> localities_;   // localities to create chunks on
+        std::size_t num_partitions_;        // number of chunks to create
+        std::size_t num_virtual_nodes_;     // number of ring points per chunk
+    };
+
+    static consistent_hash_distribution_policy const consistent_hash_layout;
+
     ///////////////////////////////////////////////////////////////////////////
     namespace detail
     {
@@ -26,6 +132,108 @@ namespace hpx
         struct is_unordered_distribution_policy<distribution_policy>
           : std::true_type
         {};
+
+        template <>
+        struct is_unordered_distribution_policy<
+                consistent_hash_distribution_policy>
+          : std::true_type
+        {};
+
+        ///////////////////////////////////////////////////////////////////////
+        // The hash ring used to map keys to partitions for the consistent
+        // hashing distribution policy. Each partition is identified by a
+        // node id which stays the same for as long as the partition exists,
+        // the placement of its virtual nodes depends on this id only.
+        class consistent_hash_ring
+        {
+        public:
+            consistent_hash_ring()
+              : num_virtual_nodes_(0)
+            {}
+
+            consistent_hash_ring(std::vector<boost::uint64_t> const& node_ids,
+                    std::size_t num_virtual_nodes)
+              : node_ids_(node_ids),
+                num_virtual_nodes_(num_virtual_nodes)
+            {
+                std::vector<std::pair<boost::uint64_t, std::size_t> > ring;
+                ring.reserve(node_ids_.size() * num_virtual_nodes_);
+
+                for (std::size_t part = 0; part != node_ids_.size(); ++part)
+                {
+                    boost::uint64_t seed = mix(node_ids_[part]);
+                    for (std::size_t i = 0; i != num_virtual_nodes_; ++i)
+                    {
+                        ring.push_back(std::make_pair(
+                            mix(seed ^ (0x9e3779b97f4a7c15ULL * (i + 1))),
+                            part));
+                    }
+                }
+                std::sort(ring.begin(), ring.end());
+
+                points_.reserve(ring.size());
+                owners_.reserve(ring.size());
+                for (std::size_t i = 0; i != ring.size(); ++i)
+                {
+                    points_.push_back(ring[i].first);
+                    owners_.push_back(ring[i].second);
+                }
+            }
+
+            bool empty() const
+            {
+                return points_.empty();
+            }
+
+            /// Return the sequence number of the partition owning the given
+            /// hash value.
+            std::size_t get_partition(std::size_t hash) const
+            {
+                HPX_ASSERT(!empty());
+
+                std::vector<boost::uint64_t>::const_iterator it =
+                    std::upper_bound(points_.begin(), points_.end(),
+                        mix(hash));
+                if (it == points_.end())
+                    return owners_.front();
+                return owners_[std::distance(points_.begin(), it)];
+            }
+
+            std::vector<boost::uint64_t> const& get_node_ids() const
+            {
+                return node_ids_;
+            }
+
+            std::size_t get_num_virtual_nodes() const
+            {
+                return num_virtual_nodes_;
+            }
+
+        private:
+            // 64 bit finalizer of MurmurHash3
+            static boost::uint64_t mix(boost::uint64_t h)
+            {
+                h ^= h >> 33;
+                h *= 0xff51afd7ed558ccdULL;
+                h ^= h >> 33;
+                h *= 0xc4ceb9fe1a85ec53ULL;
+                h ^= h >> 33;
+                return h;
+            }
+
+            friend class hpx::serialization::access;
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned)
+            {
+                ar & node_ids_ & num_virtual_nodes_ & points_ & owners_;
+            }
+
+            std::vector<boost::uint64_t> node_ids_;
+            std::size_t num_virtual_nodes_;
+            std::vector<boost::uint64_t> points_;
+            std::vector<std::size_t> owners_;
+        };
         // \endcond
     }
 
@@ -13,15 +13,25 @@
 #include <hpx/include/components.hpp>
 #include <hpx/runtime/serialization/serialize.hpp>
 #include <hpx/runtime/serialization/vector.hpp>
+#include <hpx/lcos/local/condition_variable.hpp>
+#include <hpx/lcos/local/mutex.hpp>
+#include <hpx/lcos/local/promise.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
 
 #include <hpx/components/containers/unordered/unordered_distribution_policy.hpp>
 #include <hpx/components/containers/unordered/partition_unordered_map_component.hpp>
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <boost/cstdint.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/locks.hpp>
 
 /// The hpx::unordered_map and its API's are defined here.
 ///
@@ -74,11 +84,15 @@ namespace hpx { namespace server
         unordered_map_config_data()
         {}
 
-        unordered_map_config_data(std::vector<partition_data> const& partitions)
-          : partitions_(std::move(partitions))
+        unordered_map_config_data(std::vector<partition_data> const& partitions,
+                hpx::detail::consistent_hash_ring const& ring =
+                    hpx::detail::consistent_hash_ring())
+          : partitions_(std::move(partitions)),
+            ring_(ring)
         {}
 
         std::vector<partition_data> partitions_;
+        hpx::detail::consistent_hash_ring ring_;
 
     private:
         friend class hpx::serialization::access;
@@ -86,7 +100,7 @@ namespace hpx { namespace server
         template <typename Archive>
         void serialize(Archive& ar, unsigned)
         {
-            ar & partitions_;
+            ar & partitions_ & ring_;
         }
     };
 }}
@@ -145,6 +159,11 @@ namespace hpx
                 return hasher_(key);
             }
 
+            Hash hash_function() const
+            {
+                return hasher_;
+            }
+
             Hash hasher_;
         };
 
@@ -159,6 +178,11 @@ namespace hpx
             {
                 return Hash()(key);
             }
+
+            Hash hash_function() const
+            {
+                return Hash();
+            }
         };
 
         ///////////////////////////////////////////////////////////////////////
@@ -176,6 +200,11 @@ namespace hpx
                 return equal_(lhs, rhs);
             }
 
+            KeyEqual key_eq() const
+            {
+                return equal_;
+            }
+
             KeyEqual equal_;
         };
 
@@ -190,6 +219,11 @@ namespace hpx
             {
                 return KeyEqual()(lhs, rhs);
             }
+
+            KeyEqual key_eq() const
+            {
+                return KeyEqual();
+            }
         };
 
         ///////////////////////////////////////////////////////////////////////
@@ -279,13 +313,166 @@ namespace hpx
         // size, and locality id.
         typedef std::vector<partition_data> partitions_vector_type;
 
-        // This is the vector representing the base_index and corresponding
-        // global ID's of the underlying partition_vectors.
-        partitions_vector_type partitions_;
+        // The partitions of this unordered_map together with the hash ring
+        // mapping the keys onto them. A rebalance replaces both at once, so
+        // they are published as a single immutable snapshot. Each operation
+        // works on the snapshot it picked up when it was started.
+        struct distribution_data
+        {
+            // This is the vector representing the base_index and
+            // corresponding global ID's of the underlying partitions.
+            partitions_vector_type partitions_;
+
+            // The hash ring mapping the keys onto the partitions, this is
+            // empty unless the consistent hashing distribution policy is
+            // used.
+            hpx::detail::consistent_hash_ring ring_;
+
+            // This becomes ready once the last operation referring to this
+            // snapshot has released it.
+            mutable lcos::local::promise<void> released_;
+
+            ~distribution_data()
+            {
+                error_code ec;      // ignore all exceptions
+                released_.set_value(ec);
+            }
+        };
+
+        typedef boost::shared_ptr<distribution_data const> distribution_ptr;
+        typedef lcos::local::spinlock mutex_type;
+
+        // Fences the modifications of the elements while a rebalance moves
+        // them between the partitions. A rebalance waits for all
+        // modifications in flight before it starts copying, modifications
+        // started afterwards are held back until the new distribution is in
+        // place.
+        struct write_fence
+        {
+            write_fence()
+              : active_writes_(0), moving_(false)
+            {}
+
+            void enter()
+            {
+                mutex_type::scoped_lock l(mtx_);
+                while (moving_)
+                    cond_.wait(l);
+                ++active_writes_;
+            }
+
+            void leave()
+            {
+                mutex_type::scoped_lock l(mtx_);
+                HPX_ASSERT(active_writes_ != 0);
+                if (--active_writes_ == 0 && moving_)
+                    cond_.notify_all();
+            }
+
+            // hold back new modifications, wait for the ones in flight
+            void lock()
+            {
+                mutex_type::scoped_lock l(mtx_);
+                HPX_ASSERT(!moving_);
+                moving_ = true;
+                while (active_writes_ != 0)
+                    cond_.wait(l);
+            }
+
+            void unlock()
+            {
+                mutex_type::scoped_lock l(mtx_);
+                moving_ = false;
+                cond_.notify_all();
+            }
+
+            mutex_type mtx_;
+            lcos::local::condition_variable cond_;
+            std::size_t active_writes_;
+            bool moving_;
+        };
+
+        // Keeps a modification registered with the write fence until it goes
+        // out of scope, or until the future handed to leave_after becomes
+        // ready. An empty fence makes this a no-op.
+        class write_guard
+        {
+        public:
+            explicit write_guard(boost::shared_ptr<write_fence> const& fence)
+              : fence_(fence)
+            {
+                if (fence_)
+                    fence_->enter();
+            }
+
+            ~write_guard()
+            {
+                if (fence_)
+                    fence_->leave();
+            }
+
+            template <typename R>
+            future<R> leave_after(future<R> && f)
+            {
+                if (!fence_)
+                    return std::move(f);
+
+                boost::shared_ptr<write_fence> fence;
+                fence.swap(fence_);
+                return f.then(
+                    [fence](future<R> && r) -> R
+                    {
+                        fence->leave();
+                        return r.get();
+                    });
+            }
+
+        private:
+            boost::shared_ptr<write_fence> fence_;
+        };
+
+        // protects data_ (but not the snapshot it refers to)
+        mutable mutex_type mtx_;
+        distribution_ptr data_;
+
+        // serializes concurrent rebalance operations
+        lcos::local::mutex rebalance_mtx_;
 
         // will be set for created (non-attached) objects
         std::string registered_name_;
 
+        // fences the modifications performed through this instance during
+        // a rebalance, shared with the modifications still in flight
+        boost::shared_ptr<write_fence> fence_;
+
+        // the fence for operations which might modify the element
+        boost::shared_ptr<write_fence> get_fence(bool modifies) const
+        {
+            return modifies ? fence_ : boost::shared_ptr<write_fence>();
+        }
+
+        distribution_ptr get_data() const
+        {
+            mutex_type::scoped_lock l(mtx_);
+            return data_;
+        }
+
+        void set_data(distribution_ptr data)
+        {
+            mutex_type::scoped_lock l(mtx_);
+            data_.swap(data);
+        }
+
+        // hand out our snapshot, leave an empty one behind
+        distribution_ptr release_data()
+        {
+            distribution_ptr empty = boost::make_shared<distribution_data>();
+
+            mutex_type::scoped_lock l(mtx_);
+            data_.swap(empty);
+            return empty;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // Connect this unordered_map to the existing unordered_mapusing the
         // given symbolic name.
@@ -294,7 +481,12 @@ namespace hpx
         {
             server::unordered_map_config_data data = f.get();
 
-            std::swap(partitions_, data.partitions_);
+            boost::shared_ptr<distribution_data> d =
+                boost::make_shared<distribution_data>();
+            std::swap(d->partitions_, data.partitions_);
+            std::swap(d->ring_, data.ring_);
+
+            set_data(d);
             base_type::reset(std::move(id));
         }
 
@@ -311,16 +503,21 @@ namespace hpx
         }
 
         ///////////////////////////////////////////////////////////////////////
-        std::size_t get_partition(Key const& key) const
+        std::size_t get_partition(distribution_data const& d,
+            Key const& key) const
         {
-            return this->hasher_(key) % partitions_.size();
+            if (!d.ring_.empty())
+                return d.ring_.get_partition(this->hasher_(key));
+            return this->hasher_(key) % d.partitions_.size();
         }
 
         std::vector<hpx::id_type> get_partition_ids() const
         {
+            distribution_ptr d = get_data();
+
             std::vector<hpx::id_type> ids;
-            ids.reserve(partitions_.size());
-            for (partition_data const& pd: partitions_)
+            ids.reserve(d->partitions_.size());
+            for (partition_data const& pd: d->partitions_)
             {
                 ids.push_back(pd.get_id());
             }
@@ -337,7 +534,7 @@ namespace hpx
 
         void init(std::vector<id_type> const& localities,
             std::vector<future<std::vector<id_type> > >& ids,
-            std::size_t num_parts_per_loc)
+            std::size_t num_parts_per_loc, partitions_vector_type& partitions)
         {
             std::size_t num_localities = localities.size();
 
@@ -353,14 +550,15 @@ namespace hpx
                 HPX_ASSERT(objs.size() == num_parts_per_loc);
                 for (std::size_t l = 0; l != num_parts_per_loc; ++l)
                 {
-                    partitions_.push_back(partition_data(objs[l], locality));
+                    partitions.push_back(partition_data(objs[l], locality));
                     if (locality == this_locality)
                     {
                         using util::placeholders::_1;
                         ptrs.push_back(get_ptr<partition_unordered_map_server>(
-                            partitions_.back().partition_.get()).then(
+                            partitions.back().partition_.get()).then(
                                 util::bind(&unordered_map::get_ptr_helper,
-                                    this, l, std::ref(partitions_), _1)));
+                                    this, partitions.size() - 1,
+                                    std::ref(partitions), _1)));
                     }
                 }
             }
@@ -368,6 +566,24 @@ namespace hpx
             wait_all(ptrs);
         }
 
+        // the default distribution policy distributes the keys using the
+        // hash value modulo the number of partitions
+        void init_ring(distribution_policy const&, distribution_data& d)
+        {
+            d.ring_ = hpx::detail::consistent_hash_ring();
+        }
+
+        void init_ring(consistent_hash_distribution_policy const& policy,
+            distribution_data& d)
+        {
+            std::vector<boost::uint64_t> node_ids(d.partitions_.size());
+            for (std::size_t i = 0; i != node_ids.size(); ++i)
+                node_ids[i] = i;
+
+            d.ring_ = hpx::detail::consistent_hash_ring(node_ids,
+                policy.get_num_virtual_nodes());
+        }
+
         ///////////////////////////////////////////////////////////////////////
         template <typename DistPolicy>
         void create(std::vector<id_type> const& localities,
@@ -391,7 +607,11 @@ namespace hpx
             hpx::wait_all(ids);
 
             // now initialize our data structures
-            init(localities, ids, num_parts_per_loc);
+            boost::shared_ptr<distribution_data> d =
+                boost::make_shared<distribution_data>();
+            init(localities, ids, num_parts_per_loc, d->partitions_);
+            init_ring(policy, *d);
+            set_data(d);
         }
 
         // default construct a local partition
@@ -430,7 +650,11 @@ namespace hpx
             hpx::wait_all(ids);
 
             // now initialize our data structures
-            init(localities, ids, num_parts_per_loc);
+            boost::shared_ptr<distribution_data> d =
+                boost::make_shared<distribution_data>();
+            init(localities, ids, num_parts_per_loc, d->partitions_);
+            init_ring(policy, *d);
+            set_data(d);
         }
 
         // This function is called when we are creating the unordered_map. It
@@ -457,9 +681,13 @@ namespace hpx
             typedef typename partitions_vector_type::const_iterator
                 const_iterator;
 
+            distribution_ptr rhs_data = rhs.get_data();
+            partitions_vector_type const& rhs_partitions =
+                rhs_data->partitions_;
+
             std::vector<future<id_type> > objs;
-            const_iterator end = rhs.partitions_.end();
-            for (const_iterator it = rhs.partitions_.begin(); it != end; ++it)
+            const_iterator end = rhs_partitions.end();
+            for (const_iterator it = rhs_partitions.begin(); it != end; ++it)
             {
                 typedef partition_unordered_map_server component_type;
                 objs.push_back(hpx::components::copy<component_type>(
@@ -470,11 +698,14 @@ namespace hpx
             boost::uint32_t this_locality = get_locality_id();
             std::vector<future<void> > ptrs;
 
-            partitions_vector_type partitions;
-            partitions.reserve(rhs.partitions_.size());
-            for (std::size_t i = 0; i != rhs.partitions_.size(); ++i)
+            boost::shared_ptr<distribution_data> d =
+                boost::make_shared<distribution_data>();
+            partitions_vector_type& partitions = d->partitions_;
+
+            partitions.reserve(rhs_partitions.size());
+            for (std::size_t i = 0; i != rhs_partitions.size(); ++i)
             {
-                boost::uint32_t locality = rhs.partitions_[i].locality_id_;
+                boost::uint32_t locality = rhs_partitions[i].locality_id_;
 
                 partitions.push_back(partition_data(
                     std::move(objs[i]), locality));
@@ -491,7 +722,8 @@ namespace hpx
 
             wait_all(ptrs);
 
-            std::swap(partitions_, partitions);
+            d->ring_ = rhs_data->ring_;
+            set_data(d);
             registered_name_.clear();
         }
 
@@ -506,7 +738,8 @@ namespace hpx
         // Register this unordered_map with AGAS using the given symbolic name
         future<void> register_as(std::string const& symbolic_name)
         {
-            server::unordered_map_config_data data(partitions_);
+            distribution_ptr d = get_data();
+            server::unordered_map_config_data data(d->partitions_, d->ring_);
 
             base_type::reset(hpx::new_<
                     typename base_type::server_component_type> >(
@@ -521,6 +754,7 @@ namespace hpx
         /// \a num_partitions = 1 and \a partition_size = 0. Hence overall size
         /// of the unordered_map is 0.
         unordered_map()
+          : fence_(boost::make_shared<write_fence>())
         {
             create(layout);
         }
@@ -530,13 +764,15 @@ namespace hpx
                 typename std::enable_if<
                         is_unordered_distribution_policy<DistPolicy>::value
                     >::type* = 0)
+          : fence_(boost::make_shared<write_fence>())
         {
             create(policy);
         }
 
         explicit unordered_map(std::size_t bucket_count,
                 Hash const& hash = Hash(), KeyEqual const& equal = KeyEqual())
-          : hash_base_type(hash, equal)
+          : hash_base_type(hash, equal),
+            fence_(boost::make_shared<write_fence>())
         {
             create(bucket_count, hpx::layout, hash, equal);
         }
@@ -546,6 +782,7 @@ namespace hpx
                 typename std::enable_if<
                         is_unordered_distribution_policy<DistPolicy>::value
                     >::type* = 0)
+          : fence_(boost::make_shared<write_fence>())
         {
             create(bucket_count, policy);
         }
@@ -556,7 +793,8 @@ namespace hpx
                 typename std::enable_if<
                         is_unordered_distribution_policy<DistPolicy>::value
                     >::type* = 0)
-          : hash_base_type(hash, KeyEqual())
+          : hash_base_type(hash, KeyEqual()),
+            fence_(boost::make_shared<write_fence>())
         {
             create(bucket_count, policy, hash);
         }
@@ -568,13 +806,15 @@ namespace hpx
                 typename std::enable_if<
                         is_unordered_distribution_policy<DistPolicy>::value
                     >::type* = 0)
-          : hash_base_type(hash, equal)
+          : hash_base_type(hash, equal),
+            fence_(boost::make_shared<write_fence>())
         {
             create(bucket_count, policy, hash, equal);
         }
 
         unordered_map(unordered_map const& rhs)
-          : hash_base_type(rhs)
+          : hash_base_type(rhs),
+            fence_(boost::make_shared<write_fence>())
         {
             copy_from(rhs);
         }
@@ -582,8 +822,9 @@ namespace hpx
         unordered_map(unordered_map && rhs)
           : base_type(std::move(rhs)),
             hash_base_type(std::move(rhs)),
-            partitions_(std::move(rhs.partitions_)),
-            registered_name_(std::move(rhs.registered_name_))
+            data_(rhs.release_data()),
+            registered_name_(std::move(rhs.registered_name_)),
+            fence_(boost::make_shared<write_fence>())
         {}
 
         ~unordered_map()
@@ -608,7 +849,7 @@ namespace hpx
                 this->base_type::operator=(std::move(rhs));
                 this->hash_base_type::operator=(std::move(rhs));
 
-                partitions_ = std::move(rhs.partitions_);
+                set_data(rhs.release_data());
                 registered_name_ = std::move(rhs.registered_name_);
             }
             return *this;
@@ -645,7 +886,9 @@ namespace hpx
         ///
         T get_value_sync(Key const& pos, bool erase = false) const
         {
-            return get_value_sync(get_partition(pos), pos, erase);
+            write_guard g(get_fence(erase));
+            distribution_ptr d = get_data();
+            return get_value_sync(*d, get_partition(*d, pos), pos, erase);
         }
 
         /// Returns the element at position \a pos in the unordered_map container.
@@ -658,14 +901,8 @@ namespace hpx
         ///
         T get_value_sync(size_type part, Key const& pos, bool erase = false) const
         {
-            HPX_ASSERT(part < partitions_.size());
-
-            partition_data const& part_data = partitions_[part];
-            if (part_data.local_data_)
-                return part_data.local_data_->get_value(pos, erase);
-
-            return partition_unordered_map_client(part_data.partition_)
-                .get_value_sync(pos, erase);
+            write_guard g(get_fence(erase));
+            return get_value_sync(*get_data(), part, pos, erase);
         }
 
         /// Returns the element at position \a pos in the unordered_map container
@@ -678,7 +915,10 @@ namespace hpx
         ///
         future<T> get_value(Key const& pos, bool erase = false) const
         {
-            return get_value(get_partition(pos), pos, erase);
+            write_guard g(get_fence(erase));
+            distribution_ptr d = get_data();
+            return g.leave_after(
+                get_value(*d, get_partition(*d, pos), pos, erase));
         }
 
         /// Returns the element at position \a pos in the given partition in
@@ -693,16 +933,121 @@ namespace hpx
         future<T>
         get_value(size_type part, Key const& pos, bool erase = false) const
         {
-            HPX_ASSERT(part < partitions_.size());
+            write_guard g(get_fence(erase));
+            return g.leave_after(get_value(*get_data(), part, pos, erase));
+        }
+
+        /// Returns the elements with the keys \a keys from the given
+        /// partition in the unordered_map container.
+        ///
+        /// \param part  Sequence number of the partition
+        /// \param keys  Keys of the elements in the partition
+        ///
+        /// \return Returns the values of the elements with the keys
+        ///         \a keys.
+        ///
+        std::vector<T>
+        get_values_sync(size_type part, std::vector<Key> const& keys) const
+        {
+            return get_values_sync(*get_data(), part, keys);
+        }
+
+        /// Asynchronously returns the elements with the keys \a keys from
+        /// the given partition in the unordered_map container.
+        ///
+        /// \param part  Sequence number of the partition
+        /// \param keys  Keys of the elements in the partition
+        ///
+        /// \return Returns the hpx::future to the values of the elements
+        ///         with the keys \a keys.
+        ///
+        future<std::vector<T> >
+        get_values(size_type part, std::vector<Key> const& keys) const
+        {
+            return get_values(*get_data(), part, keys);
+        }
 
-            if (partitions_[part].local_data_)
+        /// Asynchronously returns the elements with the keys \a keys in the
+        /// unordered_map container.
+        ///
+        /// The keys are grouped by the partition they belong to and all
+        /// elements residing on the same partition are retrieved using a
+        /// single action. All partitions are accessed concurrently.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        ///
+        /// \return Returns the hpx::future to the values of the elements
+        ///         with the keys \a keys (in the same order).
+        ///
+        future<std::vector<T> > get_values(std::vector<Key> const& keys) const
+        {
+            if (keys.empty())
+                return make_ready_future(std::vector<T>());
+
+            distribution_ptr d = get_data();
+            size_type num_partitions = d->partitions_.size();
+
+            // group the keys by partition, remember where each of the
+            // values has to go in the result
+            std::vector<std::vector<Key> > part_keys(num_partitions);
+            std::vector<std::vector<size_type> > positions(num_partitions);
+
+            for (size_type i = 0; i != keys.size(); ++i)
             {
-                return make_ready_future(
-                    partitions_[part].local_data_->get_value(pos, erase));
+                size_type part = get_partition(*d, keys[i]);
+                part_keys[part].push_back(keys[i]);
+                positions[part].push_back(i);
             }
 
-            return partition_unordered_map_client(partitions_[part].partition_)
-                .get_value(pos, erase);
+            // issue one request per partition
+            std::vector<future<std::vector<T> > > part_values_future;
+            std::vector<std::vector<size_type> > part_positions;
+            for (size_type part = 0; part != num_partitions; ++part)
+            {
+                if (part_keys[part].empty())
+                    continue;
+
+                part_values_future.push_back(
+                    get_values(*d, part, part_keys[part]));
+                part_positions.push_back(std::move(positions[part]));
+            }
+
+            // This helper function unwraps the vectors from each partition
+            // and places the values at their original positions
+            size_type count = keys.size();
+            auto merge_func =
+                [count](std::vector<future<std::vector<T> > > && part_values_f,
+                    std::vector<std::vector<size_type> > && part_positions)
+                    -> std::vector<T>
+                {
+                    std::vector<T> values(count);
+                    for (size_type i = 0; i != part_values_f.size(); ++i)
+                    {
+                        std::vector<T> part_values = part_values_f[i].get();
+                        std::vector<size_type> const& pos = part_positions[i];
+
+                        HPX_ASSERT(part_values.size() == pos.size());
+                        for (size_type j = 0; j != pos.size(); ++j)
+                            values[pos[j]] = std::move(part_values[j]);
+                    }
+                    return values;
+                };
+
+            return lcos::local::dataflow(launch::async, merge_func,
+                std::move(part_values_future), std::move(part_positions));
+        }
+
+        /// Returns the elements with the keys \a keys in the unordered_map
+        /// container.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        ///
+        /// \return Returns the values of the elements with the keys
+        ///         \a keys (in the same order).
+        ///
+        std::vector<T> get_values_sync(std::vector<Key> const& keys) const
+        {
+            return get_values(keys).get();
         }
 
         /// Copy the value of \a val in the element at position \a pos in
@@ -714,7 +1059,9 @@ namespace hpx
         template <typename T_>
         void set_value_sync(Key const& pos, T_ && val)
         {
-            return set_value_sync(get_partition(pos), pos,
+            write_guard g(fence_);
+            distribution_ptr d = get_data();
+            set_value_sync(*d, get_partition(*d, pos), pos,
                 std::forward<T_>(val));
         }
 
@@ -728,18 +1075,8 @@ namespace hpx
         template <typename T_>
         void set_value_sync(size_type part, Key const& pos, T_ && val)
         {
-            HPX_ASSERT(part < partitions_.size());
-
-            partition_data const& part_data = partitions_[part];
-            if (part_data.local_data_)
-            {
-                part_data.local_data_->set_value(pos, std::forward<T_>(val));
-            }
-            else
-            {
-                partition_unordered_map_client(part_data.partition_)
-                    .set_value_sync(pos, std::forward<T_>(val));
-            }
+            write_guard g(fence_);
+            set_value_sync(*get_data(), part, pos, std::forward<T_>(val));
         }
 
         /// Asynchronous set the element at position \a pos of the partition
@@ -754,7 +1091,10 @@ namespace hpx
         template <typename T_>
         future<void> set_value(Key const& pos, T_ && val)
         {
-            return set_value(get_partition(pos), pos, std::forward<T_>(val));
+            write_guard g(fence_);
+            distribution_ptr d = get_data();
+            return g.leave_after(set_value(*d, get_partition(*d, pos), pos,
+                std::forward<T_>(val)));
         }
 
         /// Asynchronously set the element at position \a pos in
@@ -770,17 +1110,104 @@ namespace hpx
         template <typename T_>
         future<void> set_value(size_type part, Key const& pos, T_ && val)
         {
-            HPX_ASSERT(part < partitions_.size());
+            write_guard g(fence_);
+            return g.leave_after(
+                set_value(*get_data(), part, pos, std::forward<T_>(val)));
+        }
 
-            partition_data const& part_data = partitions_[part];
-            if (part_data.local_data_)
-            {
-                part_data.local_data_->set_value(pos, std::forward<T_>(val));
+        /// Copy the values \a vals to the elements with the keys \a keys in
+        /// the partition \a part of the unordered_map container.
+        ///
+        /// \param part  Sequence number of the partition
+        /// \param keys  Keys of the elements in the partition
+        /// \param vals  The values to be copied
+        ///
+        void set_values_sync(size_type part, std::vector<Key> const& keys,
+            std::vector<T> const& vals)
+        {
+            set_values(part, keys, vals).get();
+        }
+
+        /// Asynchronously copy the values \a vals to the elements with the
+        /// keys \a keys in the partition \a part of the unordered_map
+        /// container.
+        ///
+        /// \param part  Sequence number of the partition
+        /// \param keys  Keys of the elements in the partition
+        /// \param vals  The values to be copied
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once the operation is finished.
+        ///
+        future<void> set_values(size_type part, std::vector<Key> const& keys,
+            std::vector<T> const& vals)
+        {
+            write_guard g(fence_);
+            return g.leave_after(set_values(*get_data(), part, keys, vals));
+        }
+
+        /// Asynchronously copy the values \a vals to the elements with the
+        /// keys \a keys in the unordered_map container.
+        ///
+        /// The keys are grouped by the partition they belong to and all
+        /// elements residing on the same partition are updated using a
+        /// single action. All partitions are accessed concurrently.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        /// \param vals  The values to be copied, \a vals[i] is stored for
+        ///              the key \a keys[i]
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once the operation is finished.
+        ///
+        future<void> set_values(std::vector<Key> const& keys,
+            std::vector<T> const& vals)
+        {
+            HPX_ASSERT(keys.size() == vals.size());
+
+            if (keys.empty())
                 return make_ready_future();
+
+            write_guard g(fence_);
+            distribution_ptr d = get_data();
+            size_type num_partitions = d->partitions_.size();
+
+            // group the keys and values by partition
+            std::vector<std::vector<Key> > part_keys(num_partitions);
+            std::vector<std::vector<T> > part_vals(num_partitions);
+
+            for (size_type i = 0; i != keys.size(); ++i)
+            {
+                size_type part = get_partition(*d, keys[i]);
+                part_keys[part].push_back(keys[i]);
+                part_vals[part].push_back(vals[i]);
             }
 
-            return partition_unordered_map_client(part_data.partition_)
-                .set_value(pos, std::forward<T_>(val));
+            // issue one request per partition
+            std::vector<future<void> > part_futures;
+            for (size_type part = 0; part != num_partitions; ++part)
+            {
+                if (part_keys[part].empty())
+                    continue;
+
+                part_futures.push_back(
+                    set_values(*d, part, part_keys[part], part_vals[part]));
+            }
+
+            future<void> f = when_all(part_futures);
+            return g.leave_after(std::move(f));
+        }
+
+        /// Copy the values \a vals to the elements with the keys \a keys in
+        /// the unordered_map container.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        /// \param vals  The values to be copied
+        ///
+        void set_values_sync(std::vector<Key> const& keys,
+            std::vector<T> const& vals)
+        {
+            set_values(keys, vals).get();
         }
 
         /// Asynchronously compute the size of the unordered_map.
@@ -821,14 +1248,7 @@ namespace hpx
 
         std::size_t erase_sync(size_type part, Key const& key)
         {
-            HPX_ASSERT(part < partitions_.size());
-
-            partition_data const& part_data = partitions_[part];
-            if (part_data.local_data_)
-                return part_data.local_data_->erase(key);
-
-            return partition_unordered_map_client(
-                part_data.partition_).erase_sync(key);
+            return erase(part, key).get();
         }
         /// Erase all values with the given key from the partition_unordered_map
         /// container.
@@ -840,20 +1260,418 @@ namespace hpx
         ///
         future<std::size_t> erase(Key const& key)
         {
-            return erase(get_partition(key), key);
+            write_guard g(fence_);
+            distribution_ptr d = get_data();
+            return g.leave_after(erase(*d, get_partition(*d, key), key));
         }
 
         future<std::size_t> erase(size_type part, Key const& key)
         {
-            HPX_ASSERT(part < partitions_.size());
+            write_guard g(fence_);
+            return g.leave_after(erase(*get_data(), part, key));
+        }
+
+        /// Redistribute the elements of the unordered_map according to the
+        /// given consistent hashing distribution policy.
+        ///
+        /// The partitions already existing on the localities of the new
+        /// policy are kept, missing partitions are created, and partitions
+        /// located elsewhere are removed. Only the elements whose owning
+        /// partition changes in the new distribution are moved. Those are
+        /// transferred in bulk, using a single action per pair of source and
+        /// target partition, and all partitions are processed concurrently.
+        ///
+        /// The elements are copied to their new partitions before this
+        /// unordered_map switches over to the new distribution, which
+        /// replaces the partitions and the hash ring at once. The moved
+        /// elements are removed from their old partitions only after all
+        /// operations which have been started on the old distribution have
+        /// returned. Lookups performed through this unordered_map
+        /// therefore keep succeeding while the rebalancing is in progress.
+        ///
+        /// Modifications performed through this unordered_map are not lost:
+        /// the rebalancing waits for the modifications in flight before it
+        /// starts copying, and modifications issued while the elements are
+        /// being copied are held back until the new distribution is in
+        /// place.
+        ///
+        /// \param policy The distribution policy describing the new layout
+        ///
+        /// \throws hpx::exception (invalid_status) if this unordered_map has
+        ///         been registered with (see \a register_as) or connected to
+        ///         (see \a connect_to) a symbolic name, as other instances
+        ///         would keep using the old layout. Register the
+        ///         unordered_map after rebalancing it instead.
+        ///
+        /// \note Lookups of moved elements whose future is still pending
+        ///       when the moved elements are removed from their old
+        ///       partitions might fail.
+        ///
+        void rebalance_sync(consistent_hash_distribution_policy const& policy)
+        {
+            if (this->valid())
+            {
+                HPX_THROW_EXCEPTION(hpx::invalid_status,
+                    "unordered_map::rebalance_sync",
+                    "cannot rebalance an unordered_map which is registered "
+                    "with or connected to a symbolic name");
+            }
+
+            lcos::local::mutex::scoped_lock rl(rebalance_mtx_);
+
+            std::vector<id_type> localities = policy.get_localities();
+            if (localities.empty())
+                localities.push_back(find_here());
+
+            std::size_t num_parts = policy.get_num_partitions();
+            std::size_t num_localities = localities.size();
+            std::size_t num_parts_per_loc =
+                (num_parts + num_localities - 1) / num_localities;
+
+            distribution_ptr old_data = get_data();
+            partitions_vector_type const& old_partitions =
+                old_data->partitions_;
+
+            // node ids of the existing partitions, these determine the
+            // position of the partitions on the hash ring
+            std::vector<boost::uint64_t> old_node_ids =
+                old_data->ring_.get_node_ids();
+            if (old_node_ids.size() != old_partitions.size())
+            {
+                old_node_ids.resize(old_partitions.size());
+                for (std::size_t i = 0; i != old_node_ids.size(); ++i)
+                    old_node_ids[i] = i;
+            }
+
+            boost::uint64_t next_node_id = 0;
+            for (boost::uint64_t id : old_node_ids)
+                next_node_id = (std::max)(next_node_id, id + 1);
+
+            // keep the existing partitions residing on the requested
+            // localities, create the missing ones
+            std::vector<std::size_t> new_index(
+                old_partitions.size(), std::size_t(-1));
+
+            boost::shared_ptr<distribution_data> new_data =
+                boost::make_shared<distribution_data>();
+            partitions_vector_type& partitions = new_data->partitions_;
+
+            std::vector<boost::uint64_t> node_ids;
+            std::vector<future<std::vector<id_type> > > ids;
+            std::vector<boost::uint32_t> locality_ids;
+
+            for (std::size_t loc = 0; loc != num_localities; ++loc)
+            {
+                boost::uint32_t locality =
+                    naming::get_locality_id_from_id(localities[loc]);
+
+                std::size_t count = 0;
+                for (std::size_t p = 0;
+                     p != old_partitions.size() && count != num_parts_per_loc;
+                     ++p)
+                {
+                    if (new_index[p] == std::size_t(-1) &&
+                        old_partitions[p].locality_id_ == locality)
+                    {
+                        new_index[p] = partitions.size();
+                        partitions.push_back(old_partitions[p]);
+                        node_ids.push_back(old_node_ids[p]);
+                        ++count;
+                    }
+                }
+
+                if (count != num_parts_per_loc)
+                {
+                    ids.push_back(
+                        partition_unordered_map_client::bulk_create_async(
+                            localities[loc], num_parts_per_loc - count,
+                            std::size_t(0), this->hasher_.hash_function(),
+                            this->equal_.key_eq()));
+                    locality_ids.push_back(locality);
+                }
+            }
+
+            boost::uint32_t this_locality = get_locality_id();
+            std::vector<future<void> > ptrs;
+
+            for (std::size_t i = 0; i != ids.size(); ++i)
+            {
+                std::vector<id_type> objs = ids[i].get();
+                for (id_type const& id : objs)
+                {
+                    partitions.push_back(partition_data(id, locality_ids[i]));
+                    node_ids.push_back(next_node_id++);
+
+                    if (locality_ids[i] == this_locality)
+                    {
+                        using util::placeholders::_1;
+                        ptrs.push_back(get_ptr<partition_unordered_map_server>(
+                            id).then(util::bind(
+                                &unordered_map::get_ptr_helper, this,
+                                partitions.size() - 1, std::ref(partitions),
+                                _1)));
+                    }
+                }
+            }
+            wait_all(ptrs);
+
+            new_data->ring_ = hpx::detail::consistent_hash_ring(node_ids,
+                policy.get_num_virtual_nodes());
+
+            // copy all elements changing their owner to the new partitions,
+            // all old partitions are handled concurrently
+            hpx::detail::consistent_hash_ring const& ring = new_data->ring_;
+
+            std::vector<future<std::vector<Key> > > moved;
+            moved.reserve(old_partitions.size());
+            {
+                // no modifications may happen while the elements are copied
+                boost::unique_lock<write_fence> fl(*fence_);
+
+                for (std::size_t p = 0; p != old_partitions.size(); ++p)
+                {
+                    moved.push_back(hpx::async(
+                        [this, p, &old_partitions, &ring, &partitions,
+                            &new_index]() -> std::vector<Key>
+                        {
+                            return this->transfer_moved_values(
+                                old_partitions[p], new_index[p], ring,
+                                partitions);
+                        }));
+                }
+                wait_all(moved);
+
+                // switch over to the new distribution
+                set_data(new_data);
+            }
+
+            // wait for the operations still using the old distribution
+            future<void> released = old_data->released_.get_future();
+            old_data.reset();
+            released.get();
+
+            // remove the moved elements from the partitions which are kept,
+            // the removed partitions go away with their last reference
+            std::vector<future<std::size_t> > erased;
+            for (std::size_t p = 0; p != new_index.size(); ++p)
+            {
+                std::vector<Key> keys = moved[p].get();
+                if (new_index[p] == std::size_t(-1) || keys.empty())
+                    continue;
+
+                partition_data const& part_data = partitions[new_index[p]];
+                if (part_data.local_data_)
+                {
+                    part_data.local_data_->erase_values(keys);
+                    continue;
+                }
+
+                erased.push_back(partition_unordered_map_client(
+                    part_data.partition_).erase_values(keys));
+            }
+            wait_all(erased);
+        }
+
+        /// Asynchronously redistribute the elements of the unordered_map
+        /// according to the given consistent hashing distribution policy.
+        ///
+        /// \param policy The distribution policy describing the new layout
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once the operation is finished.
+        ///
+        /// \note The unordered_map has to be kept alive until the returned
+        ///       future has become ready. See \a rebalance_sync for more
+        ///       details.
+        ///
+        future<void> rebalance(consistent_hash_distribution_policy const& policy)
+        {
+            return hpx::async(
+                [this, policy]()
+                {
+                    this->rebalance_sync(policy);
+                });
+        }
+
+    private:
+        // The operations on a single partition, these work on the given
+        // snapshot of the distribution.
+        T get_value_sync(distribution_data const& d, size_type part,
+            Key const& pos, bool erase) const
+        {
+            HPX_ASSERT(part < d.partitions_.size());
 
-            partition_data const& part_data = partitions_[part];
+            partition_data const& part_data = d.partitions_[part];
+            if (part_data.local_data_)
+                return part_data.local_data_->get_value(pos, erase);
+
+            return partition_unordered_map_client(part_data.partition_)
+                .get_value_sync(pos, erase);
+        }
+
+        future<T> get_value(distribution_data const& d, size_type part,
+            Key const& pos, bool erase) const
+        {
+            HPX_ASSERT(part < d.partitions_.size());
+
+            partition_data const& part_data = d.partitions_[part];
+            if (part_data.local_data_)
+            {
+                return make_ready_future(
+                    part_data.local_data_->get_value(pos, erase));
+            }
+
+            return partition_unordered_map_client(part_data.partition_)
+                .get_value(pos, erase);
+        }
+
+        std::vector<T> get_values_sync(distribution_data const& d,
+            size_type part, std::vector<Key> const& keys) const
+        {
+            HPX_ASSERT(part < d.partitions_.size());
+
+            partition_data const& part_data = d.partitions_[part];
+            if (part_data.local_data_)
+                return part_data.local_data_->get_values(keys);
+
+            return partition_unordered_map_client(part_data.partition_)
+                .get_values_sync(keys);
+        }
+
+        future<std::vector<T> > get_values(distribution_data const& d,
+            size_type part, std::vector<Key> const& keys) const
+        {
+            HPX_ASSERT(part < d.partitions_.size());
+
+            partition_data const& part_data = d.partitions_[part];
+            if (part_data.local_data_)
+                return make_ready_future(part_data.local_data_->get_values(keys));
+
+            return partition_unordered_map_client(part_data.partition_)
+                .get_values(keys);
+        }
+
+        template <typename T_>
+        void set_value_sync(distribution_data const& d, size_type part,
+            Key const& pos, T_ && val)
+        {
+            HPX_ASSERT(part < d.partitions_.size());
+
+            partition_data const& part_data = d.partitions_[part];
+            if (part_data.local_data_)
+            {
+                part_data.local_data_->set_value(pos, std::forward<T_>(val));
+            }
+            else
+            {
+                partition_unordered_map_client(part_data.partition_)
+                    .set_value_sync(pos, std::forward<T_>(val));
+            }
+        }
+
+        template <typename T_>
+        future<void> set_value(distribution_data const& d, size_type part,
+            Key const& pos, T_ && val)
+        {
+            HPX_ASSERT(part < d.partitions_.size());
+
+            partition_data const& part_data = d.partitions_[part];
+            if (part_data.local_data_)
+            {
+                part_data.local_data_->set_value(pos, std::forward<T_>(val));
+                return make_ready_future();
+            }
+
+            return partition_unordered_map_client(part_data.partition_)
+                .set_value(pos, std::forward<T_>(val));
+        }
+
+        future<void> set_values(distribution_data const& d, size_type part,
+            std::vector<Key> const& keys, std::vector<T> const& vals)
+        {
+            HPX_ASSERT(part < d.partitions_.size());
+            HPX_ASSERT(keys.size() == vals.size());
+
+            partition_data const& part_data = d.partitions_[part];
+            if (part_data.local_data_)
+            {
+                part_data.local_data_->set_values(keys, vals);
+                return make_ready_future();
+            }
+
+            return partition_unordered_map_client(part_data.partition_)
+                .set_values(keys, vals);
+        }
+
+        future<std::size_t> erase(distribution_data const& d, size_type part,
+            Key const& key)
+        {
+            HPX_ASSERT(part < d.partitions_.size());
+
+            partition_data const& part_data = d.partitions_[part];
             if (part_data.local_data_)
                 return make_ready_future(part_data.local_data_->erase(key));
 
             return partition_unordered_map_client(
                 part_data.partition_).erase(key);
         }
+
+        // Copy all elements of the given (old) partition which are owned by
+        // a different partition in the new distribution to their new
+        // partitions, return the keys of the copied elements.
+        std::vector<Key> transfer_moved_values(partition_data const& source,
+            std::size_t new_index,
+            hpx::detail::consistent_hash_ring const& ring,
+            partitions_vector_type const& partitions) const
+        {
+            std::vector<std::pair<Key, T> > values;
+            if (source.local_data_)
+                values = source.local_data_->get_moved_values(ring, new_index);
+            else
+            {
+                values = partition_unordered_map_client(source.partition_)
+                    .get_moved_values(ring, new_index).get();
+            }
+
+            // group the elements by their new partition
+            std::vector<std::vector<Key> > part_keys(partitions.size());
+            std::vector<std::vector<T> > part_vals(partitions.size());
+            std::vector<Key> keys;
+            keys.reserve(values.size());
+
+            for (std::pair<Key, T>& v : values)
+            {
+                std::size_t part = ring.get_partition(this->hasher_(v.first));
+                HPX_ASSERT(part != new_index);
+
+                keys.push_back(v.first);
+                part_keys[part].push_back(std::move(v.first));
+                part_vals[part].push_back(std::move(v.second));
+            }
+
+            // issue one request per target partition
+            std::vector<future<void> > part_futures;
+            for (std::size_t part = 0; part != partitions.size(); ++part)
+            {
+                if (part_keys[part].empty())
+                    continue;
+
+                partition_data const& part_data = partitions[part];
+                if (part_data.local_data_)
+                {
+                    part_data.local_data_->set_values(
+                        part_keys[part], part_vals[part]);
+                    continue;
+                }
+
+                part_futures.push_back(
+                    partition_unordered_map_client(part_data.partition_)
+                        .set_values(part_keys[part], part_vals[part]));
+            }
+            wait_all(part_futures);
+
+            return keys;
+        }
     };
 }
 
@@ -23,6 +23,7 @@
 #include <iterator>
 #include <algorithm>
 #include <type_traits>
+#include <utility>
 
 #include <boost/cstdint.hpp>
 
@@ -72,18 +73,49 @@ namespace hpx { namespace server
             }
         };
 
+        // Describes a segment by the sequence number of the partition it is
+        // stored in and its offset inside that partition. This is stored
+        // only if the segments can't be mapped to the partitions cyclically.
+        struct segment_data
+        {
+            segment_data()
+              : part_(0), offset_(0)
+            {}
+
+            segment_data(std::size_t part, std::size_t offset)
+              : part_(part), offset_(offset)
+            {}
+
+            std::size_t part_;
+            std::size_t offset_;
+
+        private:
+            friend class hpx::serialization::access;
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned)
+            {
+                ar & part_ & offset_;
+            }
+        };
+
         vector_config_data()
-          : size_(0)
+          : size_(0), partition_size_(0)
         {}
 
-        vector_config_data(std::size_t size,
-                std::vector<partition_data> && partitions)
+        vector_config_data(std::size_t size, std::size_t partition_size,
+                std::vector<partition_data> && partitions,
+                std::vector<segment_data> && segments)
           : size_(size),
-            partitions_(std::move(partitions))
+            partition_size_(partition_size),
+            partitions_(std::move(partitions)),
+            segments_(std::move(segments))
         {}
 
         std::size_t size_;
+        std::size_t partition_size_;
         std::vector<partition_data> partitions_;
+        std::vector<segment_data> segments_;
 
     private:
         friend class hpx::serialization::access;
@@ -91,7 +123,7 @@ namespace hpx { namespace server
         template <typename Archive>
         void serialize(Archive& ar, unsigned)
         {
-            ar & size_ & partitions_;
+            ar & size_ & partition_size_ & partitions_ & segments_;
         }
     };
 }}
@@ -191,13 +223,21 @@ namespace hpx
         // size, and locality id.
         typedef std::vector<partition_data> partitions_vector_type;
 
+        typedef server::vector_config_data::segment_data segment_data;
+
         size_type size_;                // overall size of the vector
-        size_type partition_size_;      // cached partition size
+        size_type partition_size_;      // cached segment size
 
         // This is the vector representing the base_index and corresponding
         // global ID's of the underlying partition_vectors.
         partitions_vector_type partitions_;
 
+        // The vector is a sequence of segments of size partition_size_ (only
+        // the last one may be shorter). Segment i is stored in partition
+        // i % partitions_.size() at offset (i / partitions_.size()) *
+        // partition_size_, unless the segments are listed here explicitly.
+        std::vector<segment_data> segments_;
+
         // will be set for created (non-attached) objects
         std::string registered_name_;
 
@@ -239,10 +279,84 @@ namespace hpx
             return num_parts ? ((size_ + num_parts - 1) / num_parts) : 0;
         }
 
+        // Return the number of segments of this vector
+        std::size_t get_num_segments() const
+        {
+            std::size_t segment_size = partition_size_;
+            if (partitions_.empty() || segment_size == std::size_t(-1) ||
+                segment_size == 0)
+            {
+                return 0;
+            }
+            return (size_ + segment_size - 1) / segment_size;
+        }
+
+        // Return the sequence number of the segment holding the element with
+        // the given global index
+        std::size_t get_segment(size_type global_index) const
+        {
+            std::size_t segment_size = partition_size_;
+            if (global_index == size_ || segment_size == std::size_t(-1) ||
+                segment_size == 0)
+            {
+                return get_num_segments();
+            }
+            return global_index / segment_size;
+        }
+
+        // Return the sequence number of the partition storing the given
+        // segment
+        std::size_t get_segment_partition(std::size_t segment) const
+        {
+            HPX_ASSERT(!partitions_.empty());
+            if (segments_.empty())
+                return segment % partitions_.size();
+            return segments_[segment].part_;
+        }
+
+        // Return the offset of the given segment inside its partition
+        std::size_t get_segment_offset(std::size_t segment) const
+        {
+            HPX_ASSERT(!partitions_.empty());
+            if (segments_.empty())
+                return (segment / partitions_.size()) * partition_size_;
+            return segments_[segment].offset_;
+        }
+
+        // Return the size of the given segment
+        std::size_t get_segment_size(std::size_t segment) const
+        {
+            return (std::min)(partition_size_,
+                size_ - segment * partition_size_);
+        }
+
+        // Return the sequence number of the segment stored at the given
+        // local index inside the given partition
+        std::size_t get_partition_segment(std::size_t part,
+            size_type local_index) const
+        {
+            std::size_t segment_size = partition_size_;
+            if (segments_.empty())
+            {
+                return (local_index / segment_size) * partitions_.size() +
+                    part;
+            }
+
+            // the segments of a partition are stored consecutively
+            std::size_t segment = 0;
+            while (segment != segments_.size() &&
+                segments_[segment].part_ != part)
+            {
+                ++segment;
+            }
+            return segment + local_index / segment_size;
+        }
+
         std::size_t get_global_index(std::size_t segment,
-            std::size_t part_size, size_type local_index) const
+            size_type local_index) const
         {
-            return segment * part_size + local_index;
+            return segment * partition_size_ + local_index -
+                get_segment_offset(segment);
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -280,7 +394,8 @@ namespace hpx
             }
             wait_all(ptrs);
 
-            partition_size_ = get_partition_size();
+            partition_size_ = data.partition_size_;
+            segments_ = std::move(data.segments_);
             this->base_type::reset(std::move(id));
         }
 
@@ -319,7 +434,10 @@ namespace hpx
             std::copy(partitions_.begin(), partitions_.end(),
                 std::back_inserter(partitions));
 
-            server::vector_config_data data(size_, std::move(partitions));
+            std::vector<segment_data> segments(segments_);
+
+            server::vector_config_data data(size_, partition_size_,
+                std::move(partitions), std::move(segments));
             this->base_type::reset(hpx::new_<
                     components::server::distributed_metadata_base<
                         server::vector_config_data> >(
@@ -334,32 +452,27 @@ namespace hpx
         }
 
     public:
-        // Return the sequence number of the segment corresponding to the
-        // given global index
+        // Return the sequence number of the partition holding the segment
+        // corresponding to the given global index
         std::size_t get_partition(size_type global_index) const
         {
-            if (global_index == size_)
+            std::size_t segment = get_segment(global_index);
+            if (segment == get_num_segments())
                 return partitions_.size();
 
-            std::size_t part_size = partition_size_;
-            if (part_size != 0)
-                return (part_size != size_) ? (global_index / part_size) : 0;
-
-            return partitions_.size();
+            return get_segment_partition(segment);
         }
 
-        // Return the local index inside the segment corresponding to the
-        // given global index
+        // Return the local index inside the partition holding the segment
+        // corresponding to the given global index
         std::size_t get_local_index(size_type global_index) const
         {
-            if (global_index == size_ || partition_size_ == std::size_t(-1) ||
-                partition_size_ == 0)
-            {
+            std::size_t segment = get_segment(global_index);
+            if (segment == get_num_segments())
                 return std::size_t(-1);
-            }
 
-            return (partition_size_ != size_) ?
-                (global_index % partition_size_) : global_index;
+            return get_segment_offset(segment) +
+                global_index % partition_size_;
         }
 
         // Return the local indices inside the segment corresponding to the
@@ -378,15 +491,28 @@ namespace hpx
         std::size_t get_global_index(SegmentIter const& it,
             size_type local_index) const
         {
-            std::size_t part_size = partition_size_;
-            if (part_size == std::size_t(-1) || part_size == 0)
+            if (it.is_at_end())
                 return size_;
 
-            std::size_t segment = it.base() - partitions_.cbegin();
-            if (segment == partitions_.size())
+            return get_global_index(it.get_segment(), local_index);
+        }
+
+        // Return the global index corresponding to the local index inside the
+        // partition referenced by the given local segment iterator.
+        template <typename BaseIter>
+        std::size_t get_global_index(
+            local_segment_vector_iterator<T, BaseIter> const& it,
+            size_type local_index) const
+        {
+            std::size_t part = it.base() - partitions_.cbegin();
+            if (part == partitions_.size())
+                return size_;
+
+            std::size_t segment = get_partition_segment(part, local_index);
+            if (segment >= get_num_segments())
                 return size_;
 
-            return get_global_index(segment, part_size, local_index);
+            return get_global_index(segment, local_index);
         }
 
         template <typename SegmentIter>
@@ -404,9 +530,24 @@ namespace hpx
             std::size_t part = get_partition(global_index);
             if (part == partitions_.size())
             {
-                // return an iterator to the end of the last partition
-                return local_iterator(partitions_.back().partition_,
-                    partitions_.back().size_, partitions_.back().local_data_);
+                std::size_t num_segments = get_num_segments();
+                if (num_segments == 0)
+                {
+                    // an empty vector has no segment to refer to
+                    if (partitions_.empty())
+                        return local_iterator();
+
+                    partition_data const& data = partitions_.front();
+                    return local_iterator(data.partition_, 0, data.local_data_);
+                }
+
+                // return an iterator to the end of the last segment
+                std::size_t last = num_segments - 1;
+                partition_data const& data =
+                    partitions_[get_segment_partition(last)];
+                return local_iterator(data.partition_,
+                    get_segment_offset(last) + get_segment_size(last),
+                    data.local_data_);
             }
 
             std::size_t local_index = get_local_index(global_index);
@@ -423,9 +564,24 @@ namespace hpx
             std::size_t part = get_partition(global_index);
             if (part == partitions_.size())
             {
-                // return an iterator to the end of the last partition
-                return const_local_iterator(partitions_.back().partition_,
-                    partitions_.back().size_, partitions_.back().local_data_);
+                std::size_t num_segments = get_num_segments();
+                if (num_segments == 0)
+                {
+                    // an empty vector has no segment to refer to
+                    if (partitions_.empty())
+                        return const_local_iterator();
+
+                    partition_data const& data = partitions_.front();
+                    return const_local_iterator(data.partition_, 0, data.local_data_);
+                }
+
+                // return an iterator to the end of the last segment
+                std::size_t last = num_segments - 1;
+                partition_data const& data =
+                    partitions_[get_segment_partition(last)];
+                return const_local_iterator(data.partition_,
+                    get_segment_offset(last) + get_segment_size(last),
+                    data.local_data_);
             }
 
             std::size_t local_index = get_local_index(global_index);
@@ -439,21 +595,13 @@ namespace hpx
         // given global index.
         segment_iterator get_segment_iterator(size_type global_index)
         {
-            std::size_t part = get_partition(global_index);
-            if (part == partitions_.size())
-                return segment_iterator(partitions_.end());
-
-            return segment_iterator(partitions_.begin() + part, this);
+            return segment_iterator(this, get_segment(global_index));
         }
 
         const_segment_iterator get_const_segment_iterator(
             size_type global_index) const
         {
-            std::size_t part = get_partition(global_index);
-            if (part == partitions_.size())
-                return const_segment_iterator(partitions_.cend());
-
-            return const_segment_iterator(partitions_.cbegin() + part, this);
+            return const_segment_iterator(this, get_segment(global_index));
         }
 
     protected:
@@ -556,6 +704,166 @@ namespace hpx
             partition_size_ = get_partition_size();
         }
 
+        // Create the partitions with the given sizes on the given localities.
+        template <typename Create>
+        void create_partitions(std::vector<id_type> const& localities,
+            std::vector<std::size_t> const& part_locality,
+            std::vector<std::size_t> const& part_size,
+            std::size_t segment_size, Create && creator)
+        {
+            std::size_t num_parts = part_locality.size();
+
+            // create all partitions concurrently
+            std::vector<future<std::vector<id_type> > > ids;
+            ids.reserve(num_parts);
+            for (std::size_t part = 0; part != num_parts; ++part)
+            {
+                ids.push_back(creator(localities[part_locality[part]],
+                    1, part_size[part]));
+            }
+            hpx::wait_all(ids);
+
+            // now initialize our data structures
+            boost::uint32_t this_locality = get_locality_id();
+            std::vector<future<void> > ptrs;
+
+            partitions_.reserve(num_parts);
+            for (std::size_t part = 0; part != num_parts; ++part)
+            {
+                std::vector<id_type> objs = ids[part].get();
+                HPX_ASSERT(objs.size() == 1);
+
+                boost::uint32_t locality = naming::get_locality_id_from_id(
+                    localities[part_locality[part]]);
+                partitions_.push_back(
+                    partition_data(objs[0], part_size[part], locality));
+
+                if (locality == this_locality)
+                {
+                    using util::placeholders::_1;
+                    ptrs.push_back(get_ptr<partition_vector_server>(
+                        objs[0]).then(
+                            util::bind(&vector::get_ptr_helper, this, part,
+                                std::ref(partitions_), _1)));
+                }
+            }
+
+            wait_all(ptrs);
+
+            // cache our segment size
+            partition_size_ = segment_size;
+        }
+
+        // Block i is stored in partition i % num_parts, the segments are the
+        // blocks.
+        template <typename Create>
+        void create(std::vector<id_type> const& localities,
+            block_cyclic_distribution_policy const& policy, Create && creator)
+        {
+            std::size_t block_size = policy.get_block_size();
+            std::size_t num_blocks = (size_ + block_size - 1) / block_size;
+
+            // an empty vector is represented by one empty partition
+            std::size_t num_parts = (std::max)(std::size_t(1),
+                (std::min)(policy.get_num_partitions(), num_blocks));
+            std::size_t num_localities = localities.size();
+            std::size_t num_parts_per_loc =
+                (num_parts + num_localities - 1) / num_localities;
+
+            std::vector<std::size_t> part_locality(num_parts);
+            for (std::size_t part = 0; part != num_parts; ++part)
+                part_locality[part] = part / num_parts_per_loc;
+
+            // every partition gets num_blocks / num_parts full blocks, the
+            // first few partitions get one more, the last block may be short
+            std::vector<std::size_t> part_size(num_parts,
+                (num_blocks / num_parts) * block_size);
+            if (num_blocks != 0)
+            {
+                for (std::size_t part = 0; part != num_blocks % num_parts;
+                     ++part)
+                {
+                    part_size[part] += block_size;
+                }
+                part_size[(num_blocks - 1) % num_parts] -=
+                    num_blocks * block_size - size_;
+            }
+
+            create_partitions(localities, part_locality, part_size,
+                block_size, std::forward<Create>(creator));
+        }
+
+        // Each locality holds one partition consisting of a number of
+        // consecutive, equally sized segments proportional to its weight.
+        template <typename Create>
+        void create(std::vector<id_type> const& localities,
+            weighted_distribution_policy const& policy, Create && creator)
+        {
+            std::vector<std::size_t> segments_per_loc =
+                policy.get_segments_per_locality();
+            HPX_ASSERT(segments_per_loc.size() == localities.size());
+
+            std::size_t num_segments = 0;
+            for (std::size_t count: segments_per_loc)
+                num_segments += count;
+            HPX_ASSERT(num_segments != 0);
+
+            // rounding up the segment size may leave some of the weighted
+            // segments without any elements, those are not created
+            std::size_t segment_size =
+                (size_ + num_segments - 1) / num_segments;
+            if (segment_size != 0)
+                num_segments = (size_ + segment_size - 1) / segment_size;
+            else
+                num_segments = 0;
+
+            std::vector<std::size_t> part_locality;
+            std::vector<std::size_t> part_size;
+            std::vector<segment_data> segments;
+            segments.reserve(num_segments);
+
+            std::size_t allocated_size = 0;
+            for (std::size_t loc = 0; loc != localities.size(); ++loc)
+            {
+                std::size_t count = (std::min)(segments_per_loc[loc],
+                    num_segments - segments.size());
+                if (count == 0)
+                    continue;
+
+                std::size_t part = part_locality.size();
+                std::size_t offset = 0;
+                for (std::size_t i = 0; i != count; ++i)
+                {
+                    std::size_t size =
+                        (std::min)(segment_size, size_ - allocated_size);
+
+                    segments.push_back(segment_data(part, offset));
+                    offset += size;
+                    allocated_size += size;
+                }
+
+                part_locality.push_back(loc);
+                part_size.push_back(offset);
+            }
+            HPX_ASSERT(allocated_size == size_);
+
+            // an empty vector is represented by one empty partition placed
+            // onto the first locality with a non-zero weight
+            if (part_locality.empty())
+            {
+                std::size_t loc = 0;
+                while (segments_per_loc[loc] == 0)
+                    ++loc;
+
+                part_locality.push_back(loc);
+                part_size.push_back(0);
+            }
+
+            create_partitions(localities, part_locality, part_size,
+                segment_size, std::forward<Create>(creator));
+            segments_ = std::move(segments);
+        }
+
         template <typename DistPolicy>
         void create(std::vector<id_type> const& localities,
             DistPolicy const& policy)
@@ -645,6 +953,7 @@ namespace hpx
             size_ = rhs.size_;
             partition_size_ = rhs.partition_size_;
             std::swap(partitions_, partitions);
+            segments_ = rhs.segments_;
             registered_name_.clear();
         }
 
@@ -752,6 +1061,7 @@ namespace hpx
             size_(rhs.size_),
             partition_size_(rhs.partition_size_),
             partitions_(std::move(rhs.partitions_)),
+            segments_(std::move(rhs.segments_)),
             registered_name_(std::move(rhs.registered_name_))
         {
             rhs.size_ = 0;
@@ -810,6 +1120,7 @@ namespace hpx
                 size_ = rhs.size_;
                 partition_size_ = rhs.partition_size_;
                 partitions_ = std::move(rhs.partitions_);
+                segments_ = std::move(rhs.segments_);
                 registered_name_ = std::move(rhs.registered_name_);
 
                 rhs.size_ = 0;
@@ -938,77 +1249,72 @@ namespace hpx
                 .get_values(pos);
         }
 
-        /// Returns the elements at the positions \a pos
-        /// in the vector container.
+        /// Asynchronously returns the elements at the positions \a pos_vec
+        /// in the vector container (gather).
         ///
-        /// \param pos   Global position of the element in the vector
+        /// The positions are grouped by the partition they belong to and
+        /// all elements residing on the same partition are retrieved using
+        /// a single action. All partitions are accessed concurrently.
         ///
-        /// \return Returns the value of the element at position represented by
-        ///         \a pos.
+        /// \param pos_vec   Global positions of the elements in the vector,
+        ///                  these don't have to be sorted
+        ///
+        /// \return Returns the hpx::future to the values of the elements at
+        ///         the positions represented by \a pos_vec (in the same
+        ///         order).
         ///
         future<std::vector<T> >
         get_values(std::vector<size_type> const & pos_vec) const
         {
             // check if position vector is empty
-            // the following code needs at least one element.
             if (pos_vec.empty())
                 return make_ready_future(std::vector<T>());
 
-            // current partition index of the block
-            size_type part_cur = get_partition(pos_vec[0]);
+            // group the indices by partition, remember where each of the
+            // values has to go in the result
+            std::vector<std::vector<size_type> > local_indices(
+                partitions_.size());
+            std::vector<std::vector<size_type> > positions(partitions_.size());
 
-            // iterator to the begin of current block
-            std::vector<size_type>::const_iterator part_begin = pos_vec.begin();
+            for (size_type i = 0; i != pos_vec.size(); ++i)
+            {
+                size_type part = get_partition(pos_vec[i]);
+                HPX_ASSERT(part < partitions_.size());
+
+                local_indices[part].push_back(get_local_index(pos_vec[i]));
+                positions[part].push_back(i);
+            }
 
-            // vector holding futures of the values for all blocks
+            // issue one request per partition
             std::vector<future<std::vector<T> > > part_values_future;
-            for (std::vector<size_type>::const_iterator it = pos_vec.begin();
-                 it != pos_vec.end(); ++it)
+            std::vector<std::vector<size_type> > part_positions;
+            for (size_type part = 0; part != partitions_.size(); ++part)
             {
-                // get the partition of the current position
-                size_type part = get_partition(*it);
-
-                // if the partition of the current position is the same
-                // as the rest of the current block go to next position
-                if (part == part_cur)
+                if (local_indices[part].empty())
                     continue;
 
-                // if the partition of the current position is NOT the same
-                // as the positions before the block ends here
-                else
-                {
-                    // this is the end of a block containing indexes ('pos')
-                    // of the same partition ('part').
-                    // get async values for this block
-                    part_values_future.push_back(get_values(part_cur,
-                        get_local_indices(std::vector<size_type>(part_begin, it))));
-
-                    // reset block variables to start a new one from here
-                    part_cur = part;
-                    part_begin = it;
-                }
+                part_values_future.push_back(
+                    get_values(part, local_indices[part]));
+                part_positions.push_back(std::move(positions[part]));
             }
 
-            // the end of the vector is also an end of a block
-            // get async values for this block
-            part_values_future.push_back(get_values(part_cur,
-                get_local_indices(std::vector<size_type>(
-                    part_begin, pos_vec.end()))));
-
             // This helper function unwraps the vectors from each partition
-            // and merge them to one vector
+            // and places the values at their original positions
+            size_type count = pos_vec.size();
             auto merge_func =
-                [&pos_vec](std::vector<future<std::vector<T> > > && part_values_f)
+                [count](std::vector<future<std::vector<T> > > && part_values_f,
+                    std::vector<std::vector<size_type> > && part_positions)
                     -> std::vector<T>
                 {
-                    std::vector<T> values;
-                    values.reserve(pos_vec.size());
-
-                    for (future<std::vector<T> >& part_f: part_values_f)
+                    std::vector<T> values(count);
+                    for (size_type i = 0; i != part_values_f.size(); ++i)
                     {
-                        std::vector<T> part_values = part_f.get();
-                        std::move(part_values.begin(), part_values.end(),
-                            std::back_inserter(values));
+                        std::vector<T> part_values = part_values_f[i].get();
+                        std::vector<size_type> const& pos = part_positions[i];
+
+                        HPX_ASSERT(part_values.size() == pos.size());
+                        for (size_type j = 0; j != pos.size(); ++j)
+                            values[pos[j]] = std::move(part_values[j]);
                     }
                     return values;
                 };
@@ -1016,7 +1322,7 @@ namespace hpx
             // when all values are here merge them to one vector
             // and return a future to this vector
             return lcos::local::dataflow(launch::async, merge_func,
-                std::move(part_values_future));
+                std::move(part_values_future), std::move(part_positions));
         }
 
         /// Returns the elements at the positions \a pos
@@ -1253,7 +1559,7 @@ namespace hpx
         void set_values_sync(size_type part, std::vector<size_type> const& pos,
             std::vector<T> const& val)
         {
-            set_value(pos, val).get();
+            set_values(part, pos, val).get();
         }
 
         /// Asynchronously set the element at position \a pos in
@@ -1282,11 +1588,17 @@ namespace hpx
                 .set_values(pos, val);
         }
 
-        /// Asynchronously set the element at position \a pos
-        /// to the given value \a val.
+        /// Asynchronously set the elements at the positions \a pos to the
+        /// given values \a val (scatter).
         ///
-        /// \param pos   Global position of the element in the vector
-        /// \param val   The value to be copied
+        /// The positions are grouped by the partition they belong to and
+        /// all elements residing on the same partition are updated using
+        /// a single action. All partitions are accessed concurrently.
+        ///
+        /// \param pos   Global positions of the elements in the vector,
+        ///              these don't have to be sorted
+        /// \param val   The values to be copied, \a val[i] is stored at
+        ///              \a pos[i]
         ///
         /// \return This returns the hpx::future of type void which gets ready
         ///         once the operation is finished.
@@ -1297,66 +1609,41 @@ namespace hpx
             HPX_ASSERT(pos.size() == val.size());
 
             // check if position vector is empty
-            // the following code needs at least one element.
             if (pos.empty())
                 return make_ready_future();
 
-            // partition index of the current block
-            size_type part_cur = get_partition(pos[0]);
+            // group the indices and values by partition
+            std::vector<std::vector<size_type> > local_indices(
+                partitions_.size());
+            std::vector<std::vector<T> > values(partitions_.size());
 
-            // iterator to the begin of current block
-            std::vector<size_type>::const_iterator pos_block_begin = pos.begin();
-            typename std::vector<T>::const_iterator val_block_begin = val.begin();
+            for (size_type i = 0; i != pos.size(); ++i)
+            {
+                size_type part = get_partition(pos[i]);
+                HPX_ASSERT(part < partitions_.size());
 
-            // vector holding futures of the state for all blocks
-            std::vector<future<void> > part_futures;
+                local_indices[part].push_back(get_local_index(pos[i]));
+                values[part].push_back(val[i]);
+            }
 
-            // going through the position vector
-            std::vector<size_type>::const_iterator pos_it = pos.begin();
-            typename std::vector<T>::const_iterator val_it = val.begin();
-            for (/**/; pos_it != pos.end(); ++pos_it, ++val_it)
+            // issue one request per partition
+            std::vector<future<void> > part_futures;
+            for (size_type part = 0; part != partitions_.size(); ++part)
             {
-                // get the partition of the current position
-                size_type part = get_partition(*pos_it);
-
-                // if the partition of the current position is the same
-                // as the rest of the current block go to next position
-                if (part == part_cur)
+                if (local_indices[part].empty())
                     continue;
 
-                // if the partition of the current position is NOT the same
-                // as the positions before the block ends here
-                else
-                {
-                    // this is the end of a block containing indexes ('pos')
-                    // of the same partition ('part').
-                    // set asynchronous values for this block
-                    part_futures.push_back(set_values(part_cur,
-                        get_local_indices(std::vector<size_type>(
-                            pos_block_begin, pos_it)),
-                        std::vector<T>(val_block_begin, val_it)));
-
-                    // reset block variables to start a new one from here
-                    part_cur = part;
-                    pos_block_begin = pos_it;
-                    val_block_begin = val_it;
-                }
+                part_futures.push_back(set_values(part,
+                    local_indices[part], values[part]));
             }
 
-            // the end of the vector is also an end of a block
-            // get asynchronous values for this block
-            part_futures.push_back(set_values(part_cur,
-                get_local_indices(std::vector<size_type>(
-                    pos_block_begin, pos.end())),
-                std::vector<T>(val_block_begin, val.end())));
-
             return when_all(part_futures);
         }
 
         void set_values_sync(std::vector<size_type> const& pos,
             std::vector<T> const& val)
         {
-            return set_value(pos, val).get();
+            return set_values(pos, val).get();
         }
 
 //             //CLEAR
@@ -1505,32 +1792,32 @@ namespace hpx
         // Return global segment iterator
         segment_iterator segment_begin()
         {
-            return segment_iterator(partitions_.begin(), this);
+            return segment_iterator(this, 0);
         }
 
         const_segment_iterator segment_begin() const
         {
-            return const_segment_iterator(partitions_.cbegin(), this);
+            return const_segment_iterator(this, 0);
         }
 
         const_segment_iterator segment_cbegin() const //-V524
         {
-            return const_segment_iterator(partitions_.cbegin(), this);
+            return const_segment_iterator(this, 0);
         }
 
         segment_iterator segment_end()
         {
-            return segment_iterator(partitions_.end());
+            return segment_iterator(this, get_num_segments());
         }
 
         const_segment_iterator segment_end() const
         {
-            return const_segment_iterator(partitions_.cend());
+            return const_segment_iterator(this, get_num_segments());
         }
 
         const_segment_iterator segment_cend() const //-V524
         {
-            return const_segment_iterator(partitions_.cend());
+            return const_segment_iterator(this, get_num_segments());
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -10,10 +10,211 @@
 #include <hpx/include/util.hpp>
 #include <hpx/components/containers/distribution_policy.hpp>
 
+#include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/runtime/serialization/vector.hpp>
+
+#include <algorithm>
+#include <cstddef>
 #include <type_traits>
+#include <vector>
+
+#include <boost/math/common_factor_rt.hpp>
 
 namespace hpx
 {
+    ///////////////////////////////////////////////////////////////////////////
+    // This class specifies the block-cyclic distribution policy to use for
+    // the partitioning of the data in a hpx::vector. The elements are split
+    // into blocks of the given size which are dealt out to the partitions in
+    // a round robin fashion, block i is stored in partition
+    // i % num_partitions. A block size of one results in a purely cyclic
+    // distribution.
+    struct block_cyclic_distribution_policy
+    {
+    public:
+        block_cyclic_distribution_policy()
+          : block_size_(1), num_partitions_(std::size_t(-1))
+        {}
+
+        block_cyclic_distribution_policy operator()(
+            std::size_t block_size) const
+        {
+            return block_cyclic_distribution_policy(block_size,
+                num_partitions_, localities_);
+        }
+
+        block_cyclic_distribution_policy operator()(std::size_t block_size,
+            std::size_t num_partitions) const
+        {
+            return block_cyclic_distribution_policy(block_size,
+                num_partitions, localities_);
+        }
+
+        block_cyclic_distribution_policy operator()(std::size_t block_size,
+            std::vector<id_type> const& localities) const
+        {
+            return block_cyclic_distribution_policy(block_size,
+                num_partitions_, localities);
+        }
+
+        block_cyclic_distribution_policy operator()(std::size_t block_size,
+            std::size_t num_partitions,
+            std::vector<id_type> const& localities) const
+        {
+            return block_cyclic_distribution_policy(block_size,
+                num_partitions, localities);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        std::vector<id_type> const& get_localities() const
+        {
+            return localities_;
+        }
+
+        std::size_t get_num_partitions() const
+        {
+            std::size_t num_parts = (num_partitions_ == std::size_t(-1)) ?
+                localities_.size() : num_partitions_;
+            return (std::max)(num_parts, std::size_t(1));
+        }
+
+        std::size_t get_block_size() const
+        {
+            return block_size_;
+        }
+
+    private:
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive & ar, const unsigned int version)
+        {
+            ar & localities_ & block_size_ & num_partitions_;
+        }
+
+        block_cyclic_distribution_policy(std::size_t block_size,
+                std::size_t num_partitions,
+                std::vector<id_type> const& localities)
+          : localities_(localities),
+            block_size_((std::max)(block_size, std::size_t(1))),
+            num_partitions_(num_partitions)
+        {}
+
+    private:
+        std::vector<id_type> localities_;   // localities to create chunks on
+        std::size_t block_size_;            // number of elements per block
+        std::size_t num_partitions_;        // number of chunks to create
+    };
+
+    static block_cyclic_distribution_policy const block_cyclic_layout;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // This class specifies the weighted distribution policy to use for the
+    // partitioning of the data in a hpx::vector. One partition is created on
+    // each of the given localities, the size of which is proportional to the
+    // weight given for this locality (for instance its number of cores or
+    // its amount of memory).
+    struct weighted_distribution_policy
+    {
+    public:
+        // The weights are reduced to at most this number of (equally sized)
+        // segments. This limits the number of segments the segmented
+        // algorithms have to handle for weights with no common divisor.
+        static const std::size_t max_segments = 1024;
+
+        weighted_distribution_policy() {}
+
+        weighted_distribution_policy operator()(
+            std::vector<id_type> const& localities) const
+        {
+            return weighted_distribution_policy(localities,
+                std::vector<std::size_t>());
+        }
+
+        weighted_distribution_policy operator()(
+            std::vector<id_type> const& localities,
+            std::vector<std::size_t> const& weights) const
+        {
+            HPX_ASSERT(weights.empty() || weights.size() == localities.size());
+            return weighted_distribution_policy(localities, weights);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        std::vector<id_type> const& get_localities() const
+        {
+            return localities_;
+        }
+
+        std::size_t get_num_partitions() const
+        {
+            return (std::max)(localities_.size(), std::size_t(1));
+        }
+
+        std::vector<std::size_t> const& get_weights() const
+        {
+            return weights_;
+        }
+
+        // Return the number of equally sized segments to place onto each of
+        // the localities. The weights are reduced by their greatest common
+        // divisor and scaled down if necessary.
+        std::vector<std::size_t> get_segments_per_locality() const
+        {
+            std::size_t num_parts = get_num_partitions();
+            if (weights_.empty())
+                return std::vector<std::size_t>(num_parts, 1);
+
+            std::size_t divisor = 0;
+            for (std::size_t w : weights_)
+                divisor = boost::math::gcd(divisor, w);
+
+            std::vector<std::size_t> segments(weights_);
+            if (divisor == 0)
+                return std::vector<std::size_t>(num_parts, 1);
+
+            std::size_t sum = 0;
+            for (std::size_t& s : segments)
+            {
+                s /= divisor;
+                sum += s;
+            }
+
+            if (sum > max_segments)
+            {
+                for (std::size_t& s : segments)
+                {
+                    if (s != 0)
+                    {
+                        s = (std::max)(std::size_t(1),
+                            std::size_t(double(s) * max_segments / sum));
+                    }
+                }
+            }
+            return segments;
+        }
+
+    private:
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive & ar, const unsigned int version)
+        {
+            ar & localities_ & weights_;
+        }
+
+        weighted_distribution_policy(std::vector<id_type> const& localities,
+                std::vector<std::size_t> const& weights)
+          : localities_(localities),
+            weights_(weights)
+        {}
+
+    private:
+        std::vector<id_type> localities_;   // localities to create chunks on
+        std::vector<std::size_t> weights_;  // relative weight of each locality
+    };
+
+    static weighted_distribution_policy const weighted_layout;
+
     ///////////////////////////////////////////////////////////////////////////
     namespace detail
     {
@@ -27,6 +228,16 @@ namespace hpx
         struct is_vector_distribution_policy<distribution_policy>
           : std::true_type
         {};
+
+        template <>
+        struct is_vector_distribution_policy<block_cyclic_distribution_policy>
+          : std::true_type
+        {};
+
+        template <>
+        struct is_vector_distribution_policy<weighted_distribution_policy>
+          : std::true_type
+        {};
         // \endcond
     }
 
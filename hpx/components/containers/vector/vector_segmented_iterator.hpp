@@ -441,62 +441,205 @@ namespace hpx
     };
 
     ///////////////////////////////////////////////////////////////////////////
-    /// This class implement the segmented iterator for the hpx::vector
+    /// This class implement the segmented iterator for the hpx::vector. It
+    /// visits the segments in the order of their global indices, where a
+    /// partition may store more than one segment. Dereferencing it yields
+    /// the data of the partition the current segment is stored in.
     template <typename T, typename BaseIter>
     class segment_vector_iterator
-      : public boost::iterator_adaptor<
-            segment_vector_iterator<T, BaseIter>, BaseIter
+      : public boost::iterator_facade<
+            segment_vector_iterator<T, BaseIter>,
+            typename std::iterator_traits<BaseIter>::value_type,
+            std::random_access_iterator_tag,
+            typename std::iterator_traits<BaseIter>::reference
         >
     {
     private:
-        typedef boost::iterator_adaptor<
-                segment_vector_iterator<T, BaseIter>, BaseIter
+        typedef boost::iterator_facade<
+                segment_vector_iterator<T, BaseIter>,
+                typename std::iterator_traits<BaseIter>::value_type,
+                std::random_access_iterator_tag,
+                typename std::iterator_traits<BaseIter>::reference
             > base_type;
 
     public:
-        segment_vector_iterator(BaseIter const& it, vector<T>* data = 0)
-          : base_type(it), data_(data)
+        segment_vector_iterator(vector<T>* data = 0, std::size_t segment = 0)
+          : data_(data), segment_(segment)
         {}
 
         vector<T>* get_data() { return data_; }
         vector<T> const* get_data() const { return data_; }
 
+        // Return the sequence number of the referenced segment
+        std::size_t get_segment() const { return segment_; }
+
+        // Return the iterator referencing the partition the current segment
+        // is stored in
+        BaseIter base() const
+        {
+            HPX_ASSERT(data_);
+            if (is_at_end())
+                return data_->partitions_.end();
+            return data_->partitions_.begin() +
+                data_->get_segment_partition(segment_);
+        }
+
+        // Return the offset of the current segment inside its partition
+        std::size_t get_local_offset() const
+        {
+            HPX_ASSERT(!is_at_end());
+            return data_->get_segment_offset(segment_);
+        }
+
+        // Return the size of the current segment
+        std::size_t get_size() const
+        {
+            HPX_ASSERT(!is_at_end());
+            return data_->get_segment_size(segment_);
+        }
+
         bool is_at_end() const
         {
-            return data_ == 0 ||
-                this->base_type::base_reference() == data_->partitions_.end();
+            return data_ == 0 || segment_ == data_->get_num_segments();
+        }
+
+    private:
+        friend class boost::iterator_core_access;
+
+        bool equal(segment_vector_iterator const& other) const
+        {
+            return data_ == other.data_ && segment_ == other.segment_;
+        }
+
+        typename base_type::reference dereference() const
+        {
+            HPX_ASSERT(!is_at_end());
+            return *base();
+        }
+
+        void increment()
+        {
+            ++segment_;
+        }
+
+        void decrement()
+        {
+            --segment_;
+        }
+
+        void advance(std::ptrdiff_t n)
+        {
+            segment_ += n;
+        }
+
+        std::ptrdiff_t distance_to(segment_vector_iterator const& other) const
+        {
+            HPX_ASSERT(data_ == other.data_);
+            return std::ptrdiff_t(other.segment_) - std::ptrdiff_t(segment_);
         }
 
     private:
         vector<T>* data_;
+        std::size_t segment_;
     };
 
     template <typename T, typename BaseIter>
     class const_segment_vector_iterator
-      : public boost::iterator_adaptor<
-            const_segment_vector_iterator<T, BaseIter>, BaseIter
+      : public boost::iterator_facade<
+            const_segment_vector_iterator<T, BaseIter>,
+            typename std::iterator_traits<BaseIter>::value_type,
+            std::random_access_iterator_tag,
+            typename std::iterator_traits<BaseIter>::reference
         >
     {
     private:
-        typedef boost::iterator_adaptor<
-                const_segment_vector_iterator<T, BaseIter>, BaseIter
+        typedef boost::iterator_facade<
+                const_segment_vector_iterator<T, BaseIter>,
+                typename std::iterator_traits<BaseIter>::value_type,
+                std::random_access_iterator_tag,
+                typename std::iterator_traits<BaseIter>::reference
             > base_type;
 
     public:
-        const_segment_vector_iterator(BaseIter const& it, vector<T> const* data = 0)
-          : base_type(it), data_(data)
+        const_segment_vector_iterator(vector<T> const* data = 0,
+                std::size_t segment = 0)
+          : data_(data), segment_(segment)
         {}
 
         vector<T> const* get_data() const { return data_; }
 
+        // Return the sequence number of the referenced segment
+        std::size_t get_segment() const { return segment_; }
+
+        // Return the iterator referencing the partition the current segment
+        // is stored in
+        BaseIter base() const
+        {
+            HPX_ASSERT(data_);
+            if (is_at_end())
+                return data_->partitions_.end();
+            return data_->partitions_.begin() +
+                data_->get_segment_partition(segment_);
+        }
+
+        // Return the offset of the current segment inside its partition
+        std::size_t get_local_offset() const
+        {
+            HPX_ASSERT(!is_at_end());
+            return data_->get_segment_offset(segment_);
+        }
+
+        // Return the size of the current segment
+        std::size_t get_size() const
+        {
+            HPX_ASSERT(!is_at_end());
+            return data_->get_segment_size(segment_);
+        }
+
         bool is_at_end() const
         {
-            return data_ == 0 ||
-                this->base_type::base_reference() == data_->partitions_.end();
+            return data_ == 0 || segment_ == data_->get_num_segments();
+        }
+
+    private:
+        friend class boost::iterator_core_access;
+
+        bool equal(const_segment_vector_iterator const& other) const
+        {
+            return data_ == other.data_ && segment_ == other.segment_;
+        }
+
+        typename base_type::reference dereference() const
+        {
+            HPX_ASSERT(!is_at_end());
+            return *base();
+        }
+
+        void increment()
+        {
+            ++segment_;
+        }
+
+        void decrement()
+        {
+            --segment_;
+        }
+
+        void advance(std::ptrdiff_t n)
+        {
+            segment_ += n;
+        }
+
+        std::ptrdiff_t distance_to(
+            const_segment_vector_iterator const& other) const
+        {
+            HPX_ASSERT(data_ == other.data_);
+            return std::ptrdiff_t(other.segment_) - std::ptrdiff_t(segment_);
         }
 
     private:
         vector<T> const* data_;
+        std::size_t segment_;
     };
 
     ///////////////////////////////////////////////////////////////////////////
@@ -792,30 +935,42 @@ namespace hpx { namespace traits
         }
 
         //  This function should specify the local iterator which is at the
-        //  beginning of the partition.
+        //  beginning of the segment.
         static local_iterator begin(segment_iterator seg_iter)
         {
             std::size_t offset = 0;
             if (seg_iter.is_at_end())
             {
+                // an empty vector has no segment to refer to
+                if (seg_iter.get_segment() == 0)
+                    return local_iterator();
+
                 // return iterator to the end of last segment
                 --seg_iter;
-                offset = seg_iter.base()->size_;
+                offset = seg_iter.get_size();
             }
 
-            return local_iterator(seg_iter.base()->partition_, offset,
-                seg_iter.base()->local_data_);
+            return local_iterator(seg_iter->partition_,
+                seg_iter.get_local_offset() + offset,
+                seg_iter->local_data_);
         }
 
         //  This function should specify the local iterator which is at the
-        //  end of the partition.
+        //  end of the segment.
         static local_iterator end(segment_iterator seg_iter)
         {
             if (seg_iter.is_at_end())
+            {
+                // an empty vector has no segment to refer to
+                if (seg_iter.get_segment() == 0)
+                    return local_iterator();
+
                 --seg_iter;     // return iterator to the end of last segment
+            }
 
-            return local_iterator(seg_iter.base()->partition_,
-                seg_iter.base()->size_, seg_iter.base()->local_data_);
+            return local_iterator(seg_iter->partition_,
+                seg_iter.get_local_offset() + seg_iter.get_size(),
+                seg_iter->local_data_);
         }
 
         //  This function should specify the local iterator which is at the
@@ -879,30 +1034,42 @@ namespace hpx { namespace traits
         }
 
         //  This function should specify the local iterator which is at the
-        //  beginning of the partition.
+        //  beginning of the segment.
         static local_iterator begin(segment_iterator seg_iter)
         {
             std::size_t offset = 0;
             if (seg_iter.is_at_end())
             {
+                // an empty vector has no segment to refer to
+                if (seg_iter.get_segment() == 0)
+                    return local_iterator();
+
                 // return iterator to the end of last segment
                 --seg_iter;
-                offset = seg_iter.base()->size_;
+                offset = seg_iter.get_size();
             }
 
-            return local_iterator(seg_iter.base()->partition_, offset,
-                seg_iter.base()->local_data_);
+            return local_iterator(seg_iter->partition_,
+                seg_iter.get_local_offset() + offset,
+                seg_iter->local_data_);
         }
 
         //  This function should specify the local iterator which is at the
-        //  end of the partition.
+        //  end of the segment.
         static local_iterator end(segment_iterator seg_iter)
         {
             if (seg_iter.is_at_end())
+            {
+                // an empty vector has no segment to refer to
+                if (seg_iter.get_segment() == 0)
+                    return local_iterator();
+
                 --seg_iter;     // return iterator to the end of last segment
+            }
 
-            return local_iterator(seg_iter.base()->partition_,
-                seg_iter.base()->size_, seg_iter.base()->local_data_);
+            return local_iterator(seg_iter->partition_,
+                seg_iter.get_local_offset() + seg_iter.get_size(),
+                seg_iter->local_data_);
         }
 
         //  This function should specify the local iterator which is at the
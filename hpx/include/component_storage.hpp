@@ -6,6 +6,7 @@
 #if !defined(HPX_MIGRATE_TO_STORAGE_FEB_06_2014_0957AM)
 #define HPX_MIGRATE_TO_STORAGE_FEB_06_2014_0957AM
 
+#include <hpx/components/component_storage/checkpoint.hpp>
 #include <hpx/components/component_storage/component_storage.hpp>
 #include <hpx/components/component_storage/migrate_from_storage.hpp>
 #include <hpx/components/component_storage/migrate_to_storage.hpp>
@@ -14,6 +14,7 @@
 
 #include <hpx/lcos/queue.hpp>
 #include <hpx/lcos/barrier.hpp>
+#include <hpx/lcos/hierarchical_barrier.hpp>
 #include <hpx/lcos/reduce.hpp>
 
 #include <hpx/include/local_lcos.hpp>
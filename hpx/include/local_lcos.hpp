@@ -8,13 +8,17 @@
 #define HPX_6EB418B5_DC41_45A3_ADF4_C45A068F73D4
 
 #include <hpx/hpx_fwd.hpp>
+#include <hpx/lcos/local/adaptive_mutex.hpp>
 #include <hpx/lcos/local/barrier.hpp>
+#include <hpx/lcos/local/bounded_channel.hpp>
 #include <hpx/lcos/local/condition_variable.hpp>
 #include <hpx/lcos/local/counting_semaphore.hpp>
 #include <hpx/lcos/local/dataflow.hpp>
 #include <hpx/lcos/local/event.hpp>
+#include <hpx/lcos/local/full_empty_array.hpp>
 #include <hpx/lcos/local/mutex.hpp>
 #include <hpx/lcos/local/shared_mutex.hpp>
+#include <hpx/lcos/local/scalable_shared_mutex.hpp>
 #include <hpx/lcos/local/recursive_mutex.hpp>
 
 #include <hpx/lcos/future.hpp>
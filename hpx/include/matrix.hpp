@@ -0,0 +1,12 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_MATRIX_OCT_06_2015_1108AM)
+#define HPX_MATRIX_OCT_06_2015_1108AM
+
+#include <hpx/components/containers/matrix/matrix.hpp>
+
+#endif
+
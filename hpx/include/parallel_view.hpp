@@ -0,0 +1,11 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_VIEW_AUG_10_2015_1040AM)
+#define HPX_PARALLEL_VIEW_AUG_10_2015_1040AM
+
+#include <hpx/parallel/view.hpp>
+
+#endif
@@ -0,0 +1,681 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file all_reduce.hpp
+
+#if !defined(HPX_LCOS_ALL_REDUCE_OCT_12_2015_0211PM)
+#define HPX_LCOS_ALL_REDUCE_OCT_12_2015_0211PM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/wait_all.hpp>
+#include <hpx/lcos/detail/buffer_slice.hpp>
+#include <hpx/lcos/local/promise.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/runtime/actions/component_action.hpp>
+#include <hpx/runtime/applier/apply.hpp>
+#include <hpx/runtime/components/new.hpp>
+#include <hpx/runtime/components/server/simple_component_base.hpp>
+#include <hpx/runtime/get_ptr.hpp>
+#include <hpx/runtime/naming/id_type.hpp>
+#include <hpx/runtime/serialization/serialize_buffer.hpp>
+#include <hpx/util/scoped_unlock.hpp>
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/noncopyable.hpp>
+#include <boost/preprocessor/cat.hpp>
+#include <boost/shared_ptr.hpp>
+
+namespace hpx { namespace lcos
+{
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // One step of a reduction schedule. In each step a site sends at
+        // most one block and receives at most one block. The steps are
+        // numbered the same way on all sites, messages are matched by the
+        // number of the step.
+        struct reduction_step
+        {
+            static std::size_t const npos = std::size_t(-1);
+
+            std::size_t send_to;        // site to send to (or npos)
+            std::size_t send_block;     // block to send
+            std::size_t recv_block;     // block to receive (or npos)
+            bool reduce;                // combine or replace received block
+            bool recv_first;            // received data is left operand
+        };
+
+        // Recursive doubling operating on the whole buffer: log2(N) rounds,
+        // in round r sites exchange their data with the site whose index
+        // differs in bit r. If N is not a power of two, the sites beyond the
+        // largest power of two first fold their data into their partner,
+        // and receive the result from it at the end.
+        inline std::vector<reduction_step>
+        recursive_doubling_schedule(std::size_t num_sites, std::size_t site)
+        {
+            std::size_t const npos = reduction_step::npos;
+
+            std::size_t pof2 = 1;
+            std::size_t rounds = 0;
+            while (pof2 * 2 <= num_sites)
+            {
+                pof2 *= 2;
+                ++rounds;
+            }
+            std::size_t rem = num_sites - pof2;
+
+            std::vector<reduction_step> steps;
+            steps.reserve(rounds + 2);
+
+            // fold
+            reduction_step fold = { npos, 0, npos, true, false };
+            if (site >= pof2)
+                fold.send_to = site - pof2;
+            else if (site < rem)
+                fold.recv_block = 0;
+            steps.push_back(fold);
+
+            // exchange
+            for (std::size_t r = 0; r != rounds; ++r)
+            {
+                reduction_step s = { npos, 0, npos, true, false };
+                if (site < pof2)
+                {
+                    std::size_t partner = site ^ (std::size_t(1) << r);
+                    s.send_to = partner;
+                    s.recv_block = 0;
+                    s.recv_first = partner < site;
+                }
+                steps.push_back(s);
+            }
+
+            // unfold
+            reduction_step unfold = { npos, 0, npos, false, false };
+            if (site < rem)
+                unfold.send_to = site + pof2;
+            else if (site >= pof2)
+                unfold.recv_block = 0;
+            steps.push_back(unfold);
+
+            return steps;
+        }
+
+        // Ring algorithm operating on N blocks: in N - 1 steps the partial
+        // results of each block travel around the ring, after which site i
+        // holds the result for block i (reduce-scatter). If requested, the
+        // result blocks then travel around the ring once more (allgather).
+        inline std::vector<reduction_step>
+        ring_schedule(std::size_t num_sites, std::size_t site, bool allgather)
+        {
+            std::size_t next = (site + 1) % num_sites;
+
+            std::vector<reduction_step> steps;
+            steps.reserve(2 * num_sites);
+
+            for (std::size_t s = 0; s + 1 < num_sites; ++s)
+            {
+                reduction_step step = {
+                    next,
+                    (site + 2 * num_sites - s - 1) % num_sites,
+                    (site + 2 * num_sites - s - 2) % num_sites,
+                    true, true
+                };
+                steps.push_back(step);
+            }
+
+            if (allgather)
+            {
+                for (std::size_t s = 0; s + 1 < num_sites; ++s)
+                {
+                    reduction_step step = {
+                        next,
+                        (site + num_sites - s) % num_sites,
+                        (site + 2 * num_sites - s - 1) % num_sites,
+                        false, false
+                    };
+                    steps.push_back(step);
+                }
+            }
+
+            return steps;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        enum reduction_operation
+        {
+            all_reduce_operation = 0,
+            reduce_scatter_operation = 1
+        };
+
+        // The part of a reduction_group living on one of the sites. The
+        // contributions of all threads on this site are combined first, the
+        // sites then execute the steps of their schedule driven by the
+        // arriving messages.
+        //
+        // As no site can be more than one generation ahead of any other
+        // site, the received messages are kept for two generations (indexed
+        // by the parity of the generation).
+        template <typename T, typename Op>
+        class all_reduce_server
+          : public components::simple_component_base<all_reduce_server<T, Op> >
+        {
+        private:
+            typedef lcos::local::spinlock mutex_type;
+            typedef serialization::serialize_buffer<T> buffer_type;
+            typedef std::map<std::size_t, buffer_type> received_type;
+
+        public:
+            all_reduce_server()
+              : num_sites_(1), this_site_(0), num_local_(1),
+                ring_threshold_(0)
+            {
+                HPX_ASSERT(false);  // shouldn't ever be called
+            }
+
+            all_reduce_server(std::size_t num_sites, std::size_t this_site,
+                    std::size_t num_local, Op const& op,
+                    std::size_t ring_threshold)
+              : op_(op), num_sites_(num_sites), this_site_(this_site),
+                num_local_(num_local), ring_threshold_(ring_threshold),
+                operation_(all_reduce_operation), generation_(0), size_(0),
+                step_(0), step_sent_(false), active_(false), running_(false),
+                result_block_(reduction_step::npos)
+            {
+                HPX_ASSERT(this_site_ < num_sites_ && num_local_ != 0);
+            }
+
+            ///////////////////////////////////////////////////////////////////
+            // The sites this site may send messages to
+            std::vector<std::size_t> get_peer_sites() const
+            {
+                std::vector<reduction_step> rd =
+                    recursive_doubling_schedule(num_sites_, this_site_);
+                std::vector<reduction_step> ring =
+                    ring_schedule(num_sites_, this_site_, false);
+
+                std::vector<std::size_t> sites;
+                for (reduction_step const& s : rd)
+                {
+                    if (s.send_to != reduction_step::npos)
+                        sites.push_back(s.send_to);
+                }
+                for (reduction_step const& s : ring)
+                {
+                    if (s.send_to != reduction_step::npos)
+                        sites.push_back(s.send_to);
+                }
+
+                std::sort(sites.begin(), sites.end());
+                sites.erase(std::unique(sites.begin(), sites.end()),
+                    sites.end());
+                return sites;
+            }
+
+            // The ids of the sites returned by get_peer_sites, this has to
+            // be called before the first operation is started.
+            void set_peers(std::vector<std::size_t> const& sites,
+                std::vector<naming::id_type> const& ids)
+            {
+                HPX_ASSERT(sites.size() == ids.size());
+
+                mutex_type::scoped_lock l(mtx_);
+                peers_.resize(num_sites_);
+                for (std::size_t i = 0; i != sites.size(); ++i)
+                    peers_[sites[i]] = ids[i];
+            }
+
+            ///////////////////////////////////////////////////////////////////
+            // Contribute the data of one of the local threads
+            future<buffer_type> arrive(reduction_operation op,
+                buffer_type const& data)
+            {
+                mutex_type::scoped_lock l(mtx_);
+
+                // The threads of this site receive their results only after
+                // the current operation has finished, so a new contribution
+                // arriving before that means that more than num_local
+                // threads are taking part.
+                if (active_)
+                {
+                    l.unlock();
+                    HPX_THROW_EXCEPTION(invalid_status,
+                        "all_reduce_server::arrive",
+                        "the previous operation has not finished yet");
+                    return future<buffer_type>();
+                }
+
+                if (local_data_.empty())
+                {
+                    operation_ = op;
+                }
+                else if (operation_ != op ||
+                    local_data_[0].size() != data.size())
+                {
+                    l.unlock();
+                    HPX_THROW_EXCEPTION(bad_parameter,
+                        "all_reduce_server::arrive",
+                        "all threads have to invoke the same operation "
+                        "with the same number of elements");
+                    return future<buffer_type>();
+                }
+
+                local_data_.push_back(data);
+                waiters_.push_back(lcos::local::promise<buffer_type>());
+                future<buffer_type> f = waiters_.back().get_future();
+
+                if (local_data_.size() == num_local_)
+                {
+                    std::vector<buffer_type> local_data;
+                    std::swap(local_data, local_data_);
+
+                    l.unlock();
+                    start(local_data);
+                }
+                return f;
+            }
+
+            // Receive the data sent by another site in the given step
+            void receive(std::size_t generation, std::size_t step,
+                buffer_type const& data)
+            {
+                {
+                    mutex_type::scoped_lock l(mtx_);
+                    HPX_ASSERT(generation == generation_ ||
+                        generation == generation_ + 1);
+
+                    received_[generation % 2][step] = data;
+                    if (generation != generation_ || !active_ || running_)
+                        return;
+                }
+                progress();
+            }
+
+            HPX_DEFINE_COMPONENT_ACTION(all_reduce_server, receive,
+                receive_action);
+
+        private:
+            buffer_type combine(buffer_type const& lhs,
+                buffer_type const& rhs) const
+            {
+                HPX_ASSERT(lhs.size() == rhs.size());
+
+                std::size_t size = lhs.size();
+                buffer_type result(new T[size], size, buffer_type::take);
+
+                T const* l = lhs.data();
+                T const* r = rhs.data();
+                T* p = result.data();
+                for (std::size_t i = 0; i != size; ++i)
+                    p[i] = op_(l[i], r[i]);
+
+                return result;
+            }
+
+            // combine the contributions of all local threads and start the
+            // communication with the other sites
+            void start(std::vector<buffer_type> const& local_data)
+            {
+                buffer_type data = local_data[0];
+                if (local_data.size() > 1)
+                {
+                    data = combine(local_data[0], local_data[1]);
+
+                    T* p = data.data();
+                    for (std::size_t j = 2; j != local_data.size(); ++j)
+                    {
+                        T const* q = local_data[j].data();
+                        for (std::size_t i = 0; i != data.size(); ++i)
+                            p[i] = op_(p[i], q[i]);
+                    }
+                }
+
+                std::size_t size = data.size();
+
+                std::vector<reduction_step> steps;
+                std::vector<buffer_type> blocks;
+                std::size_t result_block = reduction_step::npos;
+
+                if (operation_ == all_reduce_operation &&
+                    (size < num_sites_ || size * sizeof(T) < ring_threshold_))
+                {
+                    // small payloads: minimize the number of steps
+                    steps = recursive_doubling_schedule(num_sites_, this_site_);
+                    blocks.push_back(data);
+                    result_block = 0;
+                }
+                else
+                {
+                    // large payloads: minimize the data sent by each site
+                    bool allgather = operation_ == all_reduce_operation;
+                    steps = ring_schedule(num_sites_, this_site_, allgather);
+
+                    blocks.reserve(num_sites_);
+                    for (std::size_t b = 0; b != num_sites_; ++b)
+                    {
+                        std::size_t first = block_offset(size, num_sites_, b);
+                        std::size_t last = block_offset(size, num_sites_, b + 1);
+                        blocks.push_back(
+                            make_buffer_slice(data, first, last - first));
+                    }
+
+                    if (!allgather)
+                        result_block = this_site_;
+                }
+
+                {
+                    mutex_type::scoped_lock l(mtx_);
+
+                    if (active_)
+                    {
+                        l.unlock();
+                        HPX_THROW_EXCEPTION(invalid_status,
+                            "all_reduce_server::start",
+                            "the previous operation has not finished yet");
+                        return;
+                    }
+
+                    size_ = size;
+                    std::swap(steps_, steps);
+                    std::swap(blocks_, blocks);
+                    result_block_ = result_block;
+                    step_ = 0;
+                    step_sent_ = false;
+                    active_ = true;
+                }
+                progress();
+            }
+
+            // Execute the steps of the schedule as far as possible. Only one
+            // thread at a time drives the schedule, the messages are sent
+            // and the data is combined without holding the lock.
+            void progress()
+            {
+                mutex_type::scoped_lock l(mtx_);
+                if (running_ || !active_)
+                    return;
+
+                running_ = true;
+
+                std::size_t generation = generation_;
+                received_type& received = received_[generation % 2];
+
+                while (step_ != steps_.size())
+                {
+                    reduction_step const& s = steps_[step_];
+
+                    if (!step_sent_)
+                    {
+                        step_sent_ = true;
+                        if (s.send_to != reduction_step::npos)
+                        {
+                            naming::id_type id = peers_[s.send_to];
+                            buffer_type data = blocks_[s.send_block];
+                            std::size_t step = step_;
+
+                            util::scoped_unlock<mutex_type::scoped_lock> ul(l);
+                            hpx::apply<receive_action>(
+                                id, generation, step, data);
+                        }
+                    }
+
+                    if (s.recv_block != reduction_step::npos)
+                    {
+                        typename received_type::iterator it =
+                            received.find(step_);
+                        if (it == received.end())
+                        {
+                            running_ = false;   // wait for the message
+                            return;
+                        }
+
+                        buffer_type data = it->second;
+                        received.erase(it);
+
+                        if (s.reduce)
+                        {
+                            buffer_type block = blocks_[s.recv_block];
+
+                            util::scoped_unlock<mutex_type::scoped_lock> ul(l);
+                            data = s.recv_first ?
+                                combine(data, block) : combine(block, data);
+                        }
+
+                        HPX_ASSERT(data.size() == blocks_[s.recv_block].size());
+                        blocks_[s.recv_block] = data;
+                    }
+
+                    ++step_;
+                    step_sent_ = false;
+                }
+
+                // all steps are done, start the next generation
+                std::vector<buffer_type> blocks;
+                std::swap(blocks, blocks_);
+
+                std::vector<lcos::local::promise<buffer_type> > waiters;
+                std::swap(waiters, waiters_);
+
+                std::size_t size = size_;
+                std::size_t result_block = result_block_;
+
+                steps_.clear();
+                active_ = false;
+                running_ = false;
+                ++generation_;
+
+                l.unlock();
+
+                buffer_type result;
+                if (result_block != reduction_step::npos)
+                    result = blocks[result_block];
+                else
+                    result = concatenate_buffers(blocks, size);
+
+                for (lcos::local::promise<buffer_type>& p : waiters)
+                    p.set_value(result);
+            }
+
+        private:
+            mutex_type mtx_;
+
+            Op op_;
+            std::size_t num_sites_;
+            std::size_t this_site_;
+            std::size_t num_local_;
+            std::size_t ring_threshold_;
+
+            std::vector<naming::id_type> peers_;
+
+            reduction_operation operation_;
+            std::size_t generation_;
+            std::vector<buffer_type> local_data_;
+            std::vector<lcos::local::promise<buffer_type> > waiters_;
+
+            received_type received_[2];
+
+            std::size_t size_;
+            std::vector<reduction_step> steps_;
+            std::vector<buffer_type> blocks_;
+            std::size_t step_;
+            bool step_sent_;
+            bool active_;
+            bool running_;
+            std::size_t result_block_;
+        };
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A reduction_group connects the sites (localities) taking part in
+    /// repeated \a all_reduce and \a reduce_scatter operations.
+    ///
+    /// Each site creates its own instance of the group, the instances find
+    /// each other using the given base name. On each site a fixed number of
+    /// threads contribute to each operation, their data is combined on the
+    /// site before any data is sent to other sites.
+    ///
+    /// \tparam T   The type of the elements to reduce
+    /// \tparam Op  The binary operation used to combine two elements, it has
+    ///             to be associative and commutative. All sites have to use
+    ///             the same operation.
+    ///
+    /// \note The (T, Op) combination has to be registered using
+    ///       \a HPX_REGISTER_ALL_REDUCE.
+    ///
+    template <typename T, typename Op>
+    class reduction_group : boost::noncopyable
+    {
+    private:
+        typedef detail::all_reduce_server<T, Op> server_type;
+
+    public:
+        typedef serialization::serialize_buffer<T> buffer_type;
+
+        /// \param base_name      The name used by all sites to find each
+        ///                       other
+        /// \param num_local      The number of threads on this site
+        ///                       contributing to each operation
+        /// \param op             The operation used to combine the data
+        /// \param num_sites      The number of participating sites
+        ///                       (default: the number of localities)
+        /// \param this_site      The index of this site (default: the
+        ///                       locality id of this locality)
+        /// \param ring_threshold Payloads of at least this many bytes are
+        ///                       reduced using the ring algorithm, smaller
+        ///                       ones using recursive doubling
+        reduction_group(std::string const& base_name,
+                std::size_t num_local = 1, Op const& op = Op(),
+                std::size_t num_sites = ~0U, std::size_t this_site = ~0U,
+                std::size_t ring_threshold = 64 * 1024)
+          : base_name_(base_name), this_site_(this_site)
+        {
+            if (num_sites == ~0U)
+                num_sites = hpx::get_num_localities_sync();
+            if (this_site_ == ~0U)
+                this_site_ = hpx::get_locality_id();
+
+            if (this_site_ >= num_sites || num_local == 0)
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "reduction_group::reduction_group",
+                    "invalid number of sites or threads");
+            }
+
+            id_ = hpx::new_<server_type>(hpx::find_here(), num_sites,
+                this_site_, num_local, op, ring_threshold).get();
+            ptr_ = hpx::get_ptr<server_type>(id_).get();
+
+            hpx::register_id_with_basename(
+                base_name_.c_str(), id_, this_site_).get();
+
+            // The peers are referenced using unmanaged ids only, as the
+            // sites reference each other.
+            std::vector<std::size_t> sites = ptr_->get_peer_sites();
+            std::vector<hpx::future<hpx::id_type> > peers =
+                hpx::find_ids_from_basename(base_name_.c_str(), sites);
+            hpx::wait_all(peers);
+
+            std::vector<hpx::id_type> ids;
+            ids.reserve(peers.size());
+            for (hpx::future<hpx::id_type>& f : peers)
+            {
+                ids.push_back(hpx::id_type(
+                    f.get().get_gid(), hpx::id_type::unmanaged));
+            }
+            ptr_->set_peers(sites, ids);
+        }
+
+        ~reduction_group()
+        {
+            // make sure the group is not found anymore
+            hpx::unregister_id_with_basename(base_name_.c_str(), this_site_);
+        }
+
+        /// \cond NOINTERNAL
+        future<buffer_type> arrive(detail::reduction_operation op,
+            buffer_type const& data)
+        {
+            return ptr_->arrive(op, data);
+        }
+        /// \endcond
+
+    private:
+        std::string base_name_;
+        std::size_t this_site_;
+        hpx::id_type id_;
+        boost::shared_ptr<server_type> ptr_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Combine the data contributed by all threads on all sites of the given
+    /// group element by element, each thread receives the full result.
+    ///
+    /// \param group    The group to use
+    /// \param data     The data contributed by this thread, all threads have
+    ///                 to contribute the same number of elements. The data
+    ///                 is sent without copying it, it must not be modified
+    ///                 before the operation has finished on all sites.
+    ///
+    /// \returns A future referring to the combined data. All threads on a
+    ///          site receive a reference to the same data, which must not be
+    ///          modified while it is still in use by other threads.
+    ///
+    /// \note Small payloads are combined using recursive doubling (log2(N)
+    ///       steps, the full payload is sent in each step), larger payloads
+    ///       are combined using a ring reduce-scatter followed by a ring
+    ///       allgather (2(N - 1) steps, each sending 1/N-th of the payload).
+    ///
+    template <typename T, typename Op>
+    future<serialization::serialize_buffer<T> >
+    all_reduce(reduction_group<T, Op>& group,
+        serialization::serialize_buffer<T> const& data)
+    {
+        return group.arrive(detail::all_reduce_operation, data);
+    }
+
+    /// Combine the data contributed by all threads on all sites of the given
+    /// group element by element, each site receives one block of the result.
+    ///
+    /// \param group    The group to use
+    /// \param data     The data contributed by this thread, all threads have
+    ///                 to contribute the same number of elements. The data
+    ///                 is sent without copying it, it must not be modified
+    ///                 before the operation has finished on all sites.
+    ///
+    /// \returns A future referring to the block of the combined data
+    ///          assigned to this site. For N sites and S elements site i
+    ///          receives the elements [i * S / N, (i + 1) * S / N).
+    ///
+    template <typename T, typename Op>
+    future<serialization::serialize_buffer<T> >
+    reduce_scatter(reduction_group<T, Op>& group,
+        serialization::serialize_buffer<T> const& data)
+    {
+        return group.arrive(detail::reduce_scatter_operation, data);
+    }
+}}
+
+///////////////////////////////////////////////////////////////////////////////
+#define HPX_REGISTER_ALL_REDUCE_DECLARATION(type, op, name)                   \
+    HPX_REGISTER_ACTION_DECLARATION(                                          \
+        hpx::lcos::detail::all_reduce_server<type, op>::receive_action,       \
+        BOOST_PP_CAT(all_reduce_receive_action_, name))                       \
+    /**/
+
+#define HPX_REGISTER_ALL_REDUCE(type, op, name)                               \
+    HPX_REGISTER_ACTION(                                                      \
+        hpx::lcos::detail::all_reduce_server<type, op>::receive_action,       \
+        BOOST_PP_CAT(all_reduce_receive_action_, name))                       \
+    typedef hpx::components::simple_component<                                \
+        hpx::lcos::detail::all_reduce_server<type, op>                        \
+    > BOOST_PP_CAT(all_reduce_, name);                                        \
+    HPX_REGISTER_MINIMAL_COMPONENT_FACTORY(BOOST_PP_CAT(all_reduce_, name))   \
+    /**/
+
+#endif
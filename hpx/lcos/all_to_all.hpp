@@ -0,0 +1,572 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file all_to_all.hpp
+
+#if !defined(HPX_LCOS_ALL_TO_ALL_OCT_14_2015_1005AM)
+#define HPX_LCOS_ALL_TO_ALL_OCT_14_2015_1005AM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/wait_all.hpp>
+#include <hpx/lcos/detail/buffer_slice.hpp>
+#include <hpx/lcos/local/promise.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/runtime/actions/component_action.hpp>
+#include <hpx/runtime/applier/apply.hpp>
+#include <hpx/runtime/components/new.hpp>
+#include <hpx/runtime/components/server/simple_component_base.hpp>
+#include <hpx/runtime/get_ptr.hpp>
+#include <hpx/runtime/naming/id_type.hpp>
+#include <hpx/runtime/serialization/serialize_buffer.hpp>
+#include <hpx/util/scoped_unlock.hpp>
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/noncopyable.hpp>
+#include <boost/preprocessor/cat.hpp>
+#include <boost/shared_ptr.hpp>
+
+namespace hpx { namespace lcos
+{
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // One step of an exchange schedule. In each step a site sends at most
+        // one chunk (the chunk destined to the site it sends to) and receives
+        // at most one chunk. Messages are matched by their tag.
+        struct exchange_step
+        {
+            static std::size_t const npos = std::size_t(-1);
+
+            std::size_t send_to;        // site to send to (or npos)
+            std::size_t tag;            // tag of the sent/received message
+            std::size_t recv_chunk;     // where to store the received chunk
+                                        // (or npos)
+        };
+
+        // Pairwise exchange: in step k site i sends to site i + k and
+        // receives from site i - k. Each site talks to one site at a time, no
+        // site receives from more than one site in each step.
+        inline std::vector<exchange_step>
+        pairwise_exchange_schedule(std::size_t num_sites, std::size_t site)
+        {
+            std::vector<exchange_step> steps;
+            steps.reserve(num_sites);
+
+            for (std::size_t k = 1; k < num_sites; ++k)
+            {
+                exchange_step step = {
+                    (site + k) % num_sites, k,
+                    (site + num_sites - k) % num_sites
+                };
+                steps.push_back(step);
+            }
+            return steps;
+        }
+
+        // Scatter: the root sends one chunk to each of the other sites,
+        // starting with its successor.
+        inline std::vector<exchange_step>
+        scatter_schedule(std::size_t num_sites, std::size_t site,
+            std::size_t root)
+        {
+            std::vector<exchange_step> steps;
+            if (site == root)
+            {
+                steps.reserve(num_sites);
+                for (std::size_t k = 1; k < num_sites; ++k)
+                {
+                    exchange_step step = {
+                        (root + k) % num_sites, k, exchange_step::npos
+                    };
+                    steps.push_back(step);
+                }
+            }
+            else
+            {
+                exchange_step step = {
+                    exchange_step::npos,
+                    (site + num_sites - root) % num_sites, site
+                };
+                steps.push_back(step);
+            }
+            return steps;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        enum exchange_operation
+        {
+            all_to_all_operation = 0,
+            scatter_operation = 1
+        };
+
+        // The part of an exchange_group living on one of the sites. The
+        // sites execute the steps of their schedule driven by the arriving
+        // messages.
+        //
+        // The root of a scatter does not wait for any other site, it can be
+        // any number of generations ahead of the other sites. The received
+        // messages are therefore kept by generation and tag.
+        template <typename T>
+        class all_to_all_server
+          : public components::simple_component_base<all_to_all_server<T> >
+        {
+        private:
+            typedef lcos::local::spinlock mutex_type;
+            typedef serialization::serialize_buffer<T> buffer_type;
+            typedef std::pair<std::size_t, std::size_t> message_key;
+            typedef std::map<message_key, buffer_type> received_type;
+
+        public:
+            all_to_all_server()
+              : num_sites_(1), this_site_(0)
+            {
+                HPX_ASSERT(false);  // shouldn't ever be called
+            }
+
+            all_to_all_server(std::size_t num_sites, std::size_t this_site)
+              : num_sites_(num_sites), this_site_(this_site),
+                generation_(0), step_(0), step_sent_(false), active_(false),
+                running_(false)
+            {
+                HPX_ASSERT(this_site_ < num_sites_);
+            }
+
+            // The ids of all sites, this has to be called before the first
+            // operation is started.
+            void set_peers(std::vector<naming::id_type> const& peers)
+            {
+                HPX_ASSERT(peers.size() == num_sites_);
+
+                mutex_type::scoped_lock l(mtx_);
+                peers_ = peers;
+            }
+
+            ///////////////////////////////////////////////////////////////////
+            // Start the next operation, 'chunks' holds the data to send to
+            // each of the sites (if any).
+            future<std::vector<buffer_type> > arrive(exchange_operation op,
+                std::vector<buffer_type> const& chunks, std::size_t root)
+            {
+                std::vector<exchange_step> steps;
+                std::vector<buffer_type> result(num_sites_);
+
+                if (op == all_to_all_operation)
+                {
+                    steps = pairwise_exchange_schedule(num_sites_, this_site_);
+                    result[this_site_] = chunks[this_site_];
+                }
+                else
+                {
+                    steps = scatter_schedule(num_sites_, this_site_, root);
+                    if (this_site_ == root)
+                        result[this_site_] = chunks[this_site_];
+                }
+
+                future<std::vector<buffer_type> > f;
+                {
+                    mutex_type::scoped_lock l(mtx_);
+
+                    if (active_)
+                    {
+                        l.unlock();
+                        HPX_THROW_EXCEPTION(invalid_status,
+                            "all_to_all_server::arrive",
+                            "the previous operation has not finished yet");
+                        return f;
+                    }
+
+                    waiter_ = lcos::local::promise<std::vector<buffer_type> >();
+                    f = waiter_.get_future();
+
+                    std::swap(steps_, steps);
+                    chunks_ = chunks;
+                    std::swap(result_, result);
+                    step_ = 0;
+                    step_sent_ = false;
+                    active_ = true;
+                }
+
+                progress();
+                return f;
+            }
+
+            // Receive the chunk sent by another site with the given tag
+            void receive(std::size_t generation, std::size_t tag,
+                buffer_type const& data)
+            {
+                {
+                    mutex_type::scoped_lock l(mtx_);
+                    HPX_ASSERT(generation >= generation_);
+
+                    received_[message_key(generation, tag)] = data;
+                    if (generation != generation_ || !active_ || running_)
+                        return;
+                }
+                progress();
+            }
+
+            HPX_DEFINE_COMPONENT_ACTION(all_to_all_server, receive,
+                receive_action);
+
+        private:
+            // Execute the steps of the schedule as far as possible. Only one
+            // thread at a time drives the schedule, messages are sent without
+            // holding the lock. A site does not send to its next partner
+            // before it has received from its current partner, which keeps
+            // the number of messages in flight to each site small.
+            void progress()
+            {
+                mutex_type::scoped_lock l(mtx_);
+                if (running_ || !active_)
+                    return;
+
+                running_ = true;
+
+                std::size_t generation = generation_;
+
+                while (step_ != steps_.size())
+                {
+                    exchange_step const& s = steps_[step_];
+
+                    if (!step_sent_)
+                    {
+                        step_sent_ = true;
+                        if (s.send_to != exchange_step::npos)
+                        {
+                            naming::id_type id = peers_[s.send_to];
+                            buffer_type data = chunks_[s.send_to];
+                            std::size_t tag = s.tag;
+
+                            util::scoped_unlock<mutex_type::scoped_lock> ul(l);
+                            hpx::apply<receive_action>(id, generation, tag, data);
+                        }
+                    }
+
+                    if (s.recv_chunk != exchange_step::npos)
+                    {
+                        typename received_type::iterator it =
+                            received_.find(message_key(generation, s.tag));
+                        if (it == received_.end())
+                        {
+                            running_ = false;   // wait for the message
+                            return;
+                        }
+
+                        result_[s.recv_chunk] = it->second;
+                        received_.erase(it);
+                    }
+
+                    ++step_;
+                    step_sent_ = false;
+                }
+
+                // all steps are done, start the next generation
+                std::vector<buffer_type> result;
+                std::swap(result, result_);
+
+                lcos::local::promise<std::vector<buffer_type> > waiter;
+                std::swap(waiter, waiter_);
+
+                steps_.clear();
+                chunks_.clear();
+                active_ = false;
+                running_ = false;
+                ++generation_;
+
+                l.unlock();
+                waiter.set_value(std::move(result));
+            }
+
+        private:
+            mutex_type mtx_;
+
+            std::size_t num_sites_;
+            std::size_t this_site_;
+
+            std::vector<naming::id_type> peers_;
+
+            std::size_t generation_;
+            received_type received_;
+
+            std::vector<exchange_step> steps_;
+            std::vector<buffer_type> chunks_;
+            std::vector<buffer_type> result_;
+            lcos::local::promise<std::vector<buffer_type> > waiter_;
+            std::size_t step_;
+            bool step_sent_;
+            bool active_;
+            bool running_;
+        };
+
+        template <typename T>
+        serialization::serialize_buffer<T>
+        extract_chunk(future<std::vector<serialization::serialize_buffer<T> > > f,
+            std::size_t site)
+        {
+            return f.get()[site];
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// An exchange_group connects the sites (localities) taking part in
+    /// repeated \a all_to_all, \a all_to_allv, and \a scatter operations.
+    ///
+    /// Each site creates its own instance of the group, the instances find
+    /// each other using the given base name. Operations on a group have to
+    /// be invoked by exactly one thread per site, in the same order on all
+    /// sites.
+    ///
+    /// \tparam T   The type of the exchanged elements
+    ///
+    /// \note The type has to be registered using \a HPX_REGISTER_ALL_TO_ALL.
+    ///
+    template <typename T>
+    class exchange_group : boost::noncopyable
+    {
+    private:
+        typedef detail::all_to_all_server<T> server_type;
+
+    public:
+        typedef serialization::serialize_buffer<T> buffer_type;
+
+        /// \param base_name      The name used by all sites to find each
+        ///                       other
+        /// \param num_sites      The number of participating sites
+        ///                       (default: the number of localities)
+        /// \param this_site      The index of this site (default: the
+        ///                       locality id of this locality)
+        exchange_group(std::string const& base_name,
+                std::size_t num_sites = ~0U, std::size_t this_site = ~0U)
+          : base_name_(base_name), num_sites_(num_sites),
+            this_site_(this_site)
+        {
+            if (num_sites_ == ~0U)
+                num_sites_ = hpx::get_num_localities_sync();
+            if (this_site_ == ~0U)
+                this_site_ = hpx::get_locality_id();
+
+            if (this_site_ >= num_sites_)
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "exchange_group::exchange_group",
+                    "invalid number of sites");
+            }
+
+            id_ = hpx::new_<server_type>(hpx::find_here(), num_sites_,
+                this_site_).get();
+            ptr_ = hpx::get_ptr<server_type>(id_).get();
+
+            hpx::register_id_with_basename(
+                base_name_.c_str(), id_, this_site_).get();
+
+            // The peers are referenced using unmanaged ids only, as the
+            // sites reference each other.
+            std::vector<std::size_t> sites;
+            sites.reserve(num_sites_);
+            for (std::size_t i = 0; i != num_sites_; ++i)
+                sites.push_back(i);
+
+            std::vector<hpx::future<hpx::id_type> > peers =
+                hpx::find_ids_from_basename(base_name_.c_str(), sites);
+            hpx::wait_all(peers);
+
+            std::vector<hpx::id_type> ids;
+            ids.reserve(peers.size());
+            for (hpx::future<hpx::id_type>& f : peers)
+            {
+                ids.push_back(hpx::id_type(
+                    f.get().get_gid(), hpx::id_type::unmanaged));
+            }
+            ptr_->set_peers(ids);
+        }
+
+        ~exchange_group()
+        {
+            // make sure the group is not found anymore
+            hpx::unregister_id_with_basename(base_name_.c_str(), this_site_);
+        }
+
+        std::size_t get_num_sites() const { return num_sites_; }
+        std::size_t get_this_site() const { return this_site_; }
+
+        /// \cond NOINTERNAL
+        future<std::vector<buffer_type> > arrive(
+            detail::exchange_operation op,
+            std::vector<buffer_type> const& chunks, std::size_t root = 0)
+        {
+            return ptr_->arrive(op, chunks, root);
+        }
+        /// \endcond
+
+    private:
+        std::string base_name_;
+        std::size_t num_sites_;
+        std::size_t this_site_;
+        hpx::id_type id_;
+        boost::shared_ptr<server_type> ptr_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Send the i-th of N equally sized chunks of \a data to site i, and
+    /// receive one chunk from each of the sites.
+    ///
+    /// \param group    The group to use
+    /// \param data     The data to distribute, its size has to be a multiple
+    ///                 of the number of sites. The chunks are sent without
+    ///                 copying the data, it must not be modified before the
+    ///                 operation has finished on all sites.
+    ///
+    /// \returns A future referring to the chunks received from each of the
+    ///          sites (in site order).
+    ///
+    /// \note The chunks are exchanged pairwise: in step k each site sends to
+    ///       the site k positions ahead and receives from the site k
+    ///       positions behind, so that no site is flooded with messages.
+    ///
+    template <typename T>
+    future<std::vector<serialization::serialize_buffer<T> > >
+    all_to_all(exchange_group<T>& group,
+        serialization::serialize_buffer<T> const& data)
+    {
+        typedef serialization::serialize_buffer<T> buffer_type;
+
+        std::size_t num_sites = group.get_num_sites();
+        if (data.size() % num_sites != 0)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter, "hpx::lcos::all_to_all",
+                "the size of the data has to be a multiple of the number "
+                "of sites");
+        }
+
+        std::size_t count = data.size() / num_sites;
+
+        std::vector<buffer_type> chunks;
+        chunks.reserve(num_sites);
+        for (std::size_t i = 0; i != num_sites; ++i)
+            chunks.push_back(detail::make_buffer_slice(data, i * count, count));
+
+        return group.arrive(detail::all_to_all_operation, chunks);
+    }
+
+    /// Send counts[i] consecutive elements of \a data to site i, and receive
+    /// one chunk from each of the sites.
+    ///
+    /// \param group    The group to use
+    /// \param data     The data to distribute. The chunks are sent without
+    ///                 copying the data, it must not be modified before the
+    ///                 operation has finished on all sites.
+    /// \param counts   The number of elements to send to each of the sites,
+    ///                 the counts have to add up to the size of \a data
+    ///
+    /// \returns A future referring to the chunks received from each of the
+    ///          sites (in site order).
+    ///
+    template <typename T>
+    future<std::vector<serialization::serialize_buffer<T> > >
+    all_to_allv(exchange_group<T>& group,
+        serialization::serialize_buffer<T> const& data,
+        std::vector<std::size_t> const& counts)
+    {
+        typedef serialization::serialize_buffer<T> buffer_type;
+
+        std::size_t num_sites = group.get_num_sites();
+        if (counts.size() != num_sites)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter, "hpx::lcos::all_to_allv",
+                "one count has to be given for each of the sites");
+        }
+
+        std::vector<buffer_type> chunks;
+        chunks.reserve(num_sites);
+
+        std::size_t offset = 0;
+        for (std::size_t i = 0; i != num_sites; ++i)
+        {
+            if (offset + counts[i] > data.size())
+            {
+                HPX_THROW_EXCEPTION(bad_parameter, "hpx::lcos::all_to_allv",
+                    "the counts exceed the size of the data");
+            }
+
+            chunks.push_back(
+                detail::make_buffer_slice(data, offset, counts[i]));
+            offset += counts[i];
+        }
+
+        return group.arrive(detail::all_to_all_operation, chunks);
+    }
+
+    /// Distribute the data of the root site over all sites: for N sites and
+    /// S elements site i receives the elements [i * S / N, (i + 1) * S / N).
+    ///
+    /// \param group        The group to use
+    /// \param data         The data to distribute, this is used on the root
+    ///                     site only. The chunks are sent without copying
+    ///                     the data, it must not be modified before the
+    ///                     operation has finished on all sites.
+    /// \param root_site    The site distributing its data
+    ///
+    /// \returns A future referring to the chunk received by this site.
+    ///
+    template <typename T>
+    future<serialization::serialize_buffer<T> >
+    scatter(exchange_group<T>& group,
+        serialization::serialize_buffer<T> const& data,
+        std::size_t root_site = 0)
+    {
+        typedef serialization::serialize_buffer<T> buffer_type;
+
+        std::size_t num_sites = group.get_num_sites();
+        if (root_site >= num_sites)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter, "hpx::lcos::scatter",
+                "invalid root site");
+        }
+
+        std::vector<buffer_type> chunks;
+        if (group.get_this_site() == root_site)
+        {
+            std::size_t size = data.size();
+
+            chunks.reserve(num_sites);
+            for (std::size_t i = 0; i != num_sites; ++i)
+            {
+                std::size_t first = detail::block_offset(size, num_sites, i);
+                std::size_t last = detail::block_offset(size, num_sites, i + 1);
+                chunks.push_back(
+                    detail::make_buffer_slice(data, first, last - first));
+            }
+        }
+
+        using util::placeholders::_1;
+        return group.arrive(detail::scatter_operation, chunks, root_site)
+            .then(util::bind(&detail::extract_chunk<T>, _1,
+                group.get_this_site()));
+    }
+}}
+
+///////////////////////////////////////////////////////////////////////////////
+#define HPX_REGISTER_ALL_TO_ALL_DECLARATION(type, name)                       \
+    HPX_REGISTER_ACTION_DECLARATION(                                          \
+        hpx::lcos::detail::all_to_all_server<type>::receive_action,           \
+        BOOST_PP_CAT(all_to_all_receive_action_, name))                       \
+    /**/
+
+#define HPX_REGISTER_ALL_TO_ALL(type, name)                                   \
+    HPX_REGISTER_ACTION(                                                      \
+        hpx::lcos::detail::all_to_all_server<type>::receive_action,           \
+        BOOST_PP_CAT(all_to_all_receive_action_, name))                       \
+    typedef hpx::components::simple_component<                                \
+        hpx::lcos::detail::all_to_all_server<type>                            \
+    > BOOST_PP_CAT(all_to_all_, name);                                        \
+    HPX_REGISTER_MINIMAL_COMPONENT_FACTORY(BOOST_PP_CAT(all_to_all_, name))   \
+    /**/
+
+#endif
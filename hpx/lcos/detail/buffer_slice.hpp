@@ -0,0 +1,69 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_LCOS_DETAIL_BUFFER_SLICE_OCT_14_2015_0932AM)
+#define HPX_LCOS_DETAIL_BUFFER_SLICE_OCT_14_2015_0932AM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/runtime/serialization/serialize_buffer.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include <boost/shared_array.hpp>
+
+namespace hpx { namespace lcos { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // A slice of a serialize_buffer referencing the original data, the
+    // deleter keeps the original buffer alive.
+    template <typename T>
+    struct buffer_slice_deleter
+    {
+        void operator()(T*) const {}
+        boost::shared_array<T> data_;
+    };
+
+    template <typename T>
+    serialization::serialize_buffer<T> make_buffer_slice(
+        serialization::serialize_buffer<T> const& buffer,
+        std::size_t offset, std::size_t size)
+    {
+        typedef serialization::serialize_buffer<T> buffer_type;
+
+        HPX_ASSERT(offset + size <= buffer.size());
+
+        buffer_slice_deleter<T> deleter = { buffer.data_array() };
+        return buffer_type(buffer.data() + offset, size,
+            buffer_type::reference, deleter);
+    }
+
+    template <typename T>
+    serialization::serialize_buffer<T> concatenate_buffers(
+        std::vector<serialization::serialize_buffer<T> > const& buffers,
+        std::size_t size)
+    {
+        typedef serialization::serialize_buffer<T> buffer_type;
+
+        buffer_type result(new T[size], size, buffer_type::take);
+
+        T* p = result.data();
+        for (buffer_type const& b : buffers)
+            p = std::copy(b.data(), b.data() + b.size(), p);
+
+        HPX_ASSERT(p == result.data() + size);
+        return result;
+    }
+
+    // The elements [offset(b), offset(b + 1)) of a buffer of the given size
+    // form the block b when distributing the buffer evenly over the sites.
+    inline std::size_t block_offset(std::size_t size,
+        std::size_t num_sites, std::size_t block)
+    {
+        return (size * block) / num_sites;
+    }
+}}}
+
+#endif
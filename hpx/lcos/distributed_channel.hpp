@@ -0,0 +1,610 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file distributed_channel.hpp
+
+#if !defined(HPX_LCOS_DISTRIBUTED_CHANNEL_OCT_19_2015_0912AM)
+#define HPX_LCOS_DISTRIBUTED_CHANNEL_OCT_19_2015_0912AM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/lcos/async.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/local/detail/condition_variable.hpp>
+#include <hpx/lcos/local/promise.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/runtime/actions/component_action.hpp>
+#include <hpx/runtime/applier/apply.hpp>
+#include <hpx/runtime/components/new.hpp>
+#include <hpx/runtime/components/server/simple_component_base.hpp>
+#include <hpx/runtime/get_ptr.hpp>
+#include <hpx/runtime/naming/id_type.hpp>
+#include <hpx/runtime/serialization/vector.hpp>
+#include <hpx/util/scoped_unlock.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <iterator>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/noncopyable.hpp>
+#include <boost/preprocessor/cat.hpp>
+#include <boost/shared_ptr.hpp>
+
+namespace hpx { namespace lcos
+{
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // The sending end of a channel keeps track of the credits granted by
+        // the receiver, each credit allows to send one item.
+        template <typename T>
+        class channel_sender_server
+          : public components::simple_component_base<
+                channel_sender_server<T> >
+        {
+        private:
+            typedef lcos::local::spinlock mutex_type;
+
+        public:
+            channel_sender_server()
+              : credits_(0)
+            {}
+
+            // Called by the receiver whenever items were consumed
+            void grant(std::size_t credits)
+            {
+                mutex_type::scoped_lock l(mtx_);
+                credits_ += credits;
+                cond_.notify_all(l);        // leaves the lock unlocked
+            }
+
+            HPX_DEFINE_COMPONENT_DIRECT_ACTION(channel_sender_server, grant,
+                grant_action);
+
+            // Wait for at least one credit to be available, take up to
+            // 'count' of them.
+            std::size_t acquire(std::size_t count)
+            {
+                mutex_type::scoped_lock l(mtx_);
+                while (credits_ == 0)
+                    cond_.wait(l, "channel_sender_server::acquire");
+
+                std::size_t result = (std::min)(count, credits_);
+                credits_ -= result;
+                return result;
+            }
+
+        private:
+            mutex_type mtx_;
+            lcos::local::detail::condition_variable cond_;
+            std::size_t credits_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // The receiving end of a channel collects the batches sent by all
+        // connected senders. Batches are numbered by each sender, as parcels
+        // may overtake each other the batches arriving early are kept aside
+        // until their predecessors have arrived.
+        //
+        // Each sender is granted 'window' credits initially. The credits for
+        // consumed items are handed back in chunks of half the window, which
+        // bounds the number of items buffered for each sender.
+        template <typename T>
+        class channel_receiver_server
+          : public components::simple_component_base<
+                channel_receiver_server<T> >
+        {
+        private:
+            typedef lcos::local::spinlock mutex_type;
+            typedef typename channel_sender_server<T>::grant_action
+                grant_action;
+
+            static std::size_t const npos = std::size_t(-1);
+
+            struct sender_data
+            {
+                explicit sender_data(naming::id_type const& id)
+                  : id_(id), next_sequence_(0), last_sequence_(npos),
+                    consumed_(0), closed_(false)
+                {}
+
+                naming::id_type id_;
+                std::size_t next_sequence_;
+                std::size_t last_sequence_;     // number of the final batch
+                std::map<std::size_t, std::vector<T> > early_;
+                std::size_t consumed_;          // items not granted back yet
+                bool closed_;
+            };
+
+        public:
+            channel_receiver_server()
+              : num_senders_(1), window_(1)
+            {
+                HPX_ASSERT(false);  // shouldn't ever be called
+            }
+
+            channel_receiver_server(std::size_t num_senders, std::size_t window)
+              : num_senders_(num_senders), window_(window), closed_senders_(0),
+                waiting_(false)
+            {
+                HPX_ASSERT(num_senders_ != 0 && window_ != 0);
+            }
+
+            ///////////////////////////////////////////////////////////////////
+            // Register a new sender, returns the index of the sender used to
+            // identify its batches.
+            std::size_t connect(naming::id_type const& sender)
+            {
+                std::size_t index = 0;
+                {
+                    mutex_type::scoped_lock l(mtx_);
+                    if (senders_.size() == num_senders_)
+                    {
+                        l.unlock();
+                        HPX_THROW_EXCEPTION(bad_parameter,
+                            "channel_receiver_server::connect",
+                            "too many senders are connected to the channel");
+                        return 0;
+                    }
+
+                    index = senders_.size();
+                    senders_.push_back(sender_data(sender));
+                }
+
+                hpx::apply<grant_action>(sender, window_);
+                return index;
+            }
+
+            HPX_DEFINE_COMPONENT_ACTION(channel_receiver_server, connect,
+                connect_action);
+
+            // Receive a batch of items from one of the senders
+            void deliver(std::size_t sender, std::size_t sequence,
+                std::vector<T> const& items, bool last)
+            {
+                mutex_type::scoped_lock l(mtx_);
+                HPX_ASSERT(sender < senders_.size());
+
+                sender_data& s = senders_[sender];
+                if (last)
+                    s.last_sequence_ = sequence;
+
+                if (sequence != s.next_sequence_)
+                {
+                    HPX_ASSERT(sequence > s.next_sequence_);
+                    s.early_[sequence] = items;
+                    return;
+                }
+
+                append(sender, items);
+                ++s.next_sequence_;
+
+                // now the batches which arrived early may be in order
+                typedef typename std::map<
+                        std::size_t, std::vector<T>
+                    >::iterator iterator;
+
+                iterator it = s.early_.begin();
+                while (it != s.early_.end() && it->first == s.next_sequence_)
+                {
+                    append(sender, it->second);
+                    ++s.next_sequence_;
+                    s.early_.erase(it++);
+                }
+
+                if (s.last_sequence_ != npos &&
+                    s.next_sequence_ == s.last_sequence_ + 1)
+                {
+                    s.closed_ = true;
+                    ++closed_senders_;
+                }
+
+                notify(l);
+            }
+
+            HPX_DEFINE_COMPONENT_ACTION(channel_receiver_server, deliver,
+                deliver_action);
+
+            ///////////////////////////////////////////////////////////////////
+            // The returned future becomes ready once an item is available
+            // (true) or all senders have closed the channel (false).
+            future<bool> next()
+            {
+                mutex_type::scoped_lock l(mtx_);
+                HPX_ASSERT(!waiting_);
+
+                if (!ready_.empty())
+                    return make_ready_future(true);
+                if (closed_senders_ == num_senders_)
+                    return make_ready_future(false);
+
+                waiting_ = true;
+                waiter_ = lcos::local::promise<bool>();
+                return waiter_.get_future();
+            }
+
+            // Retrieve the item made available by the last call to next()
+            T get()
+            {
+                mutex_type::scoped_lock l(mtx_);
+                if (ready_.empty())
+                {
+                    l.unlock();
+                    HPX_THROW_EXCEPTION(invalid_status,
+                        "channel_receiver_server::get",
+                        "no item is available, next() has to be called "
+                        "first");
+                    return T();
+                }
+
+                std::pair<std::size_t, T> item(std::move(ready_.front()));
+                ready_.pop_front();
+
+                // hand back the credits in chunks of half the window
+                sender_data& s = senders_[item.first];
+                if (!s.closed_ && ++s.consumed_ >= (window_ + 1) / 2)
+                {
+                    std::size_t credits = s.consumed_;
+                    s.consumed_ = 0;
+
+                    naming::id_type id = s.id_;
+                    util::scoped_unlock<mutex_type::scoped_lock> ul(l);
+                    hpx::apply<grant_action>(id, credits);
+                }
+
+                return std::move(item.second);
+            }
+
+        private:
+            void append(std::size_t sender, std::vector<T> const& items)
+            {
+                for (std::size_t i = 0; i != items.size(); ++i)
+                    ready_.push_back(std::make_pair(sender, items[i]));
+            }
+
+            void notify(mutex_type::scoped_lock& l)
+            {
+                if (!waiting_)
+                    return;
+
+                bool has_item = !ready_.empty();
+                if (!has_item && closed_senders_ != num_senders_)
+                    return;
+
+                lcos::local::promise<bool> waiter;
+                std::swap(waiter, waiter_);
+                waiting_ = false;
+
+                l.unlock();
+                waiter.set_value(has_item);
+            }
+
+        private:
+            mutex_type mtx_;
+
+            std::size_t num_senders_;
+            std::size_t window_;
+
+            std::vector<sender_data> senders_;
+            std::size_t closed_senders_;
+
+            std::deque<std::pair<std::size_t, T> > ready_;
+            lcos::local::promise<bool> waiter_;
+            bool waiting_;
+        };
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The receiving end of a channel streaming items of type \a T from one
+    /// or more senders, possibly located on other localities.
+    ///
+    /// The items are received by a single consumer, either by calling
+    /// next() followed by get(), or by iterating over the channel. The
+    /// channel ends once all senders have been closed.
+    ///
+    /// \tparam T   The type of the streamed items
+    ///
+    /// \note The type has to be registered using
+    ///       \a HPX_REGISTER_DISTRIBUTED_CHANNEL.
+    ///
+    template <typename T>
+    class channel_receiver : boost::noncopyable
+    {
+    private:
+        typedef detail::channel_receiver_server<T> server_type;
+
+    public:
+        /// An input iterator over the items received from the channel,
+        /// incrementing it suspends the calling thread until the next item
+        /// is available.
+        class iterator
+          : public std::iterator<std::input_iterator_tag, T>
+        {
+        public:
+            iterator()
+              : receiver_(0)
+            {}
+
+            explicit iterator(channel_receiver& receiver)
+              : receiver_(&receiver)
+            {
+                increment();
+            }
+
+            T const& operator*() const { return value_; }
+            T const* operator->() const { return &value_; }
+
+            iterator& operator++()
+            {
+                increment();
+                return *this;
+            }
+
+            bool operator==(iterator const& rhs) const
+            {
+                return receiver_ == rhs.receiver_;
+            }
+            bool operator!=(iterator const& rhs) const
+            {
+                return receiver_ != rhs.receiver_;
+            }
+
+        private:
+            void increment()
+            {
+                if (!receiver_->receive(value_))
+                    receiver_ = 0;
+            }
+
+            channel_receiver* receiver_;
+            T value_;
+        };
+
+        /// \param base_name      The name used by the senders to find this
+        ///                       channel
+        /// \param num_senders    The number of senders which will connect
+        /// \param window         The maximal number of items each sender
+        ///                       may have in flight or buffered
+        channel_receiver(std::string const& base_name,
+                std::size_t num_senders = 1, std::size_t window = 1024)
+          : base_name_(base_name)
+        {
+            if (num_senders == 0 || window == 0)
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "channel_receiver::channel_receiver",
+                    "invalid number of senders or window size");
+            }
+
+            id_ = hpx::new_<server_type>(hpx::find_here(), num_senders,
+                window).get();
+            ptr_ = hpx::get_ptr<server_type>(id_).get();
+
+            hpx::register_id_with_basename(base_name_.c_str(), id_, 0).get();
+        }
+
+        ~channel_receiver()
+        {
+            // make sure the channel is not found anymore
+            hpx::unregister_id_with_basename(base_name_.c_str(), 0);
+        }
+
+        /// Wait for the next item, the returned future holds false if all
+        /// senders have closed the channel and all items were received.
+        future<bool> next()
+        {
+            return ptr_->next();
+        }
+
+        /// Retrieve the item made available by the preceding call to next()
+        T get()
+        {
+            return ptr_->get();
+        }
+
+        /// Receive the next item, suspending the calling thread until it is
+        /// available. Returns false at the end of the channel.
+        bool receive(T& val)
+        {
+            if (!next().get())
+                return false;
+
+            val = get();
+            return true;
+        }
+
+        iterator begin() { return iterator(*this); }
+        iterator end() { return iterator(); }
+
+    private:
+        std::string base_name_;
+        hpx::id_type id_;
+        boost::shared_ptr<server_type> ptr_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The sending end of a channel. Items are collected into batches of
+    /// the given size which are sent as one parcel each. A sender never has
+    /// more items in flight than the receiver granted credits for, sending
+    /// suspends the calling thread until credits are available.
+    ///
+    /// Each sender is used by one thread at a time. Sending ends by calling
+    /// close(), which flushes the last batch.
+    ///
+    /// \tparam T   The type of the streamed items
+    ///
+    template <typename T>
+    class channel_sender : boost::noncopyable
+    {
+    private:
+        typedef detail::channel_sender_server<T> server_type;
+        typedef typename detail::channel_receiver_server<T>::connect_action
+            connect_action;
+        typedef typename detail::channel_receiver_server<T>::deliver_action
+            deliver_action;
+
+    public:
+        /// \param base_name      The name the receiver of the channel was
+        ///                       created with
+        /// \param batch_size     The number of items sent in one parcel
+        channel_sender(std::string const& base_name,
+                std::size_t batch_size = 64)
+          : batch_size_(batch_size), sequence_(0), closed_(false)
+        {
+            if (batch_size_ == 0)
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "channel_sender::channel_sender",
+                    "invalid batch size");
+            }
+
+            id_ = hpx::new_<server_type>(hpx::find_here()).get();
+            ptr_ = hpx::get_ptr<server_type>(id_).get();
+
+            receiver_ = hpx::find_id_from_basename(base_name.c_str(), 0).get();
+            index_ = hpx::async<connect_action>(receiver_, id_).get();
+
+            batch_.reserve(batch_size_);
+        }
+
+        ~channel_sender()
+        {
+            if (!closed_)
+            {
+                try {
+                    close();
+                }
+                catch (...) {
+                    ;   // there is nothing we can do
+                }
+            }
+        }
+
+        /// Add an item to the current batch, sends the batch once it is full
+        void send(T const& val)
+        {
+            if (closed_)
+            {
+                HPX_THROW_EXCEPTION(invalid_status, "channel_sender::send",
+                    "the channel was closed");
+            }
+
+            batch_.push_back(val);
+            if (batch_.size() >= batch_size_)
+                send_batch(false);
+        }
+
+        /// Send the current batch, even if it is not full
+        void flush()
+        {
+            if (closed_)
+            {
+                HPX_THROW_EXCEPTION(invalid_status, "channel_sender::flush",
+                    "the channel was closed");
+            }
+            send_batch(false);
+        }
+
+        /// Send the current batch and close this end of the channel
+        void close()
+        {
+            if (closed_)
+            {
+                HPX_THROW_EXCEPTION(invalid_status, "channel_sender::close",
+                    "the channel was closed");
+            }
+
+            closed_ = true;
+            send_batch(true);
+        }
+
+    private:
+        void send_batch(bool last)
+        {
+            while (!batch_.empty())
+            {
+                std::size_t count = ptr_->acquire(batch_.size());
+
+                std::vector<T> items;
+                if (count == batch_.size())
+                {
+                    std::swap(items, batch_);
+                    batch_.reserve(batch_size_);
+                }
+                else
+                {
+                    items.assign(batch_.begin(), batch_.begin() + count);
+                    batch_.erase(batch_.begin(), batch_.begin() + count);
+                }
+
+                bool is_last = last && batch_.empty();
+                hpx::apply<deliver_action>(receiver_, index_, sequence_++,
+                    std::move(items), is_last);
+
+                if (is_last)
+                    return;
+            }
+
+            // an empty batch marks the end of the channel
+            if (last)
+            {
+                hpx::apply<deliver_action>(receiver_, index_, sequence_++,
+                    std::vector<T>(), true);
+            }
+        }
+
+    private:
+        std::size_t batch_size_;
+        hpx::id_type id_;
+        boost::shared_ptr<server_type> ptr_;
+
+        hpx::id_type receiver_;
+        std::size_t index_;
+
+        std::vector<T> batch_;
+        std::size_t sequence_;
+        bool closed_;
+    };
+}}
+
+///////////////////////////////////////////////////////////////////////////////
+#define HPX_REGISTER_DISTRIBUTED_CHANNEL_DECLARATION(type, name)              \
+    HPX_REGISTER_ACTION_DECLARATION(                                          \
+        hpx::lcos::detail::channel_sender_server<type>::grant_action,         \
+        BOOST_PP_CAT(channel_grant_action_, name))                            \
+    HPX_REGISTER_ACTION_DECLARATION(                                          \
+        hpx::lcos::detail::channel_receiver_server<type>::connect_action,     \
+        BOOST_PP_CAT(channel_connect_action_, name))                          \
+    HPX_REGISTER_ACTION_DECLARATION(                                          \
+        hpx::lcos::detail::channel_receiver_server<type>::deliver_action,     \
+        BOOST_PP_CAT(channel_deliver_action_, name))                          \
+    /**/
+
+#define HPX_REGISTER_DISTRIBUTED_CHANNEL(type, name)                          \
+    HPX_REGISTER_ACTION(                                                      \
+        hpx::lcos::detail::channel_sender_server<type>::grant_action,         \
+        BOOST_PP_CAT(channel_grant_action_, name))                            \
+    HPX_REGISTER_ACTION(                                                      \
+        hpx::lcos::detail::channel_receiver_server<type>::connect_action,     \
+        BOOST_PP_CAT(channel_connect_action_, name))                          \
+    HPX_REGISTER_ACTION(                                                      \
+        hpx::lcos::detail::channel_receiver_server<type>::deliver_action,     \
+        BOOST_PP_CAT(channel_deliver_action_, name))                          \
+    typedef hpx::components::simple_component<                                \
+        hpx::lcos::detail::channel_sender_server<type>                        \
+    > BOOST_PP_CAT(channel_sender_, name);                                    \
+    HPX_REGISTER_MINIMAL_COMPONENT_FACTORY(                                   \
+        BOOST_PP_CAT(channel_sender_, name))                                  \
+    typedef hpx::components::simple_component<                                \
+        hpx::lcos::detail::channel_receiver_server<type>                      \
+    > BOOST_PP_CAT(channel_receiver_, name);                                  \
+    HPX_REGISTER_MINIMAL_COMPONENT_FACTORY(                                   \
+        BOOST_PP_CAT(channel_receiver_, name))                                \
+    /**/
+
+#endif
@@ -0,0 +1,125 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_LCOS_HIERARCHICAL_BARRIER_OCT_07_2015_1010AM)
+#define HPX_LCOS_HIERARCHICAL_BARRIER_OCT_07_2015_1010AM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/wait_all.hpp>
+#include <hpx/lcos/server/hierarchical_barrier.hpp>
+#include <hpx/runtime/components/new.hpp>
+#include <hpx/runtime/get_ptr.hpp>
+
+#include <string>
+#include <vector>
+
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace lcos
+{
+    /// A hierarchical_barrier synchronizes a fixed number of threads on each
+    /// of the participating sites (localities).
+    ///
+    /// Different from \a hpx::lcos::barrier, which funnels all threads
+    /// through a single component, each site creates its own part of the
+    /// barrier. Threads entering the barrier are combined locally, only one
+    /// message per site is sent in each step of the communication between
+    /// the sites. The sites are connected either as a k-ary tree or using
+    /// a dissemination pattern (see \a hierarchical_barrier_mode).
+    ///
+    /// The barrier can be reused any number of times. All sites have to
+    /// create their instance using the same base name, the same mode, and
+    /// the same arity.
+    class hierarchical_barrier : boost::noncopyable
+    {
+    private:
+        typedef server::hierarchical_barrier server_type;
+
+    public:
+        /// \param base_name The name used by all sites to find each other
+        /// \param num_local The number of threads on this site which will
+        ///                  enter the barrier in each generation
+        /// \param mode      The communication pattern between the sites
+        /// \param arity     The number of children of each site (for
+        ///                  \a tree_mode only)
+        /// \param num_sites The number of participating sites (default: the
+        ///                  number of localities)
+        /// \param this_site The index of this site (default: the locality
+        ///                  id of this locality)
+        hierarchical_barrier(std::string const& base_name,
+                std::size_t num_local = 1,
+                hierarchical_barrier_mode mode = tree_mode,
+                std::size_t arity = 2, std::size_t num_sites = ~0U,
+                std::size_t this_site = ~0U)
+          : base_name_(base_name), this_site_(this_site)
+        {
+            if (num_sites == ~0U)
+                num_sites = hpx::get_num_localities_sync();
+            if (this_site_ == ~0U)
+                this_site_ = hpx::get_locality_id();
+
+            if (this_site_ >= num_sites || num_local == 0)
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "hierarchical_barrier::hierarchical_barrier",
+                    "invalid number of sites or threads");
+            }
+
+            id_ = hpx::new_<server_type>(hpx::find_here(), num_sites,
+                this_site_, num_local, int(mode), arity).get();
+            ptr_ = hpx::get_ptr<server_type>(id_).get();
+
+            hpx::register_id_with_basename(
+                base_name_.c_str(), id_, this_site_).get();
+
+            // The peers are referenced using unmanaged ids only, as the
+            // sites reference each other.
+            std::vector<hpx::future<hpx::id_type> > peers =
+                hpx::find_ids_from_basename(
+                    base_name_.c_str(), ptr_->get_peer_sites());
+            hpx::wait_all(peers);
+
+            std::vector<hpx::id_type> ids;
+            ids.reserve(peers.size());
+            for (hpx::future<hpx::id_type>& f : peers)
+            {
+                ids.push_back(hpx::id_type(
+                    f.get().get_gid(), hpx::id_type::unmanaged));
+            }
+            ptr_->set_peers(ids);
+        }
+
+        ~hierarchical_barrier()
+        {
+            // make sure the barrier is not found anymore
+            hpx::unregister_id_with_basename(base_name_.c_str(), this_site_);
+        }
+
+        /// Enter the barrier, the returned future becomes ready once all
+        /// threads on all sites have entered the barrier.
+        lcos::future<void> wait_async()
+        {
+            return ptr_->arrive();
+        }
+
+        /// Enter the barrier and wait for all threads on all sites to have
+        /// entered the barrier as well.
+        void wait()
+        {
+            wait_async().get();
+        }
+
+    private:
+        std::string base_name_;
+        std::size_t this_site_;
+        hpx::id_type id_;
+        boost::shared_ptr<server_type> ptr_;
+    };
+}}
+
+#endif
@@ -0,0 +1,562 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hierarchical_gather.hpp
+
+#if !defined(HPX_LCOS_HIERARCHICAL_GATHER_OCT_15_2015_0344PM)
+#define HPX_LCOS_HIERARCHICAL_GATHER_OCT_15_2015_0344PM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/wait_all.hpp>
+#include <hpx/lcos/local/promise.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/runtime/actions/component_action.hpp>
+#include <hpx/runtime/applier/apply.hpp>
+#include <hpx/runtime/components/new.hpp>
+#include <hpx/runtime/components/server/simple_component_base.hpp>
+#include <hpx/runtime/get_ptr.hpp>
+#include <hpx/runtime/naming/id_type.hpp>
+#include <hpx/util/bind.hpp>
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/noncopyable.hpp>
+#include <boost/preprocessor/cat.hpp>
+#include <boost/shared_ptr.hpp>
+
+namespace hpx { namespace lcos
+{
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // The position of a site in a k-ary tree over the (relative) sites
+        // [0, num_sites) rooted at site 0. Each subtree covers a contiguous
+        // range of sites starting at the root of the subtree, which allows
+        // to combine the data of a subtree by simply concatenating the data
+        // of its root and the data of its children.
+        struct gather_tree_position
+        {
+            static std::size_t const npos = std::size_t(-1);
+
+            gather_tree_position(std::size_t num_sites, std::size_t site,
+                std::size_t arity)
+              : parent(npos), parent_pos(0)
+            {
+                std::size_t node = 0;
+                std::size_t last = num_sites;
+
+                while (true)
+                {
+                    // split the sites below this node into 'arity'
+                    // contiguous ranges
+                    std::size_t first = node + 1;
+                    std::size_t count = last - first;
+
+                    std::vector<std::pair<std::size_t, std::size_t> > ranges;
+                    for (std::size_t k = 0; k != arity; ++k)
+                    {
+                        std::size_t b = first + (count * k) / arity;
+                        std::size_t e = first + (count * (k + 1)) / arity;
+                        if (b != e)
+                            ranges.push_back(std::make_pair(b, e));
+                    }
+
+                    if (node == site)
+                    {
+                        for (std::size_t k = 0; k != ranges.size(); ++k)
+                            children.push_back(ranges[k].first);
+                        return;
+                    }
+
+                    // descend into the range holding the site
+                    for (std::size_t k = 0; k != ranges.size(); ++k)
+                    {
+                        if (site < ranges[k].second)
+                        {
+                            parent = node;
+                            parent_pos = k;
+                            node = ranges[k].first;
+                            last = ranges[k].second;
+                            break;
+                        }
+                    }
+                }
+            }
+
+            std::size_t parent;                 // npos for the root
+            std::size_t parent_pos;             // index in parent's children
+            std::vector<std::size_t> children;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        enum gather_operation
+        {
+            gather_operation_here = 0,
+            gather_operation_there = 1,
+            gather_operation_all = 2
+        };
+
+        // The part of a hierarchical_gather living on one of the sites. The
+        // values of the threads on this site are combined first, the site
+        // then waits for the data of its children, and forwards the
+        // concatenated data to its parent. The root reorders the data (if it
+        // is not site 0), and for all_gather sends the result back down the
+        // tree.
+        //
+        // A site invoking gather_there does not wait for the other sites,
+        // so it can be any number of generations ahead of its parent. The
+        // data received from the children is therefore kept by generation.
+        template <typename T>
+        class hierarchical_gather_server
+          : public components::simple_component_base<
+                hierarchical_gather_server<T> >
+        {
+        private:
+            typedef lcos::local::spinlock mutex_type;
+            typedef std::pair<std::size_t, std::size_t> message_key;
+            typedef std::map<message_key, std::vector<T> > received_type;
+
+        public:
+            hierarchical_gather_server()
+              : num_sites_(1), this_site_(0), num_local_(1), root_(0),
+                position_(1, 0, 2)
+            {
+                HPX_ASSERT(false);  // shouldn't ever be called
+            }
+
+            hierarchical_gather_server(std::size_t num_sites,
+                    std::size_t this_site, std::size_t num_local,
+                    std::size_t root, std::size_t arity)
+              : num_sites_(num_sites), this_site_(this_site),
+                num_local_(num_local), root_(root),
+                position_(num_sites, (this_site + num_sites - root) % num_sites,
+                    arity < 2 ? 2 : arity),
+                operation_(gather_operation_here), generation_(0),
+                local_values_(num_local), local_arrived_(0),
+                forwarded_(false)
+            {
+                HPX_ASSERT(this_site_ < num_sites_ && root_ < num_sites_);
+                HPX_ASSERT(num_local_ != 0);
+            }
+
+            ///////////////////////////////////////////////////////////////////
+            // The sites this site sends messages to: the parent (if any),
+            // followed by the children
+            std::vector<std::size_t> get_peer_sites() const
+            {
+                std::vector<std::size_t> sites;
+                if (position_.parent != gather_tree_position::npos)
+                    sites.push_back(absolute_site(position_.parent));
+                for (std::size_t child : position_.children)
+                    sites.push_back(absolute_site(child));
+                return sites;
+            }
+
+            void set_peers(std::vector<naming::id_type> const& peers)
+            {
+                mutex_type::scoped_lock l(mtx_);
+                if (position_.parent != gather_tree_position::npos)
+                {
+                    parent_ = peers[0];
+                    children_.assign(peers.begin() + 1, peers.end());
+                }
+                else
+                {
+                    children_ = peers;
+                }
+                HPX_ASSERT(children_.size() == position_.children.size());
+            }
+
+            ///////////////////////////////////////////////////////////////////
+            // Contribute the value of the local thread with the given index
+            future<std::vector<T> > arrive(gather_operation op,
+                std::size_t this_local, T const& value)
+            {
+                mutex_type::scoped_lock l(mtx_);
+
+                if (local_arrived_ == 0)
+                {
+                    operation_ = op;
+                }
+                else if (operation_ != op)
+                {
+                    l.unlock();
+                    HPX_THROW_EXCEPTION(bad_parameter,
+                        "hierarchical_gather_server::arrive",
+                        "all threads have to invoke the same operation");
+                    return future<std::vector<T> >();
+                }
+
+                local_values_[this_local] = value;
+                waiters_.push_back(lcos::local::promise<std::vector<T> >());
+                future<std::vector<T> > f = waiters_.back().get_future();
+
+                if (++local_arrived_ == num_local_)
+                    progress(l);
+
+                return f;
+            }
+
+            // The concatenated data of the subtree of one of the children
+            void child_data(std::size_t generation, std::size_t child,
+                std::vector<T> const& data)
+            {
+                mutex_type::scoped_lock l(mtx_);
+                HPX_ASSERT(generation >= generation_);
+
+                received_[message_key(generation, child)] = data;
+                if (generation == generation_)
+                    progress(l);
+            }
+
+            // The result of an all_gather, sent down the tree
+            void result(std::size_t generation, std::vector<T> const& data)
+            {
+                mutex_type::scoped_lock l(mtx_);
+                HPX_ASSERT(generation == generation_ && forwarded_);
+
+                release(l, data);
+            }
+
+            HPX_DEFINE_COMPONENT_ACTION(hierarchical_gather_server,
+                child_data, child_data_action);
+            HPX_DEFINE_COMPONENT_ACTION(hierarchical_gather_server,
+                result, result_action);
+
+        private:
+            std::size_t absolute_site(std::size_t relative) const
+            {
+                return (relative + root_) % num_sites_;
+            }
+
+            // Forward the data of this subtree once the values of all local
+            // threads and the data of all children have arrived.
+            void progress(mutex_type::scoped_lock& l)
+            {
+                if (local_arrived_ != num_local_ || forwarded_)
+                    return;
+
+                std::size_t generation = generation_;
+                std::size_t num_children = position_.children.size();
+                for (std::size_t c = 0; c != num_children; ++c)
+                {
+                    if (received_.find(message_key(generation, c)) ==
+                        received_.end())
+                    {
+                        return;
+                    }
+                }
+
+                // concatenate the data of this subtree, keeping site order
+                std::vector<T> data;
+                std::swap(data, local_values_);
+                local_values_.resize(num_local_);
+
+                for (std::size_t c = 0; c != num_children; ++c)
+                {
+                    typename received_type::iterator it =
+                        received_.find(message_key(generation, c));
+                    data.insert(data.end(), it->second.begin(),
+                        it->second.end());
+                    received_.erase(it);
+                }
+
+                if (position_.parent == gather_tree_position::npos)
+                {
+                    // the root has all data, restore the order of the sites
+                    HPX_ASSERT(data.size() == num_sites_ * num_local_);
+                    std::rotate(data.begin(),
+                        data.begin() + (num_sites_ - root_) * num_local_,
+                        data.end());
+
+                    release(l, data);
+                    return;
+                }
+
+                naming::id_type parent = parent_;
+                std::size_t parent_pos = position_.parent_pos;
+
+                if (operation_ == gather_operation_all)
+                {
+                    // wait for the result to come back down the tree
+                    forwarded_ = true;
+
+                    l.unlock();
+                    hpx::apply<child_data_action>(
+                        parent, generation, parent_pos, data);
+                    return;
+                }
+
+                release(l, std::vector<T>());
+                hpx::apply<child_data_action>(
+                    parent, generation, parent_pos, std::move(data));
+            }
+
+            // Start the next generation, pass on the result of an all_gather
+            // to the children, and make the local threads ready. This
+            // releases the lock.
+            void release(mutex_type::scoped_lock& l,
+                std::vector<T> const& data)
+            {
+                std::size_t generation = generation_;
+                bool all = operation_ == gather_operation_all;
+
+                std::vector<lcos::local::promise<std::vector<T> > > waiters;
+                std::swap(waiters, waiters_);
+
+                local_arrived_ = 0;
+                forwarded_ = false;
+                ++generation_;
+
+                std::vector<naming::id_type> children;
+                if (all)
+                    children = children_;
+
+                // the data of the next generation may have arrived already
+                // (this can't make progress before the local threads have
+                // arrived again)
+
+                l.unlock();
+
+                for (naming::id_type const& child : children)
+                    hpx::apply<result_action>(child, generation, data);
+
+                for (lcos::local::promise<std::vector<T> >& p : waiters)
+                    p.set_value(data);
+            }
+
+        private:
+            mutex_type mtx_;
+
+            std::size_t num_sites_;
+            std::size_t this_site_;
+            std::size_t num_local_;
+            std::size_t root_;
+            gather_tree_position position_;
+
+            naming::id_type parent_;
+            std::vector<naming::id_type> children_;
+
+            gather_operation operation_;
+            std::size_t generation_;
+            std::vector<T> local_values_;
+            std::size_t local_arrived_;
+            bool forwarded_;
+            std::vector<lcos::local::promise<std::vector<T> > > waiters_;
+
+            received_type received_;
+        };
+
+        template <typename T>
+        void get_gather_there_result(future<std::vector<T> > f)
+        {
+            f.get();        // propagate exceptions
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A hierarchical_gather collects the values of a fixed number of
+    /// threads on each of the participating sites (localities) on the root
+    /// site.
+    ///
+    /// Different from \a gather_here and \a gather_there using a basename,
+    /// which send the value of each participant directly to the root, the
+    /// values are first combined on each site, and the sites forward the
+    /// combined data of their subtree to their parent in a k-ary tree. The
+    /// root receives one message from each of its children only.
+    ///
+    /// The result holds the values of all threads ordered by site, and by
+    /// the local index of the threads on each site. The gather can be
+    /// reused any number of times.
+    ///
+    /// \note The type has to be registered using
+    ///       \a HPX_REGISTER_HIERARCHICAL_GATHER.
+    ///
+    template <typename T>
+    class hierarchical_gather : boost::noncopyable
+    {
+    private:
+        typedef detail::hierarchical_gather_server<T> server_type;
+
+    public:
+        /// \param base_name The name used by all sites to find each other
+        /// \param num_local The number of threads on each site contributing
+        ///                  to each operation
+        /// \param root_site The site receiving the result of \a gather_here
+        /// \param arity     The number of children of each site in the tree
+        /// \param num_sites The number of participating sites (default: the
+        ///                  number of localities)
+        /// \param this_site The index of this site (default: the locality
+        ///                  id of this locality)
+        hierarchical_gather(std::string const& base_name,
+                std::size_t num_local = 1, std::size_t root_site = 0,
+                std::size_t arity = 2, std::size_t num_sites = ~0U,
+                std::size_t this_site = ~0U)
+          : base_name_(base_name), num_local_(num_local),
+            root_site_(root_site), this_site_(this_site)
+        {
+            if (num_sites == ~0U)
+                num_sites = hpx::get_num_localities_sync();
+            if (this_site_ == ~0U)
+                this_site_ = hpx::get_locality_id();
+
+            if (this_site_ >= num_sites || root_site_ >= num_sites ||
+                num_local_ == 0)
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "hierarchical_gather::hierarchical_gather",
+                    "invalid number of sites or threads");
+            }
+
+            id_ = hpx::new_<server_type>(hpx::find_here(), num_sites,
+                this_site_, num_local_, root_site_, arity).get();
+            ptr_ = hpx::get_ptr<server_type>(id_).get();
+
+            hpx::register_id_with_basename(
+                base_name_.c_str(), id_, this_site_).get();
+
+            // The peers are referenced using unmanaged ids only, as the
+            // sites reference each other.
+            std::vector<hpx::future<hpx::id_type> > peers =
+                hpx::find_ids_from_basename(
+                    base_name_.c_str(), ptr_->get_peer_sites());
+            hpx::wait_all(peers);
+
+            std::vector<hpx::id_type> ids;
+            ids.reserve(peers.size());
+            for (hpx::future<hpx::id_type>& f : peers)
+            {
+                ids.push_back(hpx::id_type(
+                    f.get().get_gid(), hpx::id_type::unmanaged));
+            }
+            ptr_->set_peers(ids);
+        }
+
+        ~hierarchical_gather()
+        {
+            // make sure the gather is not found anymore
+            hpx::unregister_id_with_basename(base_name_.c_str(), this_site_);
+        }
+
+        std::size_t get_root_site() const { return root_site_; }
+        std::size_t get_this_site() const { return this_site_; }
+
+        /// \cond NOINTERNAL
+        future<std::vector<T> > arrive(detail::gather_operation op,
+            std::size_t this_local, T const& value)
+        {
+            if (this_local >= num_local_)
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "hierarchical_gather::arrive",
+                    "invalid local index");
+            }
+            return ptr_->arrive(op, this_local, value);
+        }
+        /// \endcond
+
+    private:
+        std::string base_name_;
+        std::size_t num_local_;
+        std::size_t root_site_;
+        std::size_t this_site_;
+        hpx::id_type id_;
+        boost::shared_ptr<server_type> ptr_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Contribute a value to the given gather from the root site, and
+    /// receive the values of all threads on all sites.
+    ///
+    /// \param g            The gather to use
+    /// \param value        The value contributed by this thread
+    /// \param this_local   The index of this thread on this site
+    ///
+    template <typename T>
+    future<std::vector<T> >
+    gather_here(hierarchical_gather<T>& g, T const& value,
+        std::size_t this_local = 0)
+    {
+        if (g.get_this_site() != g.get_root_site())
+        {
+            HPX_THROW_EXCEPTION(bad_parameter, "hpx::lcos::gather_here",
+                "gather_here has to be invoked on the root site");
+        }
+        return g.arrive(detail::gather_operation_here, this_local, value);
+    }
+
+    /// Contribute a value to the given gather from any site but the root
+    /// site.
+    ///
+    /// \param g            The gather to use
+    /// \param value        The value contributed by this thread
+    /// \param this_local   The index of this thread on this site
+    ///
+    /// \returns A future which becomes ready once the data of this site has
+    ///          been forwarded towards the root site.
+    ///
+    template <typename T>
+    future<void>
+    gather_there(hierarchical_gather<T>& g, T const& value,
+        std::size_t this_local = 0)
+    {
+        if (g.get_this_site() == g.get_root_site())
+        {
+            HPX_THROW_EXCEPTION(bad_parameter, "hpx::lcos::gather_there",
+                "gather_there can't be invoked on the root site");
+        }
+
+        using util::placeholders::_1;
+        return g.arrive(detail::gather_operation_there, this_local, value)
+            .then(util::bind(&detail::get_gather_there_result<T>, _1));
+    }
+
+    /// Contribute a value to the given gather, and receive the values of all
+    /// threads on all sites. The data is gathered on the root site and then
+    /// sent back down the same tree.
+    ///
+    /// \param g            The gather to use
+    /// \param value        The value contributed by this thread
+    /// \param this_local   The index of this thread on this site
+    ///
+    template <typename T>
+    future<std::vector<T> >
+    all_gather(hierarchical_gather<T>& g, T const& value,
+        std::size_t this_local = 0)
+    {
+        return g.arrive(detail::gather_operation_all, this_local, value);
+    }
+}}
+
+///////////////////////////////////////////////////////////////////////////////
+#define HPX_REGISTER_HIERARCHICAL_GATHER_DECLARATION(type, name)              \
+    HPX_REGISTER_ACTION_DECLARATION(                                          \
+        hpx::lcos::detail::hierarchical_gather_server<type>::child_data_action,\
+        BOOST_PP_CAT(hierarchical_gather_child_data_action_, name))           \
+    HPX_REGISTER_ACTION_DECLARATION(                                          \
+        hpx::lcos::detail::hierarchical_gather_server<type>::result_action,   \
+        BOOST_PP_CAT(hierarchical_gather_result_action_, name))               \
+    /**/
+
+#define HPX_REGISTER_HIERARCHICAL_GATHER(type, name)                          \
+    HPX_REGISTER_ACTION(                                                      \
+        hpx::lcos::detail::hierarchical_gather_server<type>::child_data_action,\
+        BOOST_PP_CAT(hierarchical_gather_child_data_action_, name))           \
+    HPX_REGISTER_ACTION(                                                      \
+        hpx::lcos::detail::hierarchical_gather_server<type>::result_action,   \
+        BOOST_PP_CAT(hierarchical_gather_result_action_, name))               \
+    typedef hpx::components::simple_component<                                \
+        hpx::lcos::detail::hierarchical_gather_server<type>                   \
+    > BOOST_PP_CAT(hierarchical_gather_, name);                               \
+    HPX_REGISTER_MINIMAL_COMPONENT_FACTORY(                                   \
+        BOOST_PP_CAT(hierarchical_gather_, name))                             \
+    /**/
+
+#endif
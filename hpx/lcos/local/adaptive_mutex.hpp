@@ -0,0 +1,154 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_LCOS_LOCAL_ADAPTIVE_MUTEX_OCT_19_2015_0216PM)
+#define HPX_LCOS_LOCAL_ADAPTIVE_MUTEX_OCT_19_2015_0216PM
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/lcos/local/detail/condition_variable.hpp>
+#include <hpx/util/itt_notify.hpp>
+#include <hpx/util/register_locks.hpp>
+
+#include <string>
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/locks.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace lcos { namespace local
+{
+    namespace detail
+    {
+        // The contention statistics of an adaptive_mutex, these are shared
+        // with the performance counters exposing them.
+        struct adaptive_mutex_statistics
+        {
+            adaptive_mutex_statistics()
+              : acquisitions_(0), contentions_(0), suspensions_(0),
+                wait_time_(0)
+            {}
+
+            boost::atomic<boost::int64_t> acquisitions_;
+            boost::atomic<boost::int64_t> contentions_;
+            boost::atomic<boost::int64_t> suspensions_;
+            boost::atomic<boost::int64_t> wait_time_;   // [ns]
+        };
+    }
+
+    /// A mutex for HPX threads which spins for a while if it is contended
+    /// and suspends the calling thread if it could not acquire the lock that
+    /// way. The time spent spinning adapts to the time it took to acquire
+    /// the lock before.
+    ///
+    /// Unlocking a mutex which has suspended waiters hands the ownership
+    /// directly to the first of them instead of waking it up to compete for
+    /// the lock again.
+    ///
+    /// If enabled on construction, the mutex counts the number of
+    /// acquisitions, of contended acquisitions, and of suspensions, and
+    /// sums up the time spent waiting. These can be exposed as performance
+    /// counters.
+    class HPX_EXPORT adaptive_mutex : boost::noncopyable
+    {
+    private:
+        typedef lcos::local::spinlock mutex_type;
+
+    public:
+        typedef boost::unique_lock<adaptive_mutex> scoped_lock;
+        typedef boost::detail::try_lock_wrapper<adaptive_mutex> scoped_try_lock;
+
+        adaptive_mutex(char const* const description = "",
+            bool collect_statistics = false);
+        ~adaptive_mutex();
+
+        void lock()
+        {
+            HPX_ITT_SYNC_PREPARE(this);
+
+            if (!try_acquire())
+                lock_contended();
+
+            if (stats_)
+                ++stats_->acquisitions_;
+
+            HPX_ITT_SYNC_ACQUIRED(this);
+            util::register_lock(this);
+        }
+
+        bool try_lock()
+        {
+            HPX_ITT_SYNC_PREPARE(this);
+
+            if (!try_acquire())
+            {
+                HPX_ITT_SYNC_CANCEL(this);
+                return false;
+            }
+
+            if (stats_)
+                ++stats_->acquisitions_;
+
+            HPX_ITT_SYNC_ACQUIRED(this);
+            util::register_lock(this);
+            return true;
+        }
+
+        void unlock()
+        {
+            HPX_ITT_SYNC_RELEASING(this);
+            util::unregister_lock(this);
+
+            if (waiters_.load() == 0)
+            {
+                locked_.store(false);
+
+                // a thread might have started waiting in between
+                if (waiters_.load() != 0)
+                    wake_waiter();
+            }
+            else
+            {
+                unlock_contended();
+            }
+
+            HPX_ITT_SYNC_RELEASED(this);
+        }
+
+        /// Expose the statistics as performance counters named
+        /// /mutex/<name>/acquisitions, /mutex/<name>/contentions,
+        /// /mutex/<name>/suspensions, and /mutex/<name>/wait-time. Throws if
+        /// the mutex was not constructed to collect statistics.
+        void install_counters(std::string const& name);
+
+    private:
+        bool try_acquire()
+        {
+            bool expected = false;
+            return locked_.compare_exchange_strong(expected, true);
+        }
+
+        void lock_contended();
+        void unlock_contended();
+        void wake_waiter();
+        void adjust_spin_count(std::size_t spins, bool acquired);
+
+    private:
+        boost::atomic<bool> locked_;
+        boost::atomic<std::size_t> waiters_;
+        boost::atomic<std::size_t> spin_count_;
+
+        mutex_type mtx_;
+        detail::condition_variable cond_;
+        bool handoff_;
+
+        boost::shared_ptr<detail::adaptive_mutex_statistics> stats_;
+    };
+}}}
+
+#endif
@@ -0,0 +1,592 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_LCOS_LOCAL_BOUNDED_CHANNEL_JUN_22_2015_0952AM)
+#define HPX_LCOS_LOCAL_BOUNDED_CHANNEL_JUN_22_2015_0952AM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/async.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/local/detail/condition_variable.hpp>
+#include <hpx/lcos/local/promise.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/move.hpp>
+
+#include <deque>
+#include <vector>
+
+#include <boost/atomic.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/scoped_array.hpp>
+#include <boost/type_traits/aligned_storage.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+
+namespace hpx { namespace lcos { namespace local
+{
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // A one-shot wake-up signal used by select() to wait on several
+        // channels at once. A signal delivered before wait() is not lost.
+        struct channel_select_waiter : boost::noncopyable
+        {
+            typedef lcos::local::spinlock mutex_type;
+
+            channel_select_waiter()
+              : signaled_(false)
+            {}
+
+            void signal()
+            {
+                mutex_type::scoped_lock l(mtx_);
+                signaled_ = true;
+                cond_.notify_one(l);
+            }
+
+            void wait()
+            {
+                mutex_type::scoped_lock l(mtx_);
+                while (!signaled_)
+                    cond_.wait(l, "channel_select_waiter::wait");
+                signaled_ = false;
+            }
+
+        private:
+            mutex_type mtx_;
+            lcos::local::detail::condition_variable cond_;
+            bool signaled_;
+        };
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A bounded multi-producer multi-consumer channel for passing values
+    /// between HPX threads.
+    ///
+    /// Values are stored in a fixed size ring buffer which is operated on
+    /// without locking, each cell carrying a sequence number telling whether
+    /// it is ready to be written or read. Only if the ring is full (for
+    /// senders) or empty (for receivers) the calling HPX thread is suspended
+    /// until the other side makes progress.
+    ///
+    /// Senders finding the ring full are queued and their values are stored
+    /// in the order the senders were blocked. No sender overtakes a blocked
+    /// one, which keeps the values sent by each producer in order.
+    ///
+    /// After close() has been called no new values may be sent. Receivers
+    /// still get all values stored in the channel, after which receive()
+    /// returns false.
+    template <typename T>
+    class bounded_channel : boost::noncopyable
+    {
+    private:
+        typedef lcos::local::spinlock mutex_type;
+
+        struct cell
+        {
+            typedef typename boost::aligned_storage<
+                    sizeof(T), boost::alignment_of<T>::value
+                >::type storage_type;
+
+            T* address()
+            {
+                return static_cast<T*>(static_cast<void*>(&storage_));
+            }
+
+            boost::atomic<std::size_t> sequence_;
+            storage_type storage_;
+        };
+
+        static std::size_t round_up_capacity(std::size_t capacity)
+        {
+            std::size_t result = 2;
+            while (result < capacity)
+                result <<= 1;
+            return result;
+        }
+
+        // A value waiting for room in the ring, the promise becomes ready
+        // once the value has been stored.
+        struct pending_send
+        {
+            explicit pending_send(T && val)
+              : val_(std::move(val))
+            {}
+
+            pending_send(pending_send && rhs)
+              : val_(std::move(rhs.val_)),
+                promise_(std::move(rhs.promise_))
+            {}
+
+            T val_;
+            lcos::local::promise<void> promise_;
+        };
+
+        typedef std::vector<lcos::local::promise<void> > completed_sends;
+
+        struct receive_task
+        {
+            explicit receive_task(bounded_channel& channel)
+              : channel_(&channel)
+            {}
+
+            T operator()() const
+            {
+                T val;
+                if (!channel_->receive(val))
+                {
+                    HPX_THROW_EXCEPTION(invalid_status,
+                        "bounded_channel::receive_async",
+                        "the channel was closed");
+                }
+                return val;
+            }
+
+            bounded_channel* channel_;
+        };
+
+    public:
+        typedef T value_type;
+
+        /// Create a new channel able to hold at least \a capacity values (the
+        /// capacity is rounded up to the next power of two).
+        explicit bounded_channel(std::size_t capacity)
+          : mask_(round_up_capacity(capacity) - 1),
+            buffer_(new cell[mask_ + 1]),
+            enqueue_pos_(0),
+            dequeue_pos_(0),
+            closed_(false),
+            waiting_senders_(0),
+            waiting_receivers_(0)
+        {
+            for (std::size_t i = 0; i <= mask_; ++i)
+                buffer_[i].sequence_.store(i, boost::memory_order_relaxed);
+        }
+
+        ~bounded_channel()
+        {
+            HPX_ASSERT(waiting_senders_.load() == 0);
+            HPX_ASSERT(waiting_receivers_.load() == 0);
+
+            // destroy all values which were never received
+            T val;
+            while (try_pop(val))
+                ;
+        }
+
+        std::size_t capacity() const
+        {
+            return mask_ + 1;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// Store the given value if the channel has room for it and no
+        /// other sender is blocked, never suspends. Throws if the channel
+        /// was closed.
+        bool try_send(T val)
+        {
+            check_closed("bounded_channel::try_send");
+            if (waiting_senders_.load() != 0 || !try_push(val))
+                return false;
+
+            notify_receivers();
+            return true;
+        }
+
+        /// Store the given value, suspending the calling thread as long as
+        /// the channel is full. Throws if the channel was closed.
+        void send(T val)
+        {
+            check_closed("bounded_channel::send");
+            if (waiting_senders_.load() == 0 && try_push(val))
+            {
+                notify_receivers();
+                return;
+            }
+
+            enqueue_send(std::move(val), "bounded_channel::send").get();
+        }
+
+        /// Retrieve a value if one is available, never suspends.
+        bool try_receive(T& val)
+        {
+            if (!try_pop(val))
+                return false;
+
+            notify_senders();
+            return true;
+        }
+
+        /// Retrieve a value, suspending the calling thread as long as the
+        /// channel is empty. Returns false if the channel was closed and
+        /// all values were received.
+        bool receive(T& val)
+        {
+            while (true)
+            {
+                // load the flag before trying to pop, a closed and empty
+                // channel will never receive any further values
+                bool closed = closed_.load();
+                if (try_pop(val))
+                    break;
+                if (closed)
+                    return false;
+
+                mutex_type::scoped_lock l(mtx_);
+
+                ++waiting_receivers_;
+                closed = closed_.load();
+                if (!try_pop(val))
+                {
+                    if (!closed)
+                        not_empty_.wait(l, "bounded_channel::receive");
+                    --waiting_receivers_;
+                    continue;
+                }
+                --waiting_receivers_;
+                break;
+            }
+
+            notify_senders();
+            return true;
+        }
+
+        /// Asynchronous variants of send() and receive(). The returned future
+        /// is ready right away if the operation could be completed without
+        /// suspending. Otherwise the value sent is queued behind the values
+        /// of the senders blocked before, and a new HPX thread is scheduled
+        /// to complete a receive. The future returned by send_async() holds
+        /// an exception if the channel is closed before the value could be
+        /// stored, the one returned by receive_async() if the channel was
+        /// closed and all values were received.
+        future<void> send_async(T val)
+        {
+            check_closed("bounded_channel::send_async");
+            if (waiting_senders_.load() == 0 && try_push(val))
+            {
+                notify_receivers();
+                return make_ready_future();
+            }
+
+            return enqueue_send(std::move(val), "bounded_channel::send_async");
+        }
+
+        future<T> receive_async()
+        {
+            T val;
+            if (try_receive(val))
+                return make_ready_future(std::move(val));
+            return hpx::async(receive_task(*this));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// Close the channel, waking up all threads waiting in send() or
+        /// receive(). The values of blocked senders are dropped. Values sent
+        /// concurrently with close() might be stored after all receivers
+        /// have returned.
+        void close()
+        {
+            closed_.store(true);
+
+            std::deque<pending_send> pending;
+
+            mutex_type::scoped_lock l(mtx_);
+            pending.swap(pending_sends_);
+            waiting_senders_.store(0);
+
+            signal_select_waiters(l);
+            not_empty_.notify_all(l);       // leaves the lock unlocked
+
+            // all blocked senders fail
+            for (pending_send& p : pending)
+            {
+                p.promise_.set_exception(HPX_GET_EXCEPTION(invalid_status,
+                    "bounded_channel::close", "the channel was closed"));
+            }
+        }
+
+        bool is_closed() const
+        {
+            return closed_.load();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Registration of threads waiting in select() for any of a set of
+        // channels to receive a value.
+        void add_select_waiter(detail::channel_select_waiter* waiter)
+        {
+            mutex_type::scoped_lock l(mtx_);
+            select_waiters_.push_back(waiter);
+            ++waiting_receivers_;
+        }
+
+        void remove_select_waiter(detail::channel_select_waiter* waiter)
+        {
+            mutex_type::scoped_lock l(mtx_);
+            typedef std::vector<detail::channel_select_waiter*>::iterator
+                iterator;
+            for (iterator it = select_waiters_.begin();
+                 it != select_waiters_.end(); ++it)
+            {
+                if (*it == waiter)
+                {
+                    select_waiters_.erase(it);
+                    --waiting_receivers_;
+                    break;
+                }
+            }
+        }
+
+    private:
+        void check_closed(char const* function_name) const
+        {
+            if (closed_.load(boost::memory_order_relaxed))
+            {
+                HPX_THROW_EXCEPTION(invalid_status, function_name,
+                    "the channel was closed");
+            }
+        }
+
+        // Queue the value behind the values of the senders blocked before,
+        // the returned future becomes ready once the value has been stored.
+        future<void> enqueue_send(T && val, char const* function_name)
+        {
+            completed_sends completed;
+            future<void> f;
+
+            {
+                mutex_type::scoped_lock l(mtx_);
+                check_closed(function_name);
+
+                pending_sends_.push_back(pending_send(std::move(val)));
+                f = pending_sends_.back().promise_.get_future();
+
+                // announce this sender before checking again, so that a
+                // receiver making room either sees us or we see the room
+                ++waiting_senders_;
+                boost::atomic_thread_fence(boost::memory_order_seq_cst);
+                store_pending_sends(completed);
+            }
+
+            complete_sends(completed);
+            return f;
+        }
+
+        // Store the values of the blocked senders in the order they were
+        // queued, as long as the ring has room. This has to be called while
+        // holding mtx_.
+        void store_pending_sends(completed_sends& completed)
+        {
+            while (!pending_sends_.empty() &&
+                try_push(pending_sends_.front().val_))
+            {
+                completed.push_back(std::move(pending_sends_.front().promise_));
+                pending_sends_.pop_front();
+                --waiting_senders_;
+            }
+        }
+
+        void complete_sends(completed_sends& completed)
+        {
+            if (completed.empty())
+                return;
+
+            for (lcos::local::promise<void>& p : completed)
+                p.set_value();
+
+            notify_receivers();
+        }
+
+        // Move the value into the next free cell, leaves the value untouched
+        // if the ring is full.
+        bool try_push(T& val)
+        {
+            cell* c = 0;
+            std::size_t pos = enqueue_pos_.load(boost::memory_order_relaxed);
+            while (true)
+            {
+                c = &buffer_[pos & mask_];
+                std::size_t seq = c->sequence_.load(boost::memory_order_acquire);
+                std::ptrdiff_t diff =
+                    static_cast<std::ptrdiff_t>(seq) -
+                    static_cast<std::ptrdiff_t>(pos);
+
+                if (diff == 0)
+                {
+                    if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                            boost::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;           // the ring is full
+                }
+                else
+                {
+                    pos = enqueue_pos_.load(boost::memory_order_relaxed);
+                }
+            }
+
+            new (c->address()) T(std::move(val));
+            c->sequence_.store(pos + 1, boost::memory_order_release);
+            return true;
+        }
+
+        bool try_pop(T& val)
+        {
+            cell* c = 0;
+            std::size_t pos = dequeue_pos_.load(boost::memory_order_relaxed);
+            while (true)
+            {
+                c = &buffer_[pos & mask_];
+                std::size_t seq = c->sequence_.load(boost::memory_order_acquire);
+                std::ptrdiff_t diff =
+                    static_cast<std::ptrdiff_t>(seq) -
+                    static_cast<std::ptrdiff_t>(pos + 1);
+
+                if (diff == 0)
+                {
+                    if (dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                            boost::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;           // the ring is empty
+                }
+                else
+                {
+                    pos = dequeue_pos_.load(boost::memory_order_relaxed);
+                }
+            }
+
+            T* p = c->address();
+            val = std::move(*p);
+            p->~T();
+            c->sequence_.store(pos + mask_ + 1, boost::memory_order_release);
+            return true;
+        }
+
+        // The fences pair with the increments of the waiter counts done
+        // by suspending threads before they re-check the ring: either the
+        // waiter sees the new state of the ring or we see the waiter.
+        void notify_receivers()
+        {
+            boost::atomic_thread_fence(boost::memory_order_seq_cst);
+            if (waiting_receivers_.load() == 0)
+                return;
+
+            mutex_type::scoped_lock l(mtx_);
+            signal_select_waiters(l);
+            not_empty_.notify_one(l);
+        }
+
+        // The waiters have to be signaled while holding the lock, otherwise
+        // they could return from select() and go out of scope in between.
+        void signal_select_waiters(mutex_type::scoped_lock& l)
+        {
+            HPX_ASSERT(l.owns_lock());
+            for (std::size_t i = 0; i != select_waiters_.size(); ++i)
+                select_waiters_[i]->signal();
+        }
+
+        void notify_senders()
+        {
+            boost::atomic_thread_fence(boost::memory_order_seq_cst);
+            if (waiting_senders_.load() == 0)
+                return;
+
+            completed_sends completed;
+            {
+                mutex_type::scoped_lock l(mtx_);
+                store_pending_sends(completed);
+            }
+            complete_sends(completed);
+        }
+
+    private:
+        std::size_t const mask_;
+        boost::scoped_array<cell> buffer_;
+
+        boost::atomic<std::size_t> enqueue_pos_;
+        boost::atomic<std::size_t> dequeue_pos_;
+        boost::atomic<bool> closed_;
+
+        boost::atomic<std::size_t> waiting_senders_;
+        boost::atomic<std::size_t> waiting_receivers_;
+
+        mutex_type mtx_;
+        lcos::local::detail::condition_variable not_empty_;
+        std::vector<detail::channel_select_waiter*> select_waiters_;
+
+        // the senders blocked on a full ring, in the order they were blocked
+        std::deque<pending_send> pending_sends_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Receive a value from the first of the given channels holding one,
+    /// suspending the calling thread until any of them does. Returns the
+    /// index of the channel the value was received from, or std::size_t(-1)
+    /// if all channels were closed and all values were received.
+    template <typename T>
+    std::size_t select(std::vector<bounded_channel<T>*> const& channels,
+        T& val)
+    {
+        std::size_t const npos = std::size_t(-1);
+        detail::channel_select_waiter waiter;
+
+        while (true)
+        {
+            for (int pass = 0; pass != 2; ++pass)
+            {
+                bool all_closed = true;
+                for (std::size_t i = 0; i != channels.size(); ++i)
+                {
+                    bool closed = channels[i]->is_closed();
+                    if (channels[i]->try_receive(val))
+                    {
+                        if (pass != 0)
+                        {
+                            for (std::size_t j = 0; j != channels.size(); ++j)
+                                channels[j]->remove_select_waiter(&waiter);
+                        }
+                        return i;
+                    }
+                    if (!closed)
+                        all_closed = false;
+                }
+
+                if (all_closed)
+                {
+                    if (pass != 0)
+                    {
+                        for (std::size_t j = 0; j != channels.size(); ++j)
+                            channels[j]->remove_select_waiter(&waiter);
+                    }
+                    return npos;
+                }
+
+                // register with all channels before checking them again, so
+                // that no value sent in between goes unnoticed
+                if (pass == 0)
+                {
+                    for (std::size_t j = 0; j != channels.size(); ++j)
+                        channels[j]->add_select_waiter(&waiter);
+                }
+            }
+
+            waiter.wait();
+
+            for (std::size_t j = 0; j != channels.size(); ++j)
+                channels[j]->remove_select_waiter(&waiter);
+        }
+    }
+}}}
+
+#endif
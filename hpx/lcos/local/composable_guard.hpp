@@ -14,6 +14,8 @@ namespace hpx { namespace lcos { namespace local {
 #include <hpx/util/assert.hpp>
 
 #include <boost/atomic.hpp>
+#include <boost/exception_ptr.hpp>
+#include <boost/function.hpp>
 #include <boost/shared_ptr.hpp>
 
 #include <vector>
@@ -48,10 +50,18 @@ namespace hpx { namespace lcos { namespace local {
 struct guard_task;
 HPX_API_EXPORT void free(guard_task *task);
 
+/// A guard created in combining mode does not spawn a new thread for each
+/// task. The thread finding the guard free runs its task directly, and then
+/// continues with the tasks queued on the guard in the meantime (up to a
+/// fixed number of them, the rest is handed to a new thread). Exceptions
+/// thrown by a task are reported the same way in both modes (see
+/// set_guard_error_handler), they never propagate out of run_guarded.
 struct guard : DebugObject {
     guard_atomic task;
+    const bool combining;
 
-    guard() : task((guard_task *)0) {}
+    explicit guard(bool combining_ = false)
+      : task((guard_task *)0), combining(combining_) {}
     ~guard() {
         free(task.load());
     }
@@ -76,12 +86,25 @@ public:
     boost::shared_ptr<guard> get(std::size_t i) { return guards[i]; }
 };
 
+/// The function invoked with an exception thrown by a guarded task.
+typedef boost::function<void(boost::exception_ptr const&)> guard_error_handler;
+
+/// Install the function invoked with the exceptions thrown by guarded
+/// tasks, returns the previously installed one. By default (or if an empty
+/// function is installed) the exceptions are passed to hpx::report_error,
+/// just like an exception escaping any other HPX thread. The guards of the
+/// throwing task are released as usual, queued tasks keep running.
+HPX_API_EXPORT guard_error_handler set_guard_error_handler(
+    guard_error_handler const& f);
+
 /// Conceptually, a guard acts like a mutex on an asyncrhonous task. The
 /// mutex is locked before the task runs, and unlocked afterwards.
 HPX_API_EXPORT void run_guarded(guard& guard,boost::function<void()> task);
 
 /// Conceptually, a guard_set acts like a set of mutexes on an asyncrhonous task. The
-/// mutexes are locked before the task runs, and unlocked afterwards.
+/// mutexes are locked before the task runs, and unlocked afterwards. The guards
+/// are acquired in order, the thread which acquired a guard continues with the
+/// next one as long as they are free.
 HPX_API_EXPORT void run_guarded(guard_set& guards,boost::function<void()> task);
 }}}
 #endif
@@ -0,0 +1,308 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_LCOS_LOCAL_FULL_EMPTY_ARRAY_OCT_19_2015_0347PM)
+#define HPX_LCOS_LOCAL_FULL_EMPTY_ARRAY_OCT_19_2015_0347PM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/lcos/local/detail/condition_variable.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/runtime/threads/thread_helpers.hpp>
+#include <hpx/util/assert.hpp>
+
+#include <map>
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/scoped_array.hpp>
+#include <boost/shared_ptr.hpp>
+
+namespace hpx { namespace lcos { namespace local
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// An array of memory locations guarded by full/empty bits, see
+    /// lcos::detail::full_empty for the semantics of the operations.
+    ///
+    /// Each element consists of the value and a state word holding the
+    /// full/empty bit. Operations which find an element in the required
+    /// state complete with a single atomic operation on the state word
+    /// without taking any lock. Only operations which have to wait for an
+    /// element to change its state register with a wait queue, which is
+    /// shared by all elements of the array and allocates the bookkeeping for
+    /// an element only while threads are waiting on it.
+    ///
+    /// \tparam T   The type of the elements, this has to be a trivially
+    ///             copyable type usable with boost::atomic.
+    template <typename T>
+    class full_empty_array : boost::noncopyable
+    {
+    private:
+        typedef lcos::local::spinlock mutex_type;
+
+        // The state word holds the full bit, a busy bit set while a value
+        // is being stored or extracted, and a bit telling that threads are
+        // waiting for the element to change its state. The remaining bits
+        // count the state changes, which allows readers to detect that the
+        // value has changed while reading it.
+        enum state_bits
+        {
+            full = 0x1,
+            busy = 0x2,
+            waiters = 0x4,
+            generation_shift = 3
+        };
+
+        struct entry
+        {
+            entry()
+              : state_(0), value_(T())
+            {}
+
+            boost::atomic<boost::uint64_t> state_;
+            boost::atomic<T> value_;
+        };
+
+        struct wait_entry
+        {
+            wait_entry()
+              : count_(0)
+            {}
+
+            lcos::local::detail::condition_variable cond_;
+            std::size_t count_;
+        };
+
+        typedef std::map<std::size_t, boost::shared_ptr<wait_entry> >
+            wait_map_type;
+
+        static boost::uint64_t next_state(boost::uint64_t s,
+            boost::uint64_t bits)
+        {
+            return (((s >> generation_shift) + 1) << generation_shift) | bits;
+        }
+
+    public:
+        /// Create a new array of the given size, all elements are either
+        /// empty or full, holding a default constructed value.
+        explicit full_empty_array(std::size_t size, bool is_full = false)
+          : size_(size), data_(new entry[size])
+        {
+            if (is_full)
+            {
+                for (std::size_t i = 0; i != size_; ++i)
+                    data_[i].state_.store(full, boost::memory_order_relaxed);
+            }
+        }
+
+        ~full_empty_array()
+        {
+            HPX_ASSERT(wait_map_.empty());
+        }
+
+        std::size_t size() const
+        {
+            return size_;
+        }
+
+        /// Query the current state of the element
+        bool is_empty(std::size_t i) const
+        {
+            HPX_ASSERT(i < size_);
+            return !(data_[i].state_.load(boost::memory_order_acquire) & full);
+        }
+
+        /// Set the element to empty, releases threads waiting for it to
+        /// become empty
+        void set_empty(std::size_t i)
+        {
+            change_state(i, 0);
+        }
+
+        /// Set the element to full, releases threads waiting for it to
+        /// become full
+        void set_full(std::size_t i)
+        {
+            change_state(i, full);
+        }
+
+        /// Wait for the element to become full and read it, leaves the
+        /// element full.
+        T read(std::size_t i)
+        {
+            HPX_ASSERT(i < size_);
+            entry& e = data_[i];
+
+            while (true)
+            {
+                boost::uint64_t s = e.state_.load(boost::memory_order_acquire);
+                if ((s & (full | busy)) == full)
+                {
+                    T val = e.value_.load(boost::memory_order_relaxed);
+
+                    // the value is valid if the element was not changed
+                    // while reading it
+                    boost::atomic_thread_fence(boost::memory_order_acquire);
+                    if ((e.state_.load(boost::memory_order_relaxed) & ~waiters)
+                        == (s & ~waiters))
+                    {
+                        return val;
+                    }
+                }
+                else if (!(s & busy))
+                {
+                    wait(i, s);
+                }
+            }
+        }
+
+        /// Wait for the element to become full and read it, sets the element
+        /// to empty.
+        T read_and_empty(std::size_t i)
+        {
+            HPX_ASSERT(i < size_);
+            entry& e = data_[i];
+
+            while (true)
+            {
+                boost::uint64_t s = e.state_.load(boost::memory_order_acquire);
+                if ((s & (full | busy)) == full)
+                {
+                    if (!e.state_.compare_exchange_weak(s, s | busy))
+                        continue;
+
+                    T val = e.value_.load(boost::memory_order_relaxed);
+                    release(i, s, 0);
+                    return val;
+                }
+                else if (!(s & busy))
+                {
+                    wait(i, s);
+                }
+            }
+        }
+
+        /// Wait for the element to become empty and fill it
+        void write(std::size_t i, T const& val)
+        {
+            HPX_ASSERT(i < size_);
+            entry& e = data_[i];
+
+            while (true)
+            {
+                boost::uint64_t s = e.state_.load(boost::memory_order_acquire);
+                if ((s & (full | busy)) == 0)
+                {
+                    if (!e.state_.compare_exchange_weak(s, s | busy))
+                        continue;
+
+                    e.value_.store(val, boost::memory_order_relaxed);
+                    release(i, s, full);
+                    return;
+                }
+                else if (!(s & busy))
+                {
+                    wait(i, s);
+                }
+            }
+        }
+
+        /// Store the value and set the element to full without waiting for
+        /// it to become empty.
+        void set(std::size_t i, T const& val)
+        {
+            HPX_ASSERT(i < size_);
+            entry& e = data_[i];
+
+            while (true)
+            {
+                boost::uint64_t s = e.state_.load(boost::memory_order_acquire);
+                if (!(s & busy) && e.state_.compare_exchange_weak(s, s | busy))
+                {
+                    e.value_.store(val, boost::memory_order_relaxed);
+                    release(i, s, full);
+                    return;
+                }
+            }
+        }
+
+    private:
+        // Publish the new state of an element marked busy before, wakes up
+        // all threads waiting on it (they will check the new state again).
+        void release(std::size_t i, boost::uint64_t s, boost::uint64_t bits)
+        {
+            data_[i].state_.store(next_state(s, bits),
+                boost::memory_order_release);
+
+            if (s & waiters)
+                notify(i);
+        }
+
+        // Change the full/empty bit only, wakes up all threads waiting on
+        // the element (they will check the new state again).
+        void change_state(std::size_t i, boost::uint64_t bits)
+        {
+            HPX_ASSERT(i < size_);
+            entry& e = data_[i];
+
+            boost::uint64_t s = e.state_.load(boost::memory_order_acquire);
+            while (true)
+            {
+                if (s & busy)
+                {
+                    s = e.state_.load(boost::memory_order_acquire);
+                    continue;
+                }
+                if (e.state_.compare_exchange_weak(s, next_state(s, bits)))
+                    break;
+            }
+
+            if (s & waiters)
+                notify(i);
+        }
+
+        // Suspend the calling thread until the state of the element changes
+        // from the given one. The waiters bit is set while holding the lock
+        // protecting the wait queues, a thread changing the state either
+        // sees the bit or this thread sees the changed state.
+        void wait(std::size_t i, boost::uint64_t s)
+        {
+            HPX_ASSERT(threads::get_self_ptr() != 0);
+
+            mutex_type::scoped_lock l(mtx_);
+            if (!data_[i].state_.compare_exchange_strong(s, s | waiters))
+                return;
+
+            boost::shared_ptr<wait_entry>& p = wait_map_[i];
+            if (!p)
+                p = boost::make_shared<wait_entry>();
+
+            boost::shared_ptr<wait_entry> w(p);
+            ++w->count_;
+            w->cond_.wait(l, "full_empty_array::wait");
+            if (--w->count_ == 0)
+                wait_map_.erase(i);
+        }
+
+        void notify(std::size_t i)
+        {
+            mutex_type::scoped_lock l(mtx_);
+
+            typename wait_map_type::iterator it = wait_map_.find(i);
+            if (it != wait_map_.end())
+                it->second->cond_.notify_all(l);    // leaves the lock unlocked
+        }
+
+    private:
+        std::size_t const size_;
+        boost::scoped_array<entry> data_;
+
+        mutex_type mtx_;
+        wait_map_type wait_map_;
+    };
+}}}
+
+#endif
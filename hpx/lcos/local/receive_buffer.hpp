@@ -16,6 +16,7 @@
 
 #include <utility>
 #include <map>
+#include <vector>
 
 #include <boost/shared_ptr.hpp>
 #include <boost/make_shared.hpp>
@@ -322,7 +323,149 @@ namespace hpx { namespace lcos { namespace local
         mutable mutex_type mtx_;
         buffer_map_type buffer_map_;
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A receive_buffer variant for exchanges where the steps in flight stay
+    // within a window of known size. The entries live in a fixed ring of
+    // slots indexed by step modulo the capacity, which avoids the allocation
+    // of a map node and of the entry for each step. If the value arrives
+    // before it is asked for, it is kept in the slot and handed out as a
+    // ready future, otherwise a promise is created on demand.
+    template <typename T, typename Mutex = lcos::local::spinlock>
+    struct ring_receive_buffer
+    {
+    protected:
+        typedef Mutex mutex_type;
+        typedef hpx::lcos::local::promise<T> buffer_promise_type;
+
+        struct entry_data
+        {
+            entry_data()
+              : step_(std::size_t(-1)),
+                has_value_(false),
+                future_retrieved_(false)
+            {}
+
+            void reset()
+            {
+                step_ = std::size_t(-1);
+                has_value_ = false;
+                future_retrieved_ = false;
+            }
+
+            std::size_t step_;
+            bool has_value_;
+            bool future_retrieved_;
+            T value_;
+            buffer_promise_type promise_;
+        };
+
+        typedef std::vector<entry_data> buffer_type;
+
+    private:
+        HPX_MOVABLE_BUT_NOT_COPYABLE(ring_receive_buffer)
+
+    public:
+        /// \a capacity is the number of steps which may be in flight at the
+        /// same time, i.e. received or asked for but not both.
+        explicit ring_receive_buffer(std::size_t capacity)
+          : buffer_(capacity)
+        {
+            HPX_ASSERT(capacity != 0);
+        }
+
+        ring_receive_buffer(ring_receive_buffer && other)
+          : buffer_(std::move(other.buffer_))
+        {}
+
+        ring_receive_buffer& operator=(ring_receive_buffer && other)
+        {
+            if(this != &other)
+            {
+                buffer_ = std::move(other.buffer_);
+            }
+            return *this;
+        }
+
+        hpx::future<T> receive(std::size_t step)
+        {
+            typename mutex_type::scoped_lock l(mtx_);
+
+            entry_data& entry = get_buffer_entry(step);
+            HPX_ASSERT(!entry.future_retrieved_);
+
+            // if the value was already stored, hand it out and release the
+            // slot
+            if (entry.has_value_)
+            {
+                T val(std::move(entry.value_));
+                entry.reset();
+                l.unlock();
+
+                return hpx::make_ready_future(std::move(val));
+            }
+
+            // otherwise leave a promise behind to be set once the value
+            // arrives
+            buffer_promise_type p;
+            hpx::future<T> f = p.get_future();
+
+            entry.promise_ = std::move(p);
+            entry.future_retrieved_ = true;
+            return f;
+        }
+
+        void store_received(std::size_t step, T && val)
+        {
+            typename mutex_type::scoped_lock l(mtx_);
+
+            entry_data& entry = get_buffer_entry(step);
+            HPX_ASSERT(!entry.has_value_);
+
+            if (!entry.future_retrieved_)
+            {
+                // nobody asked for the value yet, keep it in the slot
+                entry.value_ = std::move(val);
+                entry.has_value_ = true;
+                return;
+            }
+
+            // the future was already retrieved, release the slot
+            buffer_promise_type p(std::move(entry.promise_));
+            entry.reset();
+            l.unlock();
+
+            // set value in promise, but only after the lock was released
+            p.set_value(std::move(val));
+        }
+
+        std::size_t capacity() const
+        {
+            return buffer_.size();
+        }
+
+    protected:
+        entry_data& get_buffer_entry(std::size_t step)
+        {
+            entry_data& entry = buffer_[step % buffer_.size()];
+            if (entry.step_ == std::size_t(-1))
+            {
+                entry.step_ = step;
+            }
+            else if (entry.step_ != step)
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "ring_receive_buffer::get_buffer_entry",
+                    "the given step is outside of the window covered by "
+                    "the receive buffer");
+            }
+            return entry;
+        }
+
+    private:
+        mutable mutex_type mtx_;
+        buffer_type buffer_;
+    };
 }}}
 
 #endif
-
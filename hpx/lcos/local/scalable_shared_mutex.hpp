@@ -0,0 +1,244 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_LCOS_LOCAL_SCALABLE_SHARED_MUTEX_OCT_19_2015_1127AM)
+#define HPX_LCOS_LOCAL_SCALABLE_SHARED_MUTEX_OCT_19_2015_1127AM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/lcos/local/detail/condition_variable.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/util/assert.hpp>
+
+#include <cstddef>
+
+#include <boost/atomic.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/scoped_array.hpp>
+
+namespace hpx { namespace lcos { namespace local
+{
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // A reader-writer lock for read-mostly data.
+        //
+        // Readers announce themselves by incrementing a counter belonging to
+        // the worker thread they run on, each counter lives on its own cache
+        // line. As long as no writer is around, acquiring and releasing a
+        // shared lock touches only that counter. A reader may be resumed on
+        // a different worker thread than the one it acquired the lock on,
+        // the counters are therefore signed and only their sum is meaningful.
+        //
+        // A writer first raises the writer flag, which makes arriving readers
+        // back off and suspend, and then waits for the sum of all counters
+        // to drop to zero. Readers suspended while a writer held the lock
+        // are admitted as a group once it is released, before the next
+        // writer may enter. This prefers writers over new readers without
+        // starving readers.
+        //
+        // This lock does not support upgrade ownership.
+        template <typename Mutex = lcos::local::spinlock>
+        class scalable_shared_mutex : boost::noncopyable
+        {
+        private:
+            typedef Mutex mutex_type;
+
+            enum { cache_line_size = 64 };
+
+            struct reader_counter
+            {
+                reader_counter()
+                  : count_(0)
+                {}
+
+                typedef boost::atomic<std::ptrdiff_t> counter_type;
+
+                counter_type count_;
+                char padding_[cache_line_size - sizeof(counter_type)];
+            };
+
+            static std::size_t get_num_counters(std::size_t num_counters)
+            {
+                if (num_counters != 0)
+                    return num_counters;
+                if (get_runtime_ptr() == 0)
+                    return 1;
+                return get_os_thread_count();
+            }
+
+        public:
+            /// \param num_counters The number of reader counters, the default
+            ///                     is the number of worker threads
+            explicit scalable_shared_mutex(std::size_t num_counters = 0)
+              : num_counters_(get_num_counters(num_counters)),
+                counters_(new reader_counter[num_counters_]),
+                admitted_(0),
+                writer_(false),
+                waiting_readers_(0),
+                phase_(0)
+            {}
+
+            ~scalable_shared_mutex()
+            {
+                HPX_ASSERT(!writer_.load());
+                HPX_ASSERT(!readers_present());
+            }
+
+            void lock_shared()
+            {
+                reader_counter& c = get_counter();
+                ++c.count_;
+                if (!writer_.load())
+                    return;
+
+                // a writer is waiting or active, back off
+                --c.count_;
+                notify_writer();
+                lock_shared_slow();
+            }
+
+            bool try_lock_shared()
+            {
+                reader_counter& c = get_counter();
+                ++c.count_;
+                if (!writer_.load())
+                    return true;
+
+                --c.count_;
+                notify_writer();
+                return false;
+            }
+
+            void unlock_shared()
+            {
+                --get_counter().count_;
+                if (writer_.load())
+                    notify_writer();
+            }
+
+            void lock()
+            {
+                typename mutex_type::scoped_lock l(mtx_);
+
+                while (writer_.load())
+                    writers_cond_.wait(l, "scalable_shared_mutex::lock");
+
+                writer_.store(true);
+
+                // wait for the readers to leave
+                while (readers_present())
+                    drained_cond_.wait(l, "scalable_shared_mutex::lock");
+            }
+
+            bool try_lock()
+            {
+                typename mutex_type::scoped_lock l(mtx_);
+                if (writer_.load())
+                    return false;
+
+                writer_.store(true);
+                if (!readers_present())
+                    return true;
+
+                // readers might have backed off in between, let them in
+                release(l);
+                return false;
+            }
+
+            void unlock()
+            {
+                typename mutex_type::scoped_lock l(mtx_);
+                HPX_ASSERT(writer_.load());
+                release(l);
+            }
+
+        private:
+            reader_counter& get_counter()
+            {
+                return counters_[get_worker_thread_num() % num_counters_];
+            }
+
+            // A counter may be read while another reader moves from one
+            // counter to another (when resumed on a different worker), the
+            // sum may be too large but never too small.
+            bool readers_present() const
+            {
+                std::ptrdiff_t sum = admitted_.load();
+                for (std::size_t i = 0; i != num_counters_; ++i)
+                    sum += counters_[i].count_.load();
+                return sum > 0;
+            }
+
+            // Wake up a writer waiting for the readers to leave. The writer
+            // checks the counters while holding the lock, after raising its
+            // flag. Either it sees the decremented counter or we see its
+            // flag and take the lock after it went to sleep.
+            void notify_writer()
+            {
+                typename mutex_type::scoped_lock l(mtx_);
+                drained_cond_.notify_one(l);
+            }
+
+            void lock_shared_slow()
+            {
+                typename mutex_type::scoped_lock l(mtx_);
+
+                // the writer flag is only changed while holding the lock
+                if (!writer_.load())
+                {
+                    ++get_counter().count_;
+                    return;
+                }
+
+                ++waiting_readers_;
+
+                std::size_t phase = phase_;
+                do {
+                    readers_cond_.wait(l, "scalable_shared_mutex::lock_shared");
+                } while (phase == phase_);
+
+                // this reader was admitted by the writer releasing the lock,
+                // the increment of the counter has to precede the decrement
+                // of the admitted readers to keep the sum from dropping
+                ++get_counter().count_;
+                --admitted_;
+            }
+
+            // Release the writer ownership, admitting all readers which are
+            // waiting for it.
+            void release(typename mutex_type::scoped_lock& l)
+            {
+                if (waiting_readers_ != 0)
+                {
+                    admitted_ += static_cast<std::ptrdiff_t>(waiting_readers_);
+                    waiting_readers_ = 0;
+                    ++phase_;
+                }
+
+                writer_.store(false);
+
+                writers_cond_.notify_one(l);
+                readers_cond_.notify_all(l);    // leaves the lock unlocked
+            }
+
+        private:
+            std::size_t const num_counters_;
+            boost::scoped_array<reader_counter> counters_;
+            boost::atomic<std::ptrdiff_t> admitted_;
+            boost::atomic<bool> writer_;
+
+            mutex_type mtx_;
+            std::size_t waiting_readers_;
+            std::size_t phase_;
+            lcos::local::detail::condition_variable readers_cond_;
+            lcos::local::detail::condition_variable writers_cond_;
+            lcos::local::detail::condition_variable drained_cond_;
+        };
+    }
+
+    typedef detail::scalable_shared_mutex<> scalable_shared_mutex;
+}}}
+
+#endif
@@ -0,0 +1,325 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_LCOS_SERVER_HIERARCHICAL_BARRIER_OCT_07_2015_0925AM)
+#define HPX_LCOS_SERVER_HIERARCHICAL_BARRIER_OCT_07_2015_0925AM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/local/promise.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/runtime/actions/component_action.hpp>
+#include <hpx/runtime/applier/apply.hpp>
+#include <hpx/runtime/components/server/simple_component_base.hpp>
+#include <hpx/runtime/naming/name.hpp>
+#include <hpx/util/scoped_unlock.hpp>
+
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace lcos
+{
+    /// The communication pattern used by a \a hierarchical_barrier to
+    /// synchronize the participating sites.
+    enum hierarchical_barrier_mode
+    {
+        /// The sites form a k-ary tree. Arrivals are combined towards the
+        /// root, the release is propagated from the root to the leaves
+        /// (2 * log_k(N) message latencies, N - 1 messages each way).
+        tree_mode = 0,
+
+        /// Each site notifies the site 2^r positions ahead in round r and
+        /// waits for the notification from the site 2^r positions behind
+        /// (log_2(N) message latencies, N messages per round).
+        dissemination_mode = 1
+    };
+}}
+
+namespace hpx { namespace lcos { namespace server
+{
+    /// The part of a \a hpx::lcos::hierarchical_barrier living on one of
+    /// the participating sites (localities). All threads entering the
+    /// barrier on this site are combined locally before the site takes part
+    /// in the communication with the other sites.
+    ///
+    /// Each use of the barrier is a new generation. As no site can be more
+    /// than one generation ahead of any other site, the state related to the
+    /// messages from other sites is kept for two generations (indexed by the
+    /// parity of the generation).
+    class hierarchical_barrier
+      : public components::simple_component_base<hierarchical_barrier>
+    {
+    private:
+        typedef lcos::local::spinlock mutex_type;
+        typedef std::vector<lcos::local::promise<void> > waiters_type;
+
+    public:
+        hierarchical_barrier()
+          : mode_(tree_mode), arity_(2), num_sites_(1), this_site_(0),
+            num_local_(1), generation_(0), local_arrived_(0),
+            local_complete_(false), round_(0), round_sent_(false)
+        {
+            HPX_ASSERT(false);  // shouldn't ever be called
+        }
+
+        hierarchical_barrier(std::size_t num_sites, std::size_t this_site,
+                std::size_t num_local, int mode, std::size_t arity)
+          : mode_(static_cast<hierarchical_barrier_mode>(mode)),
+            arity_(arity < 2 ? 2 : arity),
+            num_sites_(num_sites), this_site_(this_site),
+            num_local_(num_local), generation_(0), local_arrived_(0),
+            local_complete_(false), round_(0), round_sent_(false)
+        {
+            HPX_ASSERT(this_site_ < num_sites_ && num_local_ != 0);
+
+            children_arrived_[0] = children_arrived_[1] = 0;
+            received_[0].resize(get_num_rounds(), 0);
+            received_[1].resize(get_num_rounds(), 0);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The sites this site sends messages to
+        //
+        // tree mode:          the parent (if any), followed by the children
+        // dissemination mode: the site to notify in each of the rounds
+        std::vector<std::size_t> get_peer_sites() const
+        {
+            std::vector<std::size_t> sites;
+            if (mode_ == tree_mode)
+            {
+                if (this_site_ != 0)
+                    sites.push_back((this_site_ - 1) / arity_);
+
+                for (std::size_t i = 1; i <= arity_; ++i)
+                {
+                    std::size_t child = this_site_ * arity_ + i;
+                    if (child >= num_sites_)
+                        break;
+                    sites.push_back(child);
+                }
+            }
+            else
+            {
+                for (std::size_t r = 0; r != get_num_rounds(); ++r)
+                {
+                    sites.push_back(
+                        (this_site_ + (std::size_t(1) << r)) % num_sites_);
+                }
+            }
+            return sites;
+        }
+
+        // The ids of the sites returned by get_peer_sites, this has to be
+        // called before the barrier is used for the first time.
+        void set_peers(std::vector<naming::id_type> const& peers)
+        {
+            mutex_type::scoped_lock l(mtx_);
+            peers_ = peers;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// Enter the barrier from this site. The returned future becomes
+        /// ready once all threads on all sites have entered the barrier.
+        future<void> arrive()
+        {
+            mutex_type::scoped_lock l(mtx_);
+
+            waiters_.push_back(lcos::local::promise<void>());
+            future<void> f = waiters_.back().get_future();
+
+            if (++local_arrived_ == num_local_)
+            {
+                local_complete_ = true;
+                if (mode_ == tree_mode)
+                    tree_progress(l);
+                else
+                    dissemination_progress(l);
+            }
+            return f;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // tree mode: all sites in the subtree of the given child have
+        // entered the barrier
+        void child_arrived(std::size_t generation)
+        {
+            mutex_type::scoped_lock l(mtx_);
+            HPX_ASSERT(generation == generation_);
+
+            ++children_arrived_[generation % 2];
+            tree_progress(l);
+        }
+
+        // tree mode: all sites have entered the barrier
+        void release(std::size_t generation)
+        {
+            mutex_type::scoped_lock l(mtx_);
+            HPX_ASSERT(generation == generation_);
+
+            release_locked(l);
+        }
+
+        // dissemination mode: the site 2^round positions behind has
+        // completed the given round
+        void notify(std::size_t generation, std::size_t round)
+        {
+            mutex_type::scoped_lock l(mtx_);
+            HPX_ASSERT(round < get_num_rounds());
+
+            ++received_[generation % 2][round];
+            if (generation == generation_ && local_complete_)
+                dissemination_progress(l);
+        }
+
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(hierarchical_barrier,
+            child_arrived, child_arrived_action);
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(hierarchical_barrier,
+            release, release_action);
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(hierarchical_barrier,
+            notify, notify_action);
+
+    private:
+        std::size_t get_num_rounds() const
+        {
+            std::size_t rounds = 0;
+            while ((std::size_t(1) << rounds) < num_sites_)
+                ++rounds;
+            return rounds;
+        }
+
+        std::size_t get_num_children() const
+        {
+            return peers_.size() - (this_site_ != 0 ? 1 : 0);
+        }
+
+        // Release all local threads and start the next generation. All
+        // messages are sent (and all threads are released) after the lock
+        // has been released.
+        void release_locked(mutex_type::scoped_lock& l)
+        {
+            std::size_t generation = generation_;
+
+            waiters_type waiters;
+            std::swap(waiters, waiters_);
+
+            local_arrived_ = 0;
+            local_complete_ = false;
+            children_arrived_[generation % 2] = 0;
+            round_ = 0;
+            round_sent_ = false;
+            ++generation_;
+
+            std::vector<naming::id_type> children;
+            if (mode_ == tree_mode)
+            {
+                children.assign(
+                    peers_.begin() + (this_site_ != 0 ? 1 : 0), peers_.end());
+            }
+
+            l.unlock();
+
+            for (naming::id_type const& child : children)
+                hpx::apply<release_action>(child, generation);
+
+            for (lcos::local::promise<void>& p : waiters)
+                p.set_value();
+        }
+
+        void tree_progress(mutex_type::scoped_lock& l)
+        {
+            if (!local_complete_ ||
+                children_arrived_[generation_ % 2] != get_num_children())
+            {
+                return;
+            }
+
+            if (this_site_ == 0)
+            {
+                release_locked(l);      // the root releases everybody
+                return;
+            }
+
+            // notify the parent
+            naming::id_type parent = peers_[0];
+            std::size_t generation = generation_;
+
+            l.unlock();
+            hpx::apply<child_arrived_action>(parent, generation);
+        }
+
+        void dissemination_progress(mutex_type::scoped_lock& l)
+        {
+            std::size_t num_rounds = get_num_rounds();
+            std::size_t generation = generation_;
+            std::vector<std::size_t>& received = received_[generation % 2];
+
+            std::vector<std::pair<naming::id_type, std::size_t> > messages;
+            while (round_ != num_rounds)
+            {
+                if (!round_sent_)
+                {
+                    messages.push_back(std::make_pair(peers_[round_], round_));
+                    round_sent_ = true;
+                }
+
+                if (received[round_] == 0)
+                    break;
+
+                --received[round_];
+                ++round_;
+                round_sent_ = false;
+            }
+
+            bool done = (round_ == num_rounds);
+
+            {
+                util::scoped_unlock<mutex_type::scoped_lock> ul(l);
+                for (auto const& m : messages)
+                {
+                    hpx::apply<notify_action>(m.first, generation, m.second);
+                }
+            }
+
+            if (done && generation == generation_)
+                release_locked(l);
+        }
+
+    private:
+        mutex_type mtx_;
+
+        hierarchical_barrier_mode const mode_;
+        std::size_t const arity_;
+        std::size_t const num_sites_;
+        std::size_t const this_site_;
+        std::size_t const num_local_;
+
+        std::vector<naming::id_type> peers_;
+
+        std::size_t generation_;
+        std::size_t local_arrived_;
+        bool local_complete_;
+        waiters_type waiters_;
+
+        // tree mode
+        std::size_t children_arrived_[2];
+
+        // dissemination mode
+        std::vector<std::size_t> received_[2];
+        std::size_t round_;
+        bool round_sent_;
+    };
+}}}
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::lcos::server::hierarchical_barrier::child_arrived_action,
+    hpx_lcos_server_hierarchical_barrier_child_arrived_action)
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::lcos::server::hierarchical_barrier::release_action,
+    hpx_lcos_server_hierarchical_barrier_release_action)
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::lcos::server::hierarchical_barrier::notify_action,
+    hpx_lcos_server_hierarchical_barrier_notify_action)
+
+#endif
@@ -90,7 +90,8 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                                 first = last;
 
                             return std::move(first);
-                        });
+                        },
+                        tok);
             }
         };
         /// \endcond
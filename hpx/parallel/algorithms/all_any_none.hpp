@@ -11,6 +11,7 @@
 #include <hpx/hpx_fwd.hpp>
 #include <hpx/util/void_guard.hpp>
 #include <hpx/util/move.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
 
 #include <hpx/parallel/config/inline_namespace.hpp>
 #include <hpx/parallel/execution_policy.hpp>
@@ -27,6 +28,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <type_traits>
 
 namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
 {
@@ -78,9 +80,36 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                             {
                                 return val.get();
                             });
-                    });
+                    },
+                    tok);
             }
         };
+
+        ///////////////////////////////////////////////////////////////////////
+        // non-segmented implementation
+        template <typename ExPolicy, typename InIter, typename F>
+        inline typename detail::algorithm_result<ExPolicy, bool>::type
+        none_of_(ExPolicy && policy, InIter first, InIter last, F && f,
+            std::false_type)
+        {
+            typedef typename std::iterator_traits<InIter>::iterator_category
+                iterator_category;
+            typedef typename boost::mpl::or_<
+                is_sequential_execution_policy<ExPolicy>,
+                boost::is_same<std::input_iterator_tag, iterator_category>
+            >::type is_seq;
+
+            return detail::none_of().call(
+                std::forward<ExPolicy>(policy), is_seq(),
+                first, last, std::forward<F>(f));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename SegIter, typename F>
+        inline typename detail::algorithm_result<ExPolicy, bool>::type
+        none_of_(ExPolicy && policy, SegIter first, SegIter last, F && f,
+            std::true_type);
+
         /// \endcond
     }
 
@@ -156,14 +185,12 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             (boost::is_base_of<std::input_iterator_tag, iterator_category>::value),
             "Requires at least input iterator.");
 
-        typedef typename boost::mpl::or_<
-            is_sequential_execution_policy<ExPolicy>,
-            boost::is_same<std::input_iterator_tag, iterator_category>
-        >::type is_seq;
+        typedef hpx::traits::segmented_iterator_traits<InIter> iterator_traits;
+        typedef typename iterator_traits::is_segmented_iterator is_segmented;
 
-        return detail::none_of().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, std::forward<F>(f));
+        return detail::none_of_(
+            std::forward<ExPolicy>(policy), first, last, std::forward<F>(f),
+            is_segmented());
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -214,9 +241,36 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                             {
                                 return val.get();
                             });
-                    });
+                    },
+                    tok);
             }
         };
+
+        ///////////////////////////////////////////////////////////////////////
+        // non-segmented implementation
+        template <typename ExPolicy, typename InIter, typename F>
+        inline typename detail::algorithm_result<ExPolicy, bool>::type
+        any_of_(ExPolicy && policy, InIter first, InIter last, F && f,
+            std::false_type)
+        {
+            typedef typename std::iterator_traits<InIter>::iterator_category
+                iterator_category;
+            typedef typename boost::mpl::or_<
+                is_sequential_execution_policy<ExPolicy>,
+                boost::is_same<std::input_iterator_tag, iterator_category>
+            >::type is_seq;
+
+            return detail::any_of().call(
+                std::forward<ExPolicy>(policy), is_seq(),
+                first, last, std::forward<F>(f));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename SegIter, typename F>
+        inline typename detail::algorithm_result<ExPolicy, bool>::type
+        any_of_(ExPolicy && policy, SegIter first, SegIter last, F && f,
+            std::true_type);
+
         /// \endcond
     }
 
@@ -292,14 +346,12 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             (boost::is_base_of<std::input_iterator_tag, iterator_category>::value),
             "Requires at least input iterator.");
 
-        typedef typename boost::mpl::or_<
-            is_sequential_execution_policy<ExPolicy>,
-            boost::is_same<std::input_iterator_tag, iterator_category>
-        >::type is_seq;
+        typedef hpx::traits::segmented_iterator_traits<InIter> iterator_traits;
+        typedef typename iterator_traits::is_segmented_iterator is_segmented;
 
-        return detail::any_of().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, std::forward<F>(f));
+        return detail::any_of_(
+            std::forward<ExPolicy>(policy), first, last, std::forward<F>(f),
+            is_segmented());
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -350,9 +402,36 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                             {
                                 return val.get();
                             });
-                    });
+                    },
+                    tok);
             }
         };
+
+        ///////////////////////////////////////////////////////////////////////
+        // non-segmented implementation
+        template <typename ExPolicy, typename InIter, typename F>
+        inline typename detail::algorithm_result<ExPolicy, bool>::type
+        all_of_(ExPolicy && policy, InIter first, InIter last, F && f,
+            std::false_type)
+        {
+            typedef typename std::iterator_traits<InIter>::iterator_category
+                iterator_category;
+            typedef typename boost::mpl::or_<
+                is_sequential_execution_policy<ExPolicy>,
+                boost::is_same<std::input_iterator_tag, iterator_category>
+            >::type is_seq;
+
+            return detail::all_of().call(
+                std::forward<ExPolicy>(policy), is_seq(),
+                first, last, std::forward<F>(f));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename SegIter, typename F>
+        inline typename detail::algorithm_result<ExPolicy, bool>::type
+        all_of_(ExPolicy && policy, SegIter first, SegIter last, F && f,
+            std::true_type);
+
         /// \endcond
     }
 
@@ -428,14 +507,12 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             (boost::is_base_of<std::input_iterator_tag, iterator_category>::value),
             "Requires at least input iterator.");
 
-        typedef typename boost::mpl::or_<
-            is_sequential_execution_policy<ExPolicy>,
-            boost::is_same<std::input_iterator_tag, iterator_category>
-        >::type is_seq;
+        typedef hpx::traits::segmented_iterator_traits<InIter> iterator_traits;
+        typedef typename iterator_traits::is_segmented_iterator is_segmented;
 
-        return detail::all_of().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, std::forward<F>(f));
+        return detail::all_of_(
+            std::forward<ExPolicy>(policy), first, last, std::forward<F>(f),
+            is_segmented());
     }
 }}}
 
@@ -323,6 +323,10 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
     namespace detail
     {
         /// \cond NOINTERNAL
+
+        // The overloads taking an additional transformation store the result
+        // of applying it to the selected elements (this is used by the
+        // filtered views).
         template <typename Iter>
         struct copy_if : public detail::algorithm<copy_if<Iter>, Iter>
         {
@@ -338,17 +342,44 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                 return std::copy_if(first, last, dest, std::forward<F>(f));
             }
 
+            template <typename ExPolicy, typename InIter, typename F,
+                typename Transformer>
+            static Iter
+            sequential(ExPolicy const&, InIter first, InIter last, Iter dest,
+                F && f, Transformer const& t)
+            {
+                for (/**/; first != last; ++first)
+                {
+                    typename std::iterator_traits<InIter>::reference v =
+                        *first;
+                    if (f(v))
+                        *dest++ = t(v);
+                }
+                return dest;
+            }
+
             template <typename ExPolicy, typename FwdIter, typename F>
             static typename detail::algorithm_result<ExPolicy, Iter>::type
             parallel(ExPolicy const& policy, FwdIter first, FwdIter last,
                 Iter dest, F && f)
+            {
+                typedef typename std::iterator_traits<FwdIter>::value_type
+                    value_type;
+
+                return parallel(policy, first, last, dest, std::forward<F>(f),
+                    detail::identity<value_type>());
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename F,
+                typename Transformer>
+            static typename detail::algorithm_result<ExPolicy, Iter>::type
+            parallel(ExPolicy const& policy, FwdIter first, FwdIter last,
+                Iter dest, F && f, Transformer const& t)
             {
                 typedef hpx::util::zip_iterator<FwdIter, char*> zip_iterator;
                 typedef detail::algorithm_result<ExPolicy, Iter> result;
                 typedef typename std::iterator_traits<FwdIter>::difference_type
                     difference_type;
-                typedef typename detail::algorithm_result<ExPolicy, Iter>::type
-                    result_type;
 
                 if (first == last)
                     return result::get(std::move(dest));
@@ -358,8 +389,14 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                 boost::shared_array<char> flags(new char[count]);
                 std::size_t init = 0;
 
-                typedef util::scan_partitioner<ExPolicy, Iter, std::size_t>
-                    scan_partitioner_type;
+                // The elements are compacted using a single-pass scan: every
+                // partition flags and counts the elements to be copied, finds
+                // its offset into the destination by looking back at the
+                // partitions to its left, and copies its flagged elements
+                // while they are still cache resident.
+                typedef util::single_pass_scan_partitioner<
+                        ExPolicy, Iter, std::size_t
+                    > scan_partitioner_type;
                 return scan_partitioner_type::call(
                     policy,
                     hpx::util::make_zip_iterator(first, flags.get()),
@@ -379,50 +416,32 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                             });
                         return curr;
                     },
-                    // Determine how far to advance the  dest iterator for each
+                    // Determine how far to advance the dest iterator for each
                     // partition
-                    hpx::util::unwrapped(
-                        [](std::size_t const& prev, std::size_t const& curr)
-                        {
-                            return prev + curr;
-                        }),
-                    // Copy the elements into dest in parallel
-                    [=](std::vector<hpx::shared_future<std::size_t> >&& r,
-                        std::vector<std::size_t> const& chunk_sizes) mutable
-                            -> result_type
+                    [](std::size_t const& prev, std::size_t const& curr)
                     {
-                        HPX_ASSERT(!r.empty());
-                        std::size_t last_index = r[r.size()-1].get();
-
-                        typedef util::partitioner<ExPolicy, Iter, void>
-                            partitioner_type;
-                        return partitioner_type::call_with_data(
-                            policy,
-                            hpx::util::make_zip_iterator(first, flags.get()),
-                            count,
-                            [dest](hpx::shared_future<std::size_t>&& pos,
-                                zip_iterator part_begin, std::size_t part_count)
-                            {
-                                Iter iter = dest;
-                                std::size_t next_pos = pos.get();
-                                std::advance(iter, next_pos);
-                                util::loop_n(part_begin, part_count,
-                                    [&iter](zip_iterator d)
-                                    {
-                                        using hpx::util::get;
-                                        if(get<1>(*d))
-                                            *iter++ = get<0>(*d);
-                                    });
-                            },
-                            [=](std::vector<hpx::future<void> >&&) mutable
-                                -> Iter
+                        return prev + curr;
+                    },
+                    // Copy the elements into dest
+                    [dest, t](std::size_t const& pos, zip_iterator part_begin,
+                        std::size_t part_count)
+                    {
+                        Iter iter = dest;
+                        std::advance(iter, pos);
+                        util::loop_n(part_begin, part_count,
+                            [&iter, &t](zip_iterator d)
                             {
-                                std::advance(dest, last_index);
-                                return dest;
-                            },
-                            chunk_sizes,
-                            std::move(r)
-                        );
+                                using hpx::util::get;
+                                if(get<1>(*d))
+                                    *iter++ = t(get<0>(*d));
+                            });
+                    },
+                    // Return the end of the destination range, this also
+                    // keeps the flags alive until all partitions are done
+                    [dest, flags](std::size_t && last_index) mutable -> Iter
+                    {
+                        std::advance(dest, last_index);
+                        return dest;
                     }
                 );
             }
@@ -22,6 +22,7 @@
 #include <boost/mpl/bool.hpp>
 
 #include <string>
+#include <utility>
 
 namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1) { namespace detail
 {
@@ -34,6 +35,19 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1) { namespace detail
             >::local_raw_iterator type;
     };
 
+    template <typename Iterator1, typename Iterator2>
+    struct local_algorithm_result<std::pair<Iterator1, Iterator2> >
+    {
+        typedef typename hpx::traits::segmented_local_iterator_traits<
+                Iterator1
+            >::local_raw_iterator type1;
+        typedef typename hpx::traits::segmented_local_iterator_traits<
+                Iterator2
+            >::local_raw_iterator type2;
+
+        typedef std::pair<type1, type2> type;
+    };
+
     template <>
     struct local_algorithm_result<void>
     {
@@ -167,7 +181,9 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1) { namespace detail
                 {
                     parallel_task_execution_policy const& t =
                         *policy.get<parallel_task_execution_policy>();
-                    return call(par(t.get_executor(), t.get_chunk_size()),
+                    parallel_execution_policy p =
+                        par(t.get_executor(), t.get_chunk_size());
+                    return call(t.is_single_pass() ? p(single_pass) : p,
                         boost::mpl::false_(), std::forward<Args>(args)...);
                 }
 
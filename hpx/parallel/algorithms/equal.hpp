@@ -126,7 +126,8 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                             {
                                 return val.get();
                             });
-                    });
+                    },
+                    tok);
             }
         };
         /// \endcond
@@ -381,7 +382,8 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                             {
                                 return val.get();
                             });
-                    });
+                    },
+                    tok);
             }
         };
         /// \endcond
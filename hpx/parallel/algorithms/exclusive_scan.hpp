@@ -9,6 +9,7 @@
 #define HPX_PARALLEL_ALGORITHM_EXCLUSIVE_SCAN_DEC_30_2014_1236PM
 
 #include <hpx/hpx_fwd.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
 #include <hpx/util/move.hpp>
 #include <hpx/util/unwrapped.hpp>
 #include <hpx/util/zip_iterator.hpp>
@@ -18,6 +19,7 @@
 #include <hpx/parallel/algorithms/inclusive_scan.hpp>
 #include <hpx/parallel/algorithms/detail/algorithm_result.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/predicates.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
 #include <hpx/parallel/util/scan_partitioner.hpp>
 #include <hpx/parallel/util/loop.hpp>
@@ -25,6 +27,7 @@
 #include <algorithm>
 #include <numeric>
 #include <iterator>
+#include <type_traits>
 
 #include <boost/static_assert.hpp>
 #include <boost/utility/enable_if.hpp>
@@ -55,6 +58,64 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             return dest;
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Single-pass version of the parallel (transform) exclusive scan, see
+        // single_pass_inclusive_scan. The input element is always read before
+        // the corresponding output element is written, which keeps in-place
+        // scans correct.
+        template <typename ExPolicy, typename FwdIter, typename OutIter,
+            typename Conv, typename T, typename Op>
+        typename detail::algorithm_result<ExPolicy, OutIter>::type
+        single_pass_exclusive_scan(ExPolicy const& policy, FwdIter first,
+            std::size_t count, OutIter dest, Conv && conv, T && init, Op && op)
+        {
+            typedef hpx::util::zip_iterator<FwdIter, OutIter> zip_iterator;
+            typedef typename std::iterator_traits<FwdIter>::reference reference;
+
+            using hpx::util::make_zip_iterator;
+            return
+                util::single_pass_scan_partitioner<ExPolicy, OutIter, T>::call(
+                    policy, make_zip_iterator(first, dest), count,
+                    std::forward<T>(init),
+                    // step 1 reduces each partition
+                    [=](zip_iterator part_begin, std::size_t part_size) -> T
+                    {
+                        using hpx::util::get;
+                        FwdIter it = get<0>(part_begin.get_iterator_tuple());
+                        T part_init = conv(*it);
+                        return util::accumulate_n(++it, part_size-1, part_init,
+                            [&](T const& sum, reference val) -> T
+                            {
+                                return op(sum, conv(val));
+                            });
+                    },
+                    // step 2 combines the results of adjacent partitions
+                    [=](T const& prev, T const& curr) -> T
+                    {
+                        return op(prev, curr);
+                    },
+                    // step 3 scans each partition starting from its prefix
+                    [=](T const& prefix, zip_iterator part_begin,
+                        std::size_t part_size)
+                    {
+                        T sum = prefix;
+                        util::loop_n(part_begin, part_size,
+                            [&](zip_iterator d)
+                            {
+                                using hpx::util::get;
+                                T temp = sum;
+                                sum = op(sum, conv(get<0>(*d)));
+                                get<1>(*d) = temp;
+                            });
+                    },
+                    // step 4 produces the overall result
+                    [dest, count](T &&) mutable -> OutIter
+                    {
+                        std::advance(dest, count);
+                        return dest;
+                    });
+        }
+
         ///////////////////////////////////////////////////////////////////////
         template <typename OutIter>
         struct exclusive_scan
@@ -64,21 +125,23 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
               : exclusive_scan::algorithm("exclusive_scan")
             {}
 
-            template <typename ExPolicy, typename InIter, typename T, typename Op>
-            static OutIter
+            template <typename ExPolicy, typename InIter, typename OutIter_,
+                typename T, typename Op>
+            static OutIter_
             sequential(ExPolicy const&, InIter first, InIter last,
-                OutIter dest, T && init, Op && op)
+                OutIter_ dest, T && init, Op && op)
             {
                 return sequential_exclusive_scan(first, last, dest,
                     std::forward<T>(init), std::forward<Op>(op));
             }
 
-            template <typename ExPolicy, typename FwdIter, typename T, typename Op>
-            static typename detail::algorithm_result<ExPolicy, OutIter>::type
+            template <typename ExPolicy, typename FwdIter, typename OutIter_,
+                typename T, typename Op>
+            static typename detail::algorithm_result<ExPolicy, OutIter_>::type
             parallel(ExPolicy const& policy, FwdIter first, FwdIter last,
-                 OutIter dest, T && init, Op && op)
+                 OutIter_ dest, T && init, Op && op)
             {
-                typedef detail::algorithm_result<ExPolicy, OutIter> result;
+                typedef detail::algorithm_result<ExPolicy, OutIter_> result;
                 typedef hpx::util::zip_iterator<FwdIter, T*> zip_iterator;
 
                 if (first == last)
@@ -86,6 +149,17 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
 
                 typedef typename std::iterator_traits<FwdIter>::difference_type
                     difference_type;
+
+                if (policy.is_single_pass())
+                {
+                    typedef typename std::iterator_traits<FwdIter>::value_type
+                        value_type;
+                    return single_pass_exclusive_scan(policy, first,
+                        std::distance(first, last), dest,
+                        detail::identity<value_type>(),
+                        std::forward<T>(init), std::forward<Op>(op));
+                }
+
                 difference_type count = std::distance(first, last) - 1;
 
                 if (count == 0) {
@@ -95,7 +169,7 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
               
                 // The scan may use the same array for output as input
                 // don't write initial value until after sum to avoid trampling on input
-                OutIter iout = dest++;
+                OutIter_ iout = dest++;
                 T temp = init;
               
 
@@ -107,7 +181,7 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                 // overall result
                 using hpx::util::make_zip_iterator;
                 auto ret =
-                    util::scan_partitioner<ExPolicy, OutIter, T>::call(
+                    util::scan_partitioner<ExPolicy, OutIter_, T>::call(
                         policy, make_zip_iterator(first, data.get()), count, init,
                         // step 1 performs first part of scan algorithm
                         [=](zip_iterator part_begin, std::size_t part_size) -> T
@@ -141,6 +215,39 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                 return ret;
             }
         };
+
+        ///////////////////////////////////////////////////////////////////////
+        // non-segmented implementation
+        template <typename ExPolicy, typename InIter, typename OutIter,
+            typename T, typename Op>
+        inline typename detail::algorithm_result<ExPolicy, OutIter>::type
+        exclusive_scan_(ExPolicy && policy, InIter first, InIter last,
+            OutIter dest, T init, Op && op, std::false_type)
+        {
+            typedef typename std::iterator_traits<InIter>::iterator_category
+                iterator_category;
+            typedef typename std::iterator_traits<OutIter>::iterator_category
+                output_iterator_category;
+
+            typedef typename boost::mpl::or_<
+                is_sequential_execution_policy<ExPolicy>,
+                boost::is_same<std::input_iterator_tag, iterator_category>,
+                boost::is_same<
+                    std::output_iterator_tag, output_iterator_category>
+            >::type is_seq;
+
+            return detail::exclusive_scan<OutIter>().call(
+                std::forward<ExPolicy>(policy), is_seq(),
+                first, last, dest, std::move(init), std::forward<Op>(op));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename SegIter, typename SegOutIter,
+            typename T, typename Op>
+        inline typename detail::algorithm_result<ExPolicy, SegOutIter>::type
+        exclusive_scan_(ExPolicy && policy, SegIter first, SegIter last,
+            SegOutIter dest, T init, Op && op, std::true_type);
+
         /// \endcond
     }
 
@@ -248,15 +355,19 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             >::value),
             "Requires at least output iterator.");
 
-        typedef typename boost::mpl::or_<
-            is_sequential_execution_policy<ExPolicy>,
-            boost::is_same<std::input_iterator_tag, iterator_category>,
-            boost::is_same<std::output_iterator_tag, output_iterator_category>
-        >::type is_seq;
+        // the segmented version requires both sequences to be segmented
+        typedef std::integral_constant<bool,
+                hpx::traits::segmented_iterator_traits<
+                    InIter
+                >::is_segmented_iterator::value &&
+                hpx::traits::segmented_iterator_traits<
+                    OutIter
+                >::is_segmented_iterator::value
+            > is_segmented;
 
-        return detail::exclusive_scan<OutIter>().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, dest, std::move(init), std::forward<Op>(op));
+        return detail::exclusive_scan_(
+            std::forward<ExPolicy>(policy), first, last, dest,
+            std::move(init), std::forward<Op>(op), is_segmented());
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -343,15 +454,19 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             >::value),
             "Requires at least output iterator.");
 
-        typedef typename boost::mpl::or_<
-            is_sequential_execution_policy<ExPolicy>,
-            boost::is_same<std::input_iterator_tag, iterator_category>,
-            boost::is_same<std::output_iterator_tag, output_iterator_category>
-        >::type is_seq;
+        // the segmented version requires both sequences to be segmented
+        typedef std::integral_constant<bool,
+                hpx::traits::segmented_iterator_traits<
+                    InIter
+                >::is_segmented_iterator::value &&
+                hpx::traits::segmented_iterator_traits<
+                    OutIter
+                >::is_segmented_iterator::value
+            > is_segmented;
 
-        return detail::exclusive_scan<OutIter>().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, dest, std::move(init), std::plus<T>());
+        return detail::exclusive_scan_(
+            std::forward<ExPolicy>(policy), first, last, dest,
+            std::move(init), std::plus<T>(), is_segmented());
     }
 }}}
 
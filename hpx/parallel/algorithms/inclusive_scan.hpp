@@ -9,6 +9,7 @@
 #define HPX_PARALLEL_ALGORITHM_INCLUSIVE_SCAN_JAN_03_2015_0136PM
 
 #include <hpx/hpx_fwd.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
 #include <hpx/util/move.hpp>
 #include <hpx/util/unwrapped.hpp>
 #include <hpx/util/zip_iterator.hpp>
@@ -17,6 +18,7 @@
 #include <hpx/parallel/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/algorithm_result.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/predicates.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
 #include <hpx/parallel/util/scan_partitioner.hpp>
 #include <hpx/parallel/util/loop.hpp>
@@ -24,6 +26,7 @@
 #include <algorithm>
 #include <numeric>
 #include <iterator>
+#include <type_traits>
 
 #include <boost/static_assert.hpp>
 #include <boost/utility/enable_if.hpp>
@@ -101,6 +104,65 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                 );
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Single-pass version of the parallel (transform) inclusive scan,
+        // used if the execution policy has been created using par(single_pass).
+        // Each partition is reduced, its prefix is found by looking back at
+        // the partitions to its left, and it is then scanned into the
+        // destination while still cache resident. No intermediate buffer is
+        // required.
+        template <typename ExPolicy, typename FwdIter, typename OutIter,
+            typename Conv, typename T, typename Op>
+        typename detail::algorithm_result<ExPolicy, OutIter>::type
+        single_pass_inclusive_scan(ExPolicy const& policy, FwdIter first,
+            std::size_t count, OutIter dest, Conv && conv, T && init, Op && op)
+        {
+            typedef hpx::util::zip_iterator<FwdIter, OutIter> zip_iterator;
+            typedef typename std::iterator_traits<FwdIter>::reference reference;
+
+            using hpx::util::make_zip_iterator;
+            return
+                util::single_pass_scan_partitioner<ExPolicy, OutIter, T>::call(
+                    policy, make_zip_iterator(first, dest), count,
+                    std::forward<T>(init),
+                    // step 1 reduces each partition
+                    [=](zip_iterator part_begin, std::size_t part_size) -> T
+                    {
+                        using hpx::util::get;
+                        FwdIter it = get<0>(part_begin.get_iterator_tuple());
+                        T part_init = conv(*it);
+                        return util::accumulate_n(++it, part_size-1, part_init,
+                            [&](T const& sum, reference val) -> T
+                            {
+                                return op(sum, conv(val));
+                            });
+                    },
+                    // step 2 combines the results of adjacent partitions
+                    [=](T const& prev, T const& curr) -> T
+                    {
+                        return op(prev, curr);
+                    },
+                    // step 3 scans each partition starting from its prefix
+                    [=](T const& prefix, zip_iterator part_begin,
+                        std::size_t part_size)
+                    {
+                        T sum = prefix;
+                        util::loop_n(part_begin, part_size,
+                            [&](zip_iterator d)
+                            {
+                                using hpx::util::get;
+                                sum = op(sum, conv(get<0>(*d)));
+                                get<1>(*d) = sum;
+                            });
+                    },
+                    // step 4 produces the overall result
+                    [dest, count](T &&) mutable -> OutIter
+                    {
+                        std::advance(dest, count);
+                        return dest;
+                    });
+        }
+
         ///////////////////////////////////////////////////////////////////////
         template <typename OutIter>
         struct inclusive_scan
@@ -110,21 +172,23 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
               : inclusive_scan::algorithm("inclusive_scan")
             {}
 
-            template <typename ExPolicy, typename InIter, typename T, typename Op>
-            static OutIter
+            template <typename ExPolicy, typename InIter, typename OutIter_,
+                typename T, typename Op>
+            static OutIter_
             sequential(ExPolicy const&, InIter first, InIter last,
-                OutIter dest, T && init, Op && op)
+                OutIter_ dest, T && init, Op && op)
             {
                 return sequential_inclusive_scan(first, last, dest,
                     std::forward<T>(init), std::forward<Op>(op));
             }
 
-            template <typename ExPolicy, typename FwdIter, typename T, typename Op>
-            static typename detail::algorithm_result<ExPolicy, OutIter>::type
+            template <typename ExPolicy, typename FwdIter, typename OutIter_,
+                typename T, typename Op>
+            static typename detail::algorithm_result<ExPolicy, OutIter_>::type
             parallel(ExPolicy const& policy, FwdIter first, FwdIter last,
-                 OutIter dest, T && init, Op && op)
+                 OutIter_ dest, T && init, Op && op)
             {
-                typedef detail::algorithm_result<ExPolicy, OutIter> result;
+                typedef detail::algorithm_result<ExPolicy, OutIter_> result;
                 typedef hpx::util::zip_iterator<FwdIter, T*> zip_iterator;
                 typedef typename std::iterator_traits<FwdIter>::difference_type
                     difference_type;
@@ -133,6 +197,16 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                     return result::get(std::move(dest));
 
                 difference_type count = std::distance(first, last);
+
+                if (policy.is_single_pass())
+                {
+                    typedef typename std::iterator_traits<FwdIter>::value_type
+                        value_type;
+                    return single_pass_inclusive_scan(policy, first, count,
+                        dest, detail::identity<value_type>(),
+                        std::forward<T>(init), std::forward<Op>(op));
+                }
+
                 boost::shared_array<T> data(new T[count]);
 
                 // The overall scan algorithm is performed by executing 2
@@ -142,7 +216,7 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
 
                 using hpx::util::make_zip_iterator;
                 return
-                    util::scan_partitioner<ExPolicy, OutIter, T>::call(
+                    util::scan_partitioner<ExPolicy, OutIter_, T>::call(
                         policy, make_zip_iterator(first, data.get()), count, init,
                         // step 1 performs first part of scan algorithm
                         [=](zip_iterator part_begin, std::size_t part_size) -> T
@@ -173,6 +247,39 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                     );
             }
         };
+
+        ///////////////////////////////////////////////////////////////////////
+        // non-segmented implementation
+        template <typename ExPolicy, typename InIter, typename OutIter,
+            typename T, typename Op>
+        inline typename detail::algorithm_result<ExPolicy, OutIter>::type
+        inclusive_scan_(ExPolicy && policy, InIter first, InIter last,
+            OutIter dest, T init, Op && op, std::false_type)
+        {
+            typedef typename std::iterator_traits<InIter>::iterator_category
+                iterator_category;
+            typedef typename std::iterator_traits<OutIter>::iterator_category
+                output_iterator_category;
+
+            typedef typename boost::mpl::or_<
+                is_sequential_execution_policy<ExPolicy>,
+                boost::is_same<std::input_iterator_tag, iterator_category>,
+                boost::is_same<
+                    std::output_iterator_tag, output_iterator_category>
+            >::type is_seq;
+
+            return detail::inclusive_scan<OutIter>().call(
+                std::forward<ExPolicy>(policy), is_seq(),
+                first, last, dest, std::move(init), std::forward<Op>(op));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename SegIter, typename SegOutIter,
+            typename T, typename Op>
+        inline typename detail::algorithm_result<ExPolicy, SegOutIter>::type
+        inclusive_scan_(ExPolicy && policy, SegIter first, SegIter last,
+            SegOutIter dest, T init, Op && op, std::true_type);
+
         /// \endcond
     }
 
@@ -280,15 +387,19 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             >::value),
             "Requires at least output iterator.");
 
-        typedef typename boost::mpl::or_<
-            is_sequential_execution_policy<ExPolicy>,
-            boost::is_same<std::input_iterator_tag, iterator_category>,
-            boost::is_same<std::output_iterator_tag, output_iterator_category>
-        >::type is_seq;
-
-        return detail::inclusive_scan<OutIter>().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, dest, std::move(init), std::forward<Op>(op));
+        // the segmented version requires both sequences to be segmented
+        typedef std::integral_constant<bool,
+                hpx::traits::segmented_iterator_traits<
+                    InIter
+                >::is_segmented_iterator::value &&
+                hpx::traits::segmented_iterator_traits<
+                    OutIter
+                >::is_segmented_iterator::value
+            > is_segmented;
+
+        return detail::inclusive_scan_(
+            std::forward<ExPolicy>(policy), first, last, dest,
+            std::move(init), std::forward<Op>(op), is_segmented());
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -375,15 +486,19 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             >::value),
             "Requires at least output iterator.");
 
-        typedef typename boost::mpl::or_<
-            is_sequential_execution_policy<ExPolicy>,
-            boost::is_same<std::input_iterator_tag, iterator_category>,
-            boost::is_same<std::output_iterator_tag, output_iterator_category>
-        >::type is_seq;
-
-        return detail::inclusive_scan<OutIter>().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, dest, std::move(init), std::plus<T>());
+        // the segmented version requires both sequences to be segmented
+        typedef std::integral_constant<bool,
+                hpx::traits::segmented_iterator_traits<
+                    InIter
+                >::is_segmented_iterator::value &&
+                hpx::traits::segmented_iterator_traits<
+                    OutIter
+                >::is_segmented_iterator::value
+            > is_segmented;
+
+        return detail::inclusive_scan_(
+            std::forward<ExPolicy>(policy), first, last, dest,
+            std::move(init), std::plus<T>(), is_segmented());
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -466,17 +581,21 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             >::value),
             "Requires at least output iterator.");
 
-        typedef typename boost::mpl::or_<
-            is_sequential_execution_policy<ExPolicy>,
-            boost::is_same<std::input_iterator_tag, iterator_category>,
-            boost::is_same<std::output_iterator_tag, output_iterator_category>
-        >::type is_seq;
+        // the segmented version requires both sequences to be segmented
+        typedef std::integral_constant<bool,
+                hpx::traits::segmented_iterator_traits<
+                    InIter
+                >::is_segmented_iterator::value &&
+                hpx::traits::segmented_iterator_traits<
+                    OutIter
+                >::is_segmented_iterator::value
+            > is_segmented;
 
         typedef typename std::iterator_traits<InIter>::value_type value_type;
 
-        return detail::inclusive_scan<OutIter>().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, dest, value_type(), std::plus<value_type>());
+        return detail::inclusive_scan_(
+            std::forward<ExPolicy>(policy), first, last, dest,
+            value_type(), std::plus<value_type>(), is_segmented());
     }
 }}}
 
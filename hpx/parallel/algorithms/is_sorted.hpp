@@ -71,7 +71,7 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                     std::size_t part_size) mutable -> bool
                     {
                         FwdIter trail = part_begin++;
-                        util::loop_n(part_begin, part_size - 1,
+                        util::loop_n(part_begin, part_size - 1, tok,
                             [&trail, &tok, &pred](FwdIter it)
                             {
                                 if (pred(*it, *trail++))
@@ -84,7 +84,12 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                         //unless cancelled
                         if (!tok.was_cancelled() && trail != last)
                         {
-                            return !pred(*trail, *i);
+                            if (pred(*trail, *i))
+                            {
+                                tok.cancel();
+                                return false;
+                            }
+                            return true;
                         }
                         return !tok.was_cancelled();
                     },
@@ -96,7 +101,8 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                             {
                                 return val.get();
                             });
-                    });
+                    },
+                    tok);
             }
         };
         /// \endcond
@@ -317,7 +323,8 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                         difference_type loc = tok.get_data();
                         std::advance(first, loc);
                         return std::move(first);
-                    });
+                    },
+                    tok);
             }
         };
         /// \endcond
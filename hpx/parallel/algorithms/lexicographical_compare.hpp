@@ -104,7 +104,8 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                                 return pred(*first1, *first2);
 
                             return first2 != last2;
-                        });
+                        },
+                        tok);
             }
         };
         /// \endcond
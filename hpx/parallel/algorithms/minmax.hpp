@@ -11,6 +11,7 @@
 #include <hpx/hpx_fwd.hpp>
 #include <hpx/util/move.hpp>
 #include <hpx/util/assert.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
 
 #include <hpx/parallel/config/inline_namespace.hpp>
 #include <hpx/parallel/execution_policy.hpp>
@@ -21,6 +22,8 @@
 
 #include <algorithm>
 #include <iterator>
+#include <type_traits>
+#include <utility>
 
 #include <boost/static_assert.hpp>
 #include <boost/utility/enable_if.hpp>
@@ -75,38 +78,60 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
               : min_element::algorithm("min_element")
             {}
 
-            template <typename ExPolicy, typename F>
-            static FwdIter
-            sequential(ExPolicy const&, FwdIter first, FwdIter last, F && f)
+            template <typename ExPolicy, typename FwdIter_, typename F>
+            static FwdIter_
+            sequential(ExPolicy const&, FwdIter_ first, FwdIter_ last, F && f)
             {
                 return std::min_element(first, last, std::forward<F>(f));
             }
 
-            template <typename ExPolicy, typename F>
-            static typename detail::algorithm_result<ExPolicy, FwdIter>::type
-            parallel(ExPolicy const& policy, FwdIter first, FwdIter last,
+            template <typename ExPolicy, typename FwdIter_, typename F>
+            static typename detail::algorithm_result<ExPolicy, FwdIter_>::type
+            parallel(ExPolicy const& policy, FwdIter_ first, FwdIter_ last,
                 F && f)
             {
                 if (first == last)
                 {
-                    return detail::algorithm_result<ExPolicy, FwdIter>::
+                    return detail::algorithm_result<ExPolicy, FwdIter_>::
                         get(std::move(first));
                 }
 
-                return util::partitioner<ExPolicy, FwdIter, FwdIter>::
+                return util::partitioner<ExPolicy, FwdIter_, FwdIter_>::
                     call(
                         policy, first, std::distance(first, last),
-                        [f](FwdIter it, std::size_t part_count)
+                        [f](FwdIter_ it, std::size_t part_count)
                         {
                             return sequential_min_element(it, part_count, f);
                         },
-                        hpx::util::unwrapped([f](std::vector<FwdIter> && positions)
+                        hpx::util::unwrapped([f](std::vector<FwdIter_> && positions)
                         {
                             return sequential_min_element_ind(
                                 positions.begin(), positions.size(), f);
                         }));
             }
         };
+
+        ///////////////////////////////////////////////////////////////////////
+        // non-segmented implementation
+        template <typename ExPolicy, typename FwdIter, typename F>
+        inline typename detail::algorithm_result<ExPolicy, FwdIter>::type
+        min_element_(ExPolicy && policy, FwdIter first, FwdIter last, F && f,
+            std::false_type)
+        {
+            typedef typename is_sequential_execution_policy<ExPolicy>::type
+                is_seq;
+
+            return detail::min_element<FwdIter>().call(
+                std::forward<ExPolicy>(policy), is_seq(),
+                first, last, std::forward<F>(f));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename SegIter, typename F>
+        inline typename detail::algorithm_result<ExPolicy, SegIter>::type
+        min_element_(ExPolicy && policy, SegIter first, SegIter last, F && f,
+            std::true_type);
+
         /// \endcond
     }
 
@@ -185,11 +210,13 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                 std::forward_iterator_tag, iterator_category>::value),
             "Required at least forward iterator.");
 
-        typedef typename is_sequential_execution_policy<ExPolicy>::type is_seq;
+        typedef hpx::traits::segmented_iterator_traits<FwdIter>
+            iterator_traits;
+        typedef typename iterator_traits::is_segmented_iterator is_segmented;
 
-        return detail::min_element<FwdIter>().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, std::forward<F>(f));
+        return detail::min_element_(
+            std::forward<ExPolicy>(policy), first, last, std::forward<F>(f),
+            is_segmented());
     }
 
     /// Finds the smallest element in the range [first, last) using the given
@@ -251,11 +278,13 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                 std::forward_iterator_tag, iterator_category>::value),
             "Required at least forward iterator.");
 
-        typedef typename is_sequential_execution_policy<ExPolicy>::type is_seq;
+        typedef hpx::traits::segmented_iterator_traits<FwdIter>
+            iterator_traits;
+        typedef typename iterator_traits::is_segmented_iterator is_segmented;
 
-        return detail::min_element<FwdIter>().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, std::less<value_type>());
+        return detail::min_element_(
+            std::forward<ExPolicy>(policy), first, last,
+            std::less<value_type>(), is_segmented());
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -305,38 +334,60 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
               : max_element::algorithm("max_element")
             {}
 
-            template <typename ExPolicy, typename F>
-            static FwdIter
-            sequential(ExPolicy const&, FwdIter first, FwdIter last, F && f)
+            template <typename ExPolicy, typename FwdIter_, typename F>
+            static FwdIter_
+            sequential(ExPolicy const&, FwdIter_ first, FwdIter_ last, F && f)
             {
                 return std::max_element(first, last, std::forward<F>(f));
             }
 
-            template <typename ExPolicy, typename F>
-            static typename detail::algorithm_result<ExPolicy, FwdIter>::type
-            parallel(ExPolicy const& policy, FwdIter first, FwdIter last,
+            template <typename ExPolicy, typename FwdIter_, typename F>
+            static typename detail::algorithm_result<ExPolicy, FwdIter_>::type
+            parallel(ExPolicy const& policy, FwdIter_ first, FwdIter_ last,
                 F && f)
             {
                 if (first == last)
                 {
-                    return detail::algorithm_result<ExPolicy, FwdIter>::
+                    return detail::algorithm_result<ExPolicy, FwdIter_>::
                         get(std::move(first));
                 }
 
-                return util::partitioner<ExPolicy, FwdIter, FwdIter>::
+                return util::partitioner<ExPolicy, FwdIter_, FwdIter_>::
                     call(
                         policy, first, std::distance(first, last),
-                        [f](FwdIter it, std::size_t part_count)
+                        [f](FwdIter_ it, std::size_t part_count)
                         {
                             return sequential_max_element(it, part_count, f);
                         },
-                        hpx::util::unwrapped([f](std::vector<FwdIter> && positions)
+                        hpx::util::unwrapped([f](std::vector<FwdIter_> && positions)
                         {
                             return sequential_max_element_ind(
                                 positions.begin(), positions.size(), f);
                         }));
             }
         };
+
+        ///////////////////////////////////////////////////////////////////////
+        // non-segmented implementation
+        template <typename ExPolicy, typename FwdIter, typename F>
+        inline typename detail::algorithm_result<ExPolicy, FwdIter>::type
+        max_element_(ExPolicy && policy, FwdIter first, FwdIter last, F && f,
+            std::false_type)
+        {
+            typedef typename is_sequential_execution_policy<ExPolicy>::type
+                is_seq;
+
+            return detail::max_element<FwdIter>().call(
+                std::forward<ExPolicy>(policy), is_seq(),
+                first, last, std::forward<F>(f));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename SegIter, typename F>
+        inline typename detail::algorithm_result<ExPolicy, SegIter>::type
+        max_element_(ExPolicy && policy, SegIter first, SegIter last, F && f,
+            std::true_type);
+
         /// \endcond
     }
 
@@ -415,11 +466,13 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                 std::forward_iterator_tag, iterator_category>::value),
             "Required at least forward iterator.");
 
-        typedef typename is_sequential_execution_policy<ExPolicy>::type is_seq;
+        typedef hpx::traits::segmented_iterator_traits<FwdIter>
+            iterator_traits;
+        typedef typename iterator_traits::is_segmented_iterator is_segmented;
 
-        return detail::max_element<FwdIter>().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, std::forward<F>(f));
+        return detail::max_element_(
+            std::forward<ExPolicy>(policy), first, last, std::forward<F>(f),
+            is_segmented());
     }
 
     /// Finds the greatest element in the range [first, last) using the given
@@ -481,11 +534,13 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                 std::forward_iterator_tag, iterator_category>::value),
             "Required at least forward iterator.");
 
-        typedef typename is_sequential_execution_policy<ExPolicy>::type is_seq;
+        typedef hpx::traits::segmented_iterator_traits<FwdIter>
+            iterator_traits;
+        typedef typename iterator_traits::is_segmented_iterator is_segmented;
 
-        return detail::max_element<FwdIter>().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, std::less<value_type>());
+        return detail::max_element_(
+            std::forward<ExPolicy>(policy), first, last,
+            std::less<value_type>(), is_segmented());
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -543,21 +598,21 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
               : minmax_element::algorithm("minmax_element")
             {}
 
-            template <typename ExPolicy, typename F>
-            static std::pair<FwdIter, FwdIter>
-            sequential(ExPolicy const&, FwdIter first, FwdIter last, F && f)
+            template <typename ExPolicy, typename FwdIter_, typename F>
+            static std::pair<FwdIter_, FwdIter_>
+            sequential(ExPolicy const&, FwdIter_ first, FwdIter_ last, F && f)
             {
                 return std::minmax_element(first, last, std::forward<F>(f));
             }
 
-            template <typename ExPolicy, typename F>
+            template <typename ExPolicy, typename FwdIter_, typename F>
             static typename detail::algorithm_result<
-                ExPolicy, std::pair<FwdIter, FwdIter>
+                ExPolicy, std::pair<FwdIter_, FwdIter_>
             >::type
-            parallel(ExPolicy const& policy, FwdIter first, FwdIter last,
+            parallel(ExPolicy const& policy, FwdIter_ first, FwdIter_ last,
                 F && f)
             {
-                typedef std::pair<FwdIter, FwdIter> result_type;
+                typedef std::pair<FwdIter_, FwdIter_> result_type;
 
                 result_type result(first, first);
                 if (first == last || ++first == last)
@@ -569,7 +624,7 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                 return util::partitioner<ExPolicy, result_type, result_type>::
                     call(
                         policy, result.first, std::distance(result.first, last),
-                        [f](FwdIter it, std::size_t part_count)
+                        [f](FwdIter_ it, std::size_t part_count)
                         {
                             return sequential_minmax_element(it, part_count, f);
                         },
@@ -580,6 +635,32 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                         }));
             }
         };
+
+        ///////////////////////////////////////////////////////////////////////
+        // non-segmented implementation
+        template <typename ExPolicy, typename FwdIter, typename F>
+        inline typename detail::algorithm_result<ExPolicy,
+            std::pair<FwdIter, FwdIter>
+        >::type
+        minmax_element_(ExPolicy && policy, FwdIter first, FwdIter last, F && f,
+            std::false_type)
+        {
+            typedef typename is_sequential_execution_policy<ExPolicy>::type
+                is_seq;
+
+            return detail::minmax_element<FwdIter>().call(
+                std::forward<ExPolicy>(policy), is_seq(),
+                first, last, std::forward<F>(f));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename SegIter, typename F>
+        inline typename detail::algorithm_result<ExPolicy,
+            std::pair<SegIter, SegIter>
+        >::type
+        minmax_element_(ExPolicy && policy, SegIter first, SegIter last, F && f,
+            std::true_type);
+
         /// \endcond
     }
 
@@ -663,11 +744,13 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                 std::forward_iterator_tag, iterator_category>::value),
             "Required at least forward iterator.");
 
-        typedef typename is_sequential_execution_policy<ExPolicy>::type is_seq;
+        typedef hpx::traits::segmented_iterator_traits<FwdIter>
+            iterator_traits;
+        typedef typename iterator_traits::is_segmented_iterator is_segmented;
 
-        return detail::minmax_element<FwdIter>().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, std::forward<F>(f));
+        return detail::minmax_element_(
+            std::forward<ExPolicy>(policy), first, last, std::forward<F>(f),
+            is_segmented());
     }
 
     /// Finds the greatest element in the range [first, last) using the given
@@ -734,11 +817,13 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                 std::forward_iterator_tag, iterator_category>::value),
             "Required at least forward iterator.");
 
-        typedef typename is_sequential_execution_policy<ExPolicy>::type is_seq;
+        typedef hpx::traits::segmented_iterator_traits<FwdIter>
+            iterator_traits;
+        typedef typename iterator_traits::is_segmented_iterator is_segmented;
 
-        return detail::minmax_element<FwdIter>().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, std::less<value_type>());
+        return detail::minmax_element_(
+            std::forward<ExPolicy>(policy), first, last,
+            std::less<value_type>(), is_segmented());
     }
 }}}
 
@@ -126,7 +126,8 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                                 first2 = last2;
                             }
                             return std::make_pair(first1, first2);
-                        });
+                        },
+                        tok);
             }
         };
         /// \endcond
@@ -399,7 +400,8 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
 
                             std::advance(first2, mismatched);
                             return std::make_pair(first1, first2);
-                        });
+                        },
+                        tok);
             }
         };
         /// \endcond
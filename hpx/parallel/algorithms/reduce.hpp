@@ -11,6 +11,7 @@
 #include <hpx/hpx_fwd.hpp>
 #include <hpx/util/move.hpp>
 #include <hpx/util/unwrapped.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
 
 #include <hpx/parallel/config/inline_namespace.hpp>
 #include <hpx/parallel/execution_policy.hpp>
@@ -27,6 +28,7 @@
 #include <algorithm>
 #include <numeric>
 #include <iterator>
+#include <type_traits>
 
 namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
 {
@@ -79,6 +81,31 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                     }));
             }
         };
+
+        ///////////////////////////////////////////////////////////////////////
+        // non-segmented implementation
+        template <typename ExPolicy, typename InIter, typename T, typename F>
+        inline typename detail::algorithm_result<ExPolicy, T>::type
+        reduce_(ExPolicy && policy, InIter first, InIter last, T init,
+            F && f, std::false_type)
+        {
+            typedef typename std::iterator_traits<InIter>::iterator_category
+                iterator_category;
+            typedef typename boost::mpl::or_<
+                is_sequential_execution_policy<ExPolicy>,
+                boost::is_same<std::input_iterator_tag, iterator_category>
+            >::type is_seq;
+
+            return detail::reduce<T>().call(
+                std::forward<ExPolicy>(policy), is_seq(),
+                first, last, std::move(init), std::forward<F>(f));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename SegIter, typename T, typename F>
+        inline typename detail::algorithm_result<ExPolicy, T>::type
+        reduce_(ExPolicy && policy, SegIter first, SegIter last, T init,
+            F && f, std::true_type);
         /// \endcond
     }
 
@@ -166,14 +193,12 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             (boost::is_base_of<std::input_iterator_tag, iterator_category>::value),
             "Requires at least input iterator.");
 
-        typedef typename boost::mpl::or_<
-            is_sequential_execution_policy<ExPolicy>,
-            boost::is_same<std::input_iterator_tag, iterator_category>
-        >::type is_seq;
+        typedef hpx::traits::segmented_iterator_traits<InIter> iterator_traits;
+        typedef typename iterator_traits::is_segmented_iterator is_segmented;
 
-        return detail::reduce<T>().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, std::move(init), std::forward<F>(f));
+        return detail::reduce_(
+            std::forward<ExPolicy>(policy), first, last, std::move(init),
+            std::forward<F>(f), is_segmented());
     }
 
     /// Returns GENERALIZED_SUM(+, init, *first, ..., *(first + (last - first) - 1)).
@@ -243,14 +268,12 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             (boost::is_base_of<std::input_iterator_tag, iterator_category>::value),
             "Requires at least input iterator.");
 
-        typedef typename boost::mpl::or_<
-            is_sequential_execution_policy<ExPolicy>,
-            boost::is_same<std::input_iterator_tag, iterator_category>
-        >::type is_seq;
+        typedef hpx::traits::segmented_iterator_traits<InIter> iterator_traits;
+        typedef typename iterator_traits::is_segmented_iterator is_segmented;
 
-        return detail::reduce<T>().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, std::move(init), std::plus<T>());
+        return detail::reduce_(
+            std::forward<ExPolicy>(policy), first, last, std::move(init),
+            std::plus<T>(), is_segmented());
     }
 
     /// Returns GENERALIZED_SUM(+, T(), *first, ..., *(first + (last - first) - 1)).
@@ -323,14 +346,12 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             (boost::is_base_of<std::input_iterator_tag, iterator_category>::value),
             "Requires at least input iterator.");
 
-        typedef typename boost::mpl::or_<
-            is_sequential_execution_policy<ExPolicy>,
-            boost::is_same<std::input_iterator_tag, iterator_category>
-        >::type is_seq;
+        typedef hpx::traits::segmented_iterator_traits<InIter> iterator_traits;
+        typedef typename iterator_traits::is_segmented_iterator is_segmented;
 
-        return detail::reduce<value_type>().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, value_type(), std::plus<value_type>());
+        return detail::reduce_(
+            std::forward<ExPolicy>(policy), first, last, value_type(),
+            std::plus<value_type>(), is_segmented());
     }
 }}}
 
@@ -116,7 +116,8 @@ namespace hpx {namespace parallel { HPX_INLINE_NAMESPACE(v1)
                             first = last;
 
                         return std::move(first);
-                    });
+                    },
+                    tok);
             }
         };
         /// \endcond
@@ -390,7 +391,8 @@ namespace hpx {namespace parallel { HPX_INLINE_NAMESPACE(v1)
                             std::advance(first, search_res);
 
                         return std::move(first);
-                    });
+                    },
+                    tok);
             }
         };
         /// \endcond
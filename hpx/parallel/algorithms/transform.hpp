@@ -9,6 +9,7 @@
 #define HPX_PARALLEL_DETAIL_TRANSFORM_MAY_29_2014_0932PM
 
 #include <hpx/hpx_fwd.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
 #include <hpx/util/move.hpp>
 
 #include <hpx/parallel/config/inline_namespace.hpp>
@@ -20,6 +21,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <type_traits>
 
 #include <boost/static_assert.hpp>
 #include <boost/utility/enable_if.hpp>
@@ -39,23 +41,25 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
               : transform::algorithm("transform")
             {}
 
-            template <typename ExPolicy, typename InIter, typename F>
-            static OutIter
-            sequential(ExPolicy const&, InIter first, InIter last, OutIter dest,
-                F && f)
+            template <typename ExPolicy, typename InIter, typename OutIter_,
+                typename F>
+            static OutIter_
+            sequential(ExPolicy const&, InIter first, InIter last,
+                OutIter_ dest, F && f)
             {
                 return std::transform(first, last, dest, std::forward<F>(f));
             }
 
-            template <typename ExPolicy, typename FwdIter, typename F>
-            static typename detail::algorithm_result<ExPolicy, OutIter>::type
+            template <typename ExPolicy, typename FwdIter, typename OutIter_,
+                typename F>
+            static typename detail::algorithm_result<ExPolicy, OutIter_>::type
             parallel(ExPolicy const& policy, FwdIter first, FwdIter last,
-                OutIter dest, F && f)
+                OutIter_ dest, F && f)
             {
-                typedef hpx::util::zip_iterator<FwdIter, OutIter> zip_iterator;
+                typedef hpx::util::zip_iterator<FwdIter, OutIter_> zip_iterator;
                 typedef typename zip_iterator::reference reference;
                 typedef
-                    typename detail::algorithm_result<ExPolicy, OutIter>::type
+                    typename detail::algorithm_result<ExPolicy, OutIter_>::type
                 result_type;
 
                 return get_iter<1, result_type>(
@@ -69,6 +73,35 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                         }));
             }
         };
+
+        ///////////////////////////////////////////////////////////////////////
+        // non-segmented implementation
+        template <typename ExPolicy, typename InIter, typename OutIter,
+            typename F>
+        inline typename detail::algorithm_result<ExPolicy, OutIter>::type
+        transform_(ExPolicy && policy, InIter first, InIter last, OutIter dest,
+            F && f, std::false_type)
+        {
+            typedef typename std::iterator_traits<InIter>::iterator_category
+                iterator_category;
+
+            typedef typename boost::mpl::or_<
+                is_sequential_execution_policy<ExPolicy>,
+                boost::is_same<std::input_iterator_tag, iterator_category>
+            >::type is_seq;
+
+            return detail::transform<OutIter>().call(
+                std::forward<ExPolicy>(policy), is_seq(),
+                first, last, dest, std::forward<F>(f));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename SegIter, typename SegOutIter,
+            typename F>
+        typename detail::algorithm_result<ExPolicy, SegOutIter>::type
+        transform_(ExPolicy && policy, SegIter first, SegIter last,
+            SegOutIter dest, F && f, std::true_type);
+
         /// \endcond
     }
 
@@ -147,14 +180,19 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             (boost::is_base_of<std::input_iterator_tag, iterator_category>::value),
             "Required at least input iterator.");
 
-        typedef typename boost::mpl::or_<
-            is_sequential_execution_policy<ExPolicy>,
-            boost::is_same<std::input_iterator_tag, iterator_category>
-        >::type is_seq;
+        // the segmented version requires both sequences to be segmented
+        typedef std::integral_constant<bool,
+                hpx::traits::segmented_iterator_traits<
+                    InIter
+                >::is_segmented_iterator::value &&
+                hpx::traits::segmented_iterator_traits<
+                    OutIter
+                >::is_segmented_iterator::value
+            > is_segmented;
 
-        return detail::transform<OutIter>().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, dest, std::forward<F>(f));
+        return detail::transform_(
+            std::forward<ExPolicy>(policy), first, last, dest,
+            std::forward<F>(f), is_segmented());
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -171,25 +209,26 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             {}
 
             template <typename ExPolicy, typename InIter1, typename InIter2,
-                typename F>
-            static OutIter
+                typename OutIter_, typename F>
+            static OutIter_
             sequential(ExPolicy const&, InIter1 first1, InIter1 last1,
-                InIter2 first2, OutIter dest, F && f)
+                InIter2 first2, OutIter_ dest, F && f)
             {
                 return std::transform(first1, last1, first2, dest,
                     std::forward<F>(f));
             }
 
             template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
-                typename F>
-            static typename detail::algorithm_result<ExPolicy, OutIter>::type
+                typename OutIter_, typename F>
+            static typename detail::algorithm_result<ExPolicy, OutIter_>::type
             parallel(ExPolicy const& policy, FwdIter1 first1, FwdIter1 last1,
-                FwdIter2 first2, OutIter dest, F && f)
+                FwdIter2 first2, OutIter_ dest, F && f)
             {
-                typedef hpx::util::zip_iterator<FwdIter1, FwdIter2, OutIter> zip_iterator;
+                typedef hpx::util::zip_iterator<FwdIter1, FwdIter2, OutIter_>
+                    zip_iterator;
                 typedef typename zip_iterator::reference reference;
                 typedef
-                    typename detail::algorithm_result<ExPolicy, OutIter>::type
+                    typename detail::algorithm_result<ExPolicy, OutIter_>::type
                 result_type;
 
                 return get_iter<2, result_type>(
@@ -203,6 +242,38 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                         }));
             }
         };
+
+        ///////////////////////////////////////////////////////////////////////
+        // non-segmented implementation
+        template <typename ExPolicy, typename InIter1, typename InIter2,
+            typename OutIter, typename F>
+        inline typename detail::algorithm_result<ExPolicy, OutIter>::type
+        transform_binary_(ExPolicy && policy, InIter1 first1, InIter1 last1,
+            InIter2 first2, OutIter dest, F && f, std::false_type)
+        {
+            typedef typename std::iterator_traits<InIter1>::iterator_category
+                category1;
+            typedef typename std::iterator_traits<InIter2>::iterator_category
+                category2;
+
+            typedef typename boost::mpl::or_<
+                is_sequential_execution_policy<ExPolicy>,
+                boost::is_same<std::input_iterator_tag, category1>,
+                boost::is_same<std::input_iterator_tag, category2>
+            >::type is_seq;
+
+            return detail::transform_binary<OutIter>().call(
+                std::forward<ExPolicy>(policy), is_seq(),
+                first1, last1, first2, dest, std::forward<F>(f));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename SegIter1, typename SegIter2,
+            typename SegOutIter, typename F>
+        typename detail::algorithm_result<ExPolicy, SegOutIter>::type
+        transform_binary_(ExPolicy && policy, SegIter1 first1, SegIter1 last1,
+            SegIter2 first2, SegOutIter dest, F && f, std::true_type);
+
         /// \endcond
     }
 
@@ -295,15 +366,22 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             (boost::is_base_of<std::input_iterator_tag, category2>::value),
             "Required at least input iterator.");
 
-        typedef typename boost::mpl::or_<
-            is_sequential_execution_policy<ExPolicy>,
-            boost::is_same<std::input_iterator_tag, category1>,
-            boost::is_same<std::input_iterator_tag, category2>
-        >::type is_seq;
+        // the segmented version requires all sequences to be segmented
+        typedef std::integral_constant<bool,
+                hpx::traits::segmented_iterator_traits<
+                    InIter1
+                >::is_segmented_iterator::value &&
+                hpx::traits::segmented_iterator_traits<
+                    InIter2
+                >::is_segmented_iterator::value &&
+                hpx::traits::segmented_iterator_traits<
+                    OutIter
+                >::is_segmented_iterator::value
+            > is_segmented;
 
-        return detail::transform_binary<OutIter>().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first1, last1, first2, dest, std::forward<F>(f));
+        return detail::transform_binary_(
+            std::forward<ExPolicy>(policy), first1, last1, first2, dest,
+            std::forward<F>(f), is_segmented());
     }
 }}}
 
@@ -15,6 +15,7 @@
 #include <hpx/parallel/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/algorithm_result.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/exclusive_scan.hpp>
 #include <hpx/parallel/algorithms/transform_inclusive_scan.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
 #include <hpx/parallel/util/scan_partitioner.hpp>
@@ -84,6 +85,15 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
 
                 typedef typename std::iterator_traits<FwdIter>::difference_type
                     difference_type;
+
+                if (policy.is_single_pass())
+                {
+                    return single_pass_exclusive_scan(policy, first,
+                        std::distance(first, last), dest,
+                        std::forward<Conv>(conv), std::forward<T>(init),
+                        std::forward<Op>(op));
+                }
+
                 difference_type count = std::distance(first, last) - 1;
 
                 *dest++ = init;
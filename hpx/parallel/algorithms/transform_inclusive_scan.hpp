@@ -99,6 +99,14 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                     return result::get(std::move(dest));
 
                 difference_type count = std::distance(first, last);
+
+                if (policy.is_single_pass())
+                {
+                    return single_pass_inclusive_scan(policy, first, count,
+                        dest, std::forward<Conv>(conv), std::forward<T>(init),
+                        std::forward<Op>(op));
+                }
+
                 boost::shared_array<T> data(new T[count]);
 
                 // The overall scan algorithm is performed by executing 2
@@ -40,6 +40,20 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
     /// asynchronous way.
     static task_execution_policy_tag const task;
 
+    /// \cond NOINTERNAL
+    struct single_pass_scan_tag
+    {
+        single_pass_scan_tag() {}
+    };
+    /// \endcond
+
+    /// Extension: The execution policy tag \a single_pass can be used to
+    /// create a parallel execution policy which makes the scan based
+    /// algorithms (inclusive_scan, exclusive_scan, and their transform
+    /// variants) use a single-pass scan. All partitions of the input are
+    /// scanned while still cache resident instead of being read twice.
+    static single_pass_scan_tag const single_pass;
+
     ///////////////////////////////////////////////////////////////////////////
     /// Extension: The class sequential_task_execution_policy is an execution
     /// policy type used as a unique type to disambiguate parallel algorithm
@@ -81,7 +95,9 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
     {
     public:
         /// \cond NOINTERNAL
-        parallel_task_execution_policy() {}
+        parallel_task_execution_policy()
+          : chunk_size_(0), single_pass_(false)
+        {}
         /// \endcond
 
         /// Create a new parallel_task_execution_policy referencing an executor and
@@ -99,7 +115,8 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
         parallel_task_execution_policy operator()(threads::executor const& exec,
             std::size_t chunk_size) const
         {
-            return parallel_task_execution_policy(exec, chunk_size);
+            return parallel_task_execution_policy(exec, chunk_size,
+                single_pass_);
         }
 
         /// Create a new parallel_task_execution_policy referencing an executor and
@@ -114,7 +131,8 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
         parallel_task_execution_policy operator()(
             threads::executor const& exec) const
         {
-            return parallel_task_execution_policy(exec, chunk_size_);
+            return parallel_task_execution_policy(exec, chunk_size_,
+                single_pass_);
         }
 
         /// Create a new parallel_task_execution_policy referencing a chunk size.
@@ -127,7 +145,8 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
         ///
         parallel_task_execution_policy operator()(std::size_t chunk_size) const
         {
-            return parallel_task_execution_policy(exec_, chunk_size);
+            return parallel_task_execution_policy(exec_, chunk_size,
+                single_pass_);
         }
 
         /// Create a new parallel_task_execution_policy from itself
@@ -143,28 +162,45 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             return *this;
         }
 
+        /// Create a new parallel_task_execution_policy which makes the scan
+        /// based algorithms use the single-pass scan.
+        ///
+        /// \param tag          [in] Specify that the single-pass scan should
+        ///                     be used
+        ///
+        /// \returns The new parallel_task_execution_policy
+        ///
+        parallel_task_execution_policy operator()(
+            single_pass_scan_tag tag) const
+        {
+            return parallel_task_execution_policy(exec_, chunk_size_, true);
+        }
+
         /// \cond NOINTERNAL
         threads::executor get_executor() const { return exec_; }
         std::size_t get_chunk_size() const { return chunk_size_; }
+        bool is_single_pass() const { return single_pass_; }
         /// \endcond
 
     private:
         /// \cond NOINTERNAL
         friend class hpx::serialization::access;
+        friend struct parallel_execution_policy;
 
         template <typename Archive>
         void serialize(Archive& ar, unsigned)
         {
-            ar & chunk_size_;
+            ar & chunk_size_ & single_pass_;
         }
 
         parallel_task_execution_policy(threads::executor const& exec,
-                std::size_t chunk_size)
-          : exec_(exec), chunk_size_(chunk_size)
+                std::size_t chunk_size, bool single_pass)
+          : exec_(exec), chunk_size_(chunk_size), single_pass_(single_pass)
         {}
 
         threads::executor exec_;
         std::size_t chunk_size_;
+        bool single_pass_;
         /// \endcond
     };
 
@@ -179,7 +215,9 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
     {
     public:
         /// \cond NOINTERNAL
-        parallel_execution_policy() {}
+        parallel_execution_policy()
+          : chunk_size_(0), single_pass_(false)
+        {}
         /// \endcond
 
         /// Create a new parallel_execution_policy referencing an executor and
@@ -197,7 +235,7 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
         parallel_execution_policy operator()(threads::executor const& exec,
             std::size_t chunk_size) const
         {
-            return parallel_execution_policy(exec, chunk_size);
+            return parallel_execution_policy(exec, chunk_size, single_pass_);
         }
 
         /// Create a new parallel_execution_policy referencing an executor and
@@ -211,7 +249,7 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
         ///
         parallel_execution_policy operator()(threads::executor const& exec) const
         {
-            return parallel_execution_policy(exec, chunk_size_);
+            return parallel_execution_policy(exec, chunk_size_, single_pass_);
         }
 
         /// Create a new parallel_execution_policy referencing a chunk size.
@@ -224,7 +262,7 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
         ///
         parallel_execution_policy operator()(std::size_t chunk_size) const
         {
-            return parallel_execution_policy(exec_, chunk_size);
+            return parallel_execution_policy(exec_, chunk_size, single_pass_);
         }
 
         /// Create a new parallel_task_execution_policy referencing an executor
@@ -244,7 +282,8 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
         parallel_task_execution_policy operator()(task_execution_policy_tag tag,
             threads::executor const& exec, std::size_t chunk_size) const
         {
-            return par_task(exec, chunk_size);
+            return parallel_task_execution_policy(exec, chunk_size,
+                single_pass_);
         }
 
         /// Create a new parallel_task_execution_policy referencing an executor
@@ -261,7 +300,8 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
         parallel_task_execution_policy operator()(task_execution_policy_tag tag,
             threads::executor const& exec) const
         {
-            return par_task(exec, chunk_size_);
+            return parallel_task_execution_policy(exec, chunk_size_,
+                single_pass_);
         }
 
         /// Create a new parallel_execution_policy referencing a chunk size.
@@ -277,7 +317,8 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
         parallel_task_execution_policy operator()(task_execution_policy_tag tag,
             std::size_t chunk_size) const
         {
-            return par_task(exec_, chunk_size);
+            return parallel_task_execution_policy(exec_, chunk_size,
+                single_pass_);
         }
 
         /// Create a new parallel_execution_policy referencing a chunk size.
@@ -289,12 +330,27 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
         ///
         parallel_task_execution_policy operator()(task_execution_policy_tag tag) const
         {
-            return par_task(exec_, chunk_size_);
+            return parallel_task_execution_policy(exec_, chunk_size_,
+                single_pass_);
+        }
+
+        /// Create a new parallel_execution_policy which makes the scan based
+        /// algorithms use the single-pass scan.
+        ///
+        /// \param tag          [in] Specify that the single-pass scan should
+        ///                     be used
+        ///
+        /// \returns The new parallel_execution_policy
+        ///
+        parallel_execution_policy operator()(single_pass_scan_tag tag) const
+        {
+            return parallel_execution_policy(exec_, chunk_size_, true);
         }
 
         /// \cond NOINTERNAL
         threads::executor get_executor() const { return exec_; }
         std::size_t get_chunk_size() const { return chunk_size_; }
+        bool is_single_pass() const { return single_pass_; }
         /// \endcond
 
     private:
@@ -304,16 +360,17 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
         template <typename Archive>
         void serialize(Archive& ar, unsigned)
         {
-            ar & chunk_size_;
+            ar & chunk_size_ & single_pass_;
         }
 
         parallel_execution_policy(threads::executor const& exec,
-                std::size_t chunk_size)
-          : exec_(exec), chunk_size_(chunk_size)
+                std::size_t chunk_size, bool single_pass)
+          : exec_(exec), chunk_size_(chunk_size), single_pass_(single_pass)
         {}
 
         threads::executor exec_;
         std::size_t chunk_size_;
+        bool single_pass_;
         // \endcond
     };
 
@@ -331,6 +388,7 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
 
         static threads::executor get_executor() { return threads::executor(); }
         static std::size_t get_chunk_size() { return 0; }
+        static bool is_single_pass() { return false; }
         // \endcond
 
         /// Create a new sequential_task_execution_policy referencing an executor
@@ -362,6 +420,7 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
 
         static threads::executor get_executor() { return threads::executor(); }
         static std::size_t get_chunk_size() { return 0; }
+        static bool is_single_pass() { return false; }
         /// \endcond
 
         /// Create a new parallel_vector_execution_policy from itself
@@ -13,6 +13,7 @@
 
 #include <hpx/parallel/algorithms/uninitialized_copy.hpp>
 #include <hpx/parallel/algorithms/uninitialized_fill.hpp>
+#include <hpx/parallel/util/numa_allocator.hpp>
 
 #endif
 
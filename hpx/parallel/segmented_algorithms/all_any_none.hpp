@@ -0,0 +1,283 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHM_ALL_ANY_NONE_AUG_05_2015_0500PM)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHM_ALL_ANY_NONE_AUG_05_2015_0500PM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+
+#include <hpx/parallel/config/inline_namespace.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/algorithm_result.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/all_any_none.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include <boost/type_traits/is_same.hpp>
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_all_any_none
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // The overall result is the negation of 'decisive' unless at least
+        // one of the segments returns 'decisive' (false for all_of and
+        // none_of, true for any_of).
+
+        // sequential remote implementation, stops at the first segment
+        // which decides the overall result
+        template <typename Algo, typename ExPolicy, typename SegIter,
+            typename F>
+        static typename detail::algorithm_result<ExPolicy, bool>::type
+        segmented_all_any_none(Algo && algo, ExPolicy const& policy,
+            SegIter first, SegIter last, F && f, bool decisive,
+            boost::mpl::true_)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::segment_iterator segment_iterator;
+            typedef typename traits::local_iterator local_iterator_type;
+            typedef detail::algorithm_result<ExPolicy, bool> result;
+
+            using boost::mpl::true_;
+
+            segment_iterator sit = traits::segment(first);
+            segment_iterator send = traits::segment(last);
+
+            if (sit == send)
+            {
+                // all elements are on the same partition
+                local_iterator_type beg = traits::local(first);
+                local_iterator_type end = traits::local(last);
+                if (beg != end)
+                {
+                    return result::get(dispatch(traits::get_id(sit),
+                        std::forward<Algo>(algo), policy, true_(),
+                        beg, end, f));
+                }
+            }
+            else {
+                // handle the remaining part of the first partition
+                local_iterator_type beg = traits::local(first);
+                local_iterator_type end = traits::end(sit);
+                if (beg != end)
+                {
+                    if (dispatch(traits::get_id(sit),
+                            std::forward<Algo>(algo), policy, true_(),
+                            beg, end, f) == decisive)
+                    {
+                        return result::get(std::move(decisive));
+                    }
+                }
+
+                // handle all of the full partitions
+                for (++sit; sit != send; ++sit)
+                {
+                    beg = traits::begin(sit);
+                    end = traits::end(sit);
+                    if (beg != end)
+                    {
+                        if (dispatch(traits::get_id(sit),
+                                std::forward<Algo>(algo), policy, true_(),
+                                beg, end, f) == decisive)
+                        {
+                            return result::get(std::move(decisive));
+                        }
+                    }
+                }
+
+                // handle the beginning of the last partition
+                beg = traits::begin(sit);
+                end = traits::local(last);
+                if (beg != end)
+                {
+                    if (dispatch(traits::get_id(sit),
+                            std::forward<Algo>(algo), policy, true_(),
+                            beg, end, f) == decisive)
+                    {
+                        return result::get(std::move(decisive));
+                    }
+                }
+            }
+
+            return result::get(!decisive);
+        }
+
+        // parallel remote implementation
+        template <typename Algo, typename ExPolicy, typename SegIter,
+            typename F>
+        static typename detail::algorithm_result<ExPolicy, bool>::type
+        segmented_all_any_none(Algo && algo, ExPolicy const& policy,
+            SegIter first, SegIter last, F && f, bool decisive,
+            boost::mpl::false_)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::segment_iterator segment_iterator;
+            typedef typename traits::local_iterator local_iterator_type;
+            typedef detail::algorithm_result<ExPolicy, bool> result;
+
+            typedef typename std::iterator_traits<SegIter>::iterator_category
+                iterator_category;
+            typedef typename boost::mpl::bool_<boost::is_same<
+                    iterator_category, std::input_iterator_tag
+                >::value> forced_seq;
+
+            segment_iterator sit = traits::segment(first);
+            segment_iterator send = traits::segment(last);
+
+            std::vector<shared_future<bool> > segments;
+            segments.reserve(std::distance(sit, send));
+
+            if (sit == send)
+            {
+                // all elements are on the same partition
+                local_iterator_type beg = traits::local(first);
+                local_iterator_type end = traits::local(last);
+                if (beg != end)
+                {
+                    segments.push_back(dispatch_async(traits::get_id(sit),
+                        std::forward<Algo>(algo), policy, forced_seq(),
+                        beg, end, f));
+                }
+            }
+            else {
+                // handle the remaining part of the first partition
+                local_iterator_type beg = traits::local(first);
+                local_iterator_type end = traits::end(sit);
+                if (beg != end)
+                {
+                    segments.push_back(dispatch_async(traits::get_id(sit),
+                        std::forward<Algo>(algo), policy, forced_seq(),
+                        beg, end, f));
+                }
+
+                // handle all of the full partitions
+                for (++sit; sit != send; ++sit)
+                {
+                    beg = traits::begin(sit);
+                    end = traits::end(sit);
+                    if (beg != end)
+                    {
+                        segments.push_back(dispatch_async(traits::get_id(sit),
+                            std::forward<Algo>(algo), policy, forced_seq(),
+                            beg, end, f));
+                    }
+                }
+
+                // handle the beginning of the last partition
+                beg = traits::begin(sit);
+                end = traits::local(last);
+                if (beg != end)
+                {
+                    segments.push_back(dispatch_async(traits::get_id(sit),
+                        std::forward<Algo>(algo), policy, forced_seq(),
+                        beg, end, f));
+                }
+            }
+
+            return result::get(
+                lcos::local::dataflow(
+                    [=](std::vector<shared_future<bool> > && r) -> bool
+                    {
+                        // handle any remote exceptions, will throw on error
+                        std::list<boost::exception_ptr> errors;
+                        parallel::util::detail::handle_remote_exceptions<
+                            ExPolicy
+                        >::call(r, errors);
+
+                        bool found = std::any_of(r.begin(), r.end(),
+                            [decisive](shared_future<bool>& val)
+                            {
+                                return val.get() == decisive;
+                            });
+                        return found ? decisive : !decisive;
+                    },
+                    std::move(segments)));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter, typename F>
+        inline typename detail::algorithm_result<ExPolicy, bool>::type
+        none_of_(ExPolicy && policy, SegIter first, SegIter last, F && f,
+            std::true_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+
+            if (first == last)
+                return detail::algorithm_result<ExPolicy, bool>::get(true);
+
+            return segmented_all_any_none(none_of(),
+                std::forward<ExPolicy>(policy), first, last,
+                std::forward<F>(f), false, is_seq());
+        }
+
+        template <typename ExPolicy, typename SegIter, typename F>
+        inline typename detail::algorithm_result<ExPolicy, bool>::type
+        any_of_(ExPolicy && policy, SegIter first, SegIter last, F && f,
+            std::true_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+
+            if (first == last)
+                return detail::algorithm_result<ExPolicy, bool>::get(false);
+
+            return segmented_all_any_none(any_of(),
+                std::forward<ExPolicy>(policy), first, last,
+                std::forward<F>(f), true, is_seq());
+        }
+
+        template <typename ExPolicy, typename SegIter, typename F>
+        inline typename detail::algorithm_result<ExPolicy, bool>::type
+        all_of_(ExPolicy && policy, SegIter first, SegIter last, F && f,
+            std::true_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+
+            if (first == last)
+                return detail::algorithm_result<ExPolicy, bool>::get(true);
+
+            return segmented_all_any_none(all_of(),
+                std::forward<ExPolicy>(policy), first, last,
+                std::forward<F>(f), false, is_seq());
+        }
+
+        // forward declare the non-segmented version of these algorithms
+        template <typename ExPolicy, typename InIter, typename F>
+        inline typename detail::algorithm_result<ExPolicy, bool>::type
+        none_of_(ExPolicy && policy, InIter first, InIter last, F && f,
+            std::false_type);
+
+        template <typename ExPolicy, typename InIter, typename F>
+        inline typename detail::algorithm_result<ExPolicy, bool>::type
+        any_of_(ExPolicy && policy, InIter first, InIter last, F && f,
+            std::false_type);
+
+        template <typename ExPolicy, typename InIter, typename F>
+        inline typename detail::algorithm_result<ExPolicy, bool>::type
+        all_of_(ExPolicy && policy, InIter first, InIter last, F && f,
+            std::false_type);
+
+        /// \endcond
+    }
+}}}
+
+#endif
@@ -19,6 +19,8 @@
 
 #include <boost/utility/enable_if.hpp>
 
+#include <utility>
+
 namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1) { namespace detail
 {
     ///////////////////////////////////////////////////////////////////////////
@@ -70,6 +72,63 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1) { namespace detail
         }
     };
 
+    template <typename Iterator1, typename Iterator2>
+    struct algorithm_result_helper<
+        std::pair<Iterator1, Iterator2>,
+        typename boost::enable_if<
+                typename hpx::traits::segmented_local_iterator_traits<
+                        Iterator1
+                    >::is_segmented_local_iterator
+            >::type>
+    {
+        typedef hpx::traits::segmented_local_iterator_traits<Iterator1>
+            traits1;
+        typedef hpx::traits::segmented_local_iterator_traits<Iterator2>
+            traits2;
+
+        static BOOST_FORCEINLINE std::pair<Iterator1, Iterator2>
+        call(std::pair<
+                typename traits1::local_raw_iterator,
+                typename traits2::local_raw_iterator
+            > && p)
+        {
+            return std::make_pair(traits1::remote(std::move(p.first)),
+                traits2::remote(std::move(p.second)));
+        }
+    };
+
+    template <typename Iterator1, typename Iterator2>
+    struct algorithm_result_helper<
+        future<std::pair<Iterator1, Iterator2> >,
+        typename boost::enable_if<
+                typename hpx::traits::segmented_local_iterator_traits<
+                        Iterator1
+                    >::is_segmented_local_iterator
+            >::type>
+    {
+        typedef hpx::traits::segmented_local_iterator_traits<Iterator1>
+            traits1;
+        typedef hpx::traits::segmented_local_iterator_traits<Iterator2>
+            traits2;
+
+        typedef std::pair<
+                typename traits1::local_raw_iterator,
+                typename traits2::local_raw_iterator
+            > arg_type;
+
+        static BOOST_FORCEINLINE future<std::pair<Iterator1, Iterator2> >
+        call(future<arg_type>&& f)
+        {
+            return f.then(
+                [](future<arg_type>&& f) -> std::pair<Iterator1, Iterator2>
+                {
+                    arg_type p = f.get();
+                    return std::make_pair(traits1::remote(std::move(p.first)),
+                        traits2::remote(std::move(p.second)));
+                });
+        }
+    };
+
     template <>
     struct algorithm_result_helper<future<void> >
     {
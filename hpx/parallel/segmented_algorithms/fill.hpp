@@ -0,0 +1,59 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHM_FILL_AUG_05_2015_1145AM)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHM_FILL_AUG_05_2015_1145AM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+
+#include <hpx/parallel/config/inline_namespace.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/algorithm_result.hpp>
+#include <hpx/parallel/algorithms/fill.hpp>
+#include <hpx/parallel/segmented_algorithms/for_each.hpp>
+
+#include <type_traits>
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_fill
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter, typename T>
+        inline typename detail::algorithm_result<ExPolicy>::type
+        fill_(ExPolicy && policy, SegIter first, SegIter last, T const& value,
+            std::true_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+
+            if (first == last)
+                return detail::algorithm_result<ExPolicy>::get();
+
+            // fill has the same structure as for_each, it just runs the fill
+            // algorithm on each of the segments
+            return segmented_for_each(
+                fill(), std::forward<ExPolicy>(policy),
+                first, last, value, is_seq());
+        }
+
+        // forward declare the non-segmented version of this algorithm
+        template <typename ExPolicy, typename InIter, typename T>
+        inline typename detail::algorithm_result<ExPolicy>::type
+        fill_(ExPolicy && policy, InIter first, InIter last, T const& value,
+            std::false_type);
+
+        /// \endcond
+    }
+}}}
+
+#endif
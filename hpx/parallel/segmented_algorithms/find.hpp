@@ -0,0 +1,372 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHM_FIND_AUG_05_2015_0320PM)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHM_FIND_AUG_05_2015_0320PM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/lcos/local/dataflow.hpp>
+#include <hpx/runtime/naming/name.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+#include <hpx/util/decay.hpp>
+
+#include <hpx/parallel/config/inline_namespace.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/algorithm_result.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/find.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_find
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // sequential remote implementation, the segments are searched one
+        // after the other, the search stops at the first segment which
+        // contains a match
+        template <typename Algo, typename ExPolicy, typename SegIter,
+            typename T>
+        static typename detail::algorithm_result<ExPolicy, SegIter>::type
+        segmented_find(Algo && algo, ExPolicy const& policy,
+            SegIter first, SegIter last, T && val, boost::mpl::true_)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::segment_iterator segment_iterator;
+            typedef typename traits::local_iterator local_iterator_type;
+            typedef detail::algorithm_result<ExPolicy, SegIter> result;
+
+            using boost::mpl::true_;
+
+            segment_iterator sit = traits::segment(first);
+            segment_iterator send = traits::segment(last);
+
+            if (sit == send)
+            {
+                // all elements are on the same partition
+                local_iterator_type beg = traits::local(first);
+                local_iterator_type end = traits::local(last);
+                if (beg != end)
+                {
+                    local_iterator_type out = dispatch(traits::get_id(sit),
+                        std::forward<Algo>(algo), policy, true_(),
+                        beg, end, val);
+                    if (out != end)
+                        return result::get(traits::compose(sit, out));
+                }
+            }
+            else {
+                // handle the remaining part of the first partition
+                local_iterator_type beg = traits::local(first);
+                local_iterator_type end = traits::end(sit);
+                if (beg != end)
+                {
+                    local_iterator_type out = dispatch(traits::get_id(sit),
+                        std::forward<Algo>(algo), policy, true_(),
+                        beg, end, val);
+                    if (out != end)
+                        return result::get(traits::compose(sit, out));
+                }
+
+                // handle all of the full partitions
+                for (++sit; sit != send; ++sit)
+                {
+                    beg = traits::begin(sit);
+                    end = traits::end(sit);
+                    if (beg != end)
+                    {
+                        local_iterator_type out = dispatch(traits::get_id(sit),
+                            std::forward<Algo>(algo), policy, true_(),
+                            beg, end, val);
+                        if (out != end)
+                            return result::get(traits::compose(sit, out));
+                    }
+                }
+
+                // handle the beginning of the last partition
+                beg = traits::begin(sit);
+                end = traits::local(last);
+                if (beg != end)
+                {
+                    local_iterator_type out = dispatch(traits::get_id(sit),
+                        std::forward<Algo>(algo), policy, true_(),
+                        beg, end, val);
+                    if (out != end)
+                        return result::get(traits::compose(sit, out));
+                }
+            }
+
+            return result::get(std::move(last));
+        }
+
+        template <typename SegIter>
+        struct find_segment
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+
+            typename traits::segment_iterator sit;
+            typename traits::local_iterator beg;
+            typename traits::local_iterator end;
+        };
+
+        // collect all non-empty segment ranges of [first, last)
+        template <typename SegIter>
+        std::vector<find_segment<SegIter> >
+        get_find_segments(SegIter first, SegIter last)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::segment_iterator segment_iterator;
+
+            segment_iterator sit = traits::segment(first);
+            segment_iterator send = traits::segment(last);
+
+            std::vector<find_segment<SegIter> > segments;
+            segments.reserve(std::distance(sit, send) + 1);
+
+            find_segment<SegIter> s;
+            if (sit == send)
+            {
+                // all elements are on the same partition
+                s.sit = sit;
+                s.beg = traits::local(first);
+                s.end = traits::local(last);
+                if (s.beg != s.end)
+                    segments.push_back(s);
+            }
+            else {
+                // handle the remaining part of the first partition
+                s.sit = sit;
+                s.beg = traits::local(first);
+                s.end = traits::end(sit);
+                if (s.beg != s.end)
+                    segments.push_back(s);
+
+                // handle all of the full partitions
+                for (++sit; sit != send; ++sit)
+                {
+                    s.sit = sit;
+                    s.beg = traits::begin(sit);
+                    s.end = traits::end(sit);
+                    if (s.beg != s.end)
+                        segments.push_back(s);
+                }
+
+                // handle the beginning of the last partition
+                s.sit = sit;
+                s.beg = traits::begin(sit);
+                s.end = traits::local(last);
+                if (s.beg != s.end)
+                    segments.push_back(s);
+            }
+
+            return segments;
+        }
+
+        // Search the segments starting at the given one. The segments are
+        // searched in waves holding at most one segment per locality, all
+        // segments of a wave are searched concurrently. The next wave is
+        // started only if none of the segments of the current one contains
+        // a match, the remaining segments are skipped otherwise.
+        template <typename Algo, typename ExPolicy, typename SegIter,
+            typename T, typename IsSeq>
+        future<SegIter>
+        find_segments(Algo const& algo, ExPolicy const& policy,
+            boost::shared_ptr<std::vector<find_segment<SegIter> > > const&
+                segments,
+            std::size_t first, T const& val, SegIter last, IsSeq is_seq)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::local_iterator local_iterator_type;
+
+            std::vector<shared_future<local_iterator_type> > wave;
+            std::vector<boost::uint32_t> localities;
+
+            std::size_t next = first;
+            for (/**/; next != segments->size(); ++next)
+            {
+                find_segment<SegIter> const& s = (*segments)[next];
+                id_type id = traits::get_id(s.sit);
+
+                boost::uint32_t locality_id =
+                    naming::get_locality_id_from_gid(id.get_gid());
+                if (std::find(localities.begin(), localities.end(),
+                        locality_id) != localities.end())
+                {
+                    break;
+                }
+                localities.push_back(locality_id);
+
+                wave.push_back(dispatch_async(id, algo, policy, is_seq,
+                    s.beg, s.end, val));
+            }
+
+            return lcos::local::dataflow(
+                [=](std::vector<shared_future<local_iterator_type> > && r)
+                -> future<SegIter>
+                {
+                    // handle any remote exceptions, will throw on error
+                    std::list<boost::exception_ptr> errors;
+                    parallel::util::detail::handle_remote_exceptions<
+                        ExPolicy
+                    >::call(r, errors);
+
+                    // the first match (in sequence order) is the result
+                    for (std::size_t i = 0; i != r.size(); ++i)
+                    {
+                        find_segment<SegIter> const& s =
+                            (*segments)[first + i];
+                        local_iterator_type out = r[i].get();
+                        if (out != s.end)
+                        {
+                            return make_ready_future(
+                                traits::compose(s.sit, out));
+                        }
+                    }
+
+                    if (next == segments->size())
+                        return make_ready_future(last);
+
+                    return find_segments(algo, policy, segments, next, val,
+                        last, is_seq);
+                },
+                std::move(wave));
+        }
+
+        // parallel remote implementation, the segments are searched
+        // concurrently (see find_segments above), the first match (in
+        // sequence order) is returned
+        template <typename Algo, typename ExPolicy, typename SegIter,
+            typename T>
+        static typename detail::algorithm_result<ExPolicy, SegIter>::type
+        segmented_find(Algo && algo, ExPolicy const& policy,
+            SegIter first, SegIter last, T && val, boost::mpl::false_)
+        {
+            typedef detail::algorithm_result<ExPolicy, SegIter> result;
+
+            typedef typename std::iterator_traits<SegIter>::iterator_category
+                iterator_category;
+            typedef typename boost::mpl::bool_<boost::is_same<
+                    iterator_category, std::input_iterator_tag
+                >::value> forced_seq;
+
+            typedef typename hpx::util::decay<Algo>::type algo_type;
+            typedef typename hpx::util::decay<T>::type value_type;
+
+            boost::shared_ptr<std::vector<find_segment<SegIter> > > segments =
+                boost::make_shared<std::vector<find_segment<SegIter> > >(
+                    get_find_segments(first, last));
+
+            if (segments->empty())
+                return result::get(std::move(last));
+
+            future<SegIter> f = find_segments(
+                algo_type(std::forward<Algo>(algo)), policy, segments,
+                std::size_t(0), value_type(std::forward<T>(val)), last,
+                forced_seq());
+
+            return result::get(std::move(f));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter, typename T>
+        inline typename detail::algorithm_result<ExPolicy, SegIter>::type
+        find_(ExPolicy && policy, SegIter first, SegIter last, T const& val,
+            std::true_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+            typedef hpx::traits::segmented_iterator_traits<SegIter>
+                iterator_traits;
+
+            if (first == last)
+                return detail::algorithm_result<ExPolicy, SegIter>::get(
+                    std::move(last));
+
+            return segmented_find(
+                find<typename iterator_traits::local_iterator>(),
+                std::forward<ExPolicy>(policy), first, last, val, is_seq());
+        }
+
+        template <typename ExPolicy, typename SegIter, typename F>
+        inline typename detail::algorithm_result<ExPolicy, SegIter>::type
+        find_if_(ExPolicy && policy, SegIter first, SegIter last, F && f,
+            std::true_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+            typedef hpx::traits::segmented_iterator_traits<SegIter>
+                iterator_traits;
+
+            if (first == last)
+                return detail::algorithm_result<ExPolicy, SegIter>::get(
+                    std::move(last));
+
+            return segmented_find(
+                find_if<typename iterator_traits::local_iterator>(),
+                std::forward<ExPolicy>(policy), first, last,
+                std::forward<F>(f), is_seq());
+        }
+
+        template <typename ExPolicy, typename SegIter, typename F>
+        inline typename detail::algorithm_result<ExPolicy, SegIter>::type
+        find_if_not_(ExPolicy && policy, SegIter first, SegIter last, F && f,
+            std::true_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+            typedef hpx::traits::segmented_iterator_traits<SegIter>
+                iterator_traits;
+
+            if (first == last)
+                return detail::algorithm_result<ExPolicy, SegIter>::get(
+                    std::move(last));
+
+            return segmented_find(
+                find_if_not<typename iterator_traits::local_iterator>(),
+                std::forward<ExPolicy>(policy), first, last,
+                std::forward<F>(f), is_seq());
+        }
+
+        // forward declare the non-segmented version of these algorithms
+        template <typename ExPolicy, typename InIter, typename T>
+        inline typename detail::algorithm_result<ExPolicy, InIter>::type
+        find_(ExPolicy && policy, InIter first, InIter last, T const& val,
+            std::false_type);
+
+        template <typename ExPolicy, typename InIter, typename F>
+        inline typename detail::algorithm_result<ExPolicy, InIter>::type
+        find_if_(ExPolicy && policy, InIter first, InIter last, F && f,
+            std::false_type);
+
+        template <typename ExPolicy, typename InIter, typename F>
+        inline typename detail::algorithm_result<ExPolicy, InIter>::type
+        find_if_not_(ExPolicy && policy, InIter first, InIter last, F && f,
+            std::false_type);
+
+        /// \endcond
+    }
+}}}
+
+#endif
@@ -0,0 +1,365 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHM_MINMAX_AUG_05_2015_0410PM)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHM_MINMAX_AUG_05_2015_0410PM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+#include <hpx/util/decay.hpp>
+
+#include <hpx/parallel/config/inline_namespace.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/algorithm_result.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/minmax.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/type_traits/is_same.hpp>
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_minmax
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // Convert the (local) result of one segment into a global iterator
+        template <typename Traits, typename SegIter, typename LocalIter>
+        SegIter compose_minmax_result(SegIter*,
+            typename Traits::segment_iterator const& sit, LocalIter const& it)
+        {
+            return Traits::compose(sit, it);
+        }
+
+        template <typename Traits, typename SegIter, typename LocalIter>
+        std::pair<SegIter, SegIter> compose_minmax_result(
+            std::pair<SegIter, SegIter>*,
+            typename Traits::segment_iterator const& sit,
+            std::pair<LocalIter, LocalIter> const& p)
+        {
+            return std::make_pair(Traits::compose(sit, p.first),
+                Traits::compose(sit, p.second));
+        }
+
+        // All segments compute their local result, those results are then
+        // reduced by the calling locality using the same semantics as for
+        // the non-segmented algorithms (Reduce is one of the
+        // sequential_*_element_ind functions).
+
+        // sequential remote implementation
+        template <typename R, typename Algo, typename ExPolicy,
+            typename SegIter, typename F, typename Reduce>
+        static typename detail::algorithm_result<ExPolicy, R>::type
+        segmented_minmax(Algo && algo, ExPolicy const& policy,
+            SegIter first, SegIter last, F && f, Reduce && reduce_op,
+            boost::mpl::true_)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::segment_iterator segment_iterator;
+            typedef typename traits::local_iterator local_iterator_type;
+            typedef typename hpx::util::decay<Algo>::type::result_type
+                local_result_type;
+            typedef detail::algorithm_result<ExPolicy, R> result;
+
+            using boost::mpl::true_;
+
+            segment_iterator sit = traits::segment(first);
+            segment_iterator send = traits::segment(last);
+
+            std::vector<R> positions;
+            positions.reserve(std::distance(sit, send) + 1);
+
+            if (sit == send)
+            {
+                // all elements are on the same partition
+                local_iterator_type beg = traits::local(first);
+                local_iterator_type end = traits::local(last);
+                if (beg != end)
+                {
+                    local_result_type out = dispatch(traits::get_id(sit),
+                        std::forward<Algo>(algo), policy, true_(),
+                        beg, end, f);
+                    positions.push_back(compose_minmax_result<traits>(
+                        static_cast<R*>(0), sit, out));
+                }
+            }
+            else {
+                // handle the remaining part of the first partition
+                local_iterator_type beg = traits::local(first);
+                local_iterator_type end = traits::end(sit);
+                if (beg != end)
+                {
+                    local_result_type out = dispatch(traits::get_id(sit),
+                        std::forward<Algo>(algo), policy, true_(),
+                        beg, end, f);
+                    positions.push_back(compose_minmax_result<traits>(
+                        static_cast<R*>(0), sit, out));
+                }
+
+                // handle all of the full partitions
+                for (++sit; sit != send; ++sit)
+                {
+                    beg = traits::begin(sit);
+                    end = traits::end(sit);
+                    if (beg != end)
+                    {
+                        local_result_type out = dispatch(traits::get_id(sit),
+                            std::forward<Algo>(algo), policy, true_(),
+                            beg, end, f);
+                        positions.push_back(compose_minmax_result<traits>(
+                            static_cast<R*>(0), sit, out));
+                    }
+                }
+
+                // handle the beginning of the last partition
+                beg = traits::begin(sit);
+                end = traits::local(last);
+                if (beg != end)
+                {
+                    local_result_type out = dispatch(traits::get_id(sit),
+                        std::forward<Algo>(algo), policy, true_(),
+                        beg, end, f);
+                    positions.push_back(compose_minmax_result<traits>(
+                        static_cast<R*>(0), sit, out));
+                }
+            }
+
+            return result::get(
+                reduce_op(positions.begin(), positions.size(), f));
+        }
+
+        // parallel remote implementation
+        template <typename R, typename Algo, typename ExPolicy,
+            typename SegIter, typename F, typename Reduce>
+        static typename detail::algorithm_result<ExPolicy, R>::type
+        segmented_minmax(Algo && algo, ExPolicy const& policy,
+            SegIter first, SegIter last, F && f, Reduce && reduce_op,
+            boost::mpl::false_)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::segment_iterator segment_iterator;
+            typedef typename traits::local_iterator local_iterator_type;
+            typedef typename hpx::util::decay<Algo>::type::result_type
+                local_result_type;
+            typedef detail::algorithm_result<ExPolicy, R> result;
+
+            typedef typename std::iterator_traits<SegIter>::iterator_category
+                iterator_category;
+            typedef typename boost::mpl::bool_<boost::is_same<
+                    iterator_category, std::input_iterator_tag
+                >::value> forced_seq;
+
+            segment_iterator sit = traits::segment(first);
+            segment_iterator send = traits::segment(last);
+
+            std::size_t count = std::distance(sit, send) + 1;
+
+            std::vector<shared_future<local_result_type> > segments;
+            segments.reserve(count);
+
+            std::vector<segment_iterator> segment_its;
+            segment_its.reserve(count);
+
+            if (sit == send)
+            {
+                // all elements are on the same partition
+                local_iterator_type beg = traits::local(first);
+                local_iterator_type end = traits::local(last);
+                if (beg != end)
+                {
+                    segments.push_back(dispatch_async(traits::get_id(sit),
+                        std::forward<Algo>(algo), policy, forced_seq(),
+                        beg, end, f));
+                    segment_its.push_back(sit);
+                }
+            }
+            else {
+                // handle the remaining part of the first partition
+                local_iterator_type beg = traits::local(first);
+                local_iterator_type end = traits::end(sit);
+                if (beg != end)
+                {
+                    segments.push_back(dispatch_async(traits::get_id(sit),
+                        std::forward<Algo>(algo), policy, forced_seq(),
+                        beg, end, f));
+                    segment_its.push_back(sit);
+                }
+
+                // handle all of the full partitions
+                for (++sit; sit != send; ++sit)
+                {
+                    beg = traits::begin(sit);
+                    end = traits::end(sit);
+                    if (beg != end)
+                    {
+                        segments.push_back(dispatch_async(traits::get_id(sit),
+                            std::forward<Algo>(algo), policy, forced_seq(),
+                            beg, end, f));
+                        segment_its.push_back(sit);
+                    }
+                }
+
+                // handle the beginning of the last partition
+                beg = traits::begin(sit);
+                end = traits::local(last);
+                if (beg != end)
+                {
+                    segments.push_back(dispatch_async(traits::get_id(sit),
+                        std::forward<Algo>(algo), policy, forced_seq(),
+                        beg, end, f));
+                    segment_its.push_back(sit);
+                }
+            }
+            HPX_ASSERT(!segments.empty());
+
+            typename hpx::util::decay<F>::type pred = std::forward<F>(f);
+            typename hpx::util::decay<Reduce>::type op =
+                std::forward<Reduce>(reduce_op);
+
+            return result::get(
+                lcos::local::dataflow(
+                    [=](std::vector<shared_future<local_result_type> > && r)
+                        -> R
+                    {
+                        // handle any remote exceptions, will throw on error
+                        std::list<boost::exception_ptr> errors;
+                        parallel::util::detail::handle_remote_exceptions<
+                            ExPolicy
+                        >::call(r, errors);
+
+                        std::vector<R> positions;
+                        positions.reserve(r.size());
+                        for (std::size_t i = 0; i != r.size(); ++i)
+                        {
+                            positions.push_back(compose_minmax_result<traits>(
+                                static_cast<R*>(0), segment_its[i],
+                                r[i].get()));
+                        }
+
+                        return op(positions.begin(), positions.size(), pred);
+                    },
+                    std::move(segments)));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter, typename F>
+        inline typename detail::algorithm_result<ExPolicy, SegIter>::type
+        min_element_(ExPolicy && policy, SegIter first, SegIter last, F && f,
+            std::true_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+            typedef hpx::traits::segmented_iterator_traits<SegIter>
+                iterator_traits;
+            typedef typename std::vector<SegIter>::iterator positions_iterator;
+            typedef typename hpx::util::decay<F>::type pred_type;
+
+            if (first == last)
+            {
+                return detail::algorithm_result<ExPolicy, SegIter>::get(
+                    std::move(first));
+            }
+
+            return segmented_minmax<SegIter>(
+                min_element<typename iterator_traits::local_iterator>(),
+                std::forward<ExPolicy>(policy), first, last,
+                std::forward<F>(f),
+                &sequential_min_element_ind<positions_iterator, pred_type>,
+                is_seq());
+        }
+
+        template <typename ExPolicy, typename SegIter, typename F>
+        inline typename detail::algorithm_result<ExPolicy, SegIter>::type
+        max_element_(ExPolicy && policy, SegIter first, SegIter last, F && f,
+            std::true_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+            typedef hpx::traits::segmented_iterator_traits<SegIter>
+                iterator_traits;
+            typedef typename std::vector<SegIter>::iterator positions_iterator;
+            typedef typename hpx::util::decay<F>::type pred_type;
+
+            if (first == last)
+            {
+                return detail::algorithm_result<ExPolicy, SegIter>::get(
+                    std::move(first));
+            }
+
+            return segmented_minmax<SegIter>(
+                max_element<typename iterator_traits::local_iterator>(),
+                std::forward<ExPolicy>(policy), first, last,
+                std::forward<F>(f),
+                &sequential_max_element_ind<positions_iterator, pred_type>,
+                is_seq());
+        }
+
+        template <typename ExPolicy, typename SegIter, typename F>
+        inline typename detail::algorithm_result<ExPolicy,
+            std::pair<SegIter, SegIter>
+        >::type
+        minmax_element_(ExPolicy && policy, SegIter first, SegIter last, F && f,
+            std::true_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+            typedef hpx::traits::segmented_iterator_traits<SegIter>
+                iterator_traits;
+            typedef std::pair<SegIter, SegIter> result_type;
+            typedef typename std::vector<result_type>::iterator
+                positions_iterator;
+            typedef typename hpx::util::decay<F>::type pred_type;
+
+            if (first == last)
+            {
+                return detail::algorithm_result<ExPolicy, result_type>::get(
+                    result_type(first, first));
+            }
+
+            return segmented_minmax<result_type>(
+                minmax_element<typename iterator_traits::local_iterator>(),
+                std::forward<ExPolicy>(policy), first, last,
+                std::forward<F>(f),
+                &sequential_minmax_element_ind<positions_iterator, pred_type>,
+                is_seq());
+        }
+
+        // forward declare the non-segmented version of these algorithms
+        template <typename ExPolicy, typename FwdIter, typename F>
+        inline typename detail::algorithm_result<ExPolicy, FwdIter>::type
+        min_element_(ExPolicy && policy, FwdIter first, FwdIter last, F && f,
+            std::false_type);
+
+        template <typename ExPolicy, typename FwdIter, typename F>
+        inline typename detail::algorithm_result<ExPolicy, FwdIter>::type
+        max_element_(ExPolicy && policy, FwdIter first, FwdIter last, F && f,
+            std::false_type);
+
+        template <typename ExPolicy, typename FwdIter, typename F>
+        inline typename detail::algorithm_result<ExPolicy,
+            std::pair<FwdIter, FwdIter>
+        >::type
+        minmax_element_(ExPolicy && policy, FwdIter first, FwdIter last, F && f,
+            std::false_type);
+
+        /// \endcond
+    }
+}}}
+
+#endif
@@ -0,0 +1,283 @@
+//  Copyright (c) 2007-2015 Hartmut Kaiser
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHM_REDUCE_AUG_05_2015_0230PM)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHM_REDUCE_AUG_05_2015_0230PM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+#include <hpx/util/decay.hpp>
+
+#include <hpx/parallel/config/inline_namespace.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/algorithm_result.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/reduce.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+
+#include <boost/type_traits/is_same.hpp>
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_reduce
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // Reduces a single (non-empty) segment without an initial value. This
+        // makes sure the initial value given by the user is accounted for
+        // exactly once, regardless of the number of segments involved.
+        template <typename T>
+        struct segment_reduce
+          : public detail::algorithm<segment_reduce<T>, T>
+        {
+            segment_reduce()
+              : segment_reduce::algorithm("segment_reduce")
+            {}
+
+            template <typename ExPolicy, typename InIter, typename Reduce>
+            static T
+            sequential(ExPolicy const&, InIter first, InIter last,
+                Reduce && r)
+            {
+                T val = *first;
+                return std::accumulate(++first, last, std::move(val),
+                    std::forward<Reduce>(r));
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename Reduce>
+            static typename detail::algorithm_result<ExPolicy, T>::type
+            parallel(ExPolicy const& policy, FwdIter first, FwdIter last,
+                Reduce && r)
+            {
+                T val = *first;
+                return reduce<T>::parallel(policy, ++first, last,
+                    std::move(val), std::forward<Reduce>(r));
+            }
+        };
+
+        // sequential remote implementation
+        template <typename Algo, typename ExPolicy, typename SegIter,
+            typename T, typename Reduce>
+        static typename detail::algorithm_result<ExPolicy, T>::type
+        segmented_reduce(Algo && algo, ExPolicy const& policy,
+            SegIter first, SegIter last, T && init, Reduce && red_op,
+            boost::mpl::true_)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::segment_iterator segment_iterator;
+            typedef typename traits::local_iterator local_iterator_type;
+            typedef detail::algorithm_result<ExPolicy, T> result;
+
+            using boost::mpl::true_;
+
+            segment_iterator sit = traits::segment(first);
+            segment_iterator send = traits::segment(last);
+
+            T overall_result = std::forward<T>(init);
+
+            if (sit == send)
+            {
+                // all elements are on the same partition
+                local_iterator_type beg = traits::local(first);
+                local_iterator_type end = traits::local(last);
+                if (beg != end)
+                {
+                    overall_result = red_op(
+                        overall_result,
+                        dispatch(traits::get_id(sit),
+                            std::forward<Algo>(algo), policy, true_(),
+                            beg, end, red_op)
+                    );
+                }
+            }
+            else {
+                // handle the remaining part of the first partition
+                local_iterator_type beg = traits::local(first);
+                local_iterator_type end = traits::end(sit);
+                if (beg != end)
+                {
+                    overall_result = red_op(
+                        overall_result,
+                        dispatch(traits::get_id(sit),
+                            std::forward<Algo>(algo), policy, true_(),
+                            beg, end, red_op)
+                    );
+                }
+
+                // handle all of the full partitions
+                for (++sit; sit != send; ++sit)
+                {
+                    beg = traits::begin(sit);
+                    end = traits::end(sit);
+                    if (beg != end)
+                    {
+                        overall_result = red_op(
+                            overall_result,
+                            dispatch(traits::get_id(sit),
+                                std::forward<Algo>(algo), policy, true_(),
+                                beg, end, red_op)
+                        );
+                    }
+                }
+
+                // handle the beginning of the last partition
+                beg = traits::begin(sit);
+                end = traits::local(last);
+                if (beg != end)
+                {
+                    overall_result = red_op(
+                        overall_result,
+                        dispatch(traits::get_id(sit),
+                            std::forward<Algo>(algo), policy, true_(),
+                            beg, end, red_op)
+                    );
+                }
+            }
+
+            return result::get(std::move(overall_result));
+        }
+
+        // parallel remote implementation
+        template <typename Algo, typename ExPolicy, typename SegIter,
+            typename T, typename Reduce>
+        static typename detail::algorithm_result<ExPolicy, T>::type
+        segmented_reduce(Algo && algo, ExPolicy const& policy,
+            SegIter first, SegIter last, T && init, Reduce && red_op,
+            boost::mpl::false_)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::segment_iterator segment_iterator;
+            typedef typename traits::local_iterator local_iterator_type;
+            typedef detail::algorithm_result<ExPolicy, T> result;
+
+            typedef typename std::iterator_traits<SegIter>::iterator_category
+                iterator_category;
+            typedef typename boost::mpl::bool_<boost::is_same<
+                    iterator_category, std::input_iterator_tag
+                >::value> forced_seq;
+
+            segment_iterator sit = traits::segment(first);
+            segment_iterator send = traits::segment(last);
+
+            std::vector<shared_future<T> > segments;
+            segments.reserve(std::distance(sit, send));
+
+            if (sit == send)
+            {
+                // all elements are on the same partition
+                local_iterator_type beg = traits::local(first);
+                local_iterator_type end = traits::local(last);
+                if (beg != end)
+                {
+                    segments.push_back(dispatch_async(traits::get_id(sit),
+                        std::forward<Algo>(algo), policy, forced_seq(),
+                        beg, end, red_op));
+                }
+            }
+            else {
+                // handle the remaining part of the first partition
+                local_iterator_type beg = traits::local(first);
+                local_iterator_type end = traits::end(sit);
+                if (beg != end)
+                {
+                    segments.push_back(dispatch_async(traits::get_id(sit),
+                        std::forward<Algo>(algo), policy, forced_seq(),
+                        beg, end, red_op));
+                }
+
+                // handle all of the full partitions
+                for (++sit; sit != send; ++sit)
+                {
+                    beg = traits::begin(sit);
+                    end = traits::end(sit);
+                    if (beg != end)
+                    {
+                        segments.push_back(dispatch_async(traits::get_id(sit),
+                            std::forward<Algo>(algo), policy, forced_seq(),
+                            beg, end, red_op));
+                    }
+                }
+
+                // handle the beginning of the last partition
+                beg = traits::begin(sit);
+                end = traits::local(last);
+                if (beg != end)
+                {
+                    segments.push_back(dispatch_async(traits::get_id(sit),
+                        std::forward<Algo>(algo), policy, forced_seq(),
+                        beg, end, red_op));
+                }
+            }
+
+            typename hpx::util::decay<Reduce>::type op =
+                std::forward<Reduce>(red_op);
+            typename hpx::util::decay<T>::type init_val =
+                std::forward<T>(init);
+
+            return result::get(
+                lcos::local::dataflow(
+                    [=](std::vector<shared_future<T> > && r) -> T
+                    {
+                        // handle any remote exceptions, will throw on error
+                        std::list<boost::exception_ptr> errors;
+                        parallel::util::detail::handle_remote_exceptions<
+                            ExPolicy
+                        >::call(r, errors);
+
+                        // combine the partial results in order, the
+                        // operation is not required to be commutative
+                        return std::accumulate(
+                            r.begin(), r.end(), init_val,
+                            [&op](T const& val, shared_future<T>& curr)
+                            {
+                                return op(val, curr.get());
+                            });
+                    },
+                    std::move(segments)));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter, typename T, typename F>
+        inline typename detail::algorithm_result<ExPolicy, T>::type
+        reduce_(ExPolicy && policy, SegIter first, SegIter last, T init,
+            F && f, std::true_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+
+            if (first == last)
+            {
+                return detail::algorithm_result<ExPolicy, T>::get(
+                    std::move(init));
+            }
+
+            return segmented_reduce(
+                segment_reduce<T>(), std::forward<ExPolicy>(policy),
+                first, last, std::move(init), std::forward<F>(f), is_seq());
+        }
+
+        // forward declare the non-segmented version of this algorithm
+        template <typename ExPolicy, typename InIter, typename T, typename F>
+        inline typename detail::algorithm_result<ExPolicy, T>::type
+        reduce_(ExPolicy && policy, InIter first, InIter last, T init,
+            F && f, std::false_type);
+
+        /// \endcond
+    }
+}}}
+
+#endif
@@ -0,0 +1,350 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHM_SCAN_AUG_06_2015_1015AM)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHM_SCAN_AUG_06_2015_1015AM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/lcos/local/dataflow.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+#include <hpx/util/decay.hpp>
+
+#include <hpx/parallel/config/inline_namespace.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/algorithm_result.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/inclusive_scan.hpp>
+#include <hpx/parallel/algorithms/exclusive_scan.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/segmented_algorithms/reduce.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <vector>
+
+#include <boost/type_traits/is_same.hpp>
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_scan
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // The segmented scans assume that the destination sequence is
+        // partitioned in the same way as the source sequence. They run in
+        // three steps:
+        //
+        //  1. every segment computes the reduction of its elements (remotely),
+        //  2. the prefix (initial value) of every segment is computed locally
+        //     from the segment reductions, and
+        //  3. every segment performs its local scan starting with its prefix
+        //     (remotely).
+
+        template <typename SegIter, typename SegOutIter>
+        struct scan_segment
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef hpx::traits::segmented_iterator_traits<SegOutIter>
+                output_traits;
+
+            typename traits::segment_iterator sit;
+            typename traits::local_iterator beg;
+            typename traits::local_iterator end;
+            typename output_traits::segment_iterator sdest;
+            typename output_traits::local_iterator out;
+        };
+
+        // collect all non-empty segment ranges of [first, last) together
+        // with the corresponding destination ranges
+        template <typename SegIter, typename SegOutIter>
+        std::vector<scan_segment<SegIter, SegOutIter> >
+        get_scan_segments(SegIter first, SegIter last, SegOutIter dest)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::segment_iterator segment_iterator;
+            typedef hpx::traits::segmented_iterator_traits<SegOutIter>
+                output_traits;
+            typedef typename output_traits::segment_iterator
+                segment_output_iterator;
+
+            segment_iterator sit = traits::segment(first);
+            segment_iterator send = traits::segment(last);
+            segment_output_iterator sdest = output_traits::segment(dest);
+
+            std::vector<scan_segment<SegIter, SegOutIter> > segments;
+            segments.reserve(std::distance(sit, send) + 1);
+
+            scan_segment<SegIter, SegOutIter> s;
+            if (sit == send)
+            {
+                // all elements are on the same partition
+                s.sit = sit;
+                s.beg = traits::local(first);
+                s.end = traits::local(last);
+                s.sdest = sdest;
+                s.out = output_traits::local(dest);
+                if (s.beg != s.end)
+                    segments.push_back(s);
+            }
+            else {
+                // handle the remaining part of the first partition
+                s.sit = sit;
+                s.beg = traits::local(first);
+                s.end = traits::end(sit);
+                s.sdest = sdest;
+                s.out = output_traits::local(dest);
+                if (s.beg != s.end)
+                    segments.push_back(s);
+
+                // handle all of the full partitions
+                for ((void) ++sit, ++sdest; sit != send; (void) ++sit, ++sdest)
+                {
+                    s.sit = sit;
+                    s.beg = traits::begin(sit);
+                    s.end = traits::end(sit);
+                    s.sdest = sdest;
+                    s.out = output_traits::begin(sdest);
+                    if (s.beg != s.end)
+                        segments.push_back(s);
+                }
+
+                // handle the beginning of the last partition
+                s.sit = sit;
+                s.beg = traits::begin(sit);
+                s.end = traits::local(last);
+                s.sdest = sdest;
+                s.out = output_traits::begin(sdest);
+                if (s.beg != s.end)
+                    segments.push_back(s);
+            }
+
+            return segments;
+        }
+
+        // sequential remote implementation
+        template <typename Algo, typename ExPolicy, typename SegIter,
+            typename SegOutIter, typename T, typename Op>
+        static typename detail::algorithm_result<ExPolicy, SegOutIter>::type
+        segmented_scan(Algo && algo, ExPolicy const& policy,
+            SegIter first, SegIter last, SegOutIter dest, T init, Op && op,
+            boost::mpl::true_)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef hpx::traits::segmented_iterator_traits<SegOutIter>
+                output_traits;
+            typedef typename output_traits::local_iterator
+                local_output_iterator_type;
+            typedef scan_segment<SegIter, SegOutIter> segment_type;
+
+            using boost::mpl::true_;
+
+            std::vector<segment_type> segments =
+                get_scan_segments(first, last, dest);
+            HPX_ASSERT(!segments.empty());
+
+            T prefix = init;
+            local_output_iterator_type out = segments.front().out;
+            for (std::size_t i = 0; i != segments.size(); ++i)
+            {
+                segment_type const& s = segments[i];
+
+                // reduce the segment before scanning it, as the scan might
+                // be performed in place (the reduction of the last segment
+                // is not needed)
+                T next_prefix = prefix;
+                if (i != segments.size() - 1)
+                {
+                    next_prefix = op(prefix,
+                        dispatch(traits::get_id(s.sit),
+                            segment_reduce<T>(), policy, true_(),
+                            s.beg, s.end, op));
+                }
+
+                out = dispatch(traits::get_id(s.sit),
+                    std::forward<Algo>(algo), policy, true_(),
+                    s.beg, s.end, s.out, prefix, op);
+
+                prefix = std::move(next_prefix);
+            }
+
+            return detail::algorithm_result<ExPolicy, SegOutIter>::get(
+                output_traits::compose(segments.back().sdest, out));
+        }
+
+        // parallel remote implementation
+        template <typename Algo, typename ExPolicy, typename SegIter,
+            typename SegOutIter, typename T, typename Op>
+        static typename detail::algorithm_result<ExPolicy, SegOutIter>::type
+        segmented_scan(Algo && algo, ExPolicy const& policy,
+            SegIter first, SegIter last, SegOutIter dest, T init, Op && op,
+            boost::mpl::false_)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef hpx::traits::segmented_iterator_traits<SegOutIter>
+                output_traits;
+            typedef typename output_traits::local_iterator
+                local_output_iterator_type;
+            typedef scan_segment<SegIter, SegOutIter> segment_type;
+
+            typedef typename std::iterator_traits<SegIter>::iterator_category
+                iterator_category;
+            typedef typename boost::mpl::bool_<boost::is_same<
+                    iterator_category, std::input_iterator_tag
+                >::value> forced_seq;
+
+            std::vector<segment_type> segments =
+                get_scan_segments(first, last, dest);
+            HPX_ASSERT(!segments.empty());
+
+            // step 1: reduce all segments (except the last one) concurrently
+            std::vector<shared_future<T> > sums;
+            sums.reserve(segments.size() - 1);
+            for (std::size_t i = 0; i != segments.size() - 1; ++i)
+            {
+                segment_type const& s = segments[i];
+                sums.push_back(dispatch_async(traits::get_id(s.sit),
+                    segment_reduce<T>(), policy, forced_seq(),
+                    s.beg, s.end, op));
+            }
+
+            typedef typename hpx::util::decay<Algo>::type algo_type;
+            typedef typename hpx::util::decay<Op>::type op_type;
+
+            algo_type scan_algo = std::forward<Algo>(algo);
+            op_type scan_op = std::forward<Op>(op);
+
+            // the scans are launched once all reductions are available, the
+            // final result depends on all of them (this unwraps the future
+            // returned by the continuation)
+            future<SegOutIter> result = lcos::local::dataflow(
+                [=](std::vector<shared_future<T> > && r)
+                -> future<SegOutIter>
+                {
+                    // handle any remote exceptions, will throw on error
+                    std::list<boost::exception_ptr> errors;
+                    parallel::util::detail::handle_remote_exceptions<
+                        ExPolicy
+                    >::call(r, errors);
+
+                    // step 2: calculate the prefix of each segment and
+                    // step 3: scan all segments concurrently
+                    std::vector<shared_future<local_output_iterator_type> >
+                        scans;
+                    scans.reserve(segments.size());
+
+                    T prefix = init;
+                    for (std::size_t i = 0; i != segments.size(); ++i)
+                    {
+                        segment_type const& s = segments[i];
+                        scans.push_back(dispatch_async(
+                            traits::get_id(s.sit), scan_algo, policy,
+                            forced_seq(), s.beg, s.end, s.out, prefix,
+                            scan_op));
+
+                        if (i != r.size())
+                            prefix = scan_op(prefix, r[i].get());
+                    }
+
+                    return lcos::local::dataflow(
+                        [=](std::vector<
+                                shared_future<local_output_iterator_type>
+                            > && scans) -> SegOutIter
+                        {
+                            // handle any remote exceptions, will throw on
+                            // error
+                            std::list<boost::exception_ptr> errors;
+                            parallel::util::detail::handle_remote_exceptions<
+                                ExPolicy
+                            >::call(scans, errors);
+
+                            return output_traits::compose(
+                                segments.back().sdest, scans.back().get());
+                        },
+                        std::move(scans));
+                },
+                std::move(sums));
+
+            return detail::algorithm_result<ExPolicy, SegOutIter>::get(
+                std::move(result));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter, typename SegOutIter,
+            typename T, typename Op>
+        inline typename detail::algorithm_result<ExPolicy, SegOutIter>::type
+        inclusive_scan_(ExPolicy && policy, SegIter first, SegIter last,
+            SegOutIter dest, T init, Op && op, std::true_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+            typedef hpx::traits::segmented_iterator_traits<SegOutIter>
+                output_iterator_traits;
+
+            if (first == last)
+            {
+                return detail::algorithm_result<ExPolicy, SegOutIter>::get(
+                    std::move(dest));
+            }
+
+            return segmented_scan(
+                inclusive_scan<
+                    typename output_iterator_traits::local_iterator
+                >(),
+                std::forward<ExPolicy>(policy), first, last, dest,
+                std::move(init), std::forward<Op>(op), is_seq());
+        }
+
+        template <typename ExPolicy, typename SegIter, typename SegOutIter,
+            typename T, typename Op>
+        inline typename detail::algorithm_result<ExPolicy, SegOutIter>::type
+        exclusive_scan_(ExPolicy && policy, SegIter first, SegIter last,
+            SegOutIter dest, T init, Op && op, std::true_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+            typedef hpx::traits::segmented_iterator_traits<SegOutIter>
+                output_iterator_traits;
+
+            if (first == last)
+            {
+                return detail::algorithm_result<ExPolicy, SegOutIter>::get(
+                    std::move(dest));
+            }
+
+            return segmented_scan(
+                exclusive_scan<
+                    typename output_iterator_traits::local_iterator
+                >(),
+                std::forward<ExPolicy>(policy), first, last, dest,
+                std::move(init), std::forward<Op>(op), is_seq());
+        }
+
+        // forward declare the non-segmented version of these algorithms
+        template <typename ExPolicy, typename InIter, typename OutIter,
+            typename T, typename Op>
+        inline typename detail::algorithm_result<ExPolicy, OutIter>::type
+        inclusive_scan_(ExPolicy && policy, InIter first, InIter last,
+            OutIter dest, T init, Op && op, std::false_type);
+
+        template <typename ExPolicy, typename InIter, typename OutIter,
+            typename T, typename Op>
+        inline typename detail::algorithm_result<ExPolicy, OutIter>::type
+        exclusive_scan_(ExPolicy && policy, InIter first, InIter last,
+            OutIter dest, T init, Op && op, std::false_type);
+
+        /// \endcond
+    }
+}}}
+
+#endif
@@ -0,0 +1,513 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHM_TRANSFORM_AUG_05_2015_1205PM)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHM_TRANSFORM_AUG_05_2015_1205PM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+
+#include <hpx/parallel/config/inline_namespace.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/algorithm_result.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/transform.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+
+#include <boost/type_traits/is_same.hpp>
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_transform
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // The segmented transform algorithms assume that the destination
+        // (and the second source) sequence is partitioned in the same way as
+        // the (first) source sequence, just as segmented copy does.
+
+        // sequential remote implementation
+        template <typename Algo, typename ExPolicy, typename SegIter,
+            typename SegOutIter, typename F>
+        static typename detail::algorithm_result<ExPolicy, SegOutIter>::type
+        segmented_transform(Algo && algo, ExPolicy const& policy,
+            SegIter first, SegIter last, SegOutIter dest, F && f,
+            boost::mpl::true_)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::segment_iterator segment_iterator;
+            typedef typename traits::local_iterator local_iterator_type;
+
+            typedef hpx::traits::segmented_iterator_traits<SegOutIter>
+                output_traits;
+            typedef typename output_traits::segment_iterator
+                segment_output_iterator;
+            typedef typename output_traits::local_iterator
+                local_output_iterator_type;
+
+            using boost::mpl::true_;
+
+            segment_iterator sit = traits::segment(first);
+            segment_iterator send = traits::segment(last);
+
+            segment_output_iterator sdest = output_traits::segment(dest);
+
+            if (sit == send)
+            {
+                // all elements are on the same partition
+                local_iterator_type beg = traits::local(first);
+                local_iterator_type end = traits::local(last);
+                if (beg != end)
+                {
+                    local_output_iterator_type out = dispatch(
+                        traits::get_id(sit),
+                        std::forward<Algo>(algo), policy, true_(),
+                        beg, end, output_traits::local(dest),
+                        std::forward<F>(f));
+
+                    dest = output_traits::compose(sdest, out);
+                }
+            }
+            else {
+                // handle the remaining part of the first partition
+                local_iterator_type beg = traits::local(first);
+                local_iterator_type end = traits::end(sit);
+                local_output_iterator_type out = output_traits::local(dest);
+
+                if (beg != end)
+                {
+                    out = dispatch(traits::get_id(sit),
+                        std::forward<Algo>(algo), policy, true_(),
+                        beg, end, out, std::forward<F>(f));
+                }
+
+                // handle all of the full partitions
+                for ((void) ++sit, ++sdest; sit != send; (void) ++sit, ++sdest)
+                {
+                    beg = traits::begin(sit);
+                    end = traits::end(sit);
+                    out = output_traits::begin(sdest);
+
+                    if (beg != end)
+                    {
+                        out = dispatch(traits::get_id(sit),
+                            std::forward<Algo>(algo), policy, true_(),
+                            beg, end, out, std::forward<F>(f));
+                    }
+                }
+
+                // handle the beginning of the last partition
+                beg = traits::begin(sit);
+                end = traits::local(last);
+                out = output_traits::begin(sdest);
+
+                if (beg != end)
+                {
+                    out = dispatch(traits::get_id(sit),
+                        std::forward<Algo>(algo), policy, true_(),
+                        beg, end, out, std::forward<F>(f));
+                }
+
+                dest = output_traits::compose(sdest, out);
+            }
+
+            return detail::algorithm_result<ExPolicy, SegOutIter>::get(
+                std::move(dest));
+        }
+
+        // parallel remote implementation
+        template <typename Algo, typename ExPolicy, typename SegIter,
+            typename SegOutIter, typename F>
+        static typename detail::algorithm_result<ExPolicy, SegOutIter>::type
+        segmented_transform(Algo && algo, ExPolicy const& policy,
+            SegIter first, SegIter last, SegOutIter dest, F && f,
+            boost::mpl::false_)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::segment_iterator segment_iterator;
+            typedef typename traits::local_iterator local_iterator_type;
+
+            typedef hpx::traits::segmented_iterator_traits<SegOutIter>
+                output_traits;
+            typedef typename output_traits::segment_iterator
+                segment_output_iterator;
+            typedef typename output_traits::local_iterator
+                local_output_iterator_type;
+
+            typedef typename std::iterator_traits<SegIter>::iterator_category
+                iterator_category;
+            typedef typename boost::mpl::bool_<boost::is_same<
+                    iterator_category, std::input_iterator_tag
+                >::value> forced_seq;
+
+            segment_iterator sit = traits::segment(first);
+            segment_iterator send = traits::segment(last);
+
+            segment_output_iterator sdest = output_traits::segment(dest);
+
+            std::vector<shared_future<local_output_iterator_type> > segments;
+            segments.reserve(std::distance(sit, send));
+
+            if (sit == send)
+            {
+                // all elements are on the same partition
+                local_iterator_type beg = traits::local(first);
+                local_iterator_type end = traits::local(last);
+                if (beg != end)
+                {
+                    segments.push_back(dispatch_async(traits::get_id(sit),
+                        std::forward<Algo>(algo), policy, forced_seq(),
+                        beg, end, output_traits::local(dest),
+                        std::forward<F>(f)));
+                }
+            }
+            else {
+                // handle the remaining part of the first partition
+                local_iterator_type beg = traits::local(first);
+                local_iterator_type end = traits::end(sit);
+                local_output_iterator_type out = output_traits::local(dest);
+
+                if (beg != end)
+                {
+                    segments.push_back(dispatch_async(traits::get_id(sit),
+                        std::forward<Algo>(algo), policy, forced_seq(),
+                        beg, end, out, std::forward<F>(f)));
+                }
+
+                // handle all of the full partitions
+                for ((void) ++sit, ++sdest; sit != send; (void) ++sit, ++sdest)
+                {
+                    beg = traits::begin(sit);
+                    end = traits::end(sit);
+                    out = output_traits::begin(sdest);
+
+                    if (beg != end)
+                    {
+                        segments.push_back(dispatch_async(traits::get_id(sit),
+                            std::forward<Algo>(algo), policy, forced_seq(),
+                            beg, end, out, std::forward<F>(f)));
+                    }
+                }
+
+                // handle the beginning of the last partition
+                beg = traits::begin(sit);
+                end = traits::local(last);
+                out = output_traits::begin(sdest);
+
+                if (beg != end)
+                {
+                    segments.push_back(dispatch_async(traits::get_id(sit),
+                        std::forward<Algo>(algo), policy, forced_seq(),
+                        beg, end, out, std::forward<F>(f)));
+                }
+            }
+            HPX_ASSERT(!segments.empty());
+
+            return detail::algorithm_result<ExPolicy, SegOutIter>::get(
+                lcos::local::dataflow(
+                    [=](std::vector<shared_future<local_output_iterator_type> > && r)
+                        -> SegOutIter
+                    {
+                        // handle any remote exceptions, will throw on error
+                        std::list<boost::exception_ptr> errors;
+                        parallel::util::detail::handle_remote_exceptions<
+                            ExPolicy
+                        >::call(r, errors);
+
+                        return output_traits::compose(sdest, r.back().get());
+                    },
+                    std::move(segments)));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // sequential remote implementation
+        template <typename Algo, typename ExPolicy, typename SegIter1,
+            typename SegIter2, typename SegOutIter, typename F>
+        static typename detail::algorithm_result<ExPolicy, SegOutIter>::type
+        segmented_transform_binary(Algo && algo, ExPolicy const& policy,
+            SegIter1 first1, SegIter1 last1, SegIter2 first2, SegOutIter dest,
+            F && f, boost::mpl::true_)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter1> traits1;
+            typedef typename traits1::segment_iterator segment_iterator1;
+            typedef typename traits1::local_iterator local_iterator_type1;
+
+            typedef hpx::traits::segmented_iterator_traits<SegIter2> traits2;
+            typedef typename traits2::segment_iterator segment_iterator2;
+            typedef typename traits2::local_iterator local_iterator_type2;
+
+            typedef hpx::traits::segmented_iterator_traits<SegOutIter>
+                output_traits;
+            typedef typename output_traits::segment_iterator
+                segment_output_iterator;
+            typedef typename output_traits::local_iterator
+                local_output_iterator_type;
+
+            using boost::mpl::true_;
+
+            segment_iterator1 sit1 = traits1::segment(first1);
+            segment_iterator1 send1 = traits1::segment(last1);
+            segment_iterator2 sit2 = traits2::segment(first2);
+
+            segment_output_iterator sdest = output_traits::segment(dest);
+
+            if (sit1 == send1)
+            {
+                // all elements are on the same partition
+                local_iterator_type1 beg1 = traits1::local(first1);
+                local_iterator_type1 end1 = traits1::local(last1);
+                if (beg1 != end1)
+                {
+                    local_output_iterator_type out = dispatch(
+                        traits1::get_id(sit1),
+                        std::forward<Algo>(algo), policy, true_(),
+                        beg1, end1, traits2::local(first2),
+                        output_traits::local(dest), std::forward<F>(f));
+
+                    dest = output_traits::compose(sdest, out);
+                }
+            }
+            else {
+                // handle the remaining part of the first partition
+                local_iterator_type1 beg1 = traits1::local(first1);
+                local_iterator_type1 end1 = traits1::end(sit1);
+                local_iterator_type2 beg2 = traits2::local(first2);
+                local_output_iterator_type out = output_traits::local(dest);
+
+                if (beg1 != end1)
+                {
+                    out = dispatch(traits1::get_id(sit1),
+                        std::forward<Algo>(algo), policy, true_(),
+                        beg1, end1, beg2, out, std::forward<F>(f));
+                }
+
+                // handle all of the full partitions
+                for ((void) ++sit1, ++sit2, ++sdest; sit1 != send1;
+                     (void) ++sit1, ++sit2, ++sdest)
+                {
+                    beg1 = traits1::begin(sit1);
+                    end1 = traits1::end(sit1);
+                    beg2 = traits2::begin(sit2);
+                    out = output_traits::begin(sdest);
+
+                    if (beg1 != end1)
+                    {
+                        out = dispatch(traits1::get_id(sit1),
+                            std::forward<Algo>(algo), policy, true_(),
+                            beg1, end1, beg2, out, std::forward<F>(f));
+                    }
+                }
+
+                // handle the beginning of the last partition
+                beg1 = traits1::begin(sit1);
+                end1 = traits1::local(last1);
+                beg2 = traits2::begin(sit2);
+                out = output_traits::begin(sdest);
+
+                if (beg1 != end1)
+                {
+                    out = dispatch(traits1::get_id(sit1),
+                        std::forward<Algo>(algo), policy, true_(),
+                        beg1, end1, beg2, out, std::forward<F>(f));
+                }
+
+                dest = output_traits::compose(sdest, out);
+            }
+
+            return detail::algorithm_result<ExPolicy, SegOutIter>::get(
+                std::move(dest));
+        }
+
+        // parallel remote implementation
+        template <typename Algo, typename ExPolicy, typename SegIter1,
+            typename SegIter2, typename SegOutIter, typename F>
+        static typename detail::algorithm_result<ExPolicy, SegOutIter>::type
+        segmented_transform_binary(Algo && algo, ExPolicy const& policy,
+            SegIter1 first1, SegIter1 last1, SegIter2 first2, SegOutIter dest,
+            F && f, boost::mpl::false_)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter1> traits1;
+            typedef typename traits1::segment_iterator segment_iterator1;
+            typedef typename traits1::local_iterator local_iterator_type1;
+
+            typedef hpx::traits::segmented_iterator_traits<SegIter2> traits2;
+            typedef typename traits2::segment_iterator segment_iterator2;
+            typedef typename traits2::local_iterator local_iterator_type2;
+
+            typedef hpx::traits::segmented_iterator_traits<SegOutIter>
+                output_traits;
+            typedef typename output_traits::segment_iterator
+                segment_output_iterator;
+            typedef typename output_traits::local_iterator
+                local_output_iterator_type;
+
+            typedef typename std::iterator_traits<SegIter1>::iterator_category
+                iterator_category;
+            typedef typename boost::mpl::bool_<boost::is_same<
+                    iterator_category, std::input_iterator_tag
+                >::value> forced_seq;
+
+            segment_iterator1 sit1 = traits1::segment(first1);
+            segment_iterator1 send1 = traits1::segment(last1);
+            segment_iterator2 sit2 = traits2::segment(first2);
+
+            segment_output_iterator sdest = output_traits::segment(dest);
+
+            std::vector<shared_future<local_output_iterator_type> > segments;
+            segments.reserve(std::distance(sit1, send1));
+
+            if (sit1 == send1)
+            {
+                // all elements are on the same partition
+                local_iterator_type1 beg1 = traits1::local(first1);
+                local_iterator_type1 end1 = traits1::local(last1);
+                if (beg1 != end1)
+                {
+                    segments.push_back(dispatch_async(traits1::get_id(sit1),
+                        std::forward<Algo>(algo), policy, forced_seq(),
+                        beg1, end1, traits2::local(first2),
+                        output_traits::local(dest), std::forward<F>(f)));
+                }
+            }
+            else {
+                // handle the remaining part of the first partition
+                local_iterator_type1 beg1 = traits1::local(first1);
+                local_iterator_type1 end1 = traits1::end(sit1);
+                local_iterator_type2 beg2 = traits2::local(first2);
+                local_output_iterator_type out = output_traits::local(dest);
+
+                if (beg1 != end1)
+                {
+                    segments.push_back(dispatch_async(traits1::get_id(sit1),
+                        std::forward<Algo>(algo), policy, forced_seq(),
+                        beg1, end1, beg2, out, std::forward<F>(f)));
+                }
+
+                // handle all of the full partitions
+                for ((void) ++sit1, ++sit2, ++sdest; sit1 != send1;
+                     (void) ++sit1, ++sit2, ++sdest)
+                {
+                    beg1 = traits1::begin(sit1);
+                    end1 = traits1::end(sit1);
+                    beg2 = traits2::begin(sit2);
+                    out = output_traits::begin(sdest);
+
+                    if (beg1 != end1)
+                    {
+                        segments.push_back(dispatch_async(traits1::get_id(sit1),
+                            std::forward<Algo>(algo), policy, forced_seq(),
+                            beg1, end1, beg2, out, std::forward<F>(f)));
+                    }
+                }
+
+                // handle the beginning of the last partition
+                beg1 = traits1::begin(sit1);
+                end1 = traits1::local(last1);
+                beg2 = traits2::begin(sit2);
+                out = output_traits::begin(sdest);
+
+                if (beg1 != end1)
+                {
+                    segments.push_back(dispatch_async(traits1::get_id(sit1),
+                        std::forward<Algo>(algo), policy, forced_seq(),
+                        beg1, end1, beg2, out, std::forward<F>(f)));
+                }
+            }
+            HPX_ASSERT(!segments.empty());
+
+            return detail::algorithm_result<ExPolicy, SegOutIter>::get(
+                lcos::local::dataflow(
+                    [=](std::vector<shared_future<local_output_iterator_type> > && r)
+                        -> SegOutIter
+                    {
+                        // handle any remote exceptions, will throw on error
+                        std::list<boost::exception_ptr> errors;
+                        parallel::util::detail::handle_remote_exceptions<
+                            ExPolicy
+                        >::call(r, errors);
+
+                        return output_traits::compose(sdest, r.back().get());
+                    },
+                    std::move(segments)));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter, typename SegOutIter,
+            typename F>
+        typename detail::algorithm_result<ExPolicy, SegOutIter>::type
+        transform_(ExPolicy && policy, SegIter first, SegIter last,
+            SegOutIter dest, F && f, std::true_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+            typedef hpx::traits::segmented_iterator_traits<SegOutIter>
+                output_iterator_traits;
+
+            if (first == last)
+            {
+                return detail::algorithm_result<ExPolicy, SegOutIter>::get(
+                    std::move(dest));
+            }
+
+            return segmented_transform(
+                transform<typename output_iterator_traits::local_iterator>(),
+                std::forward<ExPolicy>(policy), first, last, dest,
+                std::forward<F>(f), is_seq());
+        }
+
+        template <typename ExPolicy, typename SegIter1, typename SegIter2,
+            typename SegOutIter, typename F>
+        typename detail::algorithm_result<ExPolicy, SegOutIter>::type
+        transform_binary_(ExPolicy && policy, SegIter1 first1, SegIter1 last1,
+            SegIter2 first2, SegOutIter dest, F && f, std::true_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+            typedef hpx::traits::segmented_iterator_traits<SegOutIter>
+                output_iterator_traits;
+
+            if (first1 == last1)
+            {
+                return detail::algorithm_result<ExPolicy, SegOutIter>::get(
+                    std::move(dest));
+            }
+
+            return segmented_transform_binary(
+                transform_binary<
+                    typename output_iterator_traits::local_iterator
+                >(),
+                std::forward<ExPolicy>(policy), first1, last1, first2, dest,
+                std::forward<F>(f), is_seq());
+        }
+
+        // forward declare the non-segmented version of this algorithm
+        template <typename ExPolicy, typename InIter, typename OutIter,
+            typename F>
+        typename detail::algorithm_result<ExPolicy, OutIter>::type
+        transform_(ExPolicy && policy, InIter first, InIter last, OutIter dest,
+            F && f, std::false_type);
+
+        template <typename ExPolicy, typename InIter1, typename InIter2,
+            typename OutIter, typename F>
+        typename detail::algorithm_result<ExPolicy, OutIter>::type
+        transform_binary_(ExPolicy && policy, InIter1 first1, InIter1 last1,
+            InIter2 first2, OutIter dest, F && f, std::false_type);
+
+        /// \endcond
+    }
+}}}
+
+#endif
@@ -9,6 +9,8 @@
 #include <hpx/hpx_fwd.hpp>
 #include <hpx/lcos/future.hpp>
 
+#include <algorithm>
+#include <iterator>
 #include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -161,6 +163,35 @@ namespace hpx { namespace parallel { namespace util { namespace detail
         }
         return chunk_size;
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The single-pass scan touches each partition twice (once to reduce it
+    // and once to produce the final values). Limit the partition size such
+    // that it is still cache resident when it is visited the second time.
+    template <typename ExPolicy, typename FwdIter>
+    std::size_t get_single_pass_chunk_size(ExPolicy const& policy,
+        FwdIter, std::size_t count, std::size_t chunk_size)
+    {
+        typedef typename std::iterator_traits<FwdIter>::value_type
+            value_type;
+
+        if (chunk_size == 0)
+        {
+            chunk_size = policy.get_chunk_size();
+            if (chunk_size == 0)
+            {
+                std::size_t const max_chunk_size =
+                    (std::max)(std::size_t(1),
+                        std::size_t(256 * 1024 / sizeof(value_type)));
+                std::size_t const cores =
+                    hpx::get_os_thread_count(policy.get_executor());
+
+                chunk_size = (std::min)(
+                    (count + cores - 1) / cores, max_chunk_size);
+            }
+        }
+        return chunk_size;
+    }
 }}}}
 
 #endif
@@ -0,0 +1,280 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/numa_allocator.hpp
+
+#if !defined(HPX_PARALLEL_UTIL_NUMA_ALLOCATOR_AUG_03_2015_0401PM)
+#define HPX_PARALLEL_UTIL_NUMA_ALLOCATOR_AUG_03_2015_0401PM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/exception.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/wait_all.hpp>
+#include <hpx/lcos/local/promise.hpp>
+#include <hpx/runtime/threads/thread_helpers.hpp>
+#include <hpx/runtime/threads/topology.hpp>
+#include <hpx/runtime/threads/executors/numa_executor.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include <boost/exception_ptr.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/optional.hpp>
+#include <boost/shared_ptr.hpp>
+
+namespace hpx { namespace parallel { namespace util
+{
+    namespace detail
+    {
+        // Write one byte into each page of [begin, end), this makes the OS
+        // place the pages on the NUMA domain of the calling worker thread.
+        inline void first_touch(char* begin, char* end, std::size_t page_size)
+        {
+            for (char* p = begin; p < end; p += page_size)
+                *p = 0;
+        }
+
+        // Touching every 4KiB is sufficient for any page size used in
+        // practice.
+        inline std::size_t get_page_size()
+        {
+            return 4096;
+        }
+
+        // Touch [begin, end) from the given worker thread. The worker thread
+        // passed to register_thread_nullary is only a hint, an idle worker
+        // thread may steal the task before it runs. In this case the task is
+        // rescheduled on the intended worker thread instead of touching the
+        // pages from a different NUMA domain. It gives up and touches the
+        // pages wherever it runs once the retries are exhausted.
+        struct first_touch_task
+        {
+            static std::size_t const max_retries = 16;
+
+            first_touch_task(std::size_t worker, char* begin, char* end,
+                    std::size_t page_size,
+                    boost::shared_ptr<lcos::local::promise<void> > const& done)
+              : worker_(worker), begin_(begin), end_(end),
+                page_size_(page_size), retries_(max_retries), done_(done)
+            {}
+
+            void operator()()
+            {
+                if (retries_ != 0 && hpx::get_worker_thread_num() != worker_)
+                {
+                    --retries_;
+                    schedule();
+                    return;
+                }
+
+                try {
+                    first_touch(begin_, end_, page_size_);
+                    done_->set_value();
+                }
+                catch (...) {
+                    done_->set_exception(boost::current_exception());
+                }
+            }
+
+            void schedule() const
+            {
+                threads::register_thread_nullary(*this,
+                    "numa_allocator::first_touch", threads::pending, true,
+                    threads::thread_priority_normal, worker_);
+            }
+
+            std::size_t worker_;
+            char* begin_;
+            char* end_;
+            std::size_t page_size_;
+            std::size_t retries_;
+            boost::shared_ptr<lcos::local::promise<void> > done_;
+        };
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The numa_allocator is a standard conforming allocator which places
+    /// the memory it hands out on the NUMA domains of the worker threads
+    /// which will later process it. The memory is allocated untouched and
+    /// subsequently split into chunks of \a chunk_size elements, where the
+    /// i-th chunk is first written to by the worker thread the i-th task
+    /// scheduled through the given \a numa_executor will run on.
+    ///
+    /// Parallel algorithms invoked on the allocated data using the execution
+    /// policy par(exec, chunk_size) will touch each chunk from the NUMA domain
+    /// it was placed on. If no chunk size is given, the memory is split evenly
+    /// between all worker threads, which matches par(exec, n / num_threads)
+    /// for a sequence of n elements.
+    ///
+    template <typename T>
+    class numa_allocator
+    {
+    public:
+        typedef T value_type;
+        typedef T* pointer;
+        typedef T const* const_pointer;
+        typedef T& reference;
+        typedef T const& const_reference;
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+
+        template <typename U>
+        struct rebind
+        {
+            typedef numa_allocator<U> other;
+        };
+
+        /// A default constructed allocator does not refer to an executor,
+        /// it does not require the runtime to be running. The memory is
+        /// touched following the assignment of a default constructed
+        /// \a numa_executor.
+        numa_allocator()
+          : chunk_size_(0)
+        {}
+
+        explicit numa_allocator(threads::executors::numa_executor const& exec,
+                std::size_t chunk_size = 0)
+          : exec_(exec), chunk_size_(chunk_size)
+        {}
+
+        template <typename U>
+        numa_allocator(numa_allocator<U> const& rhs)
+          : exec_(rhs.exec_), chunk_size_(rhs.chunk_size_)
+        {}
+
+        pointer address(reference x) const { return &x; }
+        const_pointer address(const_reference x) const { return &x; }
+
+        pointer allocate(size_type n, void const* = 0)
+        {
+            if (n > max_size())
+                throw std::bad_alloc();
+            if (n == 0)
+                return 0;
+
+            std::size_t const len = n * sizeof(T);
+
+            char* p = 0;
+            try {
+                p = static_cast<char*>(threads::get_topology().allocate(len));
+            }
+            catch (hpx::exception const&) {
+                throw std::bad_alloc();
+            }
+
+            std::size_t const num_threads = hpx::get_os_thread_count();
+            std::size_t chunk_size = chunk_size_;
+            if (chunk_size == 0)
+                chunk_size = (std::max)((n + num_threads - 1) / num_threads,
+                    std::size_t(1));
+
+            std::size_t const page_size = detail::get_page_size();
+            std::size_t const chunk_bytes = chunk_size * sizeof(T);
+
+            // Touch the chunks in the order a parallel algorithm would
+            // schedule them through the executor after resetting it. The
+            // executor itself is not used, it may be shared with algorithms
+            // running concurrently. The worker threads are determined from
+            // the executor's assignment instead. Without an executor the
+            // assignment of a default constructed numa_executor is used.
+            threads::executors::numa_executor const& exec =
+                exec_ ? *exec_ : threads::executors::numa_executor();
+
+            std::vector<hpx::future<void> > touched;
+            touched.reserve((len + chunk_bytes - 1) / chunk_bytes);
+            std::size_t chunk = 0;
+            for (std::size_t offset = 0; offset < len; offset += chunk_bytes)
+            {
+                std::size_t end = (std::min)(offset + chunk_bytes, len);
+
+                boost::shared_ptr<lcos::local::promise<void> > done =
+                    boost::make_shared<lcos::local::promise<void> >();
+                touched.push_back(done->get_future());
+
+                detail::first_touch_task(exec.get_worker_thread(chunk++),
+                    p + offset, p + end, page_size, done).schedule();
+            }
+
+            try {
+                hpx::wait_all(touched);
+                for (hpx::future<void>& f : touched)
+                    f.get();
+            }
+            catch (...) {
+                threads::get_topology().deallocate(p, len);
+                throw;
+            }
+
+            return reinterpret_cast<pointer>(p);
+        }
+
+        void deallocate(pointer p, size_type n)
+        {
+            if (p == 0)
+                return;
+            threads::get_topology().deallocate(p, n * sizeof(T));
+        }
+
+        size_type max_size() const
+        {
+            return (std::numeric_limits<size_type>::max)() / sizeof(T);
+        }
+
+        void construct(pointer p, const_reference val)
+        {
+            ::new (static_cast<void*>(p)) T(val);
+        }
+
+        template <typename U, typename ... Ts>
+        void construct(U* p, Ts &&... vs)
+        {
+            ::new (static_cast<void*>(p)) U(std::forward<Ts>(vs)...);
+        }
+
+        template <typename U>
+        void destroy(U* p)
+        {
+            p->~U();
+        }
+
+        /// Return the executor the allocator was constructed with, if any
+        boost::optional<threads::executors::numa_executor> const&
+        executor() const
+        {
+            return exec_;
+        }
+
+        std::size_t chunk_size() const
+        {
+            return chunk_size_;
+        }
+
+    private:
+        template <typename U> friend class numa_allocator;
+
+        boost::optional<threads::executors::numa_executor> exec_;
+        std::size_t chunk_size_;
+    };
+
+    template <typename T, typename U>
+    bool operator==(numa_allocator<T> const&, numa_allocator<U> const&)
+    {
+        // all memory is allocated from and returned to the topology object
+        return true;
+    }
+
+    template <typename T, typename U>
+    bool operator!=(numa_allocator<T> const& lhs, numa_allocator<U> const& rhs)
+    {
+        return !(lhs == rhs);
+    }
+}}}
+
+#endif
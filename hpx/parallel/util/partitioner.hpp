@@ -15,6 +15,7 @@
 #include <hpx/util/decay.hpp>
 
 #include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/util/cancellation_token.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
 #include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
 #include <hpx/parallel/traits/extract_partitioner.hpp>
@@ -27,23 +28,52 @@ namespace hpx { namespace parallel { namespace util
     ///////////////////////////////////////////////////////////////////////////
     namespace detail
     {
+        ///////////////////////////////////////////////////////////////////////
+        // Algorithms which may terminate early (find, equal, etc.) pass their
+        // cancellation token to the partitioner, which stops scheduling new
+        // chunks as soon as the result is known. A token carrying an index
+        // has to record the smallest position where the algorithm stopped;
+        // all chunks starting at or after this position are skipped.
+        struct no_cancellation_token {};
+
+        inline bool is_cancelled(no_cancellation_token const&, std::size_t)
+        {
+            return false;
+        }
+
+        inline bool is_cancelled(cancellation_token<> const& tok, std::size_t)
+        {
+            return tok.was_cancelled();
+        }
+
+        template <typename T>
+        inline bool is_cancelled(cancellation_token<T> const& tok,
+            std::size_t base_idx)
+        {
+            return tok.was_cancelled(static_cast<T>(base_idx));
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // The static partitioner simply spawns one chunk of iterations for
         // each available core.
         template <typename ExPolicy, typename R, typename Result = void>
         struct static_partitioner
         {
-            template <typename FwdIter, typename F1, typename F2>
+            template <typename FwdIter, typename F1, typename F2,
+                typename CancelToken>
             static R call(ExPolicy const& policy, FwdIter first,
-                std::size_t count, F1 && f1, F2 && f2, std::size_t chunk_size)
+                std::size_t count, F1 && f1, F2 && f2, CancelToken const& tok,
+                std::size_t chunk_size)
             {
                 std::vector<hpx::future<Result> > workitems;
                 std::list<boost::exception_ptr> errors;
 
                 try {
                     // estimate a chunk size based on number of cores used
+                    std::size_t base_idx = count;
                     chunk_size = get_static_chunk_size(policy, workitems, f1,
                         first, count, chunk_size);
+                    base_idx -= count;
 
                     // schedule every chunk on a separate thread
                     workitems.reserve(count / chunk_size + 1);
@@ -51,6 +81,11 @@ namespace hpx { namespace parallel { namespace util
                     threads::executor exec = policy.get_executor();
                     while(count != 0)
                     {
+                        // don't schedule chunks which are known to be
+                        // irrelevant for the overall result
+                        if (is_cancelled(tok, base_idx))
+                            break;
+
                         std::size_t chunk = (std::min)(count, chunk_size);
                         if (exec)
                         {
@@ -65,6 +100,7 @@ namespace hpx { namespace parallel { namespace util
 
                         count -= chunk;
                         std::advance(first, chunk);
+                        base_idx += chunk;
                     }
                 }
                 catch (...) {
@@ -139,9 +175,11 @@ namespace hpx { namespace parallel { namespace util
                 return f2(std::move(workitems));
             }
 
-            template <typename FwdIter, typename F1, typename F2>
+            template <typename FwdIter, typename F1, typename F2,
+                typename CancelToken>
             static R call_with_index(ExPolicy const& policy, FwdIter first,
-                std::size_t count, F1 && f1, F2 && f2, std::size_t chunk_size)
+                std::size_t count, F1 && f1, F2 && f2, CancelToken const& tok,
+                std::size_t chunk_size)
             {
                 std::vector<hpx::future<Result> > workitems;
                 std::list<boost::exception_ptr> errors;
@@ -158,6 +196,11 @@ namespace hpx { namespace parallel { namespace util
                     threads::executor exec = policy.get_executor();
                     while(count != 0)
                     {
+                        // don't schedule chunks which are known to be
+                        // irrelevant for the overall result
+                        if (is_cancelled(tok, base_idx))
+                            break;
+
                         std::size_t chunk = (std::min)(count, chunk_size);
                         if (exec)
                         {
@@ -192,19 +235,22 @@ namespace hpx { namespace parallel { namespace util
         template <typename R, typename Result>
         struct static_partitioner<parallel_task_execution_policy, R, Result>
         {
-            template <typename FwdIter, typename F1, typename F2>
+            template <typename FwdIter, typename F1, typename F2,
+                typename CancelToken>
             static hpx::future<R> call(
                 parallel_task_execution_policy const& policy,
                 FwdIter first, std::size_t count, F1 && f1, F2 && f2,
-                std::size_t chunk_size)
+                CancelToken const& tok, std::size_t chunk_size)
             {
                 std::vector<hpx::future<Result> > workitems;
                 std::list<boost::exception_ptr> errors;
 
                 try {
                     // estimate a chunk size based on number of cores used
+                    std::size_t base_idx = count;
                     chunk_size = get_static_chunk_size(policy, workitems, f1,
                         first, count, chunk_size);
+                    base_idx -= count;
 
                     // schedule every chunk on a separate thread
                     workitems.reserve(count / chunk_size + 1);
@@ -212,6 +258,11 @@ namespace hpx { namespace parallel { namespace util
                     threads::executor exec = policy.get_executor();
                     while(count != 0)
                     {
+                        // don't schedule chunks which are known to be
+                        // irrelevant for the overall result
+                        if (is_cancelled(tok, base_idx))
+                            break;
+
                         std::size_t chunk = (std::min)(count, chunk_size);
                         if (exec)
                         {
@@ -226,6 +277,7 @@ namespace hpx { namespace parallel { namespace util
 
                         count -= chunk;
                         std::advance(first, chunk);
+                        base_idx += chunk;
                     }
                 }
                 catch (std::bad_alloc const&) {
@@ -316,11 +368,12 @@ namespace hpx { namespace parallel { namespace util
                     std::move(workitems));
             }
 
-            template <typename FwdIter, typename F1, typename F2>
+            template <typename FwdIter, typename F1, typename F2,
+                typename CancelToken>
             static hpx::future<R> call_with_index(
                 parallel_task_execution_policy const& policy,
                 FwdIter first, std::size_t count, F1 && f1, F2 && f2,
-                std::size_t chunk_size)
+                CancelToken const& tok, std::size_t chunk_size)
             {
                 std::vector<hpx::future<Result> > workitems;
                 std::list<boost::exception_ptr> errors;
@@ -337,6 +390,11 @@ namespace hpx { namespace parallel { namespace util
                     threads::executor exec = policy.get_executor();
                     while(count != 0)
                     {
+                        // don't schedule chunks which are known to be
+                        // irrelevant for the overall result
+                        if (is_cancelled(tok, base_idx))
+                            break;
+
                         std::size_t chunk = (std::min)(count, chunk_size);
                         if (exec)
                         {
@@ -396,7 +454,20 @@ namespace hpx { namespace parallel { namespace util
             {
                 return static_partitioner<ExPolicy, R, Result>::call(
                     policy, first, count,
-                    std::forward<F1>(f1), std::forward<F2>(f2), chunk_size);
+                    std::forward<F1>(f1), std::forward<F2>(f2),
+                    no_cancellation_token(), chunk_size);
+            }
+
+            template <typename FwdIter, typename F1, typename F2,
+                typename T>
+            static R call(ExPolicy const& policy, FwdIter first,
+                std::size_t count, F1 && f1, F2 && f2,
+                cancellation_token<T> const& tok, std::size_t chunk_size = 0)
+            {
+                return static_partitioner<ExPolicy, R, Result>::call(
+                    policy, first, count,
+                    std::forward<F1>(f1), std::forward<F2>(f2),
+                    tok, chunk_size);
             }
 
             template <typename FwdIter, typename F1, typename F2,
@@ -418,7 +489,20 @@ namespace hpx { namespace parallel { namespace util
             {
                 return static_partitioner<ExPolicy, R, Result>::call_with_index(
                     policy, first, count,
-                    std::forward<F1>(f1), std::forward<F2>(f2), chunk_size);
+                    std::forward<F1>(f1), std::forward<F2>(f2),
+                    no_cancellation_token(), chunk_size);
+            }
+
+            template <typename FwdIter, typename F1, typename F2,
+                typename T>
+            static R call_with_index(ExPolicy const& policy, FwdIter first,
+                std::size_t count, F1 && f1, F2 && f2,
+                cancellation_token<T> const& tok, std::size_t chunk_size = 0)
+            {
+                return static_partitioner<ExPolicy, R, Result>::call_with_index(
+                    policy, first, count,
+                    std::forward<F1>(f1), std::forward<F2>(f2),
+                    tok, chunk_size);
             }
         };
 
@@ -435,7 +519,22 @@ namespace hpx { namespace parallel { namespace util
                 return static_partitioner<
                         parallel_task_execution_policy, R, Result
                     >::call(policy, first, count,
-                        std::forward<F1>(f1), std::forward<F2>(f2), chunk_size);
+                        std::forward<F1>(f1), std::forward<F2>(f2),
+                        no_cancellation_token(), chunk_size);
+            }
+
+            template <typename FwdIter, typename F1, typename F2,
+                typename T>
+            static hpx::future<R> call(
+                parallel_task_execution_policy const& policy,
+                FwdIter first, std::size_t count, F1 && f1, F2 && f2,
+                cancellation_token<T> const& tok, std::size_t chunk_size = 0)
+            {
+                return static_partitioner<
+                        parallel_task_execution_policy, R, Result
+                    >::call(policy, first, count,
+                        std::forward<F1>(f1), std::forward<F2>(f2),
+                        tok, chunk_size);
             }
 
             template <typename FwdIter, typename F1, typename F2,
@@ -461,7 +560,22 @@ namespace hpx { namespace parallel { namespace util
                 return static_partitioner<
                         parallel_task_execution_policy, R, Result
                     >::call_with_index(policy, first, count,
-                        std::forward<F1>(f1), std::forward<F2>(f2), chunk_size);
+                        std::forward<F1>(f1), std::forward<F2>(f2),
+                        no_cancellation_token(), chunk_size);
+            }
+
+            template <typename FwdIter, typename F1, typename F2,
+                typename T>
+            static hpx::future<R> call_with_index(
+                parallel_task_execution_policy const& policy,
+                FwdIter first, std::size_t count, F1 && f1, F2 && f2,
+                cancellation_token<T> const& tok, std::size_t chunk_size = 0)
+            {
+                return static_partitioner<
+                        parallel_task_execution_policy, R, Result
+                    >::call_with_index(policy, first, count,
+                        std::forward<F1>(f1), std::forward<F2>(f2),
+                        tok, chunk_size);
             }
         };
 
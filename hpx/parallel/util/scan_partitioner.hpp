@@ -11,16 +11,21 @@
 #include <hpx/exception_list.hpp>
 #include <hpx/lcos/wait_all.hpp>
 #include <hpx/lcos/local/dataflow.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
 #include <hpx/util/bind.hpp>
 #include <hpx/util/decay.hpp>
 
 #include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
 #include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
 #include <hpx/parallel/traits/extract_partitioner.hpp>
 
 #include <algorithm>
 
+#include <boost/atomic.hpp>
+#include <boost/shared_array.hpp>
+
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace parallel { namespace util
 {
@@ -222,6 +227,258 @@ namespace hpx { namespace parallel { namespace util
             }
         };
 
+        ///////////////////////////////////////////////////////////////////////
+        // Look-back descriptor published by each partition of the single-pass
+        // scan. The aggregate holds the reduction of the partition itself,
+        // the prefix holds the inclusive reduction of all partitions up to
+        // and including this one.
+        template <typename Result>
+        struct scan_partition_descriptor
+        {
+            enum status_type
+            {
+                status_invalid = 0,
+                status_aggregate = 1,
+                status_prefix = 2,
+                status_failed = 3
+            };
+
+            scan_partition_descriptor()
+              : status_(status_invalid), aggregate_(), prefix_()
+            {}
+
+            boost::atomic<int> status_;
+            Result aggregate_;
+            Result prefix_;
+        };
+
+        // Processes a single partition of the single-pass scan: reduce the
+        // partition (f1), publish the aggregate, determine the exclusive
+        // prefix by looking back at the descriptors of the partitions to the
+        // left (combining with f2), publish the inclusive prefix, and finally
+        // produce the results for the partition (f3).
+        template <typename Result, typename FwdIter,
+            typename F1, typename F2, typename F3>
+        void single_pass_scan_partition(
+            boost::shared_array<scan_partition_descriptor<Result> > const& parts,
+            std::size_t part, Result const& init, FwdIter first,
+            std::size_t count, F1 & f1, F2 & f2, F3 & f3)
+        {
+            typedef scan_partition_descriptor<Result> descriptor;
+
+            descriptor& d = parts[part];
+            try {
+                Result aggregate = f1(first, count);
+                Result prefix = init;
+
+                if (part != 0)
+                {
+                    d.aggregate_ = aggregate;
+                    d.status_.store(descriptor::status_aggregate,
+                        boost::memory_order_release);
+
+                    // Walk to the left, accumulating aggregates until a
+                    // partition with a known inclusive prefix is found. Note
+                    // that the operation may be non-commutative, therefore
+                    // partial sums are always combined from the left.
+                    bool has_sum = false;
+                    Result sum = Result();
+                    for (std::size_t pred = part; pred != 0; /**/)
+                    {
+                        descriptor const& p = parts[--pred];
+
+                        int status = p.status_.load(boost::memory_order_acquire);
+                        for (std::size_t k = 0;
+                             status == descriptor::status_invalid; ++k)
+                        {
+                            lcos::local::spinlock::yield(k);
+                            status = p.status_.load(boost::memory_order_acquire);
+                        }
+
+                        if (status == descriptor::status_failed)
+                        {
+                            // some partition to the left has failed, its
+                            // error will be reported, just stop here
+                            d.status_.store(descriptor::status_failed,
+                                boost::memory_order_release);
+                            return;
+                        }
+
+                        if (status == descriptor::status_prefix)
+                        {
+                            prefix = has_sum ? f2(p.prefix_, sum) : p.prefix_;
+                            break;
+                        }
+
+                        sum = has_sum ? f2(p.aggregate_, sum) : p.aggregate_;
+                        has_sum = true;
+                    }
+                }
+
+                d.prefix_ = f2(prefix, aggregate);
+                d.status_.store(descriptor::status_prefix,
+                    boost::memory_order_release);
+
+                f3(prefix, first, count);
+            }
+            catch (...) {
+                d.status_.store(descriptor::status_failed,
+                    boost::memory_order_release);
+                throw;
+            }
+        }
+
+        // Schedules a separate task for each partition of the single-pass
+        // scan. The partitions are scheduled in order which guarantees that
+        // all partitions a partition looks back to have been scheduled
+        // already.
+        template <typename Result, typename ExPolicy, typename FwdIter,
+            typename F1, typename F2, typename F3>
+        void schedule_single_pass_scan(ExPolicy const& policy,
+            FwdIter first, std::size_t count, Result const& init,
+            F1 && f1, F2 && f2, F3 && f3, std::size_t chunk_size,
+            boost::shared_array<scan_partition_descriptor<Result> >& parts,
+            std::vector<hpx::future<void> >& workitems)
+        {
+            chunk_size = get_single_pass_chunk_size(policy, first,
+                count, chunk_size);
+
+            std::size_t num_parts = (count + chunk_size - 1) / chunk_size;
+            parts.reset(new scan_partition_descriptor<Result>[num_parts]);
+            workitems.reserve(num_parts);
+
+            threads::executor exec = policy.get_executor();
+            for (std::size_t part = 0; count != 0; ++part)
+            {
+                std::size_t chunk = (std::min)(count, chunk_size);
+
+                auto f = [=]() mutable
+                    {
+                        single_pass_scan_partition(parts, part, init, first,
+                            chunk, f1, f2, f3);
+                    };
+
+                if (exec)
+                {
+                    workitems.push_back(hpx::async(exec, std::move(f)));
+                }
+                else
+                {
+                    workitems.push_back(
+                        hpx::async(hpx::launch::fork, std::move(f)));
+                }
+
+                count -= chunk;
+                std::advance(first, chunk);
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The single-pass scan partitioner uses a decoupled look-back scheme:
+        // every partition publishes its local aggregate and (as soon as it is
+        // known) its inclusive prefix, which allows all partitions to finish
+        // without waiting for a global barrier. The partitions are small
+        // enough to stay cache resident, so the input is read from memory
+        // only once.
+        //
+        // f1: Result (FwdIter part_begin, std::size_t part_size)
+        //     reduces a partition
+        // f2: Result (Result const& prev, Result const& curr)
+        //     combines two partial results
+        // f3: void (Result const& prefix, FwdIter part_begin, std::size_t part_size)
+        //     produces the final values of a partition given its exclusive
+        //     prefix
+        // f4: R (Result && total)
+        //     produces the overall result
+        template <typename ExPolicy, typename R, typename Result>
+        struct single_pass_scan_partitioner
+        {
+            template <typename FwdIter, typename T, typename F1, typename F2,
+                typename F3, typename F4>
+            static R call(ExPolicy const& policy, FwdIter first,
+                std::size_t count, T && init, F1 && f1, F2 && f2, F3 && f3,
+                F4 && f4, std::size_t chunk_size)
+            {
+                typedef scan_partition_descriptor<Result> descriptor;
+
+                Result init_value(std::forward<T>(init));
+                if (count == 0)
+                    return f4(std::move(init_value));
+
+                std::vector<hpx::future<void> > workitems;
+                std::list<boost::exception_ptr> errors;
+                boost::shared_array<descriptor> parts;
+
+                try {
+                    schedule_single_pass_scan(policy, first, count,
+                        init_value, f1, f2, f3, chunk_size, parts, workitems);
+                }
+                catch (...) {
+                    detail::handle_local_exceptions<ExPolicy>::call(
+                        boost::current_exception(), errors);
+                }
+
+                // wait for all tasks to finish
+                hpx::wait_all(workitems);
+                detail::handle_local_exceptions<ExPolicy>::call(
+                    workitems, errors);
+
+                // all partitions have been scheduled if nothing failed
+                HPX_ASSERT(!workitems.empty());
+                return f4(std::move(parts[workitems.size() - 1].prefix_));
+            }
+        };
+
+        template <typename R, typename Result>
+        struct single_pass_scan_partitioner<
+            parallel_task_execution_policy, R, Result>
+        {
+            template <typename FwdIter, typename T, typename F1, typename F2,
+                typename F3, typename F4>
+            static hpx::future<R> call(
+                parallel_task_execution_policy const& policy, FwdIter first,
+                std::size_t count, T && init, F1 && f1, F2 && f2, F3 && f3,
+                F4 && f4, std::size_t chunk_size)
+            {
+                typedef scan_partition_descriptor<Result> descriptor;
+
+                Result init_value(std::forward<T>(init));
+                if (count == 0)
+                    return hpx::make_ready_future(f4(std::move(init_value)));
+
+                std::vector<hpx::future<void> > workitems;
+                std::list<boost::exception_ptr> errors;
+                boost::shared_array<descriptor> parts;
+
+                try {
+                    schedule_single_pass_scan(policy, first, count,
+                        init_value, f1, f2, f3, chunk_size, parts, workitems);
+                }
+                catch (std::bad_alloc const&) {
+                    return hpx::make_exceptional_future<R>(
+                        boost::current_exception());
+                }
+                catch (...) {
+                    errors.push_back(boost::current_exception());
+                }
+
+                // wait for all tasks to finish
+                return lcos::local::dataflow(
+                    [=](std::vector<hpx::future<void> >&& r) mutable -> R
+                    {
+                        detail::handle_local_exceptions<
+                                parallel_task_execution_policy
+                            >::call(r, errors);
+
+                        // all partitions have been scheduled if nothing
+                        // failed
+                        HPX_ASSERT(!r.empty());
+                        return f4(std::move(parts[r.size() - 1].prefix_));
+                    },
+                    std::move(workitems));
+            }
+        };
+
         ///////////////////////////////////////////////////////////////////////
         // ExPolicy: execution policy
         // R:        overall result type
@@ -285,6 +542,25 @@ namespace hpx { namespace parallel { namespace util
       : detail::scan_partitioner<
             typename hpx::util::decay<ExPolicy>::type, R, Result, PartTag>
     {};
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename R = void, typename Result = R>
+    struct single_pass_scan_partitioner
+    {
+        template <typename FwdIter, typename T, typename F1, typename F2,
+            typename F3, typename F4>
+        static typename parallel::detail::algorithm_result<ExPolicy, R>::type
+        call(ExPolicy const& policy, FwdIter first, std::size_t count,
+            T && init, F1 && f1, F2 && f2, F3 && f3, F4 && f4,
+            std::size_t chunk_size = 0)
+        {
+            return detail::single_pass_scan_partitioner<
+                    typename hpx::util::decay<ExPolicy>::type, R, Result
+                >::call(policy, first, count, std::forward<T>(init),
+                    std::forward<F1>(f1), std::forward<F2>(f2),
+                    std::forward<F3>(f3), std::forward<F4>(f4), chunk_size);
+        }
+    };
 }}}
 
 #endif
@@ -0,0 +1,691 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/view.hpp
+
+#if !defined(HPX_PARALLEL_VIEW_AUG_10_2015_1010AM)
+#define HPX_PARALLEL_VIEW_AUG_10_2015_1010AM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/decay.hpp>
+#include <hpx/util/result_of.hpp>
+#include <hpx/util/transform_iterator.hpp>
+#include <hpx/util/unwrapped.hpp>
+#include <hpx/util/zip_iterator.hpp>
+
+#include <hpx/parallel/config/inline_namespace.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/algorithm_result.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/copy.hpp>
+#include <hpx/parallel/algorithms/for_each.hpp>
+#include <hpx/parallel/util/loop.hpp>
+#include <hpx/parallel/util/partitioner.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include <boost/iterator/counting_iterator.hpp>
+#include <boost/mpl/or.hpp>
+#include <boost/optional.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/utility/enable_if.hpp>
+
+// The views defined here are lazy adaptors over existing sequences. They do
+// not materialize any intermediate results, every element is computed while
+// the consuming algorithm processes the adapted sequence. Chaining views and
+// handing the result to a single parallel algorithm (for instance reduce,
+// copy, or for_each) executes the whole pipeline in one partitioned pass,
+// each chunk running the entire chain for its elements.
+//
+// The transform, zip, and enumerate views are iterator ranges exposing the
+// iterator category of the adapted sequence, they can be passed to any
+// algorithm. A filtered view has no random access iterators. It keeps the
+// underlying sequence instead, which is partitioned by the for_each, reduce,
+// and copy overloads taking a filtered view. These apply the predicate and
+// the transformations following the filter inside each chunk.
+//
+//      hpx::parallel::reduce(par,
+//          view::transform(view::filter(v, pred), f), init, op);
+//
+// All views hold iterators into the adapted sequence only, the underlying
+// container has to outlive any view referring to it.
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1) { namespace view
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// A filtered_range is the lazy view returned by \a filter. It holds the
+    /// underlying sequence [base_begin(), base_end()), the predicate
+    /// selecting the elements of the view, and the transformation applied to
+    /// the selected elements afterwards.
+    ///
+    /// A filtered_range does not expose iterators. The algorithms taking a
+    /// filtered_range (for_each, reduce, and copy) partition the underlying
+    /// sequence and evaluate the predicate exactly once for each of its
+    /// elements.
+    ///
+    template <typename Iterator, typename Pred, typename Transformer>
+    class filtered_range
+    {
+    public:
+        typedef Iterator base_iterator;
+        typedef Pred predicate_type;
+        typedef Transformer transformer_type;
+
+        /// The type of the elements of the view
+        typedef typename util::result_of<
+                Transformer const&(
+                    typename std::iterator_traits<Iterator>::reference
+                )
+            >::type reference;
+        typedef typename hpx::util::decay<reference>::type value_type;
+
+        filtered_range(Iterator first, Iterator last, Pred const& pred,
+                Transformer const& t)
+          : first_(first), last_(last), pred_(pred), t_(t)
+        {}
+
+        /// The underlying sequence
+        Iterator base_begin() const { return first_; }
+        Iterator base_end() const { return last_; }
+
+        /// The predicate selecting the elements of the underlying sequence
+        Pred const& predicate() const { return pred_; }
+
+        /// The transformation applied to the selected elements
+        Transformer const& transformer() const { return t_; }
+
+    private:
+        Iterator first_;
+        Iterator last_;
+        Pred pred_;
+        Transformer t_;
+    };
+
+    /// \cond NOINTERNAL
+    namespace detail
+    {
+        template <typename T>
+        struct is_filtered_range_impl
+          : std::false_type
+        {};
+
+        template <typename Iterator, typename Pred, typename Transformer>
+        struct is_filtered_range_impl<
+                filtered_range<Iterator, Pred, Transformer> >
+          : std::true_type
+        {};
+    }
+    /// \endcond
+
+    /// Evaluates to true if \a T is a (possibly cv/reference qualified)
+    /// \a filtered_range.
+    template <typename T>
+    struct is_filtered_range
+      : detail::is_filtered_range_impl<typename hpx::util::decay<T>::type>
+    {};
+
+    /// \cond NOINTERNAL
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Range>
+        struct range_iterator
+          : boost::range_iterator<typename std::remove_reference<Range>::type>
+        {};
+
+        ///////////////////////////////////////////////////////////////////////
+        // Iterators have to be default constructible and assignable. Wrap the
+        // user supplied function objects such that this holds even for
+        // function objects which are neither (e.g. lambdas).
+        template <typename F>
+        class function_holder
+        {
+        public:
+            function_holder() {}
+
+            explicit function_holder(F const& f)
+              : f_(f)
+            {}
+
+            function_holder(function_holder const& rhs)
+              : f_(rhs.f_)
+            {}
+
+            function_holder& operator=(function_holder const& rhs)
+            {
+                if (this != &rhs)
+                {
+                    f_ = boost::none;
+                    if (rhs.f_)
+                        f_ = *rhs.f_;
+                }
+                return *this;
+            }
+
+        protected:
+            F const& get() const
+            {
+                HPX_ASSERT(f_);
+                return *f_;
+            }
+
+        private:
+            boost::optional<F> f_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // hpx::util::transform_iterator invokes its transformer with the
+        // iterator, this adapts a function object expecting an element.
+        template <typename F, typename Reference>
+        struct dereference_transformer : function_holder<F>
+        {
+            dereference_transformer() {}
+
+            explicit dereference_transformer(F const& f)
+              : function_holder<F>(f)
+            {}
+
+            template <typename Iterator>
+            Reference operator()(Iterator const& it) const
+            {
+                return this->get()(*it);
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Range, typename F>
+        struct transform_view
+        {
+            typedef typename range_iterator<Range>::type base_iterator;
+            typedef typename util::result_of<
+                    F const&(
+                        typename std::iterator_traits<base_iterator>::reference
+                    )
+                >::type reference;
+
+            typedef util::transform_iterator<
+                    base_iterator, dereference_transformer<F, reference>,
+                    reference
+                > iterator;
+            typedef boost::iterator_range<iterator> type;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        struct identity_transformer
+        {
+            template <typename T>
+            T && operator()(T && t) const
+            {
+                return std::forward<T>(t);
+            }
+        };
+
+        // Apply G first, then F
+        template <typename F, typename G>
+        struct composed_transformer
+        {
+            composed_transformer(F const& f, G const& g)
+              : f_(f), g_(g)
+            {}
+
+            template <typename T>
+            typename util::result_of<
+                F const&(typename util::result_of<G const&(T &&)>::type)
+            >::type
+            operator()(T && t) const
+            {
+                return f_(g_(std::forward<T>(t)));
+            }
+
+            F f_;
+            G g_;
+        };
+
+        // Select the elements for which the first predicate holds and for
+        // which the second one holds for the transformed element.
+        template <typename Pred1, typename Pred2, typename Transformer>
+        struct composed_predicate
+        {
+            composed_predicate(Pred1 const& pred1, Pred2 const& pred2,
+                    Transformer const& t)
+              : pred1_(pred1), pred2_(pred2), t_(t)
+            {}
+
+            template <typename T>
+            bool operator()(T && t) const
+            {
+                return pred1_(t) && pred2_(t_(t));
+            }
+
+            Pred1 pred1_;
+            Pred2 pred2_;
+            Transformer t_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Range, typename F>
+        struct filter_view
+        {
+            typedef typename range_iterator<Range>::type base_iterator;
+            typedef filtered_range<
+                    base_iterator, F, identity_transformer
+                > type;
+        };
+
+        template <typename Range, typename F>
+        struct filtered_filter_view
+        {
+            typedef typename hpx::util::decay<Range>::type range_type;
+            typedef filtered_range<
+                    typename range_type::base_iterator,
+                    composed_predicate<
+                        typename range_type::predicate_type, F,
+                        typename range_type::transformer_type>,
+                    typename range_type::transformer_type
+                > type;
+        };
+
+        template <typename Range, typename F>
+        struct filtered_transform_view
+        {
+            typedef typename hpx::util::decay<Range>::type range_type;
+            typedef filtered_range<
+                    typename range_type::base_iterator,
+                    typename range_type::predicate_type,
+                    composed_transformer<
+                        F, typename range_type::transformer_type>
+                > type;
+        };
+
+        template <typename ...Ranges>
+        struct zip_view
+        {
+            typedef util::zip_iterator<
+                    typename range_iterator<Ranges>::type...
+                > iterator;
+            typedef boost::iterator_range<iterator> type;
+        };
+
+        template <typename Range>
+        struct enumerate_view
+          : zip_view<boost::iterator_range<
+                boost::counting_iterator<std::size_t> >, Range>
+        {};
+    }
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Returns a lazy view of the given range whose elements are the results
+    /// of invoking \a f on the elements of \a rng.
+    ///
+    /// \param rng  The range (or other view) to adapt.
+    /// \param f    The unary function object applied to each element once it
+    ///             is dereferenced. The signature of this function should be
+    ///             equivalent to
+    ///             \code
+    ///             Ret fun(const Type &a);
+    ///             \endcode \n
+    ///             where Type is the value type of \a rng.
+    ///
+    /// The iterator category of the returned view is the iterator category
+    /// of \a rng. Transforming a filtered view yields a filtered view again.
+    ///
+    template <typename Range, typename F>
+    typename boost::lazy_disable_if<
+        is_filtered_range<Range>,
+        detail::transform_view<Range, F>
+    >::type
+    transform(Range && rng, F const& f)
+    {
+        typedef detail::transform_view<Range, F> view_type;
+        typedef typename view_type::iterator iterator;
+        typedef detail::dereference_transformer<
+                F, typename view_type::reference
+            > transformer;
+
+        return typename view_type::type(
+            iterator(boost::begin(rng), transformer(f)),
+            iterator(boost::end(rng), transformer(f)));
+    }
+
+    /// \cond NOINTERNAL
+    template <typename Range, typename F>
+    typename boost::lazy_enable_if<
+        is_filtered_range<Range>,
+        detail::filtered_transform_view<Range, F>
+    >::type
+    transform(Range && rng, F const& f)
+    {
+        typedef typename detail::filtered_transform_view<Range, F>::type
+            view_type;
+        typedef typename view_type::transformer_type transformer;
+
+        return view_type(rng.base_begin(), rng.base_end(),
+            rng.predicate(), transformer(f, rng.transformer()));
+    }
+    /// \endcond
+
+    /// Returns a lazy view of the given range exposing only the elements
+    /// for which \a pred returns true.
+    ///
+    /// \param rng  The range (or other view) to adapt.
+    /// \param pred The unary predicate selecting the elements of the view.
+    ///
+    /// The returned \a filtered_range is not an iterator range, it can be
+    /// passed to the overloads of for_each, reduce, and copy taking a
+    /// \a filtered_range (or adapted further using transform and filter).
+    /// Those partition the sequence \a rng and evaluate \a pred exactly once
+    /// for each of its elements. Transformations applied to \a rng before filtering it are
+    /// evaluated again for the elements passing the filter.
+    ///
+    template <typename Range, typename F>
+    typename boost::lazy_disable_if<
+        is_filtered_range<Range>,
+        detail::filter_view<Range, F>
+    >::type
+    filter(Range && rng, F const& pred)
+    {
+        typedef typename detail::filter_view<Range, F>::type view_type;
+
+        return view_type(boost::begin(rng), boost::end(rng), pred,
+            detail::identity_transformer());
+    }
+
+    /// \cond NOINTERNAL
+    template <typename Range, typename F>
+    typename boost::lazy_enable_if<
+        is_filtered_range<Range>,
+        detail::filtered_filter_view<Range, F>
+    >::type
+    filter(Range && rng, F const& pred)
+    {
+        typedef typename detail::filtered_filter_view<Range, F>::type
+            view_type;
+        typedef typename view_type::predicate_type predicate;
+
+        return view_type(rng.base_begin(), rng.base_end(),
+            predicate(rng.predicate(), pred, rng.transformer()),
+            rng.transformer());
+    }
+    /// \endcond
+
+    /// Returns a lazy view of the given ranges whose elements are tuples
+    /// (\a hpx::util::tuple) of references to the corresponding elements of
+    /// \a rngs. The view ends with the end of the first range, all other
+    /// ranges must be at least as long.
+    ///
+    template <typename Range, typename ...Ranges>
+    typename detail::zip_view<Range, Ranges...>::type
+    zip(Range && rng, Ranges &&... rngs)
+    {
+        typedef detail::zip_view<Range, Ranges...> view_type;
+        typedef typename view_type::iterator iterator;
+
+        iterator first = util::make_zip_iterator(
+            boost::begin(rng), boost::begin(rngs)...);
+        iterator last = first;
+        std::advance(last, std::distance(boost::begin(rng), boost::end(rng)));
+
+        return typename view_type::type(first, last);
+    }
+
+    /// Returns a lazy view of the given range whose elements are tuples
+    /// (\a hpx::util::tuple) of the zero based index of each element and a
+    /// reference to the element itself.
+    ///
+    template <typename Range>
+    typename detail::enumerate_view<Range>::type
+    enumerate(Range && rng)
+    {
+        std::size_t size = std::distance(boost::begin(rng), boost::end(rng));
+        return view::zip(
+            boost::make_iterator_range(
+                boost::counting_iterator<std::size_t>(0),
+                boost::counting_iterator<std::size_t>(size)),
+            std::forward<Range>(rng));
+    }
+}}}}
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The algorithms consuming filtered views
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+        template <typename Pred, typename Transformer, typename F>
+        struct filtered_invoke
+        {
+            filtered_invoke(Pred const& pred, Transformer const& t, F && f)
+              : pred_(pred), t_(t), f_(std::forward<F>(f))
+            {}
+
+            template <typename T>
+            void operator()(T && t) const
+            {
+                if (pred_(t))
+                    f_(t_(t));
+            }
+
+            Pred pred_;
+            Transformer t_;
+            typename hpx::util::decay<F>::type f_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename T>
+        struct filtered_reduce
+          : public detail::algorithm<filtered_reduce<T>, T>
+        {
+            filtered_reduce()
+              : filtered_reduce::algorithm("reduce")
+            {}
+
+            template <typename ExPolicy, typename InIter, typename Pred,
+                typename Transformer, typename Reduce>
+            static T
+            sequential(ExPolicy const&, InIter first, InIter last,
+                Pred const& pred, Transformer const& t, T init, Reduce && r)
+            {
+                for (/**/; first != last; ++first)
+                {
+                    typename std::iterator_traits<InIter>::reference v =
+                        *first;
+                    if (pred(v))
+                        init = r(init, t(v));
+                }
+                return init;
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename Pred,
+                typename Transformer, typename Reduce>
+            static typename detail::algorithm_result<ExPolicy, T>::type
+            parallel(ExPolicy const& policy, FwdIter first, FwdIter last,
+                Pred const& pred, Transformer const& t, T init, Reduce && r)
+            {
+                if (first == last)
+                {
+                    return detail::algorithm_result<ExPolicy, T>::get(
+                        std::move(init));
+                }
+
+                // a partition might not contain any selected element
+                typedef boost::optional<T> partition_result;
+
+                return util::partitioner<ExPolicy, T, partition_result>::call(
+                    policy, first, std::distance(first, last),
+                    [pred, t, r](FwdIter part_begin, std::size_t part_size)
+                        -> partition_result
+                    {
+                        partition_result val;
+                        util::loop_n(part_begin, part_size,
+                            [&](FwdIter it)
+                            {
+                                typename std::iterator_traits<
+                                        FwdIter
+                                    >::reference v = *it;
+                                if (!pred(v))
+                                    return;
+
+                                if (val)
+                                    val = r(*val, t(v));
+                                else
+                                    val = T(t(v));
+                            });
+                        return val;
+                    },
+                    hpx::util::unwrapped(
+                        [init, r](std::vector<partition_result> && results)
+                            -> T
+                        {
+                            T val = init;
+                            for (partition_result const& part : results)
+                            {
+                                if (part)
+                                    val = r(val, *part);
+                            }
+                            return val;
+                        }));
+            }
+        };
+
+        template <typename ExPolicy, typename Iterator>
+        struct filtered_is_seq
+          : boost::mpl::or_<
+                is_sequential_execution_policy<ExPolicy>,
+                boost::is_same<
+                    std::input_iterator_tag,
+                    typename std::iterator_traits<Iterator>::iterator_category>
+            >
+        {};
+        /// \endcond
+    }
+
+    /// Applies \a f to the elements of the filtered view \a rng.
+    ///
+    /// The underlying sequence of \a rng is partitioned, each partition
+    /// evaluates the predicate of the view for its elements and invokes \a f
+    /// with the transformed selected elements. The order in which \a f is
+    /// applied is unspecified for the parallel execution policies.
+    ///
+    /// \returns  The \a for_each algorithm returns a \a hpx::future<void> if
+    ///           the execution policy is of type
+    ///           \a sequential_task_execution_policy
+    ///           or \a parallel_task_execution_policy and returns \a void
+    ///           otherwise.
+    ///
+    template <typename ExPolicy, typename Iterator, typename Pred,
+        typename Transformer, typename F>
+    inline typename boost::enable_if<
+        is_execution_policy<ExPolicy>,
+        typename detail::algorithm_result<ExPolicy, void>::type
+    >::type
+    for_each(ExPolicy && policy,
+        view::filtered_range<Iterator, Pred, Transformer> const& rng,
+        F && f)
+    {
+        return for_each(std::forward<ExPolicy>(policy),
+            rng.base_begin(), rng.base_end(),
+            detail::filtered_invoke<Pred, Transformer, F>(
+                rng.predicate(), rng.transformer(), std::forward<F>(f)));
+    }
+
+    /// Returns GENERALIZED_SUM(f, init, ...) over the elements of the
+    /// filtered view \a rng.
+    ///
+    /// The underlying sequence of \a rng is partitioned, each partition
+    /// evaluates the predicate of the view for its elements and combines
+    /// its transformed selected elements. The results of the partitions are
+    /// combined with \a init afterwards.
+    ///
+    /// \returns  The \a reduce algorithm returns a \a hpx::future<T> if the
+    ///           execution policy is of type
+    ///           \a sequential_task_execution_policy
+    ///           or \a parallel_task_execution_policy and returns \a T
+    ///           otherwise.
+    ///
+    template <typename ExPolicy, typename Iterator, typename Pred,
+        typename Transformer, typename T, typename F>
+    inline typename boost::enable_if<
+        is_execution_policy<ExPolicy>,
+        typename detail::algorithm_result<ExPolicy, T>::type
+    >::type
+    reduce(ExPolicy && policy,
+        view::filtered_range<Iterator, Pred, Transformer> const& rng,
+        T init, F && f)
+    {
+        typedef detail::filtered_is_seq<ExPolicy, Iterator> is_seq;
+
+        return detail::filtered_reduce<T>().call(
+            std::forward<ExPolicy>(policy), is_seq(),
+            rng.base_begin(), rng.base_end(), rng.predicate(),
+            rng.transformer(), std::move(init), std::forward<F>(f));
+    }
+
+    /// Returns GENERALIZED_SUM(+, init, ...) over the elements of the
+    /// filtered view \a rng.
+    ///
+    template <typename ExPolicy, typename Iterator, typename Pred,
+        typename Transformer, typename T>
+    inline typename boost::enable_if<
+        is_execution_policy<ExPolicy>,
+        typename detail::algorithm_result<ExPolicy, T>::type
+    >::type
+    reduce(ExPolicy && policy,
+        view::filtered_range<Iterator, Pred, Transformer> const& rng,
+        T init)
+    {
+        return reduce(std::forward<ExPolicy>(policy), rng, std::move(init),
+            std::plus<T>());
+    }
+
+    /// Copies the elements of the filtered view \a rng to the range beginning
+    /// at \a dest, preserving their order.
+    ///
+    /// The underlying sequence of \a rng is partitioned, each partition
+    /// evaluates the predicate of the view for its elements and stores the
+    /// transformed selected elements.
+    ///
+    /// \returns  The \a copy algorithm returns a \a hpx::future<OutIter> if
+    ///           the execution policy is of type
+    ///           \a sequential_task_execution_policy
+    ///           or \a parallel_task_execution_policy and returns \a OutIter
+    ///           otherwise. It returns the output iterator to the element in
+    ///           the destination range, one past the last element copied.
+    ///
+    template <typename ExPolicy, typename Iterator, typename Pred,
+        typename Transformer, typename OutIter>
+    inline typename boost::enable_if<
+        is_execution_policy<ExPolicy>,
+        typename detail::algorithm_result<ExPolicy, OutIter>::type
+    >::type
+    copy(ExPolicy && policy,
+        view::filtered_range<Iterator, Pred, Transformer> const& rng,
+        OutIter dest)
+    {
+        typedef typename std::iterator_traits<OutIter>::iterator_category
+            output_iterator_category;
+
+        typedef typename boost::mpl::or_<
+            detail::filtered_is_seq<ExPolicy, Iterator>,
+            boost::is_same<std::output_iterator_tag, output_iterator_category>
+        >::type is_seq;
+
+        return detail::copy_if<OutIter>().call(
+            std::forward<ExPolicy>(policy), is_seq(),
+            rng.base_begin(), rng.base_end(), dest, rng.predicate(),
+            rng.transformer());
+    }
+}}}
+
+#endif
@@ -11,7 +11,7 @@
 #include <hpx/plugins/parcelport/mpi/header.hpp>
 #include <hpx/runtime/parcelset/decode_parcels.hpp>
 
-#include <hpx/util/memory_chunk_pool.hpp>
+#include <hpx/util/size_class_memory_pool.hpp>
 #include <hpx/util/memory_chunk_pool_allocator.hpp>
 
 namespace hpx { namespace parcelset { namespace policies { namespace mpi
@@ -23,7 +23,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace mpi
         typedef hpx::lcos::local::spinlock mutex_type;
         typedef std::list<std::pair<int, header> > header_list;
         typedef std::set<std::pair<int, int> > handles_header_type;
-        typedef util::memory_chunk_pool<mutex_type> memory_pool_type;
+        typedef util::size_class_memory_pool<> memory_pool_type;
         typedef util::detail::memory_chunk_pool_allocator<
                 char, memory_pool_type
             > allocator_type;
@@ -0,0 +1,199 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file default_distribution_policy.hpp
+
+#if !defined(HPX_COMPONENTS_DEFAULT_DISTRIBUTION_POLICY_SEP_30_2015_0236PM)
+#define HPX_COMPONENTS_DEFAULT_DISTRIBUTION_POLICY_SEP_30_2015_0236PM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/runtime/naming/name.hpp>
+#include <hpx/runtime/components/stubs/stub_base.hpp>
+#include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/runtime/serialization/vector.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/when_all.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include <boost/mpl/bool.hpp>
+
+namespace hpx { namespace components
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// This class specifies the parameters for a simple distribution policy
+    /// to use for creating (and evenly distributing) a given number of items
+    /// on a given set of localities.
+    struct default_distribution_policy
+    {
+    public:
+        /// Default-construct a new instance of a \a default_distribution_policy.
+        /// This policy will represent the locality this object is created
+        /// on.
+        default_distribution_policy() {}
+
+        /// Create a new \a default_distribution policy representing the given
+        /// set of localities.
+        ///
+        /// \param locs     [in] The list of localities the new instance should
+        ///                 represent
+        default_distribution_policy operator()(
+            std::vector<id_type> const& locs) const
+        {
+            return default_distribution_policy(locs);
+        }
+
+        /// Create a new \a default_distribution policy representing the given
+        /// locality
+        ///
+        /// \param loc     [in] The locality the new instance should
+        ///                 represent
+        default_distribution_policy operator()(id_type const& loc) const
+        {
+            return default_distribution_policy(loc);
+        }
+
+        /// Returns the list of localities represented by this policy, the
+        /// list is empty if this policy represents the current locality.
+        std::vector<id_type> const& get_localities() const
+        {
+            return localities_;
+        }
+
+        /// Returns the number of items out of \a items which are to be
+        /// created on the locality with the index \a loc (in the list of
+        /// localities represented by this policy). The items are evenly
+        /// distributed, the first localities receive one additional item
+        /// each if the number of items is not divisible by the number of
+        /// localities.
+        std::size_t get_num_items(std::size_t items, std::size_t loc) const
+        {
+            std::size_t num_parts = localities_.empty() ?
+                std::size_t(1) : localities_.size();
+            return items / num_parts + ((loc < items % num_parts) ? 1 : 0);
+        }
+
+        /// Create multiple objects on the localities associated by
+        /// this policy instance. This issues exactly one (bulk) creation
+        /// action per target locality.
+        ///
+        /// \param count [in] The number of objects to create
+        /// \param vs   [in] The arguments which will be forwarded to the
+        ///             constructors of the new objects.
+        ///
+        /// \returns A future holding the list of global addresses which
+        ///          represent the newly created objects. The objects
+        ///          created on the first locality are listed first, followed
+        ///          by the objects created on the second locality, etc.
+        ///
+        template <typename Component, typename ...Ts>
+        hpx::future<std::vector<hpx::id_type> >
+        bulk_create(std::size_t count, Ts const&... vs) const
+        {
+            typedef std::vector<hpx::id_type> result_type;
+
+            if (localities_.empty())
+            {
+                return components::stub_base<Component>::bulk_create_async(
+                    hpx::find_here(), count, vs...);
+            }
+
+            std::vector<hpx::future<result_type> > objs;
+            objs.reserve(localities_.size());
+
+            for (std::size_t i = 0; i != localities_.size(); ++i)
+            {
+                std::size_t num_items = get_num_items(count, i);
+                if (num_items == 0)
+                    continue;
+
+                // the arguments are sent to each of the localities, they
+                // can't be forwarded
+                objs.push_back(
+                    components::stub_base<Component>::bulk_create_async(
+                        localities_[i], num_items, vs...));
+            }
+
+            return hpx::when_all(objs).then(
+                [count](hpx::future<std::vector<hpx::future<result_type> > >
+                    && f) -> result_type
+                {
+                    std::vector<hpx::future<result_type> > parts = f.get();
+
+                    result_type result;
+                    result.reserve(count);
+                    for (hpx::future<result_type>& part : parts)
+                    {
+                        result_type ids = part.get();
+                        result.insert(result.end(), ids.begin(), ids.end());
+                    }
+                    return result;
+                });
+        }
+
+        /// \cond NOINTERNAL
+        std::size_t get_num_localities() const
+        {
+            return localities_.empty() ? std::size_t(1) : localities_.size();
+        }
+        /// \endcond
+
+    protected:
+        /// \cond NOINTERNAL
+        default_distribution_policy(std::vector<id_type> const& localities)
+          : localities_(localities)
+        {}
+
+        default_distribution_policy(id_type const& locality)
+        {
+            localities_.push_back(locality);
+        }
+
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned int const)
+        {
+            ar & localities_;
+        }
+
+        std::vector<id_type> localities_;   // localities to create things on
+        /// \endcond
+    };
+
+    /// A predefined instance of the default \a distribution_policy. It will
+    /// represent the local locality and will place all items to create here.
+    static default_distribution_policy const default_layout =
+        default_distribution_policy();
+}}
+
+namespace hpx { namespace traits
+{
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Policy>
+    struct is_distribution_policy
+      : boost::mpl::false_
+    {};
+
+    template <typename Policy>
+    struct is_distribution_policy<Policy const>
+      : is_distribution_policy<Policy>
+    {};
+
+    template <>
+    struct is_distribution_policy<components::default_distribution_policy>
+      : boost::mpl::true_
+    {};
+}}
+
+namespace hpx
+{
+    using hpx::components::default_distribution_policy;
+    using hpx::components::default_layout;
+}
+
+#endif
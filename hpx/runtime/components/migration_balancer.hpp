@@ -0,0 +1,475 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file migration_balancer.hpp
+
+#if !defined(HPX_RUNTIME_COMPONENTS_MIGRATION_BALANCER_OCT_05_2015_1012AM)
+#define HPX_RUNTIME_COMPONENTS_MIGRATION_BALANCER_OCT_05_2015_1012AM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/local/condition_variable.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/lcos/wait_all.hpp>
+#include <hpx/performance_counters/performance_counter.hpp>
+#include <hpx/runtime/actions/plain_action.hpp>
+#include <hpx/runtime/components/migrate_component.hpp>
+#include <hpx/runtime/get_ptr.hpp>
+#include <hpx/runtime/naming/name.hpp>
+#include <hpx/util/bind.hpp>
+#include <hpx/util/interval_timer.hpp>
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+namespace hpx { namespace components
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// The load of a locality as seen by a \a migration_balancer
+    struct locality_load
+    {
+        naming::id_type locality_;
+        double idle_rate_;              ///< idle rate in percent
+    };
+
+    /// The load caused by a component as seen by a \a migration_balancer
+    struct component_load
+    {
+        naming::id_type id_;
+        naming::id_type locality_;      ///< where the object currently lives
+        boost::uint64_t invocations_;   ///< actions invoked since last round
+    };
+
+    /// A list of migrations, each pairing the object to migrate with the
+    /// locality it should be migrated to.
+    typedef std::vector<std::pair<naming::id_type, naming::id_type> >
+        migration_list;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The default policy used by \a migration_balancer. It moves the most
+    /// frequently invoked objects from the busiest locality (the one with the
+    /// lowest idle rate) to the least busy one.
+    ///
+    /// Any other policy has to expose the same function call operator.
+    class idle_rate_migration_policy
+    {
+    public:
+        /// \param threshold       [in] Objects are migrated only if the idle
+        ///                        rates of the busiest and the least busy
+        ///                        locality differ by more than this (in
+        ///                        percent).
+        /// \param max_migrations  [in] The maximal number of objects to
+        ///                        migrate in one round.
+        /// \param cooldown        [in] The number of rounds an object is not
+        ///                        considered for migration after it was
+        ///                        migrated.
+        idle_rate_migration_policy(double threshold = 20.0,
+                std::size_t max_migrations = 1, std::size_t cooldown = 3)
+          : threshold_(threshold), max_migrations_(max_migrations),
+            cooldown_(cooldown), round_(0)
+        {}
+
+        migration_list operator()(std::vector<locality_load> const& localities,
+            std::vector<component_load> const& components)
+        {
+            ++round_;
+
+            migration_list result;
+            if (localities.size() < 2)
+                return result;
+
+            std::vector<locality_load>::const_iterator busiest =
+                std::min_element(localities.begin(), localities.end(),
+                    &idle_rate_less);
+            std::vector<locality_load>::const_iterator idlest =
+                std::max_element(localities.begin(), localities.end(),
+                    &idle_rate_less);
+
+            // don't move anything if the load is sufficiently balanced
+            if (idlest->idle_rate_ - busiest->idle_rate_ <= threshold_)
+                return result;
+
+            // consider the hottest objects on the busiest locality which
+            // have not been migrated recently
+            std::vector<component_load> candidates;
+            for (component_load const& c : components)
+            {
+                if (c.locality_ != busiest->locality_ || c.invocations_ == 0)
+                    continue;
+
+                std::map<naming::gid_type, std::size_t>::const_iterator it =
+                    last_migrated_.find(c.id_.get_gid());
+                if (it != last_migrated_.end() &&
+                        round_ - it->second <= cooldown_)
+                {
+                    continue;
+                }
+                candidates.push_back(c);
+            }
+
+            std::sort(candidates.begin(), candidates.end(),
+                &invocations_greater);
+
+            std::size_t count = (std::min)(max_migrations_, candidates.size());
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                result.push_back(
+                    std::make_pair(candidates[i].id_, idlest->locality_));
+                last_migrated_[candidates[i].id_.get_gid()] = round_;
+            }
+            return result;
+        }
+
+    private:
+        static bool idle_rate_less(locality_load const& lhs,
+            locality_load const& rhs)
+        {
+            return lhs.idle_rate_ < rhs.idle_rate_;
+        }
+
+        static bool invocations_greater(component_load const& lhs,
+            component_load const& rhs)
+        {
+            return lhs.invocations_ > rhs.invocations_;
+        }
+
+        double threshold_;
+        std::size_t max_migrations_;
+        std::size_t cooldown_;
+        std::size_t round_;
+        std::map<naming::gid_type, std::size_t> last_migrated_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace server
+    {
+        // This will be executed on the locality where the given objects
+        // live, it returns (and resets) their invocation counts.
+        template <typename Component>
+        std::vector<boost::uint64_t> get_invocation_counts(
+            std::vector<naming::id_type> const& ids)
+        {
+            std::vector<future<boost::shared_ptr<Component> > > ptrs;
+            ptrs.reserve(ids.size());
+            for (naming::id_type const& id : ids)
+                ptrs.push_back(get_ptr<Component>(id));
+
+            wait_all(ptrs);
+
+            std::vector<boost::uint64_t> counts;
+            counts.reserve(ids.size());
+            for (future<boost::shared_ptr<Component> >& f : ptrs)
+            {
+                // objects which were migrated in the meantime are ignored
+                if (f.has_exception())
+                    counts.push_back(0);
+                else
+                    counts.push_back(f.get()->get_invocation_count(true));
+            }
+            return counts;
+        }
+
+        template <typename Component>
+        struct get_invocation_counts_action
+          : ::hpx::actions::action<
+                std::vector<boost::uint64_t> (*)(
+                    std::vector<naming::id_type> const&)
+              , &get_invocation_counts<Component>
+              , get_invocation_counts_action<Component> >
+        {};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A migration_balancer periodically samples the idle rates of the given
+    /// localities (using the /threads{locality#N/total}/idle-rate counters)
+    /// and the number of actions invoked on each of the objects it manages.
+    /// The policy decides which of the objects to migrate, the balancer
+    /// performs the migrations.
+    ///
+    /// \tparam Component  The (server) component type of the managed
+    ///                    objects, it has to support migration.
+    /// \tparam Policy     The policy deciding which objects to migrate.
+    ///
+    /// \note The idle-rate counters are available only if HPX was configured
+    ///       with HPX_THREAD_MAINTAIN_IDLE_RATES=On. Without them no objects
+    ///       will be migrated.
+    template <typename Component,
+        typename Policy = idle_rate_migration_policy>
+    class migration_balancer : boost::noncopyable
+    {
+    private:
+        typedef lcos::local::spinlock mutex_type;
+
+    public:
+        /// \param localities      [in] The localities to balance the load
+        ///                        between.
+        /// \param interval        [in] The time between two balancing
+        ///                        rounds (in microseconds).
+        /// \param policy          [in] The policy deciding which objects to
+        ///                        migrate.
+        migration_balancer(std::vector<naming::id_type> const& localities,
+                boost::int64_t interval, Policy const& policy = Policy())
+          : active_rounds_(0), stopped_(false),
+            localities_(localities), policy_(policy),
+            timer_(util::bind(&migration_balancer::evaluate, this),
+                interval, "migration_balancer", true)
+        {
+            for (naming::id_type const& locality : localities_)
+            {
+                std::string name = "/threads{locality#" +
+                    boost::lexical_cast<std::string>(
+                        naming::get_locality_id_from_id(locality)) +
+                    "/total}/idle-rate";
+                counters_.push_back(performance_counters::performance_counter(
+                    name));
+            }
+        }
+
+        ~migration_balancer()
+        {
+            {
+                mutex_type::scoped_lock l(mtx_);
+                stopped_ = true;
+            }
+            timer_.stop();
+
+            // wait for the balancing rounds which are still running, those
+            // access this object
+            mutex_type::scoped_lock l(mtx_);
+            while (active_rounds_ != 0)
+                rounds_done_.wait(l);
+        }
+
+        /// Add an object to the set of objects this balancer may migrate
+        void add(naming::id_type const& id)
+        {
+            mutex_type::scoped_lock l(mtx_);
+            ids_.push_back(id);
+        }
+
+        /// Remove an object from the set of objects this balancer may migrate
+        void remove(naming::id_type const& id)
+        {
+            mutex_type::scoped_lock l(mtx_);
+            ids_.erase(std::remove(ids_.begin(), ids_.end(), id), ids_.end());
+        }
+
+        /// Start balancing the load periodically
+        bool start()
+        {
+            return timer_.start(false);
+        }
+
+        /// Stop balancing the load periodically
+        bool stop()
+        {
+            return timer_.stop();
+        }
+
+        /// Perform one balancing round
+        ///
+        /// \returns The number of objects which were migrated.
+        std::size_t rebalance_sync()
+        {
+            std::vector<naming::id_type> ids;
+            {
+                mutex_type::scoped_lock l(mtx_);
+                ids = ids_;
+            }
+
+            std::vector<locality_load> loads;
+            if (!get_locality_loads(loads))
+                return 0;
+
+            std::vector<component_load> components;
+            get_component_loads(ids, components);
+
+            migration_list migrations;
+            {
+                mutex_type::scoped_lock l(mtx_);
+                migrations = policy_(loads, components);
+            }
+
+            std::vector<future<naming::id_type> > migrated;
+            migrated.reserve(migrations.size());
+            for (std::pair<naming::id_type, naming::id_type> const& m :
+                migrations)
+            {
+                migrated.push_back(migrate<Component>(m.first, m.second));
+            }
+
+            wait_all(migrated);
+
+            std::size_t count = 0;
+            for (future<naming::id_type>& f : migrated)
+            {
+                if (!f.has_exception())
+                    ++count;
+            }
+            return count;
+        }
+
+        /// Asynchronously perform one balancing round
+        future<std::size_t> rebalance()
+        {
+            {
+                mutex_type::scoped_lock l(mtx_);
+                ++active_rounds_;
+            }
+            return hpx::async(
+                util::bind(&migration_balancer::rebalance_round, this));
+        }
+
+    protected:
+        // Marks the end of a balancing round which was started
+        // asynchronously, the destructor waits for all of those.
+        struct round_guard
+        {
+            round_guard(migration_balancer& balancer)
+              : balancer_(balancer)
+            {}
+
+            ~round_guard()
+            {
+                mutex_type::scoped_lock l(balancer_.mtx_);
+                if (--balancer_.active_rounds_ == 0)
+                    balancer_.rounds_done_.notify_all();
+            }
+
+            migration_balancer& balancer_;
+        };
+
+        std::size_t rebalance_round()
+        {
+            round_guard g(*this);
+            return rebalance_sync();
+        }
+
+        bool evaluate()
+        {
+            {
+                mutex_type::scoped_lock l(mtx_);
+                if (stopped_)
+                    return false;
+                ++active_rounds_;
+            }
+
+            rebalance_round();
+            return true;        // keep running
+        }
+
+        // sample the idle rates of all localities, return false if those
+        // are not available
+        bool get_locality_loads(std::vector<locality_load>& loads)
+        {
+            std::vector<future<double> > values;
+            values.reserve(counters_.size());
+            for (performance_counters::performance_counter& c : counters_)
+                values.push_back(c.get_value<double>(true));
+
+            wait_all(values);
+
+            loads.reserve(values.size());
+            for (std::size_t i = 0; i != values.size(); ++i)
+            {
+                if (values[i].has_exception())
+                    return false;
+
+                // the idle-rate counters are reported in 0.01%
+                locality_load load = { localities_[i], values[i].get() / 100 };
+                loads.push_back(load);
+            }
+            return true;
+        }
+
+        // sample the invocation counts of all managed objects
+        void get_component_loads(std::vector<naming::id_type> const& ids,
+            std::vector<component_load>& components)
+        {
+            std::vector<future<naming::id_type> > localities;
+            localities.reserve(ids.size());
+            for (naming::id_type const& id : ids)
+                localities.push_back(hpx::get_colocation_id(id));
+
+            wait_all(localities);
+
+            // group the objects by the locality they currently live on
+            typedef std::pair<naming::id_type, std::vector<std::size_t> >
+                group_type;
+            std::map<boost::uint32_t, group_type> groups;
+            for (std::size_t i = 0; i != ids.size(); ++i)
+            {
+                if (localities[i].has_exception())
+                    continue;
+
+                naming::id_type locality = localities[i].get();
+                group_type& g =
+                    groups[naming::get_locality_id_from_id(locality)];
+                g.first = locality;
+                g.second.push_back(i);
+            }
+
+            typedef server::get_invocation_counts_action<Component>
+                action_type;
+
+            std::vector<future<std::vector<boost::uint64_t> > > counts;
+            counts.reserve(groups.size());
+            for (auto const& g : groups)
+            {
+                std::vector<naming::id_type> group_ids;
+                group_ids.reserve(g.second.second.size());
+                for (std::size_t i : g.second.second)
+                    group_ids.push_back(ids[i]);
+
+                counts.push_back(hpx::async<action_type>(
+                    g.second.first, std::move(group_ids)));
+            }
+
+            wait_all(counts);
+
+            std::size_t j = 0;
+            for (auto const& g : groups)
+            {
+                future<std::vector<boost::uint64_t> >& f = counts[j++];
+                if (f.has_exception())
+                    continue;
+
+                std::vector<boost::uint64_t> c = f.get();
+                for (std::size_t k = 0; k != c.size(); ++k)
+                {
+                    component_load load =
+                        { ids[g.second.second[k]], g.second.first, c[k] };
+                    components.push_back(load);
+                }
+            }
+        }
+
+    private:
+        mutable mutex_type mtx_;
+        lcos::local::condition_variable rounds_done_;
+        std::size_t active_rounds_;     // number of rounds in flight
+        bool stopped_;
+
+        std::vector<naming::id_type> ids_;
+        std::vector<naming::id_type> localities_;
+        std::vector<performance_counters::performance_counter> counters_;
+        Policy policy_;
+        util::interval_timer timer_;
+    };
+}}
+
+HPX_REGISTER_PLAIN_ACTION_TEMPLATE(
+    (template <typename Component>),
+    (hpx::components::server::get_invocation_counts_action<Component>))
+
+#endif
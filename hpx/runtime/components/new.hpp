@@ -11,9 +11,17 @@
 #include <hpx/hpx_fwd.hpp>
 #include <hpx/runtime/naming/name.hpp>
 #include <hpx/runtime/components/stubs/stub_base.hpp>
+#include <hpx/runtime/components/default_distribution_policy.hpp>
 #include <hpx/util/move.hpp>
 #include <hpx/traits/is_component.hpp>
 
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include <boost/mpl/bool.hpp>
+#include <boost/utility/enable_if.hpp>
+
 namespace hpx { namespace components
 {
 #if defined(DOXYGEN)
@@ -60,6 +68,51 @@ namespace hpx { namespace components
     template <typename Component, typename ArgN, ...>
     hpx::future<hpx::id_type>
     new_colocated(hpx::id_type const& id, Arg0 argN, ...);
+
+    /// \brief Create multiple new instances of the given Component type on
+    ///        the specified locality.
+    ///
+    /// This function creates \a count new instances of the given Component
+    /// type (the template argument is specified as Component[]) using a
+    /// single creation action sent to the specified locality.
+    ///
+    /// \param locality  [in] The global address of the locality where the
+    ///                  new instances should be created on.
+    /// \param count     [in] The number of component instances to create
+    /// \param argN      [in] Any number of arbitrary arguments (passed by
+    ///                  value, by const reference or by rvalue reference)
+    ///                  which will be forwarded to the constructor of
+    ///                  each of the created component instances.
+    ///
+    /// \returns The function returns an \a hpx::future object instance
+    ///          which can be used to retrieve the global addresses of the
+    ///          newly created components.
+    template <typename Component, typename ArgN, ...>
+    hpx::future<std::vector<hpx::id_type> >
+    new_(hpx::id_type const& locality, std::size_t count, Arg0 argN, ...);
+
+    /// \brief Create multiple new instances of the given Component type on
+    ///        the localities represented by the given distribution policy.
+    ///
+    /// This function creates \a count new instances of the given Component
+    /// type (the template argument is specified as Component[]) which are
+    /// distributed as specified by the given policy. Exactly one creation
+    /// action is sent to each of the target localities.
+    ///
+    /// \param policy    [in] The distribution policy used to decide where
+    ///                  the new instances should be created on.
+    /// \param count     [in] The number of component instances to create
+    /// \param argN      [in] Any number of arbitrary arguments (passed by
+    ///                  value or by const reference) which will be passed
+    ///                  to the constructor of each of the created component
+    ///                  instances.
+    ///
+    /// \returns The function returns an \a hpx::future object instance
+    ///          which can be used to retrieve the global addresses of the
+    ///          newly created components, ordered by target locality.
+    template <typename Component, typename DistPolicy, typename ArgN, ...>
+    hpx::future<std::vector<hpx::id_type> >
+    new_(DistPolicy const& policy, std::size_t count, Arg0 argN, ...);
 #else
     template <typename Component, typename ...Ts>
     inline typename boost::enable_if<
@@ -80,6 +133,46 @@ namespace hpx { namespace components
         return components::stub_base<Component>::create_colocated_async(id,
             std::forward<Ts>(vs)...);
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \cond NOINTERNAL
+    namespace detail
+    {
+        template <typename Component>
+        struct is_component_array
+          : boost::mpl::false_
+        {};
+
+        template <typename Component>
+        struct is_component_array<Component[]>
+          : traits::is_component<Component>
+        {};
+    }
+    /// \endcond
+
+    template <typename Component, typename ...Ts>
+    inline typename boost::enable_if<
+        detail::is_component_array<Component>,
+        lcos::future<std::vector<naming::id_type> >
+    >::type
+    new_(id_type const& locality, std::size_t count, Ts&&... vs)
+    {
+        typedef typename std::remove_extent<Component>::type component_type;
+        return components::stub_base<component_type>::bulk_create_async(
+            locality, count, std::forward<Ts>(vs)...);
+    }
+
+    template <typename Component, typename DistPolicy, typename ...Ts>
+    inline typename boost::enable_if_c<
+        detail::is_component_array<Component>::value &&
+            traits::is_distribution_policy<DistPolicy>::value,
+        lcos::future<std::vector<naming::id_type> >
+    >::type
+    new_(DistPolicy const& policy, std::size_t count, Ts const&... vs)
+    {
+        typedef typename std::remove_extent<Component>::type component_type;
+        return policy.template bulk_create<component_type>(count, vs...);
+    }
 #endif // !defined(DOXYGEN)
 }}
 
@@ -9,6 +9,9 @@
 #include <hpx/hpx_fwd.hpp>
 #include <hpx/lcos/local/spinlock.hpp>
 
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+
 namespace hpx { namespace components
 {
     /// This hook has to be inserted into the derivation chain of any component
@@ -26,6 +29,7 @@ namespace hpx { namespace components
         migration_support(Arg &&... arg)
           : base_type(std::forward<Arg>(arg)...)
           , pin_count_(0)
+          , invocation_count_(0)
         {}
 
         ~migration_support()
@@ -57,6 +61,17 @@ namespace hpx { namespace components
             typename mutex_type::scoped_lock l(mtx_);
             return pin_count_;
         }
+
+        /// Return the number of actions invoked on this object, this is
+        /// used to decide which objects should be migrated when balancing
+        /// the load (see \a migration_balancer).
+        boost::uint64_t get_invocation_count(bool reset = false)
+        {
+            if (reset)
+                return invocation_count_.exchange(0);
+            return invocation_count_.load();
+        }
+
         void mark_as_migrated()
         {
             typename mutex_type::scoped_lock l(mtx_);
@@ -101,12 +116,14 @@ namespace hpx { namespace components
             threads::thread_function_type f)
         {
             scoped_pinner sp(*this);
+            ++invocation_count_;
             return f(state);
         }
 
     private:
         mutable mutex_type mtx_;
         boost::uint32_t pin_count_;
+        boost::atomic<boost::uint64_t> invocation_count_;
     };
 }}
 
@@ -0,0 +1,123 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_RUNTIME_THREADS_EXECUTORS_NUMA_EXECUTOR_AUG_03_2015_0312PM)
+#define HPX_RUNTIME_THREADS_EXECUTORS_NUMA_EXECUTOR_AUG_03_2015_0312PM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/runtime/threads/thread_executor.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace threads { namespace executors
+{
+    namespace detail
+    {
+        class HPX_EXPORT numa_executor
+          : public threads::detail::scheduled_executor_base
+        {
+        public:
+            numa_executor(thread_priority priority,
+                thread_stacksize stacksize);
+
+            // Schedule the specified function for execution in this executor.
+            // Depending on the subclass implementation, this may block in some
+            // situations.
+            void add(closure_type && f, char const* description,
+                threads::thread_state_enum initial_state, bool run_now,
+                threads::thread_stacksize stacksize, error_code& ec);
+
+            // Schedule given function for execution in this executor no sooner
+            // than time abs_time. This call never blocks, and may violate
+            // bounds on the executor's queue size.
+            void add_at(
+                boost::chrono::steady_clock::time_point const& abs_time,
+                closure_type && f, char const* description,
+                threads::thread_stacksize stacksize, error_code& ec);
+
+            // Schedule given function for execution in this executor no sooner
+            // than time rel_time from now. This call never blocks, and may
+            // violate bounds on the executor's queue size.
+            inline void add_after(
+                boost::chrono::steady_clock::duration const& rel_time,
+                closure_type && f, char const* description,
+                threads::thread_stacksize stacksize, error_code& ec)
+            {
+                return add_at(boost::chrono::steady_clock::now() + rel_time,
+                    std::move(f), description, stacksize, ec);
+            }
+
+            // Return an estimate of the number of waiting tasks.
+            boost::uint64_t num_pending_closures(error_code& ec) const;
+
+            // Start assigning tasks from the first worker thread again.
+            void reset();
+
+            // Return the worker thread the n-th scheduled task is bound to.
+            std::size_t get_worker_thread(std::size_t n) const
+            {
+                return workers_[n % workers_.size()];
+            }
+
+        protected:
+            // Return the requested policy element
+            std::size_t get_policy_element(
+                threads::detail::executor_parameter p, error_code& ec) const;
+
+            std::size_t next_worker_thread();
+
+        private:
+            thread_stacksize stacksize_;
+            thread_priority priority_;
+
+            // worker threads, grouped by the NUMA domain they are running on
+            std::vector<std::size_t> workers_;
+            boost::atomic<std::size_t> next_;
+        };
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The numa_executor binds the n-th task scheduled through it to the
+    /// worker thread (n % num_worker_threads), where the worker threads are
+    /// ordered by the NUMA domain they are running on. Parallel algorithms
+    /// which are invoked repeatedly using the same executor and the same
+    /// (explicit) chunk size will therefore run each chunk on the same
+    /// worker thread, and consequently touch the same memory from the same
+    /// NUMA domain, every time. Use \a reset() before each invocation to
+    /// restart the assignment with the first worker thread.
+    struct numa_executor : public scheduled_executor
+    {
+        numa_executor(thread_priority priority = thread_priority_default,
+                thread_stacksize stacksize = thread_stacksize_default)
+          : scheduled_executor(new detail::numa_executor(priority, stacksize))
+        {}
+
+        /// Restart assigning tasks with the first worker thread.
+        void reset()
+        {
+            get_impl().reset();
+        }
+
+        /// Return the worker thread the \a n-th scheduled task is bound to.
+        std::size_t get_worker_thread(std::size_t n) const
+        {
+            return get_impl().get_worker_thread(n);
+        }
+
+    private:
+        detail::numa_executor& get_impl() const
+        {
+            return *static_cast<detail::numa_executor*>(executor_data_.get());
+        }
+    };
+}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
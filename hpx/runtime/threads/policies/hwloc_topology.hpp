@@ -127,6 +127,9 @@ namespace hpx { namespace threads
         mask_type get_cpubind_mask(error_code& ec = throws) const;
         mask_type get_cpubind_mask(boost::thread & handle, error_code& ec = throws) const;
 
+        void* allocate(std::size_t len) const;
+        void deallocate(void* addr, std::size_t len) const;
+
         ///////////////////////////////////////////////////////////////////////
         std::size_t get_number_of_sockets() const;
         std::size_t get_number_of_numa_nodes() const;
@@ -184,6 +184,16 @@ public:
     {
     }
 
+    void* allocate(std::size_t len) const
+    {
+        return ::operator new(len);
+    }
+
+    void deallocate(void* addr, std::size_t) const
+    {
+        ::operator delete(addr);
+    }
+
     struct noop_topology_tag {};
 
     void write_to_log() const {}
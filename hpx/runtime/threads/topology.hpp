@@ -313,6 +313,14 @@ namespace hpx { namespace threads
         virtual mask_type get_cpubind_mask(boost::thread & handle,
             error_code& ec = throws) const = 0;
 
+        /// \brief Allocate page aligned memory which has not been touched
+        ///        yet. The physical pages will be placed on the NUMA domain
+        ///        of the processing unit which first writes to them.
+        virtual void* allocate(std::size_t len) const = 0;
+
+        /// \brief Free memory which was allocated using \a allocate
+        virtual void deallocate(void* addr, std::size_t len) const = 0;
+
         virtual void write_to_log() const = 0;
     };
 
@@ -0,0 +1,360 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_UTIL_SIZE_CLASS_MEMORY_POOL_HPP
+#define HPX_UTIL_SIZE_CLASS_MEMORY_POOL_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/traits.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/runtime/threads/topology.hpp>
+#include <hpx/traits/is_chunk_allocator.hpp>
+#include <hpx/util/memory_chunk_pool_allocator.hpp>
+
+#include <cstdlib>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include <boost/atomic.hpp>
+#include <boost/lockfree/stack.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+// forward declare pool
+namespace hpx { namespace util
+{
+    struct default_memory_registration;
+
+    template <typename Registration>
+    struct size_class_memory_pool;
+}}
+
+// specialize chunk pool allocator traits for this size_class_memory_pool
+namespace hpx { namespace traits
+{
+    template <typename T, typename R, typename M>
+    struct is_chunk_allocator<
+            util::detail::memory_chunk_pool_allocator<
+                T, util::size_class_memory_pool<R>, M
+            >
+        >
+      : boost::mpl::true_
+    {};
+}}
+
+namespace hpx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The registration policy is invoked for every block of memory the pool
+    // acquires from (or releases to) the system. Parcelports which require
+    // their buffers to be pinned or registered with the network hardware
+    // (or placed into a shared memory segment) provide their own policy
+    // exposing the same two functions.
+    struct default_memory_registration
+    {
+        void register_memory(char*, std::size_t) {}
+        void deregister_memory(char*, std::size_t) {}
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Scalable alternative to memory_chunk_pool. Requests up to chunk_size_
+    // bytes are rounded up to the next power of two and served from the
+    // corresponding size class: first from a small cache owned by the
+    // calling worker thread, then from a lock-free freelist shared by all
+    // threads. Only if both are empty a new slab of blocks is acquired (and
+    // registered). Larger requests are forwarded to the system directly.
+    template <typename Registration = default_memory_registration>
+    struct size_class_memory_pool : boost::noncopyable
+    {
+        typedef std::size_t size_type;
+        typedef Registration registration_type;
+
+        enum
+        {
+            min_block_size = 64,        // smallest size class
+            thread_cache_size = 16,     // cached blocks per thread and class
+            blocks_per_slab = 16,       // blocks acquired at once
+            page_size = 4096            // alignment of all acquired memory
+        };
+
+        size_class_memory_pool(std::size_t chunk_size, std::size_t max_chunks,
+                Registration const& registration = Registration(),
+                std::size_t num_threads = threads::hardware_concurrency())
+          : chunk_size_(block_size(size_class(chunk_size)))
+          , num_classes_(size_class(chunk_size) + 1)
+          , thread_caches_(num_threads)
+          , registration_(registration)
+          , allocations_(0)
+          , freelist_hits_(0)
+          , slab_allocations_(0)
+          , fallback_allocations_(0)
+        {
+            freelists_.reserve(num_classes_);
+            for (std::size_t i = 0; i != num_classes_; ++i)
+            {
+                freelists_.push_back(
+                    boost::shared_ptr<freelist_type>(
+                        new freelist_type(max_chunks)));
+            }
+
+            for (thread_cache& c : thread_caches_)
+            {
+                c.counts_.resize(num_classes_, 0);
+                c.blocks_.resize(num_classes_ * thread_cache_size, 0);
+            }
+        }
+
+        ~size_class_memory_pool()
+        {
+            // all blocks are owned by the slabs, release those
+            for (slab_type& slab : slabs_)
+            {
+                registration_.deregister_memory(slab.first, slab.second);
+                free_memory(slab.first);
+            }
+        }
+
+        std::pair<char *, size_type> get_chunk_address(char * p, size_type size)
+        {
+            if (size > chunk_size_)
+                return std::make_pair(p, size);
+            return std::make_pair(p, block_size(size_class(size)));
+        }
+
+        char *allocate(size_type size)
+        {
+            if (size > chunk_size_)
+            {
+                ++fallback_allocations_;
+
+                char* p = allocate_memory(size);
+                registration_.register_memory(p, size);
+                return p;
+            }
+
+            std::size_t cls = size_class(size);
+
+            std::size_t thread_num = hpx::get_worker_thread_num();
+            if (thread_num < thread_caches_.size())
+            {
+                thread_cache& c = thread_caches_[thread_num];
+                c.allocations_.store(c.allocations_.load(
+                    boost::memory_order_relaxed) + 1,
+                    boost::memory_order_relaxed);
+
+                if (c.counts_[cls] != 0)
+                {
+                    c.hits_.store(c.hits_.load(
+                        boost::memory_order_relaxed) + 1,
+                        boost::memory_order_relaxed);
+                    return c.blocks_[cls * thread_cache_size + --c.counts_[cls]];
+                }
+            }
+            else
+            {
+                ++allocations_;
+            }
+
+            char* p = 0;
+            if (freelists_[cls]->pop(p))
+            {
+                ++freelist_hits_;
+                return p;
+            }
+
+            return allocate_slab(cls);
+        }
+
+        void deallocate(char * p, size_type size)
+        {
+            if (0 == p)
+                return;
+
+            if (size > chunk_size_)
+            {
+                registration_.deregister_memory(p, size);
+                free_memory(p);
+                return;
+            }
+
+            std::size_t cls = size_class(size);
+
+            std::size_t thread_num = hpx::get_worker_thread_num();
+            if (thread_num < thread_caches_.size())
+            {
+                thread_cache& c = thread_caches_[thread_num];
+                if (c.counts_[cls] != thread_cache_size)
+                {
+                    c.blocks_[cls * thread_cache_size + c.counts_[cls]++] = p;
+                    return;
+                }
+            }
+
+            freelists_[cls]->push(p);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // statistics
+        std::size_t get_allocation_count() const
+        {
+            std::size_t result = allocations_.load(boost::memory_order_relaxed);
+            for (thread_cache const& c : thread_caches_)
+                result += c.allocations_.load(boost::memory_order_relaxed);
+            return result + fallback_allocations_.load(boost::memory_order_relaxed);
+        }
+
+        // number of requests served from the cache of the calling thread
+        std::size_t get_thread_cache_hit_count() const
+        {
+            std::size_t result = 0;
+            for (thread_cache const& c : thread_caches_)
+                result += c.hits_.load(boost::memory_order_relaxed);
+            return result;
+        }
+
+        // number of requests served from the shared freelists
+        std::size_t get_freelist_hit_count() const
+        {
+            return freelist_hits_.load(boost::memory_order_relaxed);
+        }
+
+        // number of requests which required acquiring a new slab
+        std::size_t get_slab_allocation_count() const
+        {
+            return slab_allocations_.load(boost::memory_order_relaxed);
+        }
+
+        // number of requests too large to be served by any size class
+        std::size_t get_fallback_allocation_count() const
+        {
+            return fallback_allocations_.load(boost::memory_order_relaxed);
+        }
+
+        // fraction of requests served without acquiring memory from the
+        // system
+        double get_hit_rate() const
+        {
+            std::size_t allocations = get_allocation_count();
+            if (allocations == 0)
+                return 1.0;
+            return double(get_thread_cache_hit_count() +
+                get_freelist_hit_count()) / double(allocations);
+        }
+
+        Registration& get_registration()
+        {
+            return registration_;
+        }
+
+    private:
+        typedef boost::lockfree::stack<char*> freelist_type;
+        typedef std::pair<char*, std::size_t> slab_type;
+
+        // Only the worker thread owning a cache accesses its blocks, the
+        // counters are atomic to allow reading the statistics concurrently.
+        struct thread_cache
+        {
+            thread_cache()
+              : allocations_(0), hits_(0)
+            {}
+
+            thread_cache(thread_cache const& rhs)
+              : counts_(rhs.counts_), blocks_(rhs.blocks_)
+              , allocations_(rhs.allocations_.load())
+              , hits_(rhs.hits_.load())
+            {}
+
+            std::vector<std::size_t> counts_;
+            std::vector<char*> blocks_;
+            boost::atomic<std::size_t> allocations_;
+            boost::atomic<std::size_t> hits_;
+
+            // avoid false sharing between the caches of different threads
+            char pad_[64];
+        };
+
+        static std::size_t size_class(std::size_t size)
+        {
+            std::size_t cls = 0;
+            for (std::size_t s = min_block_size; s < size; s <<= 1)
+                ++cls;
+            return cls;
+        }
+
+        static std::size_t block_size(std::size_t cls)
+        {
+            return std::size_t(min_block_size) << cls;
+        }
+
+        static char* allocate_memory(std::size_t size)
+        {
+#if _POSIX_SOURCE
+            void* result = 0;
+            if (posix_memalign(&result, page_size, size) != 0 || !result)
+                throw std::bad_alloc();
+            return static_cast<char*>(result);
+#else
+            return new char[size];
+#endif
+        }
+
+        static void free_memory(char* p)
+        {
+#if _POSIX_SOURCE
+            free(p);
+#else
+            delete[] p;
+#endif
+        }
+
+        // acquire and register a new slab of blocks for the given size
+        // class, return its first block and make the others available
+        char* allocate_slab(std::size_t cls)
+        {
+            ++slab_allocations_;
+
+            std::size_t size = block_size(cls);
+            std::size_t slab_size = size * blocks_per_slab;
+
+            char* slab = allocate_memory(slab_size);
+            registration_.register_memory(slab, slab_size);
+
+            {
+                mutex_type::scoped_lock l(slabs_mtx_);
+                slabs_.push_back(slab_type(slab, slab_size));
+            }
+
+            for (std::size_t i = 1; i != blocks_per_slab; ++i)
+                freelists_[cls]->push(slab + i * size);
+
+            return slab;
+        }
+
+    public:
+        // largest request served from the size classes
+        std::size_t const chunk_size_;
+
+    private:
+        typedef lcos::local::spinlock mutex_type;
+
+        std::size_t const num_classes_;
+        std::vector<boost::shared_ptr<freelist_type> > freelists_;
+        std::vector<thread_cache> thread_caches_;
+
+        Registration registration_;
+
+        mutable mutex_type slabs_mtx_;
+        std::vector<slab_type> slabs_;
+
+        boost::atomic<std::size_t> allocations_;
+        boost::atomic<std::size_t> freelist_hits_;
+        boost::atomic<std::size_t> slab_allocations_;
+        boost::atomic<std::size_t> fallback_allocations_;
+    };
+}}
+
+#endif
@@ -30,7 +30,7 @@
 #include <hpx/plugins/parcelport/mpi/sender.hpp>
 #include <hpx/plugins/parcelport/mpi/receiver.hpp>
 
-#include <hpx/util/memory_chunk_pool.hpp>
+#include <hpx/util/size_class_memory_pool.hpp>
 #include <hpx/util/runtime_configuration.hpp>
 #include <hpx/util/safe_lexical_cast.hpp>
 
@@ -277,8 +277,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace mpi
         }
 
     private:
-        typedef util::memory_chunk_pool<> memory_pool_type;
-        typedef util::detail::memory_chunk_pool_allocator<char, util::memory_chunk_pool<>> allocator_type;
+        typedef util::size_class_memory_pool<> memory_pool_type;
+        typedef util::detail::memory_chunk_pool_allocator<char, memory_pool_type> allocator_type;
         typedef
             std::vector<char, allocator_type>
             data_type;
@@ -0,0 +1,17 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file src/components/containers/matrix/partition_matrix_component.cpp
+
+/// This file defines the necessary component boilerplate code which is
+/// required for proper functioning of components in the context of HPX.
+
+#include <hpx/include/components.hpp>
+
+#include <hpx/components/containers/matrix/partition_matrix_component.hpp>
+#include <hpx/components/containers/matrix/matrix.hpp>
+
+HPX_REGISTER_COMPONENT_MODULE();
+
@@ -0,0 +1,28 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/runtime/components/component_factory.hpp>
+#include <hpx/runtime/actions/continuation.hpp>
+#include <hpx/lcos/server/hierarchical_barrier.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Hierarchical barrier
+typedef hpx::components::simple_component<
+    hpx::lcos::server::hierarchical_barrier
+> hierarchical_barrier_type;
+
+HPX_REGISTER_MINIMAL_COMPONENT_FACTORY(hierarchical_barrier_type,
+    hierarchical_barrier)
+
+HPX_REGISTER_ACTION(
+    hpx::lcos::server::hierarchical_barrier::child_arrived_action,
+    hpx_lcos_server_hierarchical_barrier_child_arrived_action)
+HPX_REGISTER_ACTION(
+    hpx::lcos::server::hierarchical_barrier::release_action,
+    hpx_lcos_server_hierarchical_barrier_release_action)
+HPX_REGISTER_ACTION(
+    hpx::lcos::server::hierarchical_barrier::notify_action,
+    hpx_lcos_server_hierarchical_barrier_notify_action)
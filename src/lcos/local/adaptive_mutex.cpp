@@ -0,0 +1,209 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/exception.hpp>
+#include <hpx/lcos/local/adaptive_mutex.hpp>
+#include <hpx/performance_counters/manage_counter_type.hpp>
+#include <hpx/runtime/threads/thread_helpers.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+
+#include <algorithm>
+#include <string>
+
+#include <boost/make_shared.hpp>
+
+namespace hpx { namespace lcos { namespace local
+{
+    namespace
+    {
+        // The spin count estimate starts here and never exceeds the maximum
+        // number of iterations spent spinning before suspending.
+        std::size_t const initial_spin_count = 64;
+        std::size_t const min_spin_count = 16;
+        std::size_t const max_spin_count = 4096;
+
+        ///////////////////////////////////////////////////////////////////////
+        // The counters keep the statistics alive, even if the mutex is
+        // destroyed before the counter types are removed.
+        struct statistics_counter
+        {
+            typedef detail::adaptive_mutex_statistics statistics;
+            typedef boost::atomic<boost::int64_t> statistics::* value_type;
+
+            statistics_counter(boost::shared_ptr<statistics> const& stats,
+                    value_type value)
+              : stats_(stats), value_(value)
+            {}
+
+            boost::int64_t operator()(bool reset) const
+            {
+                return util::get_and_reset_value((*stats_).*value_, reset);
+            }
+
+            boost::shared_ptr<statistics> stats_;
+            value_type value_;
+        };
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    adaptive_mutex::adaptive_mutex(char const* const description,
+            bool collect_statistics)
+      : locked_(false), waiters_(0), spin_count_(initial_spin_count),
+        handoff_(false)
+    {
+        if (collect_statistics)
+            stats_ = boost::make_shared<detail::adaptive_mutex_statistics>();
+
+        HPX_ITT_SYNC_CREATE(this, "lcos::local::adaptive_mutex", description);
+        HPX_ITT_SYNC_RENAME(this, "lcos::local::adaptive_mutex");
+    }
+
+    adaptive_mutex::~adaptive_mutex()
+    {
+        HPX_ASSERT(waiters_.load() == 0);
+        HPX_ITT_SYNC_DESTROY(this);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Spin for twice the number of iterations it took to acquire the lock
+    // recently, if that does not succeed suspend this thread until the lock
+    // is handed over by its owner.
+    void adaptive_mutex::lock_contended()
+    {
+        boost::uint64_t start = 0;
+        if (stats_)
+        {
+            ++stats_->contentions_;
+            start = util::high_resolution_clock::now();
+        }
+
+        std::size_t const limit = (std::min)(
+            2 * spin_count_.load(boost::memory_order_relaxed) + min_spin_count,
+            max_spin_count);
+
+        bool acquired = false;
+        std::size_t k = 0;
+        for (/**/; k != limit; ++k)
+        {
+            if (!locked_.load(boost::memory_order_relaxed) && try_acquire())
+            {
+                acquired = true;
+                break;
+            }
+#if defined(BOOST_SMT_PAUSE)
+            BOOST_SMT_PAUSE
+#endif
+        }
+        adjust_spin_count(k, acquired);
+
+        if (!acquired)
+        {
+            HPX_ASSERT(threads::get_self_ptr() != 0);
+
+            mutex_type::scoped_lock l(mtx_);
+
+            // announce this thread before trying again, an unlocking thread
+            // either sees it waiting or we see the lock released
+            ++waiters_;
+            while (!try_acquire())
+            {
+                if (stats_)
+                    ++stats_->suspensions_;
+
+                cond_.wait(l, "adaptive_mutex::lock");
+
+                // the previous owner may have passed the lock on directly
+                if (handoff_)
+                {
+                    handoff_ = false;
+                    break;
+                }
+            }
+            --waiters_;
+        }
+
+        if (stats_)
+        {
+            stats_->wait_time_ += static_cast<boost::int64_t>(
+                util::high_resolution_clock::now() - start);
+        }
+    }
+
+    // There are waiting threads, hand the lock to the first of them while
+    // leaving it locked, which keeps spinning threads from barging in.
+    void adaptive_mutex::unlock_contended()
+    {
+        mutex_type::scoped_lock l(mtx_);
+        if (cond_.empty(l))
+        {
+            // the waiters are about to try again
+            locked_.store(false);
+            return;
+        }
+
+        handoff_ = true;
+        cond_.notify_one(l);
+    }
+
+    void adaptive_mutex::wake_waiter()
+    {
+        mutex_type::scoped_lock l(mtx_);
+        cond_.notify_one(l);
+    }
+
+    // Move the estimate towards the number of iterations which were needed
+    // to acquire the lock, let it decay if spinning did not help.
+    void adaptive_mutex::adjust_spin_count(std::size_t spins, bool acquired)
+    {
+        std::size_t count = spin_count_.load(boost::memory_order_relaxed);
+        if (acquired)
+        {
+            if (spins > count)
+                count += (spins - count) / 8;
+            else
+                count -= (count - spins) / 8;
+        }
+        else
+        {
+            count -= count / 8;
+        }
+        spin_count_.store(count, boost::memory_order_relaxed);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void adaptive_mutex::install_counters(std::string const& name)
+    {
+        if (!stats_)
+        {
+            HPX_THROW_EXCEPTION(invalid_status,
+                "adaptive_mutex::install_counters",
+                "the mutex was not constructed to collect statistics");
+            return;
+        }
+
+        typedef detail::adaptive_mutex_statistics statistics;
+        std::string const prefix = "/mutex/" + name;
+
+        performance_counters::install_counter_type(prefix + "/acquisitions",
+            statistics_counter(stats_, &statistics::acquisitions_),
+            "returns the number of times the mutex '" + name +
+            "' was acquired");
+        performance_counters::install_counter_type(prefix + "/contentions",
+            statistics_counter(stats_, &statistics::contentions_),
+            "returns the number of times the mutex '" + name +
+            "' was found locked while trying to acquire it");
+        performance_counters::install_counter_type(prefix + "/suspensions",
+            statistics_counter(stats_, &statistics::suspensions_),
+            "returns the number of times a thread was suspended while "
+            "waiting for the mutex '" + name + "'");
+        performance_counters::install_counter_type(prefix + "/wait-time",
+            statistics_counter(stats_, &statistics::wait_time_),
+            "returns the overall time threads spent waiting for the mutex '" +
+            name + "'", "ns");
+    }
+}}}
@@ -5,23 +5,63 @@
 
 #include "hpx/lcos/local/composable_guard.hpp"
 #include <hpx/apply.hpp>
+#include <hpx/exception.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
 
 #include <boost/cstdint.hpp>
 
 namespace hpx { namespace lcos { namespace local {
 
+namespace {
+    hpx::lcos::local::spinlock error_handler_mtx;
+    guard_error_handler error_handler;
+}
+
+guard_error_handler set_guard_error_handler(guard_error_handler const& f) {
+    hpx::lcos::local::spinlock::scoped_lock l(error_handler_mtx);
+    guard_error_handler prev = error_handler;
+    error_handler = f;
+    return prev;
+}
+
+// Report an exception thrown by a guarded task. This is used in both
+// modes, so an exception thrown by a task run in combining mode does not
+// propagate out of an unrelated call to run_guarded.
+void report_guard_error(boost::exception_ptr const& e) {
+    guard_error_handler f;
+    {
+        hpx::lcos::local::spinlock::scoped_lock l(error_handler_mtx);
+        f = error_handler;
+    }
+    if(f.empty())
+        hpx::report_error(e);
+    else
+        f(e);
+}
+
 void run_composable(guard_task *task);
 void run_async(guard_task *task);
 
+// The number of tasks a thread runs back-to-back on guards in
+// combining mode before handing the remaining ones to a new thread.
+const std::size_t max_combined_tasks = 64;
+
+struct stage_data;
+
 // A link in the list of tasks attached
 // to a guard
 struct guard_task : DebugObject {
     guard_atomic next;
     boost::function<void()> run;
     const bool single_guard;
+    const bool combining;
+    // for the stages of a multi-guarded task
+    stage_data *data;
+    std::size_t stage;
 
-    guard_task() : next((guard_task *)0), run(0), single_guard(true) {}
-    guard_task(bool sg) : next((guard_task*)0), run(0), single_guard(sg) {}
+    guard_task(bool sg = true,bool c = false)
+      : next((guard_task*)0), run(0), single_guard(sg), combining(c),
+        data(0), stage(0) {}
 };
 
 void free(guard_task *task) {
@@ -47,6 +87,7 @@ struct stage_data : public DebugObject {
     guard_set gs;
     boost::function<void()> task;
     guard_task **stages;
+    const std::size_t n;
     stage_data(boost::function<void()> task_,
         std::vector<boost::shared_ptr<guard> >& guards);
     ~stage_data() {
@@ -55,69 +96,115 @@ struct stage_data : public DebugObject {
     }
 };
 
+// Append the task to the list of tasks attached to the guard. Returns
+// true if the guard was free, in which case the caller has to run the
+// task. Otherwise the task is run once its predecessor has finished.
+bool enqueue(guard& g,guard_task *task) {
+    guard_task *prev = g.task.exchange(task);
+    if(prev == NULL)
+        return true;
+    prev->check();
+    guard_task *zero = NULL;
+    if(!prev->next.compare_exchange_strong(zero,task)) {
+        free(prev);
+        return true;
+    }
+    return false;
+}
+
+// Mark the task as finished. If a task was attached after it in the
+// meantime, that one now holds the guard and is returned, the caller
+// has to run it.
+guard_task *release(guard_task *task) {
+    guard_task *zero = NULL;
+    if(!task->next.compare_exchange_strong(zero,task)) {
+        HPX_ASSERT(zero != NULL && zero != task);
+        free(task);
+        return zero;
+    }
+    return NULL;
+}
+
 void run_guarded(guard& g,guard_task *task) {
     HPX_ASSERT(task != NULL);
     task->check();
-    guard_task *prev = g.task.exchange(task);
-    if(prev != NULL) {
-        prev->check();
-        guard_task *zero = NULL;
-        if(!prev->next.compare_exchange_strong(zero,task)) {
+    if(enqueue(g,task)) {
+        if(task->combining)
+            run_composable(task);
+        else
             run_async(task);
-            free(prev);
-        }
-    } else {
-        run_async(task);
     }
 }
 
 struct stage_task_cleanup {
     stage_data *sd;
-    std::size_t n;
-    stage_task_cleanup(stage_data *sd_,std::size_t n_) : sd(sd_), n(n_) {}
+    guard_task **next;
+    stage_task_cleanup(stage_data *sd_) : sd(sd_), next(NULL) {}
     ~stage_task_cleanup() {
-        guard_task *zero = NULL;
         // The tasks on the other guards had single_task marked,
         // so they haven't had their next field set yet. Setting
         // the next field is necessary if they are going to
-        // continue processing.
-        for(std::size_t k=0;k<n;k++) {
+        // continue processing. Once the task has run, the current
+        // thread continues with one of the tasks waiting on a guard
+        // in combining mode.
+        for(std::size_t k=0;k<sd->n;k++) {
             guard_task *lt = sd->stages[k];
             lt->check();
             HPX_ASSERT(!lt->single_guard);
-            zero = NULL;
-            if(!lt->next.compare_exchange_strong(zero,lt)) {
-                HPX_ASSERT(zero != lt);
-                run_async(zero);
-                free(lt);
+            bool combining = lt->combining;
+            guard_task *successor = release(lt);
+            if(successor == NULL)
+                continue;
+            if(next != NULL && combining) {
+                if(*next != NULL)
+                    run_async(*next);
+                *next = successor;
+            } else {
+                run_async(successor);
             }
         }
         delete sd;
     }
 };
 
-void stage_task(stage_data *sd,std::size_t i,std::size_t n) {
-    // if this is the last task in the set...
-    if(i+1 == n) {
-        stage_task_cleanup stc(sd,n);
-        sd->task();
-    } else {
-        std::size_t k = i + 1;
+// Stage i of the multi-guarded task holds the first i+1 guards.
+// Acquire the remaining ones in order, continuing in this thread
+// as long as they are free. A guard which is not free runs the
+// stage once it is released. Returns the task the current thread
+// should continue with, if any.
+guard_task *stage_task(stage_data *sd,std::size_t i) {
+    const std::size_t n = sd->n;
+    for(std::size_t k = i + 1;k<n;k++) {
         guard_task *stage = sd->stages[k];
-        stage->run = boost::bind(stage_task,sd,k,n);
         HPX_ASSERT(!stage->single_guard);
-        run_guarded(*sd->gs.get(k),stage);
+        if(!enqueue(*sd->gs.get(k),stage))
+            return NULL;
+    }
+
+    // all guards are held, run the task
+    guard_task *next = NULL;
+    {
+        stage_task_cleanup stc(sd);
+        try {
+            sd->task();
+        }
+        catch(...) {
+            report_guard_error(boost::current_exception());
+        }
+        stc.next = &next;
     }
+    return next;
 }
 
 
 stage_data::stage_data(boost::function<void()> task_,
         std::vector<boost::shared_ptr<guard> >& guards)
-  : task(task_), stages(new guard_task*[guards.size()])
+  : task(task_), stages(new guard_task*[guards.size()]), n(guards.size())
 {
-    const std::size_t n = guards.size();
     for(std::size_t i=0;i<n;i++) {
-        stages[i] = new guard_task(false);
+        stages[i] = new guard_task(false,guards[i]->combining);
+        stages[i]->data = this;
+        stages[i]->stage = i;
     }
 }
 
@@ -134,14 +221,13 @@ void run_guarded(guard_set& guards,boost::function<void()> task) {
     guards.sort();
     stage_data *sd = new stage_data(task,guards.guards);
     int k = 0;
-    sd->stages[k]->run = boost::bind(stage_task,sd,k,n);
     sd->gs = guards;
     guard_task *stage = sd->stages[k]; //-V108
     run_guarded(*sd->gs.get(k),stage); //-V106
 }
 
 void run_guarded(guard& guard,boost::function<void()> task) {
-    guard_task *tptr = new guard_task();
+    guard_task *tptr = new guard_task(true,guard.combining);
     tptr->run = task;
     run_guarded(guard,tptr);
 }
@@ -158,31 +244,52 @@ void run_async(guard_task *task) {
 // thrown.
 struct run_composable_cleanup {
     guard_task *task;
-    run_composable_cleanup(guard_task *task_) : task(task_) {}
+    // set if the current thread continues with the next task
+    guard_task **next;
+    run_composable_cleanup(guard_task *task_) : task(task_), next(NULL) {}
     ~run_composable_cleanup() {
-        guard_task *zero = 0;
-        // If single_guard is false, then this is one of the
-        // setup tasks for a multi-guarded task. By not setting
-        // the next field, we halt processing on items queued
-        // to this guard.
         HPX_ASSERT(task != NULL);
         task->check();
-        if(!task->next.compare_exchange_strong(zero,task)) {
-            HPX_ASSERT(task->next.load()!=NULL);
-            run_async(zero);
-            free(task);
+        guard_task *successor = release(task);
+        if(successor != NULL) {
+            if(next != NULL)
+                *next = successor;
+            else
+                run_async(successor);
         }
     }
 };
 
+// Run the task holding its guard(s). In combining mode the tasks
+// which were queued on the guard in the meantime are run here as
+// well, instead of spawning a new thread for each of them.
 void run_composable(guard_task *task) {
-    HPX_ASSERT(task != NULL);
-    task->check();
-    if(task->single_guard) {
-        run_composable_cleanup rcc(task);
-        task->run();
-    } else {
-        task->run();
+    std::size_t count = 0;
+    while(task != NULL) {
+        task->check();
+        guard_task *next = NULL;
+        if(task->single_guard) {
+            run_composable_cleanup rcc(task);
+            try {
+                task->run();
+            }
+            catch(...) {
+                report_guard_error(boost::current_exception());
+            }
+            if(task->combining)
+                rcc.next = &next;
+        } else {
+            // If single_guard is false, then this is one of the
+            // stages for a multi-guarded task. Its guards are only
+            // released once the task itself has been run, which
+            // halts processing on items queued to them.
+            next = stage_task(task->data,task->stage);
+        }
+        if(next != NULL && ++count == max_combined_tasks) {
+            run_async(next);
+            return;
+        }
+        task = next;
     }
 }
 }}}
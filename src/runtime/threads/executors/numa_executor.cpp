@@ -0,0 +1,131 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/runtime/threads/executors/numa_executor.hpp>
+#include <hpx/runtime/threads/thread_helpers.hpp>
+#include <hpx/runtime/threads/threadmanager.hpp>
+#include <hpx/runtime/threads/topology.hpp>
+
+#include <algorithm>
+
+namespace hpx { namespace threads { namespace executors { namespace detail
+{
+    namespace
+    {
+        struct numa_domain_less
+        {
+            numa_domain_less(std::vector<std::size_t> const& domains)
+              : domains_(domains)
+            {}
+
+            bool operator()(std::size_t lhs, std::size_t rhs) const
+            {
+                return domains_[lhs] < domains_[rhs];
+            }
+
+            std::vector<std::size_t> const& domains_;
+        };
+    }
+
+    numa_executor::numa_executor(thread_priority priority,
+        thread_stacksize stacksize)
+      : stacksize_(stacksize),
+        priority_(priority),
+        next_(0)
+    {
+        std::size_t num_threads = hpx::get_os_thread_count();
+
+        threadmanager_base& tm = get_thread_manager();
+        topology const& topo = get_topology();
+
+        std::vector<std::size_t> domains;
+        domains.reserve(num_threads);
+        workers_.reserve(num_threads);
+        for (std::size_t i = 0; i != num_threads; ++i)
+        {
+            domains.push_back(topo.get_numa_node_number(tm.get_pu_num(i)));
+            workers_.push_back(i);
+        }
+
+        // keep the worker threads of a NUMA domain next to each other, this
+        // way consecutive chunks of a sequence end up in the same domain
+        std::stable_sort(workers_.begin(), workers_.end(),
+            numa_domain_less(domains));
+    }
+
+    std::size_t numa_executor::next_worker_thread()
+    {
+        return workers_[next_++ % workers_.size()];
+    }
+
+    void numa_executor::reset()
+    {
+        next_.store(0);
+    }
+
+    // Schedule the specified function for execution in this executor.
+    // Depending on the subclass implementation, this may block in some
+    // situations.
+    void numa_executor::add(closure_type && f,
+        char const* desc, threads::thread_state_enum initial_state,
+        bool run_now, threads::thread_stacksize stacksize, error_code& ec)
+    {
+        if (stacksize == threads::thread_stacksize_default)
+            stacksize = stacksize_;
+
+        register_thread_nullary(std::move(f), desc, initial_state, run_now,
+            priority_, next_worker_thread(), stacksize, ec);
+    }
+
+    // Schedule given function for execution in this executor no sooner
+    // than time abs_time. This call never blocks, and may violate
+    // bounds on the executor's queue size.
+    void numa_executor::add_at(
+        boost::chrono::steady_clock::time_point const& abs_time,
+        closure_type && f, char const* description,
+        threads::thread_stacksize stacksize, error_code& ec)
+    {
+        if (stacksize == threads::thread_stacksize_default)
+            stacksize = stacksize_;
+
+        // create new thread
+        thread_id_type id = register_thread_nullary(
+            std::move(f), description, suspended, false,
+            priority_, next_worker_thread(), stacksize, ec);
+        if (ec) return;
+
+        HPX_ASSERT(invalid_thread_id != id);    // would throw otherwise
+
+        // now schedule new thread for execution
+        set_thread_state(id, abs_time);
+    }
+
+    // Return an estimate of the number of waiting tasks.
+    boost::uint64_t numa_executor::num_pending_closures(error_code& ec) const
+    {
+        return get_thread_count() - get_thread_count(terminated);
+    }
+
+    // Return the requested policy element
+    std::size_t numa_executor::get_policy_element(
+        threads::detail::executor_parameter p, error_code& ec) const
+    {
+        switch(p) {
+        case threads::detail::min_concurrency:
+        case threads::detail::max_concurrency:
+        case threads::detail::current_concurrency:
+            return workers_.size();
+
+        default:
+            break;
+        }
+
+        HPX_THROWS_IF(ec, bad_parameter,
+            "numa_executor::get_policy_element",
+            "requested value of invalid policy element");
+        return std::size_t(-1);
+    }
+}}}}
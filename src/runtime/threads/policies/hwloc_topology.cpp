@@ -1048,6 +1048,26 @@ namespace hpx { namespace threads
 
         return mask;
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // hwloc_alloc hands out freshly mapped pages, the default memory binding
+    // policy of the OS places them on first touch.
+    void* hwloc_topology::allocate(std::size_t len) const
+    {
+        void* p = hwloc_alloc(topo, len);
+        if (0 == p)
+        {
+            HPX_THROW_EXCEPTION(out_of_memory,
+                "hpx::threads::hwloc_topology::allocate",
+                "hwloc_alloc failed");
+        }
+        return p;
+    }
+
+    void hwloc_topology::deallocate(void* addr, std::size_t len) const
+    {
+        hwloc_free(topo, addr, len);
+    }
 }}
 
 #endif
@@ -0,0 +1,236 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This is a STREAM-like memory bandwidth benchmark (see
+// http://www.cs.virginia.edu/stream/) written using the parallel algorithms.
+// It compares the bandwidth achieved for data placed using the
+// numa_allocator/numa_executor pair with data allocated and initialized
+// sequentially using std::allocator.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+#include <hpx/include/thread_executors.hpp>
+#include <hpx/include/parallel_copy.hpp>
+#include <hpx/include/parallel_fill.hpp>
+#include <hpx/include/parallel_transform.hpp>
+#include <hpx/include/parallel_memory.hpp>
+#include <hpx/include/iostreams.hpp>
+
+#include <boost/cstdint.hpp>
+#include <boost/format.hpp>
+#include <boost/range/functions.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+char const* const kernel_names[] = { "Copy", "Scale", "Add", "Triad" };
+std::size_t const kernel_arrays[] = { 2, 2, 3, 3 };
+
+struct timings
+{
+    timings()
+    {
+        std::fill(min_, min_ + 4, (std::numeric_limits<double>::max)());
+        std::fill(max_, max_ + 4, 0.0);
+        std::fill(sum_, sum_ + 4, 0.0);
+    }
+
+    void add(std::size_t k, double t)
+    {
+        min_[k] = (std::min)(min_[k], t);
+        max_[k] = (std::max)(max_[k], t);
+        sum_[k] += t;
+    }
+
+    double min_[4];
+    double max_[4];
+    double sum_[4];
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Vector, typename Policy>
+timings run_stream(Vector& a, Vector& b, Vector& c, Policy const& policy,
+    int iterations)
+{
+    double const scalar = 3.0;
+    timings t;
+
+    hpx::parallel::fill(policy, boost::begin(a), boost::end(a), 1.0);
+    hpx::parallel::fill(policy, boost::begin(b), boost::end(b), 2.0);
+    hpx::parallel::fill(policy, boost::begin(c), boost::end(c), 0.0);
+
+    // the first iteration is not taken into account
+    for (int iteration = 0; iteration <= iterations; ++iteration)
+    {
+        double times[4];
+        boost::uint64_t start = hpx::util::high_resolution_clock::now();
+
+        // Copy: c = a
+        hpx::parallel::copy(policy,
+            boost::begin(a), boost::end(a), boost::begin(c));
+        times[0] = (hpx::util::high_resolution_clock::now() - start) / 1e9;
+
+        // Scale: b = scalar * c
+        start = hpx::util::high_resolution_clock::now();
+        hpx::parallel::transform(policy,
+            boost::begin(c), boost::end(c), boost::begin(b),
+            [scalar](double v) { return scalar * v; });
+        times[1] = (hpx::util::high_resolution_clock::now() - start) / 1e9;
+
+        // Add: c = a + b
+        start = hpx::util::high_resolution_clock::now();
+        hpx::parallel::transform(policy,
+            boost::begin(a), boost::end(a), boost::begin(b), boost::begin(c),
+            [](double v1, double v2) { return v1 + v2; });
+        times[2] = (hpx::util::high_resolution_clock::now() - start) / 1e9;
+
+        // Triad: a = b + scalar * c
+        start = hpx::util::high_resolution_clock::now();
+        hpx::parallel::transform(policy,
+            boost::begin(b), boost::end(b), boost::begin(c), boost::begin(a),
+            [scalar](double v1, double v2) { return v1 + scalar * v2; });
+        times[3] = (hpx::util::high_resolution_clock::now() - start) / 1e9;
+
+        if (iteration != 0)
+        {
+            for (std::size_t k = 0; k != 4; ++k)
+                t.add(k, times[k]);
+        }
+    }
+
+    // verify results
+    double aj = 1.0, bj = 2.0, cj = 0.0;
+    for (int iteration = 0; iteration <= iterations; ++iteration)
+    {
+        cj = aj;
+        bj = scalar * cj;
+        cj = aj + bj;
+        aj = bj + scalar * cj;
+    }
+
+    std::size_t errors = 0;
+    for (std::size_t i = 0; i != a.size(); ++i)
+    {
+        if (a[i] != aj || b[i] != bj || c[i] != cj)
+            ++errors;
+    }
+
+    if (errors != 0)
+    {
+        hpx::cout << "Failed validation, number of wrong elements: "
+                  << errors << "\n" << hpx::flush;
+    }
+
+    return t;
+}
+
+void print_timings(char const* name, timings const& t, std::size_t size,
+    int iterations)
+{
+    hpx::cout << name << ":\n"
+        << "Function    Best Rate MB/s  Avg time     Min time     Max time\n";
+
+    for (std::size_t k = 0; k != 4; ++k)
+    {
+        double bytes = double(kernel_arrays[k] * sizeof(double) * size);
+        hpx::cout
+            << (boost::format("%-12s%12.1f  %11.6f  %11.6f  %11.6f\n") %
+                    kernel_names[k] % (1.0e-6 * bytes / t.min_[k]) %
+                    (t.sum_[k] / iterations) % t.min_[k] % t.max_[k]);
+    }
+    hpx::cout << hpx::flush;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    std::size_t vector_size = vm["vector_size"].as<std::size_t>();
+    int iterations = vm["iterations"].as<int>();
+    std::size_t chunk_size = vm["chunk_size"].as<std::size_t>();
+
+    if (iterations <= 0)
+    {
+        hpx::cout << "iterations has to be positive...\n" << hpx::flush;
+        return hpx::finalize();
+    }
+
+    std::size_t num_threads = hpx::get_os_thread_count();
+    if (chunk_size == 0)
+        chunk_size = (vector_size + num_threads - 1) / num_threads;
+
+    hpx::cout
+        << "Array size: " << vector_size << " (elements), "
+        << (3 * sizeof(double) * vector_size) / (1024 * 1024)
+        << " (MiB total)\n"
+        << "Number of threads: " << num_threads << "\n"
+        << "Chunk size: " << chunk_size << "\n"
+        << "Each kernel will be executed " << iterations << " times.\n\n"
+        << hpx::flush;
+
+    {
+        // data is placed by the worker threads which later operate on it
+        typedef hpx::parallel::util::numa_allocator<double> allocator_type;
+        typedef std::vector<double, allocator_type> vector_type;
+
+        hpx::threads::executors::numa_executor exec;
+        allocator_type alloc(exec, chunk_size);
+
+        vector_type a(vector_size, 0.0, alloc);
+        vector_type b(vector_size, 0.0, alloc);
+        vector_type c(vector_size, 0.0, alloc);
+
+        timings t = run_stream(a, b, c,
+            hpx::parallel::par(exec, chunk_size), iterations);
+        print_timings("NUMA aware placement", t, vector_size, iterations);
+    }
+
+    if (!vm.count("numa_only"))
+    {
+        // data is placed by the thread calling the vector constructor
+        typedef std::vector<double> vector_type;
+
+        vector_type a(vector_size, 0.0);
+        vector_type b(vector_size, 0.0);
+        vector_type c(vector_size, 0.0);
+
+        timings t = run_stream(a, b, c,
+            hpx::parallel::par(chunk_size), iterations);
+        print_timings("\nDefault placement", t, vector_size, iterations);
+    }
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> cfg;
+    cfg.push_back("hpx.os_threads=" +
+        boost::lexical_cast<std::string>(hpx::threads::hardware_concurrency()));
+    boost::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    cmdline.add_options()
+        ( "vector_size"
+        , boost::program_options::value<std::size_t>()->default_value(20000000)
+        , "number of elements in each of the arrays")
+
+        ( "iterations"
+        , boost::program_options::value<int>()->default_value(10)
+        , "number of times each kernel is run")
+
+        ( "chunk_size"
+        , boost::program_options::value<std::size_t>()->default_value(0)
+        , "number of elements per chunk (default: vector_size / threads)")
+
+        ( "numa_only"
+        , "do not run the kernels using default memory placement")
+        ;
+
+    return hpx::init(cmdline, argc, argv, cfg);
+}
@@ -0,0 +1,129 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Barrier latency test: measures the average time needed to pass through a
+// barrier shared by all localities, comparing the central hpx::lcos::barrier
+// with both modes of hpx::lcos::hierarchical_barrier.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/util/high_resolution_timer.hpp>
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/assign/std/vector.hpp>
+#include <boost/lexical_cast.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Barrier>
+double measure(Barrier& b, std::size_t skip, std::size_t loop)
+{
+    for (std::size_t i = 0; i != skip; ++i)
+        b.wait();
+
+    hpx::util::high_resolution_timer t;
+    for (std::size_t i = 0; i != loop; ++i)
+        b.wait();
+
+    return t.elapsed() / loop;
+}
+
+double run_central_barrier(std::size_t skip, std::size_t loop)
+{
+    char const* const name = "/benchmark/barrier_latency/central";
+
+    hpx::lcos::barrier b;
+    if (hpx::get_locality_id() == 0)
+    {
+        b = hpx::lcos::barrier::create(hpx::find_here(),
+            hpx::get_num_localities_sync());
+        hpx::agas::register_name_sync(name, b.get_gid());
+    }
+    else
+    {
+        b = hpx::lcos::barrier(hpx::agas::on_symbol_namespace_event(
+            name, hpx::agas::symbol_ns_bind, true).get());
+    }
+
+    double elapsed = measure(b, skip, loop);
+
+    if (hpx::get_locality_id() == 0)
+        hpx::agas::unregister_name_sync(name);
+
+    return elapsed;
+}
+
+double run_hierarchical_barrier(std::string const& name,
+    hpx::lcos::hierarchical_barrier_mode mode, std::size_t arity,
+    std::size_t skip, std::size_t loop)
+{
+    hpx::lcos::hierarchical_barrier b(name, 1, mode, arity);
+    return measure(b, skip, loop);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void print(char const* name, double elapsed)
+{
+    if (hpx::get_locality_id() != 0)
+        return;
+
+    std::cout << std::left << std::setw(32) << name
+              << std::right << std::setw(16) << std::fixed
+              << std::setprecision(2) << elapsed * 1e6 << std::endl;
+}
+
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    std::size_t skip = vm["skip"].as<std::size_t>();
+    std::size_t loop = vm["loop"].as<std::size_t>();
+    std::size_t arity = vm["arity"].as<std::size_t>();
+
+    if (hpx::get_locality_id() == 0)
+    {
+        std::cout << "# Barrier latency test, "
+                  << hpx::get_num_localities_sync() << " localities\n"
+                  << std::left << std::setw(32) << "# Barrier"
+                  << std::right << std::setw(16) << "Latency (us)"
+                  << std::endl;
+    }
+
+    print("central", run_central_barrier(skip, loop));
+    print("hierarchical (tree)", run_hierarchical_barrier(
+        "/benchmark/barrier_latency/tree", hpx::lcos::tree_mode, arity,
+        skip, loop));
+    print("hierarchical (dissemination)", run_hierarchical_barrier(
+        "/benchmark/barrier_latency/dissemination",
+        hpx::lcos::dissemination_mode, arity, skip, loop));
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    boost::program_options::options_description
+        desc("Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc.add_options()
+        ("loop",
+         boost::program_options::value<std::size_t>()->default_value(1000),
+         "Number of barrier operations to measure")
+        ("skip",
+         boost::program_options::value<std::size_t>()->default_value(100),
+         "Number of warm-up barrier operations")
+        ("arity",
+         boost::program_options::value<std::size_t>()->default_value(2),
+         "Number of children per locality in tree mode");
+
+    // run hpx_main on all localities
+    using namespace boost::assign;
+    std::vector<std::string> cfg;
+    cfg += "hpx.run_hpx_main!=1";
+
+    return hpx::init(desc, argc, argv, cfg);
+}
@@ -0,0 +1,101 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server
+  : hpx::components::simple_component_base<test_server>
+{
+    test_server() : value_(0) {}
+    explicit test_server(int value) : value_(value) {}
+
+    int get_value() const { return value_; }
+    boost::uint32_t get_locality() const { return hpx::get_locality_id(); }
+
+    HPX_DEFINE_COMPONENT_ACTION(test_server, get_value, get_value_action);
+    HPX_DEFINE_COMPONENT_ACTION(test_server, get_locality,
+        get_locality_action);
+
+    int value_;
+};
+
+typedef hpx::components::simple_component<test_server> server_type;
+HPX_REGISTER_MINIMAL_COMPONENT_FACTORY(server_type, test_server);
+
+typedef test_server::get_value_action get_value_action;
+HPX_REGISTER_ACTION_DECLARATION(get_value_action);
+HPX_REGISTER_ACTION(get_value_action);
+
+typedef test_server::get_locality_action get_locality_action;
+HPX_REGISTER_ACTION_DECLARATION(get_locality_action);
+HPX_REGISTER_ACTION(get_locality_action);
+
+///////////////////////////////////////////////////////////////////////////////
+void test_bulk_new_locality()
+{
+    std::vector<hpx::id_type> ids =
+        hpx::new_<test_server[]>(hpx::find_here(), 10, 42).get();
+    HPX_TEST_EQ(ids.size(), std::size_t(10));
+
+    for (hpx::id_type const& id : ids)
+    {
+        HPX_TEST_EQ(hpx::async<get_value_action>(id).get(), 42);
+        HPX_TEST_EQ(hpx::async<get_locality_action>(id).get(),
+            hpx::get_locality_id());
+    }
+}
+
+void test_bulk_new_default_layout()
+{
+    std::vector<hpx::id_type> ids =
+        hpx::new_<test_server[]>(hpx::default_layout, 5).get();
+    HPX_TEST_EQ(ids.size(), std::size_t(5));
+
+    for (hpx::id_type const& id : ids)
+        HPX_TEST_EQ(hpx::async<get_value_action>(id).get(), 0);
+}
+
+void test_bulk_new_distributed()
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    // the remainder is assigned to the first localities
+    std::size_t const count = 10 * localities.size() + 1;
+    std::vector<hpx::id_type> ids = hpx::new_<test_server[]>(
+        hpx::default_layout(localities), count, 7).get();
+    HPX_TEST_EQ(ids.size(), count);
+
+    // the ids are ordered by the localities they were created on
+    std::size_t pos = 0;
+    for (std::size_t i = 0; i != localities.size(); ++i)
+    {
+        boost::uint32_t locality_id =
+            hpx::naming::get_locality_id_from_id(localities[i]);
+        std::size_t num_items = (i == 0) ? 11 : 10;
+
+        for (std::size_t j = 0; j != num_items; ++j, ++pos)
+        {
+            HPX_TEST_EQ(hpx::async<get_value_action>(ids[pos]).get(), 7);
+            HPX_TEST_EQ(hpx::async<get_locality_action>(ids[pos]).get(),
+                locality_id);
+        }
+    }
+}
+
+int main()
+{
+    test_bulk_new_locality();
+    test_bulk_new_default_layout();
+    test_bulk_new_distributed();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,160 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/naming.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/component_storage.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server
+  : hpx::components::migration_support<
+        hpx::components::simple_component_base<test_server>
+    >
+{
+    test_server() : value_(0) {}
+    explicit test_server(int value) : value_(value) {}
+
+    // Components which should be checkpointed need to be Serializable and
+    // CopyConstructable (or MoveConstructable).
+    test_server(test_server const& rhs) : value_(rhs.value_) {}
+    test_server(test_server && rhs) : value_(rhs.value_) {}
+
+    test_server& operator=(test_server const& rhs)
+    {
+        value_ = rhs.value_;
+        return *this;
+    }
+    test_server& operator=(test_server && rhs)
+    {
+        value_ = rhs.value_;
+        return *this;
+    }
+
+    int get_value() const { return value_; }
+    boost::uint32_t get_locality() const { return hpx::get_locality_id(); }
+
+    HPX_DEFINE_COMPONENT_ACTION(test_server, get_value, get_value_action);
+    HPX_DEFINE_COMPONENT_ACTION(test_server, get_locality,
+        get_locality_action);
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned version)
+    {
+        ar & value_;
+    }
+
+    int value_;
+};
+
+typedef hpx::components::simple_component<test_server> server_type;
+HPX_REGISTER_MINIMAL_COMPONENT_FACTORY(server_type, test_server);
+
+typedef test_server::get_value_action get_value_action;
+HPX_REGISTER_ACTION_DECLARATION(get_value_action);
+HPX_REGISTER_ACTION(get_value_action);
+
+typedef test_server::get_locality_action get_locality_action;
+HPX_REGISTER_ACTION_DECLARATION(get_locality_action);
+HPX_REGISTER_ACTION(get_locality_action);
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    std::string const basename("checkpoint_component_test");
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    // create some objects on all localities
+    std::vector<hpx::id_type> ids;
+    for (std::size_t i = 0; i != 10 * localities.size(); ++i)
+    {
+        ids.push_back(hpx::new_<test_server>(
+            localities[i % localities.size()], int(i)).get());
+    }
+
+    hpx::components::checkpoint<test_server>(ids, basename).get();
+
+    // restore the objects written by each of the localities on the same
+    // locality
+    std::size_t here = 0;
+    for (std::size_t k = 0; k != localities.size(); ++k)
+    {
+        boost::uint32_t locality_id =
+            hpx::naming::get_locality_id_from_id(localities[k]);
+        if (locality_id == hpx::get_locality_id())
+            here = k;
+
+        std::string filename =
+            hpx::components::get_checkpoint_filename(basename, locality_id);
+
+        std::vector<hpx::id_type> restored = hpx::components::restore<
+            test_server>(localities[k], filename).get();
+        HPX_TEST_EQ(restored.size(), std::size_t(10));
+
+        for (std::size_t i = 0; i != restored.size(); ++i)
+        {
+            std::size_t index = i * localities.size() + k;
+            HPX_TEST_EQ(hpx::async<get_value_action>(restored[i]).get(),
+                hpx::async<get_value_action>(ids[index]).get());
+            HPX_TEST_EQ(hpx::async<get_locality_action>(restored[i]).get(),
+                locality_id);
+        }
+    }
+
+    // the checkpoint file is truncated to the data written, it ends with
+    // the index
+    {
+        std::string filename = hpx::components::get_checkpoint_filename(
+            basename, hpx::get_locality_id());
+        hpx::components::detail::mapped_file file(filename,
+            hpx::components::detail::mapped_file::read_only);
+
+        hpx::components::detail::checkpoint_header header;
+        HPX_TEST(file.size() >= sizeof(header));
+        std::memcpy(&header, file.data(), sizeof(header));
+        HPX_TEST_EQ(header.index_offset_ + header.index_size_,
+            boost::uint64_t(file.size()));
+    }
+
+    // deserialize a single object on demand
+    {
+        std::string filename = hpx::components::get_checkpoint_filename(
+            basename, hpx::get_locality_id());
+        hpx::components::checkpoint_reader reader(filename);
+
+        std::vector<hpx::naming::gid_type> stored = reader.get_ids();
+        HPX_TEST_EQ(stored.size(), std::size_t(10));
+
+        boost::shared_ptr<test_server> p =
+            reader.load_id<test_server>(stored[3]);
+        HPX_TEST_EQ(p->get_value(), int(3 * localities.size() + here));
+
+        // the components are stored in the order they were given, even
+        // though they are serialized concurrently
+        HPX_TEST_EQ(reader.size(), std::size_t(10));
+        for (std::size_t i = 0; i != reader.size(); ++i)
+        {
+            HPX_TEST(!reader.read(i).empty());
+            HPX_TEST_EQ(reader.load<test_server>(i)->get_value(),
+                int(i * localities.size() + here));
+        }
+    }
+
+    for (hpx::id_type const& locality : localities)
+    {
+        std::remove(hpx::components::get_checkpoint_filename(basename,
+            hpx::naming::get_locality_id_from_id(locality)).c_str());
+    }
+
+    return hpx::util::report_errors();
+}
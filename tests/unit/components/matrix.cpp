@@ -0,0 +1,239 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/matrix.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Define the matrix types to be used.
+HPX_REGISTER_MATRIX(double);
+
+struct increment_tile
+{
+    template <typename T>
+    void operator()(hpx::matrix_tile_view<T> const& tile) const
+    {
+        for (std::size_t r = 0; r != tile.rows(); ++r)
+        {
+            for (std::size_t c = 0; c != tile.cols(); ++c)
+                ++tile(r, c);
+        }
+    }
+};
+
+struct twice
+{
+    template <typename T>
+    T operator()(T const& val) const
+    {
+        return 2 * val;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+double value(std::size_t row, std::size_t col)
+{
+    return double(row * 1000 + col);
+}
+
+void fill_values(hpx::partitioned_matrix<double>& m)
+{
+    for (std::size_t r = 0; r != m.rows(); ++r)
+    {
+        for (std::size_t c = 0; c != m.cols(); ++c)
+            m.set_value_sync(r, c, value(r, c));
+    }
+}
+
+void verify_values(hpx::partitioned_matrix<double> const& m, double offset,
+    double factor = 1.0)
+{
+    for (std::size_t r = 0; r != m.rows(); ++r)
+    {
+        for (std::size_t c = 0; c != m.cols(); ++c)
+        {
+            HPX_TEST_EQ(m.get_value_sync(r, c),
+                factor * (value(r, c) + offset));
+        }
+    }
+}
+
+void verify_tiles(hpx::partitioned_matrix<double> const& m)
+{
+    typedef hpx::partitioned_matrix<double>::const_tile_iterator iterator;
+    typedef hpx::partitioned_matrix<double>::tile_type tile_type;
+
+    std::size_t count = 0;
+    for (iterator it = m.tile_begin(); it != m.tile_end(); ++it, ++count)
+    {
+        std::size_t tile_row = (*it).tile_row();
+        std::size_t tile_col = (*it).tile_col();
+
+        HPX_TEST_EQ(tile_row, count / m.num_tile_cols());
+        HPX_TEST_EQ(tile_col, count % m.num_tile_cols());
+        HPX_TEST_EQ((*it).get_locality_id(),
+            m.get_tile_locality_id(tile_row, tile_col));
+
+        tile_type tile = (*it).get_sync();
+        HPX_TEST_EQ(tile.size(), m.tile_rows() * m.tile_cols());
+
+        for (std::size_t r = 0; r != (*it).rows(); ++r)
+        {
+            for (std::size_t c = 0; c != (*it).cols(); ++c)
+            {
+                HPX_TEST_EQ(tile[r * m.tile_cols() + c],
+                    value(tile_row * m.tile_rows() + r,
+                        tile_col * m.tile_cols() + c));
+            }
+        }
+    }
+    HPX_TEST_EQ(count, m.num_tile_rows() * m.num_tile_cols());
+
+    // row and column iterators
+    for (std::size_t tile_row = 0; tile_row != m.num_tile_rows(); ++tile_row)
+    {
+        HPX_TEST_EQ(std::size_t(std::distance(m.tile_row_begin(tile_row),
+            m.tile_row_end(tile_row))), m.num_tile_cols());
+        HPX_TEST_EQ((*m.tile_row_begin(tile_row)).tile_row(), tile_row);
+    }
+    for (std::size_t tile_col = 0; tile_col != m.num_tile_cols(); ++tile_col)
+    {
+        HPX_TEST_EQ(std::size_t(std::distance(m.tile_column_begin(tile_col),
+            m.tile_column_end(tile_col))), m.num_tile_rows());
+        HPX_TEST_EQ((*m.tile_column_begin(tile_col)).tile_col(), tile_col);
+    }
+}
+
+void set_tiles(hpx::partitioned_matrix<double>& m)
+{
+    typedef hpx::partitioned_matrix<double>::tile_type tile_type;
+
+    // replace each of the tiles as a whole
+    std::size_t size = m.tile_rows() * m.tile_cols();
+    for (std::size_t tile_row = 0; tile_row != m.num_tile_rows(); ++tile_row)
+    {
+        for (std::size_t tile_col = 0; tile_col != m.num_tile_cols(); ++tile_col)
+        {
+            std::vector<double> data(size, 0.0);
+            for (std::size_t i = 0; i != size; ++i)
+                data[i] = double(tile_row + tile_col * 100 + i);
+
+            m.set_tile_sync(tile_row, tile_col,
+                tile_type(data.data(), size, tile_type::copy));
+        }
+    }
+
+    for (std::size_t tile_row = 0; tile_row != m.num_tile_rows(); ++tile_row)
+    {
+        for (std::size_t tile_col = 0; tile_col != m.num_tile_cols(); ++tile_col)
+        {
+            tile_type tile = m.get_tile_sync(tile_row, tile_col);
+            HPX_TEST_EQ(tile.size(), size);
+            for (std::size_t i = 0; i != size; ++i)
+                HPX_TEST_EQ(tile[i], double(tile_row + tile_col * 100 + i));
+        }
+    }
+}
+
+void matrix_tests(hpx::partitioned_matrix<double>& m)
+{
+    fill_values(m);
+    verify_values(m, 0.0);
+    verify_tiles(m);
+
+    // segmented algorithms operate on the tiles in place
+    hpx::for_each_tile(m, increment_tile()).get();
+    verify_values(m, 1.0);
+
+    hpx::partitioned_matrix<double> m2(m);
+    verify_values(m2, 1.0);
+
+    hpx::transform_tiles(m, m2, twice()).get();
+    verify_values(m2, 1.0, 2.0);
+    verify_values(m, 1.0);
+
+    set_tiles(m2);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    {
+        hpx::partitioned_matrix<double> m(17, 13);
+        HPX_TEST_EQ(m.num_partitions(), localities.size());
+        matrix_tests(m);
+    }
+
+    {
+        hpx::partitioned_matrix<double> m(17, 13, 42.0);
+        HPX_TEST_EQ(m.get_value_sync(16, 12), 42.0);
+    }
+
+    {
+        // block-cyclic distribution of 3x2 tiles
+        hpx::partitioned_matrix<double> m(17, 13,
+            hpx::matrix_layout(3, 2, localities));
+        HPX_TEST_EQ(m.tile_rows(), std::size_t(3));
+        HPX_TEST_EQ(m.tile_cols(), std::size_t(2));
+        HPX_TEST_EQ(m.num_tile_rows(), std::size_t(6));
+        HPX_TEST_EQ(m.num_tile_cols(), std::size_t(7));
+        matrix_tests(m);
+    }
+
+    {
+        // explicit 2x2 grid of partitions
+        hpx::partitioned_matrix<double> m(10, 10,
+            hpx::matrix_layout(4, 4, 2, 2, localities));
+        HPX_TEST_EQ(m.num_partitions(), std::size_t(4));
+        HPX_TEST_EQ(m.get_partition(2, 1), std::size_t(1));
+        matrix_tests(m);
+    }
+
+    {
+        // same tiles but a different grid of partitions
+        hpx::partitioned_matrix<double> m1(10, 10,
+            hpx::matrix_layout(2, 2, 2, 3, localities));
+        hpx::partitioned_matrix<double> m2(10, 10,
+            hpx::matrix_layout(2, 2, 3, 2, localities));
+        HPX_TEST_EQ(m1.num_partitions(), m2.num_partitions());
+
+        fill_values(m1);
+        hpx::transform_tiles(m1, m2, twice()).get();
+        verify_values(m2, 0.0, 2.0);
+    }
+
+    {
+        // different tile sizes, every tile of the target overlaps several
+        // tiles of the source
+        hpx::partitioned_matrix<double> m1(17, 13,
+            hpx::matrix_layout(3, 2, localities));
+        hpx::partitioned_matrix<double> m2(17, 13,
+            hpx::matrix_layout(4, 5, localities));
+
+        fill_values(m1);
+        hpx::transform_tiles(m1, m2, twice()).get();
+        verify_values(m2, 0.0, 2.0);
+        verify_values(m1, 0.0);
+
+        // local tiles are returned as copies, the matrix data has to stay
+        // intact once they are gone
+        {
+            hpx::partitioned_matrix<double>::tile_type tile =
+                m2.get_tile_sync(0, 0);
+            HPX_TEST_EQ(tile.size(), m2.tile_rows() * m2.tile_cols());
+        }
+        verify_values(m2, 0.0, 2.0);
+    }
+
+    return hpx::util::report_errors();
+}
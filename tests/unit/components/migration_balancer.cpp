@@ -0,0 +1,226 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/serialization.hpp>
+#include <hpx/runtime/components/migration_balancer.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server
+  : hpx::components::migration_support<
+        hpx::components::simple_component_base<test_server>
+    >
+{
+    test_server() {}
+    ~test_server() {}
+
+    hpx::id_type call() const
+    {
+        return hpx::find_here();
+    }
+
+    test_server(test_server const& rhs) {}
+    test_server(test_server && rhs) {}
+
+    test_server& operator=(test_server const &) { return *this; }
+    test_server& operator=(test_server &&) { return *this; }
+
+    HPX_DEFINE_COMPONENT_ACTION(test_server, call, call_action);
+
+    template <typename Archive>
+    void serialize(Archive&ar, unsigned version) {}
+};
+
+typedef hpx::components::simple_component<test_server> server_type;
+HPX_REGISTER_MINIMAL_COMPONENT_FACTORY(server_type, test_server);
+
+typedef test_server::call_action call_action;
+HPX_REGISTER_ACTION_DECLARATION(call_action);
+HPX_REGISTER_ACTION(call_action);
+
+typedef hpx::components::server::get_invocation_counts_action<test_server>
+    get_invocation_counts_action;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_invocation_counts(hpx::id_type const& locality)
+{
+    std::vector<hpx::id_type> ids;
+    ids.push_back(hpx::new_<test_server>(locality).get());
+    ids.push_back(hpx::new_<test_server>(locality).get());
+
+    for (int i = 0; i != 10; ++i)
+        HPX_TEST_EQ(call_action()(ids[0]), locality);
+    HPX_TEST_EQ(call_action()(ids[1]), locality);
+
+    std::vector<boost::uint64_t> counts =
+        get_invocation_counts_action()(locality, ids);
+    HPX_TEST_EQ(counts.size(), std::size_t(2));
+    HPX_TEST_EQ(counts[0], boost::uint64_t(10));
+    HPX_TEST_EQ(counts[1], boost::uint64_t(1));
+
+    // the counts are reset after being read
+    counts = get_invocation_counts_action()(locality, ids);
+    HPX_TEST_EQ(counts[0], boost::uint64_t(0));
+    HPX_TEST_EQ(counts[1], boost::uint64_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_policy(hpx::id_type const& busy, hpx::id_type const& idle)
+{
+    using hpx::components::locality_load;
+    using hpx::components::component_load;
+
+    hpx::id_type hot = hpx::new_<test_server>(busy).get();
+    hpx::id_type cold = hpx::new_<test_server>(busy).get();
+
+    std::vector<component_load> components;
+    component_load hot_load = { hot, busy, 100 };
+    component_load cold_load = { cold, busy, 10 };
+    components.push_back(cold_load);
+    components.push_back(hot_load);
+
+    hpx::components::idle_rate_migration_policy policy(20.0, 1, 1);
+
+    // nothing is migrated if the loads are balanced
+    {
+        std::vector<locality_load> loads;
+        locality_load l1 = { busy, 40.0 };
+        locality_load l2 = { idle, 50.0 };
+        loads.push_back(l1);
+        loads.push_back(l2);
+
+        HPX_TEST(policy(loads, components).empty());
+    }
+
+    // the hottest object is moved from the busy to the idle locality
+    std::vector<locality_load> loads;
+    locality_load l1 = { busy, 10.0 };
+    locality_load l2 = { idle, 90.0 };
+    loads.push_back(l1);
+    loads.push_back(l2);
+
+    hpx::components::migration_list migrations = policy(loads, components);
+    HPX_TEST_EQ(migrations.size(), std::size_t(1));
+    HPX_TEST_EQ(migrations[0].first, hot);
+    HPX_TEST_EQ(migrations[0].second, idle);
+
+    // the same object is not moved again during the cooldown period
+    migrations = policy(loads, components);
+    HPX_TEST_EQ(migrations.size(), std::size_t(1));
+    HPX_TEST_EQ(migrations[0].first, cold);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Moves every object which was invoked since the last round to the target
+// locality.
+struct move_to_policy
+{
+    move_to_policy(hpx::id_type const& target)
+      : target_(target)
+    {}
+
+    hpx::components::migration_list operator()(
+        std::vector<hpx::components::locality_load> const&,
+        std::vector<hpx::components::component_load> const& components)
+    {
+        hpx::components::migration_list result;
+        for (hpx::components::component_load const& c : components)
+        {
+            if (c.invocations_ != 0 && c.locality_ != target_)
+                result.push_back(std::make_pair(c.id_, target_));
+        }
+        return result;
+    }
+
+    hpx::id_type target_;
+};
+
+void test_balancer(std::vector<hpx::id_type> const& localities)
+{
+    hpx::id_type here = hpx::find_here();
+    hpx::id_type target = localities.back();
+
+    hpx::components::migration_balancer<test_server, move_to_policy>
+        balancer(localities, 100000, move_to_policy(target));
+
+    std::vector<hpx::id_type> ids;
+    for (int i = 0; i != 4; ++i)
+    {
+        ids.push_back(hpx::new_<test_server>(here).get());
+        balancer.add(ids.back());
+        call_action()(ids.back());
+    }
+
+    // this object is not invoked, it has to stay in place
+    hpx::id_type cold = hpx::new_<test_server>(here).get();
+    balancer.add(cold);
+
+    std::size_t migrated = balancer.rebalance().get();
+
+    // the balancer moves objects only if the idle rates are available
+#if defined(HPX_THREAD_MAINTAIN_IDLE_RATES)
+    hpx::id_type expected = target;
+    HPX_TEST_EQ(migrated, target != here ? ids.size() : std::size_t(0));
+#else
+    hpx::id_type expected = here;
+    HPX_TEST_EQ(migrated, std::size_t(0));
+#endif
+
+    for (hpx::id_type const& id : ids)
+    {
+        HPX_TEST_EQ(hpx::get_colocation_id(id).get(), expected);
+        HPX_TEST_EQ(call_action()(id), expected);
+    }
+
+    HPX_TEST_EQ(hpx::get_colocation_id(cold).get(), here);
+    HPX_TEST_EQ(call_action()(cold), here);
+
+    balancer.remove(ids.front());
+}
+
+// Destroying a balancer waits for the rounds which are still running
+void test_balancer_shutdown(std::vector<hpx::id_type> const& localities)
+{
+    hpx::future<std::size_t> f;
+    {
+        hpx::components::migration_balancer<test_server> balancer(
+            localities, 1000);
+
+        for (int i = 0; i != 4; ++i)
+        {
+            hpx::id_type id = hpx::new_<test_server>(hpx::find_here()).get();
+            balancer.add(id);
+            call_action()(id);
+        }
+
+        balancer.start();
+        f = balancer.rebalance();
+    }
+
+    HPX_TEST(f.is_ready());
+    HPX_TEST(f.get() <= std::size_t(4));
+}
+
+int main()
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    for (hpx::id_type const& id : localities)
+        test_invocation_counts(id);
+
+    if (localities.size() > 1)
+        test_policy(localities[0], localities[1]);
+
+    test_balancer(localities);
+    test_balancer_shutdown(localities);
+
+    return hpx::util::report_errors();
+}
@@ -75,6 +75,44 @@ void fill_unordered_map(hpx::unordered_map<Key, Value, Hash, KeyEqual>& m,
     HPX_TEST(m.size() == count);
 }
 
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void test_bulk_access(hpx::unordered_map<Key, Value, Hash, KeyEqual>& m,
+    std::size_t count)
+{
+    std::vector<Key> keys;
+    std::vector<Value> values;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        // insert the keys in an order unrelated to their partitions
+        std::size_t k = (i * 7) % count;
+        keys.push_back(boost::lexical_cast<std::string>(k));
+        values.push_back(Value(k));
+    }
+
+    m.set_values_sync(keys, values);
+    HPX_TEST_EQ(m.size(), count);
+
+    std::vector<Value> result = m.get_values_sync(keys);
+    HPX_TEST_EQ(result.size(), count);
+    HPX_TEST(std::equal(values.begin(), values.end(), result.begin()));
+
+    // concurrent writers and readers operating on the same partitions
+    std::vector<hpx::future<void> > futures;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        futures.push_back(
+            m.set_value(keys[i], Value(2 * values[i])));
+    }
+    hpx::wait_all(futures);
+
+    std::vector<hpx::future<Value> > values_futures;
+    for (std::size_t i = 0; i != count; ++i)
+        values_futures.push_back(m.get_value(keys[i]));
+
+    for (std::size_t i = 0; i != count; ++i)
+        HPX_TEST_EQ(values_futures[i].get(), Value(2 * values[i]));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename Key, typename Value, typename DistPolicy>
 void trivial_tests(DistPolicy const& policy)
@@ -106,6 +144,12 @@ void trivial_tests(DistPolicy const& policy)
         fill_unordered_map(m, 107, Value(42));
         test_global_iteration(m, Value(42));
     }
+
+    // bulk access
+    {
+        hpx::unordered_map<Key, Value> m(17, policy);
+        test_bulk_access(m, 107);
+    }
 }
 
 template <typename Key, typename Value>
@@ -149,6 +193,109 @@ void trivial_tests()
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+template <typename Key, typename Value>
+void consistent_hash_tests(std::vector<hpx::id_type> const& localities)
+{
+    hpx::unordered_map<Key, Value> m(hpx::consistent_hash_layout(2));
+
+    fill_unordered_map(m, 107, Value(42));
+    test_global_iteration(m, Value(42));
+
+    // grow the map, only some of the elements are moved
+    m.rebalance_sync(hpx::consistent_hash_layout(5, localities));
+    HPX_TEST_EQ(m.size(), std::size_t(107));
+    for (std::size_t i = 0; i != 107; ++i)
+    {
+        std::string idx = boost::lexical_cast<std::string>(i);
+        HPX_TEST_EQ(m[idx], Value(i + 1));
+    }
+
+    // shrink the map again, using fewer virtual nodes
+    hpx::future<void> f = m.rebalance(
+        hpx::consistent_hash_layout(1).virtual_nodes(16));
+    f.get();
+
+    HPX_TEST_EQ(m.size(), std::size_t(107));
+    test_bulk_access(m, 107);
+
+    // the elements stay accessible while the map is being rebalanced
+    std::vector<Key> keys;
+    std::vector<Value> values;
+    for (std::size_t i = 0; i != 107; ++i)
+    {
+        keys.push_back(boost::lexical_cast<std::string>(i));
+        values.push_back(Value(i));
+    }
+    m.set_values_sync(keys, values);
+
+    f = m.rebalance(hpx::consistent_hash_layout(3, localities));
+    do {
+        for (std::size_t i = 0; i != keys.size(); ++i)
+            HPX_TEST_EQ(m.get_value_sync(keys[i]), values[i]);
+
+        std::vector<Value> result = m.get_values_sync(keys);
+        HPX_TEST(std::equal(values.begin(), values.end(), result.begin()));
+    } while (!f.is_ready());
+    f.get();
+
+    HPX_TEST_EQ(m.size(), std::size_t(107));
+
+    // modifications performed while the map is being rebalanced are kept
+    f = m.rebalance(hpx::consistent_hash_layout(4, localities));
+    std::size_t round = 0;
+    do {
+        ++round;
+        std::vector<hpx::future<void> > writes;
+        for (std::size_t i = 0; i != keys.size(); ++i)
+            writes.push_back(m.set_value(keys[i], Value(round * 1000 + i)));
+        hpx::wait_all(writes);
+    } while (!f.is_ready());
+    f.get();
+
+    HPX_TEST_EQ(m.size(), std::size_t(107));
+    for (std::size_t i = 0; i != keys.size(); ++i)
+        HPX_TEST_EQ(m.get_value_sync(keys[i]), Value(round * 1000 + i));
+}
+
+template <typename Key, typename Value>
+void rebalance_registered_tests(std::vector<hpx::id_type> const& localities)
+{
+    std::string const name("unordered_map_rebalanced");
+
+    hpx::unordered_map<Key, Value> m(hpx::consistent_hash_layout(2));
+    fill_unordered_map(m, 57, Value(42));
+
+    // instances connecting after a rebalance see the new layout
+    m.rebalance_sync(hpx::consistent_hash_layout(5, localities));
+    m.register_as(name).get();
+
+    hpx::unordered_map<Key, Value> c;
+    c.connect_to(name).get();
+
+    HPX_TEST_EQ(c.size(), std::size_t(57));
+    for (std::size_t i = 0; i != 57; ++i)
+    {
+        std::string idx = boost::lexical_cast<std::string>(i);
+        HPX_TEST_EQ(c.get_value_sync(idx), Value(42));
+
+        c.set_value_sync(idx, Value(i));
+        HPX_TEST_EQ(m.get_value_sync(idx), Value(i));
+    }
+
+    // registered maps can't be rebalanced anymore
+    bool caught_exception = false;
+    try {
+        m.rebalance_sync(hpx::consistent_hash_layout(3, localities));
+    }
+    catch (hpx::exception const& e) {
+        caught_exception = true;
+        HPX_TEST_EQ(int(e.get_error()), int(hpx::invalid_status));
+    }
+    HPX_TEST(caught_exception);
+    HPX_TEST_EQ(m.size(), std::size_t(57));
+}
+
 int main()
 {
     trivial_tests<std::string, double>();
@@ -160,6 +307,9 @@ int main()
     trivial_tests<std::string, double>(hpx::layout(3, localities));
     trivial_tests<std::string, double>(hpx::layout(localities));
 
+    consistent_hash_tests<std::string, double>(localities);
+    rebalance_registered_tests<std::string, double>(localities);
+
     return 0;
 }
 
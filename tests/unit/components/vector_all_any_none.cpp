@@ -0,0 +1,112 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/vector.hpp>
+#include <hpx/include/parallel_all_any_none_of.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Define the vector types to be used.
+HPX_REGISTER_VECTOR(double);
+HPX_REGISTER_VECTOR(int);
+
+template <typename T>
+struct cmp
+{
+    cmp(T const& val = T()) : value_(val) {}
+
+    template <typename T_>
+    bool operator()(T_ const& val) const
+    {
+        return val == value_;
+    }
+
+    T value_;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned version)
+    {
+        ar & value_;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename T>
+void test_all_any_none(ExPolicy && policy, hpx::vector<T> const& v,
+    bool all, bool any, bool none, T const& val)
+{
+    HPX_TEST_EQ(
+        hpx::parallel::all_of(policy, v.begin(), v.end(), cmp<T>(val)), all);
+    HPX_TEST_EQ(
+        hpx::parallel::any_of(policy, v.begin(), v.end(), cmp<T>(val)), any);
+    HPX_TEST_EQ(
+        hpx::parallel::none_of(policy, v.begin(), v.end(), cmp<T>(val)), none);
+}
+
+template <typename ExPolicy, typename T>
+void test_all_any_none_async(ExPolicy && policy, hpx::vector<T> const& v,
+    bool all, bool any, bool none, T const& val)
+{
+    HPX_TEST_EQ(
+        hpx::parallel::all_of(policy, v.begin(), v.end(),
+            cmp<T>(val)).get(), all);
+    HPX_TEST_EQ(
+        hpx::parallel::any_of(policy, v.begin(), v.end(),
+            cmp<T>(val)).get(), any);
+    HPX_TEST_EQ(
+        hpx::parallel::none_of(policy, v.begin(), v.end(),
+            cmp<T>(val)).get(), none);
+}
+
+template <typename T>
+void all_any_none_tests(hpx::vector<T> const& v, bool all, bool any,
+    bool none, T const& val)
+{
+    test_all_any_none(hpx::parallel::seq, v, all, any, none, val);
+    test_all_any_none(hpx::parallel::par, v, all, any, none, val);
+    test_all_any_none_async(hpx::parallel::seq(hpx::parallel::task),
+        v, all, any, none, val);
+    test_all_any_none_async(hpx::parallel::par(hpx::parallel::task),
+        v, all, any, none, val);
+}
+
+template <typename T>
+void all_any_none_tests(hpx::vector<T>& v)
+{
+    all_any_none_tests(v, true, true, false, T(0));
+    all_any_none_tests(v, false, false, true, T(1));
+
+    // a single matching element in the last segment
+    v.set_value_sync(v.size() - 1, T(1));
+    all_any_none_tests(v, false, true, false, T(1));
+    all_any_none_tests(v, false, true, false, T(0));
+}
+
+template <typename T>
+void all_any_none_tests()
+{
+    std::size_t const length = 12;
+
+    {
+        hpx::vector<T> v(length, T(0));
+        all_any_none_tests(v);
+    }
+
+    {
+        hpx::vector<T> v(length, T(0), hpx::layout(2));
+        all_any_none_tests(v);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    all_any_none_tests<double>();
+    all_any_none_tests<int>();
+
+    return 0;
+}
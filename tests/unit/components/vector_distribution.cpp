@@ -0,0 +1,210 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/vector.hpp>
+#include <hpx/include/parallel_for_each.hpp>
+#include <hpx/include/parallel_reduce.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <functional>
+#include <iterator>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Define the vector types to be used.
+HPX_REGISTER_VECTOR(int);
+
+struct pfo
+{
+    template <typename T>
+    void operator()(T& val) const
+    {
+        ++val;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void fill_values(hpx::vector<T>& v)
+{
+    for (std::size_t i = 0; i != v.size(); ++i)
+        v.set_value_sync(i, T(i));
+}
+
+template <typename T>
+void verify_values(hpx::vector<T> const& v, T const& offset)
+{
+    typedef typename hpx::vector<T>::const_iterator const_iterator;
+
+    std::size_t count = 0;
+
+    const_iterator end = v.end();
+    for (const_iterator it = v.begin(); it != end; ++it, ++count)
+    {
+        HPX_TEST_EQ(*it, T(count) + offset);
+        HPX_TEST_EQ(v.get_value_sync(count), T(count) + offset);
+    }
+
+    HPX_TEST_EQ(count, v.size());
+}
+
+// The segment iterators visit every segment once, the local segment
+// iterators visit every partition once.
+template <typename T>
+void verify_segments(hpx::vector<T>& v, std::size_t num_segments,
+    std::size_t num_partitions)
+{
+    typedef typename hpx::vector<T>::local_segment_iterator
+        local_segment_iterator;
+
+    HPX_TEST_EQ(
+        std::size_t(std::distance(v.segment_begin(), v.segment_end())),
+        num_segments);
+
+    boost::uint32_t here = hpx::get_locality_id();
+
+    std::size_t count = 0;
+    local_segment_iterator end = v.segment_end(here);
+    for (local_segment_iterator it = v.segment_begin(here); it != end; ++it)
+        ++count;
+
+    if (hpx::find_all_localities().size() == 1)
+        HPX_TEST_EQ(count, num_partitions);
+    else
+        HPX_TEST(count <= num_partitions);
+}
+
+template <typename T>
+void distribution_tests(hpx::vector<T>& v)
+{
+    fill_values(v);
+    verify_values(v, T(0));
+
+    // segmented algorithms honor the distribution
+    T expected = T(v.size() * (v.size() - 1) / 2);
+    HPX_TEST_EQ(
+        hpx::parallel::reduce(hpx::parallel::seq, v.begin(), v.end(),
+            T(0), std::plus<T>()),
+        expected);
+    HPX_TEST_EQ(
+        hpx::parallel::reduce(hpx::parallel::par, v.begin(), v.end(),
+            T(0), std::plus<T>()),
+        expected);
+
+    hpx::parallel::for_each(hpx::parallel::par, v.begin(), v.end(), pfo());
+    verify_values(v, T(1));
+
+    // partial ranges start and end inside of segments
+    T partial = T(0);
+    for (std::size_t i = 3; i != v.size() - 2; ++i)
+        partial += T(i + 1);
+
+    HPX_TEST_EQ(
+        hpx::parallel::reduce(hpx::parallel::par,
+            v.begin() + 3, v.end() - 2, T(0), std::plus<T>()),
+        partial);
+
+    // copies share the distribution
+    hpx::vector<T> c(v);
+    verify_values(c, T(1));
+}
+
+// Empty vectors have neither elements nor segments.
+template <typename T>
+void empty_distribution_tests(hpx::vector<T>& v)
+{
+    HPX_TEST_EQ(v.size(), std::size_t(0));
+    HPX_TEST(v.begin() == v.end());
+    HPX_TEST(v.segment_begin() == v.segment_end());
+    verify_values(v, T(0));
+
+    HPX_TEST_EQ(
+        hpx::parallel::reduce(hpx::parallel::par, v.begin(), v.end(),
+            T(0), std::plus<T>()),
+        T(0));
+    hpx::parallel::for_each(hpx::parallel::par, v.begin(), v.end(), pfo());
+
+    hpx::vector<T> c(v);
+    HPX_TEST_EQ(c.size(), std::size_t(0));
+}
+
+template <typename T>
+void distribution_tests()
+{
+    std::size_t const num = 1007;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    {
+        hpx::vector<T> v(num, hpx::block_cyclic_layout(7));
+        verify_segments(v, (num + 6) / 7, 1);
+        distribution_tests(v);
+    }
+
+    {
+        hpx::vector<T> v(num, hpx::block_cyclic_layout(7, 3));
+        verify_segments(v, (num + 6) / 7, 3);
+        distribution_tests(v);
+    }
+
+    {
+        hpx::vector<T> v(num, hpx::block_cyclic_layout(13, 4, localities));
+        distribution_tests(v);
+    }
+
+    {
+        hpx::vector<T> v(0, hpx::block_cyclic_layout(7, 3, localities));
+        empty_distribution_tests(v);
+    }
+
+    // cyclic distribution
+    {
+        hpx::vector<T> v(101, hpx::block_cyclic_layout(1, 2, localities));
+        distribution_tests(v);
+    }
+
+    {
+        hpx::vector<T> v(num, hpx::weighted_layout(localities));
+        distribution_tests(v);
+    }
+
+    {
+        // give the localities 16, 32, 48, ... cores
+        std::vector<std::size_t> weights;
+        for (std::size_t i = 0; i != localities.size(); ++i)
+            weights.push_back(16 * (i + 1));
+
+        hpx::vector<T> v(num, T(0), hpx::weighted_layout(localities, weights));
+        distribution_tests(v);
+    }
+
+    {
+        hpx::vector<T> v(0, T(0), hpx::weighted_layout(localities));
+        empty_distribution_tests(v);
+    }
+
+    {
+        // 7 weighted segments of size 2 need only 5 segments to hold 9
+        // elements, the last locality does not get a partition
+        std::vector<hpx::id_type> here(3, hpx::find_here());
+        std::vector<std::size_t> weights;
+        weights.push_back(4);
+        weights.push_back(2);
+        weights.push_back(1);
+
+        hpx::vector<T> v(9, hpx::weighted_layout(here, weights));
+        verify_segments(v, 5, 2);
+        distribution_tests(v);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    distribution_tests<int>();
+
+    return 0;
+}
@@ -0,0 +1,84 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/vector.hpp>
+#include <hpx/include/parallel_fill.hpp>
+#include <hpx/include/parallel_count.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Define the vector types to be used.
+HPX_REGISTER_VECTOR(double);
+HPX_REGISTER_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void verify_values(hpx::vector<T> const& v, T const& val)
+{
+    HPX_TEST_EQ(
+        std::size_t(hpx::parallel::count(
+            hpx::parallel::seq, v.begin(), v.end(), val)),
+        v.size());
+}
+
+template <typename ExPolicy, typename T>
+void test_fill(ExPolicy && policy, hpx::vector<T>& v, T val)
+{
+    hpx::parallel::fill(policy, v.begin(), v.end(), val);
+    verify_values(v, val);
+}
+
+template <typename ExPolicy, typename T>
+void test_fill_async(ExPolicy && policy, hpx::vector<T>& v, T val)
+{
+    hpx::parallel::fill(policy, v.begin(), v.end(), val).get();
+    verify_values(v, val);
+}
+
+template <typename T>
+void fill_tests(hpx::vector<T>& v)
+{
+    test_fill(hpx::parallel::seq, v, T(1));
+    test_fill(hpx::parallel::par, v, T(2));
+    test_fill_async(hpx::parallel::seq(hpx::parallel::task), v, T(3));
+    test_fill_async(hpx::parallel::par(hpx::parallel::task), v, T(4));
+}
+
+template <typename T>
+void fill_tests()
+{
+    std::size_t const length = 12;
+
+    {
+        hpx::vector<T> v;
+        hpx::parallel::fill(hpx::parallel::seq, v.begin(), v.end(), T(1));
+        hpx::parallel::fill(hpx::parallel::par, v.begin(), v.end(), T(1));
+        hpx::parallel::fill(hpx::parallel::seq(hpx::parallel::task),
+            v.begin(), v.end(), T(1)).get();
+        hpx::parallel::fill(hpx::parallel::par(hpx::parallel::task),
+            v.begin(), v.end(), T(1)).get();
+    }
+
+    {
+        hpx::vector<T> v(length);
+        fill_tests(v);
+    }
+
+    {
+        hpx::vector<T> v(length, T(0), hpx::layout(2));
+        fill_tests(v);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    fill_tests<double>();
+    fill_tests<int>();
+
+    return 0;
+}
@@ -0,0 +1,121 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/vector.hpp>
+#include <hpx/include/parallel_find.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Define the vector types to be used.
+HPX_REGISTER_VECTOR(double);
+HPX_REGISTER_VECTOR(int);
+
+template <typename T>
+struct cmp
+{
+    cmp(T const& val = T()) : value_(val) {}
+
+    template <typename T_>
+    bool operator()(T_ const& val) const
+    {
+        return val == value_;
+    }
+
+    T value_;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned version)
+    {
+        ar & value_;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename T>
+void test_find(ExPolicy && policy, hpx::vector<T> const& v,
+    std::size_t pos, T const& val)
+{
+    typedef typename hpx::vector<T>::const_iterator const_iterator;
+
+    const_iterator expected = v.begin();
+    std::advance(expected, pos);
+
+    HPX_TEST(hpx::parallel::find(policy, v.begin(), v.end(), val) ==
+        expected);
+    HPX_TEST(hpx::parallel::find_if(policy, v.begin(), v.end(),
+        cmp<T>(val)) == expected);
+
+    // a value which is not in the sequence
+    HPX_TEST(hpx::parallel::find(policy, v.begin(), v.end(), T(42)) ==
+        v.end());
+}
+
+template <typename ExPolicy, typename T>
+void test_find_async(ExPolicy && policy, hpx::vector<T> const& v,
+    std::size_t pos, T const& val)
+{
+    typedef typename hpx::vector<T>::const_iterator const_iterator;
+
+    const_iterator expected = v.begin();
+    std::advance(expected, pos);
+
+    HPX_TEST(hpx::parallel::find(policy, v.begin(), v.end(), val).get() ==
+        expected);
+    HPX_TEST(hpx::parallel::find_if(policy, v.begin(), v.end(),
+        cmp<T>(val)).get() == expected);
+}
+
+template <typename T>
+void find_tests(hpx::vector<T>& v, std::size_t pos)
+{
+    // make sure the first occurrence is reported
+    v.set_value_sync(pos, T(1));
+    v.set_value_sync(pos + 1, T(1));
+
+    test_find(hpx::parallel::seq, v, pos, T(1));
+    test_find(hpx::parallel::par, v, pos, T(1));
+    test_find_async(hpx::parallel::seq(hpx::parallel::task), v, pos, T(1));
+    test_find_async(hpx::parallel::par(hpx::parallel::task), v, pos, T(1));
+}
+
+template <typename T>
+void find_tests()
+{
+    std::size_t const length = 12;
+
+    // place the value to find close to the end, after a segment boundary
+    {
+        hpx::vector<T> v(length, T(0));
+        find_tests(v, length - 2);
+    }
+
+    {
+        hpx::vector<T> v(length, T(0), hpx::layout(2));
+        find_tests(v, length - 2);
+    }
+
+    // several segments per locality, these are searched in more than one
+    // wave, the later waves are skipped if an earlier one has a match
+    {
+        hpx::vector<T> v(length, T(0), hpx::block_cyclic_layout(2, 3));
+        find_tests(v, length - 2);
+    }
+
+    {
+        hpx::vector<T> v(length, T(0), hpx::block_cyclic_layout(2, 3));
+        find_tests(v, 1);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    find_tests<double>();
+    find_tests<int>();
+
+    return 0;
+}
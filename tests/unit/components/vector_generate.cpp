@@ -0,0 +1,93 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/vector.hpp>
+#include <hpx/include/parallel_generate.hpp>
+#include <hpx/include/parallel_count.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Define the vector types to be used.
+HPX_REGISTER_VECTOR(double);
+HPX_REGISTER_VECTOR(int);
+
+template <typename T>
+struct gen
+{
+    gen(T const& val = T()) : value_(val) {}
+
+    T operator()() const
+    {
+        return value_;
+    }
+
+    T value_;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned version)
+    {
+        ar & value_;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void verify_values(hpx::vector<T> const& v, T const& val)
+{
+    HPX_TEST_EQ(
+        std::size_t(hpx::parallel::count(
+            hpx::parallel::seq, v.begin(), v.end(), val)),
+        v.size());
+}
+
+template <typename ExPolicy, typename T>
+void test_generate(ExPolicy && policy, hpx::vector<T>& v, T val)
+{
+    hpx::parallel::generate(policy, v.begin(), v.end(), gen<T>(val));
+    verify_values(v, val);
+}
+
+template <typename ExPolicy, typename T>
+void test_generate_async(ExPolicy && policy, hpx::vector<T>& v, T val)
+{
+    hpx::parallel::generate(policy, v.begin(), v.end(), gen<T>(val)).get();
+    verify_values(v, val);
+}
+
+template <typename T>
+void generate_tests(hpx::vector<T>& v)
+{
+    test_generate(hpx::parallel::seq, v, T(1));
+    test_generate(hpx::parallel::par, v, T(2));
+    test_generate_async(hpx::parallel::seq(hpx::parallel::task), v, T(3));
+    test_generate_async(hpx::parallel::par(hpx::parallel::task), v, T(4));
+}
+
+template <typename T>
+void generate_tests()
+{
+    std::size_t const length = 12;
+
+    {
+        hpx::vector<T> v(length);
+        generate_tests(v);
+    }
+
+    {
+        hpx::vector<T> v(length, T(0), hpx::layout(2));
+        generate_tests(v);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    generate_tests<double>();
+    generate_tests<int>();
+
+    return 0;
+}
@@ -103,6 +103,43 @@ void handle_values_tests_distributed_access(hpx::vector<T>& v)
     compare_vectors(values2, result2);
 }
 
+template <typename T>
+void handle_values_tests_scattered_access(hpx::vector<T>& v)
+{
+    fill_vector(v, T(42));
+
+    // unsorted positions alternating between the front and the back of the
+    // vector, thus touching the partitions in no particular order
+    std::vector<std::size_t> positions;
+    for (std::size_t i = 0; i < v.size() / 2; i += 2)
+    {
+        positions.push_back(v.size() - i - 1);
+        positions.push_back(i);
+    }
+
+    std::vector<T> values(positions.size());
+    fill_vector(values, T(48), T(3));
+
+    v.set_values_sync(positions, values);
+    std::vector<T> result = v.get_values_sync(positions);
+
+    compare_vectors(values, result);
+
+    // the elements not touched above are unchanged
+    std::vector<std::size_t> positions2;
+    for (std::size_t i = 1; i < v.size() / 2; i += 2)
+    {
+        positions2.push_back(i);
+        positions2.push_back(v.size() - i - 1);
+    }
+
+    std::vector<T> values2(positions2.size());
+    fill_vector(values2, T(42), T(0));
+
+    std::vector<T> result2 = v.get_values(positions2).get();
+    compare_vectors(values2, result2);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 template <typename T, typename DistPolicy>
@@ -118,6 +155,11 @@ void handle_values_tests_with_policy(std::size_t size, std::size_t localities,
         hpx::vector<T> v(size, policy);
         handle_values_tests_distributed_access(v);
     }
+
+    {
+        hpx::vector<T> v(size, policy);
+        handle_values_tests_scattered_access(v);
+    }
 }
 
 template <typename T>
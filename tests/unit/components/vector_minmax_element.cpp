@@ -0,0 +1,104 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/vector.hpp>
+#include <hpx/include/parallel_minmax.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+// Define the vector types to be used.
+HPX_REGISTER_VECTOR(double);
+HPX_REGISTER_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename T>
+void test_minmax_element(ExPolicy && policy, hpx::vector<T> const& v,
+    std::size_t min_pos, std::size_t max_pos)
+{
+    typedef typename hpx::vector<T>::const_iterator const_iterator;
+
+    const_iterator min_it = v.begin();
+    std::advance(min_it, min_pos);
+    const_iterator max_it = v.begin();
+    std::advance(max_it, max_pos);
+
+    HPX_TEST(hpx::parallel::min_element(policy, v.begin(), v.end()) ==
+        min_it);
+    HPX_TEST(hpx::parallel::max_element(policy, v.begin(), v.end()) ==
+        max_it);
+
+    std::pair<const_iterator, const_iterator> r =
+        hpx::parallel::minmax_element(policy, v.begin(), v.end());
+    HPX_TEST(r.first == min_it);
+    HPX_TEST(r.second == max_it);
+}
+
+template <typename ExPolicy, typename T>
+void test_minmax_element_async(ExPolicy && policy, hpx::vector<T> const& v,
+    std::size_t min_pos, std::size_t max_pos)
+{
+    typedef typename hpx::vector<T>::const_iterator const_iterator;
+
+    const_iterator min_it = v.begin();
+    std::advance(min_it, min_pos);
+    const_iterator max_it = v.begin();
+    std::advance(max_it, max_pos);
+
+    HPX_TEST(hpx::parallel::min_element(policy, v.begin(), v.end()).get() ==
+        min_it);
+    HPX_TEST(hpx::parallel::max_element(policy, v.begin(), v.end()).get() ==
+        max_it);
+
+    std::pair<const_iterator, const_iterator> r =
+        hpx::parallel::minmax_element(policy, v.begin(), v.end()).get();
+    HPX_TEST(r.first == min_it);
+    HPX_TEST(r.second == max_it);
+}
+
+template <typename T>
+void minmax_element_tests(hpx::vector<T>& v)
+{
+    std::size_t const min_pos = v.size() - 1;
+    std::size_t const max_pos = 1;
+
+    v.set_value_sync(min_pos, T(-1));
+    v.set_value_sync(max_pos, T(1));
+
+    test_minmax_element(hpx::parallel::seq, v, min_pos, max_pos);
+    test_minmax_element(hpx::parallel::par, v, min_pos, max_pos);
+    test_minmax_element_async(hpx::parallel::seq(hpx::parallel::task),
+        v, min_pos, max_pos);
+    test_minmax_element_async(hpx::parallel::par(hpx::parallel::task),
+        v, min_pos, max_pos);
+}
+
+template <typename T>
+void minmax_element_tests()
+{
+    std::size_t const length = 12;
+
+    {
+        hpx::vector<T> v(length, T(0));
+        minmax_element_tests(v);
+    }
+
+    {
+        hpx::vector<T> v(length, T(0), hpx::layout(2));
+        minmax_element_tests(v);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    minmax_element_tests<double>();
+    minmax_element_tests<int>();
+
+    return 0;
+}
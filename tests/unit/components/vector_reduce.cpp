@@ -0,0 +1,65 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/vector.hpp>
+#include <hpx/include/parallel_reduce.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <functional>
+
+///////////////////////////////////////////////////////////////////////////////
+// Define the vector types to be used.
+HPX_REGISTER_VECTOR(double);
+HPX_REGISTER_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void reduce_tests(std::size_t num, hpx::vector<T> const& v)
+{
+    HPX_TEST_EQ(
+        hpx::parallel::reduce(hpx::parallel::seq, v.begin(), v.end(),
+            T(0), std::plus<T>()),
+        T(num));
+    HPX_TEST_EQ(
+        hpx::parallel::reduce(hpx::parallel::par, v.begin(), v.end(),
+            T(0), std::plus<T>()),
+        T(num));
+
+    HPX_TEST_EQ(
+        hpx::parallel::reduce(hpx::parallel::seq(hpx::parallel::task),
+            v.begin(), v.end(), T(1), std::plus<T>()).get(),
+        T(num + 1));
+    HPX_TEST_EQ(
+        hpx::parallel::reduce(hpx::parallel::par(hpx::parallel::task),
+            v.begin(), v.end(), T(1), std::plus<T>()).get(),
+        T(num + 1));
+}
+
+template <typename T>
+void reduce_tests()
+{
+    std::size_t const num = 10007;
+
+    {
+        hpx::vector<T> v(num, T(1));
+        reduce_tests(num, v);
+    }
+
+    {
+        hpx::vector<T> v(num, T(1), hpx::layout(2));
+        reduce_tests(num, v);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    reduce_tests<int>();
+    reduce_tests<double>();
+
+    return 0;
+}
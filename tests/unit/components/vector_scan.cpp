@@ -0,0 +1,98 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/vector.hpp>
+#include <hpx/include/parallel_scan.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <functional>
+
+///////////////////////////////////////////////////////////////////////////////
+// Define the vector types to be used.
+HPX_REGISTER_VECTOR(double);
+HPX_REGISTER_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void verify_values(hpx::vector<T> const& v, T const& init, bool inclusive)
+{
+    typedef typename hpx::vector<T>::const_iterator const_iterator;
+
+    T expected = inclusive ? T(init + 1) : init;
+
+    std::size_t size = 0;
+    const_iterator end = v.end();
+    for (const_iterator it = v.begin(); it != end; ++it, ++size)
+    {
+        HPX_TEST_EQ(*it, expected);
+        expected = expected + T(1);
+    }
+
+    HPX_TEST_EQ(size, v.size());
+}
+
+template <typename ExPolicy, typename T>
+void test_scan(ExPolicy && policy, hpx::vector<T> const& in,
+    hpx::vector<T>& out)
+{
+    HPX_TEST(hpx::parallel::inclusive_scan(policy, in.begin(), in.end(),
+        out.begin(), T(0), std::plus<T>()) == out.end());
+    verify_values(out, T(0), true);
+
+    HPX_TEST(hpx::parallel::exclusive_scan(policy, in.begin(), in.end(),
+        out.begin(), T(1), std::plus<T>()) == out.end());
+    verify_values(out, T(1), false);
+}
+
+template <typename ExPolicy, typename T>
+void test_scan_async(ExPolicy && policy, hpx::vector<T> const& in,
+    hpx::vector<T>& out)
+{
+    HPX_TEST(hpx::parallel::inclusive_scan(policy, in.begin(), in.end(),
+        out.begin(), T(0), std::plus<T>()).get() == out.end());
+    verify_values(out, T(0), true);
+
+    HPX_TEST(hpx::parallel::exclusive_scan(policy, in.begin(), in.end(),
+        out.begin(), T(1), std::plus<T>()).get() == out.end());
+    verify_values(out, T(1), false);
+}
+
+template <typename T>
+void scan_tests(hpx::vector<T> const& in, hpx::vector<T>& out)
+{
+    test_scan(hpx::parallel::seq, in, out);
+    test_scan(hpx::parallel::par, in, out);
+    test_scan_async(hpx::parallel::seq(hpx::parallel::task), in, out);
+    test_scan_async(hpx::parallel::par(hpx::parallel::task), in, out);
+}
+
+template <typename T>
+void scan_tests()
+{
+    std::size_t const length = 12;
+
+    {
+        hpx::vector<T> in(length, T(1));
+        hpx::vector<T> out(length);
+        scan_tests(in, out);
+    }
+
+    {
+        hpx::vector<T> in(length, T(1), hpx::layout(2));
+        hpx::vector<T> out(length, T(0), hpx::layout(2));
+        scan_tests(in, out);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    scan_tests<double>();
+    scan_tests<int>();
+
+    return 0;
+}
@@ -0,0 +1,101 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/vector.hpp>
+#include <hpx/include/parallel_transform.hpp>
+#include <hpx/include/parallel_count.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Define the vector types to be used.
+HPX_REGISTER_VECTOR(double);
+HPX_REGISTER_VECTOR(int);
+
+struct add_one
+{
+    template <typename T>
+    T operator()(T const& val) const
+    {
+        return val + T(1);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void verify_values(hpx::vector<T> const& v, T const& val)
+{
+    HPX_TEST_EQ(
+        std::size_t(hpx::parallel::count(
+            hpx::parallel::seq, v.begin(), v.end(), val)),
+        v.size());
+}
+
+template <typename ExPolicy, typename T>
+void test_transform(ExPolicy && policy, hpx::vector<T>& in,
+    hpx::vector<T>& out, T val)
+{
+    typename hpx::vector<T>::iterator result =
+        hpx::parallel::transform(policy, in.begin(), in.end(), out.begin(),
+            add_one());
+
+    HPX_TEST(result == out.end());
+    verify_values(out, val);
+}
+
+template <typename ExPolicy, typename T>
+void test_transform_async(ExPolicy && policy, hpx::vector<T>& in,
+    hpx::vector<T>& out, T val)
+{
+    typename hpx::vector<T>::iterator result =
+        hpx::parallel::transform(policy, in.begin(), in.end(), out.begin(),
+            add_one()).get();
+
+    HPX_TEST(result == out.end());
+    verify_values(out, val);
+}
+
+template <typename T>
+void transform_tests(hpx::vector<T>& in, hpx::vector<T>& out)
+{
+    test_transform(hpx::parallel::seq, in, out, T(2));
+    test_transform(hpx::parallel::par, in, out, T(2));
+    test_transform_async(hpx::parallel::seq(hpx::parallel::task),
+        in, out, T(2));
+    test_transform_async(hpx::parallel::par(hpx::parallel::task),
+        in, out, T(2));
+
+    // transform in place
+    test_transform(hpx::parallel::par, in, in, T(2));
+    test_transform(hpx::parallel::seq, in, in, T(3));
+}
+
+template <typename T>
+void transform_tests()
+{
+    std::size_t const length = 12;
+
+    {
+        hpx::vector<T> in(length, T(1));
+        hpx::vector<T> out(length);
+        transform_tests(in, out);
+    }
+
+    {
+        hpx::vector<T> in(length, T(1), hpx::layout(2));
+        hpx::vector<T> out(length, T(0), hpx::layout(2));
+        transform_tests(in, out);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    transform_tests<double>();
+    transform_tests<int>();
+
+    return 0;
+}
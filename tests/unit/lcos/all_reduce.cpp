@@ -0,0 +1,160 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/lcos/all_reduce.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+typedef hpx::serialization::serialize_buffer<double> buffer_type;
+
+HPX_REGISTER_ALL_REDUCE(double, std::plus<double>, double_plus);
+
+///////////////////////////////////////////////////////////////////////////////
+// The value contributed by local thread 'thread' of site 'site' in the given
+// iteration, and the expected sum over all threads and sites.
+double value(std::size_t site, std::size_t thread, std::size_t iteration,
+    std::size_t i)
+{
+    return double(site * 100 + thread * 10 + iteration + i);
+}
+
+double expected(std::size_t num_sites, std::size_t num_local,
+    std::size_t iteration, std::size_t i)
+{
+    double sum = 0.0;
+    for (std::size_t site = 0; site != num_sites; ++site)
+    {
+        for (std::size_t thread = 0; thread != num_local; ++thread)
+            sum += value(site, thread, iteration, i);
+    }
+    return sum;
+}
+
+buffer_type make_data(std::size_t size, std::size_t site, std::size_t thread,
+    std::size_t iteration)
+{
+    buffer_type data(new double[size], size, buffer_type::take);
+    for (std::size_t i = 0; i != size; ++i)
+        data[i] = value(site, thread, iteration, i);
+    return data;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void all_reduce_test(hpx::lcos::reduction_group<double, std::plus<double> >& g,
+    std::size_t thread, std::size_t num_local, std::size_t size,
+    std::size_t iterations)
+{
+    std::size_t num_sites = hpx::get_num_localities_sync();
+    std::size_t site = hpx::get_locality_id();
+
+    for (std::size_t it = 0; it != iterations; ++it)
+    {
+        buffer_type result = hpx::lcos::all_reduce(g,
+            make_data(size, site, thread, it)).get();
+
+        HPX_TEST_EQ(result.size(), size);
+        for (std::size_t i = 0; i != result.size(); ++i)
+            HPX_TEST_EQ(result[i], expected(num_sites, num_local, it, i));
+    }
+}
+
+void reduce_scatter_test(
+    hpx::lcos::reduction_group<double, std::plus<double> >& g,
+    std::size_t thread, std::size_t num_local, std::size_t size,
+    std::size_t iterations)
+{
+    std::size_t num_sites = hpx::get_num_localities_sync();
+    std::size_t site = hpx::get_locality_id();
+
+    std::size_t first = (size * site) / num_sites;
+    std::size_t last = (size * (site + 1)) / num_sites;
+
+    for (std::size_t it = 0; it != iterations; ++it)
+    {
+        buffer_type result = hpx::lcos::reduce_scatter(g,
+            make_data(size, site, thread, it)).get();
+
+        HPX_TEST_EQ(result.size(), last - first);
+        for (std::size_t i = 0; i != result.size(); ++i)
+        {
+            HPX_TEST_EQ(result[i],
+                expected(num_sites, num_local, it, first + i));
+        }
+    }
+}
+
+void run_test(std::string const& name, std::size_t num_local,
+    std::size_t size, std::size_t iterations)
+{
+    typedef hpx::lcos::reduction_group<double, std::plus<double> > group_type;
+
+    // use a small threshold to exercise both algorithms
+    group_type g(name, num_local, std::plus<double>(), ~0U, ~0U, 1024);
+
+    for (std::size_t j = 0; j != 2; ++j)
+    {
+        std::vector<hpx::future<void> > threads;
+        for (std::size_t t = 1; t != num_local; ++t)
+        {
+            threads.push_back(hpx::async(
+                j == 0 ? &all_reduce_test : &reduce_scatter_test,
+                boost::ref(g), t, num_local, size, iterations));
+        }
+
+        if (j == 0)
+            all_reduce_test(g, 0, num_local, size, iterations);
+        else
+            reduce_scatter_test(g, 0, num_local, size, iterations);
+
+        hpx::wait_all(threads);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    std::size_t iterations = vm["iterations"].as<std::size_t>();
+
+    // recursive doubling
+    run_test("/test/all_reduce/small", 1, 10, iterations);
+    run_test("/test/all_reduce/small_local", 4, 10, iterations);
+
+    // ring
+    run_test("/test/all_reduce/large", 1, 1000, iterations);
+    run_test("/test/all_reduce/large_local", 4, 1001, iterations);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace boost::program_options;
+
+    // Configure application-specific options
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("iterations", value<std::size_t>()->default_value(10),
+            "the number of times to repeat the test")
+        ;
+
+    // run hpx_main on all localities
+    using namespace boost::assign;
+    std::vector<std::string> cfg;
+    cfg += "hpx.run_hpx_main!=1";
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+      "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,165 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/lcos/all_to_all.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <string>
+#include <vector>
+
+typedef hpx::serialization::serialize_buffer<int> buffer_type;
+
+HPX_REGISTER_ALL_TO_ALL(int, int);
+
+///////////////////////////////////////////////////////////////////////////////
+// The i-th element sent from site 'from' to site 'to' in the given iteration
+int value(std::size_t from, std::size_t to, std::size_t iteration,
+    std::size_t i)
+{
+    return int(from * 10000 + to * 1000 + iteration * 100 + i);
+}
+
+void all_to_all_test(hpx::lcos::exchange_group<int>& g, std::size_t count,
+    std::size_t iterations)
+{
+    std::size_t num_sites = g.get_num_sites();
+    std::size_t site = g.get_this_site();
+
+    for (std::size_t it = 0; it != iterations; ++it)
+    {
+        buffer_type data(new int[count * num_sites], count * num_sites,
+            buffer_type::take);
+        for (std::size_t to = 0; to != num_sites; ++to)
+        {
+            for (std::size_t i = 0; i != count; ++i)
+                data[to * count + i] = value(site, to, it, i);
+        }
+
+        std::vector<buffer_type> result = hpx::lcos::all_to_all(g, data).get();
+
+        HPX_TEST_EQ(result.size(), num_sites);
+        for (std::size_t from = 0; from != result.size(); ++from)
+        {
+            HPX_TEST_EQ(result[from].size(), count);
+            for (std::size_t i = 0; i != result[from].size(); ++i)
+                HPX_TEST_EQ(result[from][i], value(from, site, it, i));
+        }
+    }
+}
+
+void all_to_allv_test(hpx::lcos::exchange_group<int>& g,
+    std::size_t iterations)
+{
+    std::size_t num_sites = g.get_num_sites();
+    std::size_t site = g.get_this_site();
+
+    for (std::size_t it = 0; it != iterations; ++it)
+    {
+        // site 'from' sends from + to + 1 elements to site 'to'
+        std::vector<std::size_t> counts;
+        std::size_t size = 0;
+        for (std::size_t to = 0; to != num_sites; ++to)
+        {
+            counts.push_back(site + to + 1);
+            size += counts.back();
+        }
+
+        buffer_type data(new int[size], size, buffer_type::take);
+        std::size_t offset = 0;
+        for (std::size_t to = 0; to != num_sites; ++to)
+        {
+            for (std::size_t i = 0; i != counts[to]; ++i)
+                data[offset++] = value(site, to, it, i);
+        }
+
+        std::vector<buffer_type> result =
+            hpx::lcos::all_to_allv(g, data, counts).get();
+
+        HPX_TEST_EQ(result.size(), num_sites);
+        for (std::size_t from = 0; from != result.size(); ++from)
+        {
+            HPX_TEST_EQ(result[from].size(), from + site + 1);
+            for (std::size_t i = 0; i != result[from].size(); ++i)
+                HPX_TEST_EQ(result[from][i], value(from, site, it, i));
+        }
+    }
+}
+
+void scatter_test(hpx::lcos::exchange_group<int>& g, std::size_t size,
+    std::size_t iterations)
+{
+    std::size_t num_sites = g.get_num_sites();
+    std::size_t site = g.get_this_site();
+
+    for (std::size_t it = 0; it != iterations; ++it)
+    {
+        std::size_t root = it % num_sites;
+
+        buffer_type data;
+        if (site == root)
+        {
+            data = buffer_type(new int[size], size, buffer_type::take);
+            for (std::size_t i = 0; i != size; ++i)
+                data[i] = value(root, 0, it, i);
+        }
+
+        buffer_type result = hpx::lcos::scatter(g, data, root).get();
+
+        std::size_t first = (size * site) / num_sites;
+        std::size_t last = (size * (site + 1)) / num_sites;
+
+        HPX_TEST_EQ(result.size(), last - first);
+        for (std::size_t i = 0; i != result.size(); ++i)
+            HPX_TEST_EQ(result[i], value(root, 0, it, first + i));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    std::size_t iterations = vm["iterations"].as<std::size_t>();
+
+    {
+        hpx::lcos::exchange_group<int> g("/test/all_to_all");
+
+        all_to_all_test(g, 1, iterations);
+        all_to_all_test(g, 100, iterations);
+        all_to_allv_test(g, iterations);
+        scatter_test(g, 99, iterations);
+
+        // make sure the operations can be mixed
+        all_to_all_test(g, 10, iterations);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace boost::program_options;
+
+    // Configure application-specific options
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("iterations", value<std::size_t>()->default_value(10),
+            "the number of times to repeat the test")
+        ;
+
+    // run hpx_main on all localities
+    using namespace boost::assign;
+    std::vector<std::string> cfg;
+    cfg += "hpx.run_hpx_main!=1";
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+      "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
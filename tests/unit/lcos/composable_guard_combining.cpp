@@ -0,0 +1,255 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/local_lcos.hpp>
+#include <hpx/lcos/local/composable_guard.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <vector>
+
+#include <boost/atomic.hpp>
+#include <boost/exception_ptr.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+
+using hpx::lcos::local::guard;
+using hpx::lcos::local::guard_set;
+
+///////////////////////////////////////////////////////////////////////////////
+// A task run on an idle guard in combining mode is run by the calling thread
+void set_flag(bool& flag)
+{
+    flag = true;
+}
+
+void test_inline_execution()
+{
+    guard g(true);
+
+    bool flag = false;
+    run_guarded(g, boost::bind(&set_flag, boost::ref(flag)));
+    HPX_TEST(flag);
+
+    // the same holds for a guard set if all guards are free
+    boost::shared_ptr<guard> g1 = boost::make_shared<guard>(true);
+    boost::shared_ptr<guard> g2 = boost::make_shared<guard>(true);
+
+    guard_set gs;
+    gs.add(g1);
+    gs.add(g2);
+
+    flag = false;
+    run_guarded(gs, boost::bind(&set_flag, boost::ref(flag)));
+    HPX_TEST(flag);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Tasks queued while the guard is held are run back-to-back by the thread
+// holding it.
+void hold_guard(hpx::thread::id& id, hpx::lcos::local::promise<void>& started,
+    hpx::shared_future<void> go)
+{
+    id = hpx::this_thread::get_id();
+    started.set_value();
+    go.get();
+}
+
+void record_thread(hpx::thread::id& id)
+{
+    id = hpx::this_thread::get_id();
+}
+
+void signal_done(hpx::lcos::local::promise<void>& done)
+{
+    done.set_value();
+}
+
+void submit_holder(guard& g, hpx::thread::id& id,
+    hpx::lcos::local::promise<void>& started, hpx::shared_future<void> go)
+{
+    run_guarded(g, boost::bind(&hold_guard, boost::ref(id),
+        boost::ref(started), go));
+}
+
+void test_combining()
+{
+    guard g(true);
+
+    hpx::lcos::local::promise<void> started, go, done;
+    hpx::thread::id holder, first, second;
+
+    hpx::future<void> f = hpx::async(&submit_holder, boost::ref(g),
+        boost::ref(holder), boost::ref(started), go.get_future().share());
+    started.get_future().get();
+
+    // the guard is held, these are queued
+    run_guarded(g, boost::bind(&record_thread, boost::ref(first)));
+    run_guarded(g, boost::bind(&record_thread, boost::ref(second)));
+    run_guarded(g, boost::bind(&signal_done, boost::ref(done)));
+
+    go.set_value();
+    done.get_future().get();
+    f.get();
+
+    HPX_TEST(holder != hpx::thread::id());
+    HPX_TEST(first == holder);
+    HPX_TEST(second == holder);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// An exception thrown by a task run in combining mode is reported through
+// the error handler, it does not propagate out of the call which happened
+// to run the task, and the guard keeps working.
+boost::atomic<std::size_t> errors_reported(0);
+
+void count_error(boost::exception_ptr const&)
+{
+    ++errors_reported;
+}
+
+void throw_error()
+{
+    HPX_THROW_EXCEPTION(hpx::bad_parameter, "throw_error",
+        "the guarded task failed");
+}
+
+void test_exceptions(bool combining)
+{
+    hpx::lcos::local::guard_error_handler prev =
+        hpx::lcos::local::set_guard_error_handler(&count_error);
+    errors_reported.store(0);
+
+    guard g(combining);
+
+    hpx::lcos::local::promise<void> started, go, done;
+    hpx::thread::id holder, after;
+
+    hpx::future<void> f = hpx::async(&submit_holder, boost::ref(g),
+        boost::ref(holder), boost::ref(started), go.get_future().share());
+    started.get_future().get();
+
+    // the guard is held, these are queued and run by the holder in
+    // combining mode
+    run_guarded(g, &throw_error);
+    run_guarded(g, boost::bind(&record_thread, boost::ref(after)));
+    run_guarded(g, boost::bind(&signal_done, boost::ref(done)));
+
+    go.set_value();
+    done.get_future().get();
+
+    // the exception of the queued task did not escape the holder's call
+    HPX_TEST(!f.has_exception());
+    f.get();
+
+    HPX_TEST_EQ(errors_reported.load(), std::size_t(1));
+    HPX_TEST(after != hpx::thread::id());
+
+    // a throwing task run directly by the caller is reported as well, the
+    // guard is released afterwards
+    hpx::lcos::local::promise<void> done2;
+    run_guarded(g, &throw_error);
+    run_guarded(g, boost::bind(&signal_done, boost::ref(done2)));
+    done2.get_future().get();
+
+    HPX_TEST_EQ(errors_reported.load(), std::size_t(2));
+
+    // the same holds for a multi-guarded task
+    boost::shared_ptr<guard> g1 = boost::make_shared<guard>(combining);
+    boost::shared_ptr<guard> g2 = boost::make_shared<guard>(combining);
+
+    guard_set gs;
+    gs.add(g1);
+    gs.add(g2);
+
+    hpx::lcos::local::promise<void> done3;
+    run_guarded(gs, &throw_error);
+    run_guarded(gs, boost::bind(&signal_done, boost::ref(done3)));
+    done3.get_future().get();
+
+    HPX_TEST_EQ(errors_reported.load(), std::size_t(3));
+
+    hpx::lcos::local::set_guard_error_handler(prev);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Single and multi-guarded tasks on guards in both modes stay serialized
+void increment(std::size_t& counter)
+{
+    ++counter;
+}
+
+void increment_both(std::size_t& c1, std::size_t& c2)
+{
+    ++c1;
+    ++c2;
+}
+
+void test_serialization(bool combining1, bool combining2,
+    std::size_t iterations)
+{
+    boost::shared_ptr<guard> g1 = boost::make_shared<guard>(combining1);
+    boost::shared_ptr<guard> g2 = boost::make_shared<guard>(combining2);
+
+    guard_set gs;
+    gs.add(g1);
+    gs.add(g2);
+
+    std::size_t c1 = 0, c2 = 0;
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        run_guarded(gs, boost::bind(&increment_both, boost::ref(c1),
+            boost::ref(c2)));
+        run_guarded(*g1, boost::bind(&increment, boost::ref(c1)));
+        run_guarded(*g2, boost::bind(&increment, boost::ref(c2)));
+    }
+
+    // this runs after all tasks submitted before on both guards
+    hpx::lcos::local::promise<void> done;
+    run_guarded(gs, boost::bind(&signal_done, boost::ref(done)));
+    done.get_future().get();
+
+    HPX_TEST_EQ(c1, 2 * iterations);
+    HPX_TEST_EQ(c2, 2 * iterations);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    std::size_t iterations = vm["iterations"].as<std::size_t>();
+
+    test_inline_execution();
+    test_combining();
+    test_exceptions(true);
+    test_exceptions(false);
+
+    test_serialization(true, true, iterations);
+    test_serialization(true, false, iterations);
+    test_serialization(false, true, iterations);
+    test_serialization(false, false, iterations);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace boost::program_options;
+
+    // Configure application-specific options
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("iterations", value<std::size_t>()->default_value(3000),
+            "the number of tasks submitted to each guard")
+        ;
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv), 0,
+      "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,107 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/lcos/distributed_channel.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <string>
+#include <vector>
+
+HPX_REGISTER_DISTRIBUTED_CHANNEL(std::size_t, size_t);
+
+///////////////////////////////////////////////////////////////////////////////
+// Every locality sends the values [site * count, (site + 1) * count) to the
+// receiver on locality 0.
+void send_values(std::string const& name, std::size_t batch_size,
+    std::size_t count)
+{
+    std::size_t site = hpx::get_locality_id();
+
+    hpx::lcos::channel_sender<std::size_t> sender(name, batch_size);
+    for (std::size_t i = 0; i != count; ++i)
+        sender.send(site * count + i);
+    sender.close();
+}
+
+void run_test(std::string const& name, std::size_t window,
+    std::size_t batch_size, std::size_t count)
+{
+    std::size_t num_sites = hpx::get_num_localities_sync();
+
+    if (hpx::get_locality_id() != 0)
+    {
+        send_values(name, batch_size, count);
+        return;
+    }
+
+    hpx::lcos::channel_receiver<std::size_t> receiver(name, num_sites,
+        window);
+
+    hpx::future<void> sender = hpx::async(&send_values, name, batch_size,
+        count);
+
+    // the items sent by each sender are received in order
+    std::vector<std::size_t> next(num_sites);
+    for (std::size_t site = 0; site != num_sites; ++site)
+        next[site] = site * count;
+
+    std::size_t received = 0;
+    typedef hpx::lcos::channel_receiver<std::size_t>::iterator iterator;
+    for (iterator it = receiver.begin(); it != receiver.end(); ++it)
+    {
+        std::size_t site = *it / count;
+        HPX_TEST(site < num_sites);
+        HPX_TEST_EQ(*it, next[site]);
+        ++next[site];
+        ++received;
+    }
+
+    HPX_TEST_EQ(received, num_sites * count);
+    HPX_TEST(!receiver.next().get());
+
+    sender.get();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    std::size_t count = vm["count"].as<std::size_t>();
+
+    run_test("/test/distributed_channel/default", 1024, 64, count);
+
+    // a window smaller than the batch size exercises the flow control
+    run_test("/test/distributed_channel/small_window", 4, 16, count);
+    run_test("/test/distributed_channel/single_item", 1, 1, count);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace boost::program_options;
+
+    // Configure application-specific options
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("count", value<std::size_t>()->default_value(1000),
+            "the number of values sent by each locality")
+        ;
+
+    // run hpx_main on all localities
+    using namespace boost::assign;
+    std::vector<std::string> cfg;
+    cfg += "hpx.run_hpx_main!=1";
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+      "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,97 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void barrier_test(hpx::lcos::hierarchical_barrier& b,
+    boost::atomic<std::size_t>& c, std::size_t iterations,
+    std::size_t num_threads)
+{
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        ++c;
+        b.wait();
+
+        // all local threads have entered the barrier of this generation,
+        // none of them can have entered the next one yet
+        std::size_t count = c.load();
+        HPX_TEST(count >= (i + 1) * num_threads);
+        HPX_TEST(count <= (i + 2) * num_threads);
+    }
+}
+
+void run_test(std::string const& name, hpx::lcos::hierarchical_barrier_mode mode,
+    std::size_t arity, boost::program_options::variables_map& vm)
+{
+    std::size_t pxthreads = vm["pxthreads"].as<std::size_t>();
+    std::size_t iterations = vm["iterations"].as<std::size_t>();
+
+    hpx::lcos::hierarchical_barrier b(name, pxthreads + 1, mode, arity);
+
+    boost::atomic<std::size_t> c(0);
+
+    std::vector<hpx::future<void> > threads;
+    threads.reserve(pxthreads);
+    for (std::size_t j = 0; j != pxthreads; ++j)
+    {
+        threads.push_back(hpx::async(&barrier_test, boost::ref(b),
+            boost::ref(c), iterations, pxthreads + 1));
+    }
+
+    barrier_test(b, c, iterations, pxthreads + 1);
+
+    hpx::wait_all(threads);
+    HPX_TEST_EQ(c.load(), iterations * (pxthreads + 1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    run_test("/test/hierarchical_barrier/tree", hpx::lcos::tree_mode, 2, vm);
+    run_test("/test/hierarchical_barrier/tree4", hpx::lcos::tree_mode, 4, vm);
+    run_test("/test/hierarchical_barrier/dissemination",
+        hpx::lcos::dissemination_mode, 2, vm);
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    using namespace boost::program_options;
+
+    // Configure application-specific options
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("pxthreads,T", value<std::size_t>()->default_value(16),
+            "the number of PX threads to invoke on each locality")
+        ("iterations", value<std::size_t>()->default_value(64),
+            "the number of times to repeat the test")
+        ;
+
+    // We force this test to use several threads by default.
+    using namespace boost::assign;
+    std::vector<std::string> cfg;
+    cfg += "hpx.os_threads=" +
+        boost::lexical_cast<std::string>(hpx::threads::hardware_concurrency());
+    cfg += "hpx.run_hpx_main!=1";
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+      "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,118 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/lcos/hierarchical_gather.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <string>
+#include <vector>
+
+HPX_REGISTER_HIERARCHICAL_GATHER(std::size_t, size_t);
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t value(std::size_t site, std::size_t thread, std::size_t iteration)
+{
+    return site * 1000 + thread * 100 + iteration;
+}
+
+void verify(std::vector<std::size_t> const& result, std::size_t num_sites,
+    std::size_t num_local, std::size_t iteration)
+{
+    HPX_TEST_EQ(result.size(), num_sites * num_local);
+    for (std::size_t site = 0; site != num_sites; ++site)
+    {
+        for (std::size_t t = 0; t != num_local; ++t)
+        {
+            HPX_TEST_EQ(result[site * num_local + t],
+                value(site, t, iteration));
+        }
+    }
+}
+
+void gather_test(hpx::lcos::hierarchical_gather<std::size_t>& g,
+    std::size_t thread, std::size_t num_local, std::size_t iterations)
+{
+    std::size_t num_sites = hpx::get_num_localities_sync();
+    std::size_t site = g.get_this_site();
+
+    for (std::size_t it = 0; it != iterations; ++it)
+    {
+        if (site == g.get_root_site())
+        {
+            std::vector<std::size_t> result = hpx::lcos::gather_here(
+                g, value(site, thread, it), thread).get();
+            verify(result, num_sites, num_local, it);
+        }
+        else
+        {
+            hpx::lcos::gather_there(g, value(site, thread, it), thread).get();
+        }
+    }
+
+    for (std::size_t it = 0; it != iterations; ++it)
+    {
+        std::vector<std::size_t> result = hpx::lcos::all_gather(
+            g, value(site, thread, it), thread).get();
+        verify(result, num_sites, num_local, it);
+    }
+}
+
+void run_test(std::string const& name, std::size_t num_local,
+    std::size_t root_site, std::size_t arity, std::size_t iterations)
+{
+    hpx::lcos::hierarchical_gather<std::size_t> g(
+        name, num_local, root_site, arity);
+
+    std::vector<hpx::future<void> > threads;
+    for (std::size_t t = 1; t != num_local; ++t)
+    {
+        threads.push_back(hpx::async(&gather_test, boost::ref(g), t,
+            num_local, iterations));
+    }
+
+    gather_test(g, 0, num_local, iterations);
+    hpx::wait_all(threads);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    std::size_t iterations = vm["iterations"].as<std::size_t>();
+    std::size_t root = hpx::get_num_localities_sync() - 1;
+
+    run_test("/test/hierarchical_gather/single", 1, 0, 2, iterations);
+    run_test("/test/hierarchical_gather/local", 4, 0, 2, iterations);
+    run_test("/test/hierarchical_gather/root", 3, root, 3, iterations);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace boost::program_options;
+
+    // Configure application-specific options
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("iterations", value<std::size_t>()->default_value(10),
+            "the number of times to repeat the test")
+        ;
+
+    // run hpx_main on all localities
+    using namespace boost::assign;
+    std::vector<std::string> cfg;
+    cfg += "hpx.run_hpx_main!=1";
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+      "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,127 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/local_lcos.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <vector>
+
+#include <boost/cstdint.hpp>
+
+typedef hpx::lcos::local::adaptive_mutex mutex_type;
+
+///////////////////////////////////////////////////////////////////////////////
+// Each thread increments the counter in two steps while holding the lock,
+// yielding in between to make the critical section long enough for other
+// threads to suspend.
+void increment(mutex_type& mtx, std::size_t& counter, std::size_t iterations,
+    bool long_section)
+{
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        mutex_type::scoped_lock l(mtx);
+
+        std::size_t value = counter;
+        if (long_section)
+            hpx::this_thread::yield();
+        counter = value + 1;
+    }
+}
+
+void test_mutual_exclusion(mutex_type& mtx, std::size_t num_threads,
+    std::size_t iterations, bool long_section)
+{
+    std::size_t counter = 0;
+
+    std::vector<hpx::future<void> > threads;
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        threads.push_back(hpx::async(&increment, boost::ref(mtx),
+            boost::ref(counter), iterations, long_section));
+    }
+    hpx::wait_all(threads);
+
+    HPX_TEST_EQ(counter, num_threads * iterations);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_try_lock()
+{
+    mutex_type mtx;
+
+    HPX_TEST(mtx.try_lock());
+    HPX_TEST(!mtx.try_lock());
+    mtx.unlock();
+
+    mutex_type::scoped_try_lock l(mtx);
+    HPX_TEST(l ? true : false);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+boost::int64_t query_counter(std::string const& name)
+{
+    hpx::performance_counters::performance_counter c(
+        "/mutex{locality#0/total}/test_adaptive_mutex/" + name);
+    return c.get_value_sync<boost::int64_t>();
+}
+
+void test_statistics(std::size_t num_threads, std::size_t iterations)
+{
+    mutex_type mtx("test_adaptive_mutex", true);
+    mtx.install_counters("test_adaptive_mutex");
+
+    test_mutual_exclusion(mtx, num_threads, iterations, true);
+
+    boost::int64_t acquisitions = query_counter("acquisitions");
+    boost::int64_t contentions = query_counter("contentions");
+    boost::int64_t suspensions = query_counter("suspensions");
+
+    HPX_TEST_EQ(acquisitions, boost::int64_t(num_threads * iterations));
+    HPX_TEST(contentions <= acquisitions);
+    HPX_TEST(suspensions >= 0);
+    HPX_TEST(query_counter("wait-time") >= 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    std::size_t iterations = vm["iterations"].as<std::size_t>();
+    std::size_t num_threads = 16;
+
+    test_try_lock();
+
+    {
+        mutex_type mtx;
+        test_mutual_exclusion(mtx, num_threads, iterations, false);
+        test_mutual_exclusion(mtx, num_threads, iterations, true);
+    }
+
+    test_statistics(num_threads, iterations);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace boost::program_options;
+
+    // Configure application-specific options
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("iterations", value<std::size_t>()->default_value(1000),
+            "the number of times each thread acquires the mutex")
+        ;
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv), 0,
+      "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,302 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/local_lcos.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <vector>
+
+#include <boost/atomic.hpp>
+
+typedef hpx::lcos::local::bounded_channel<std::size_t> channel_type;
+
+///////////////////////////////////////////////////////////////////////////////
+void produce(channel_type& c, std::size_t first, std::size_t count)
+{
+    for (std::size_t i = 0; i != count; ++i)
+        c.send(first + i);
+}
+
+std::size_t consume(channel_type& c, boost::atomic<std::size_t>& received)
+{
+    std::size_t sum = 0;
+    std::size_t val = 0;
+    while (c.receive(val))
+    {
+        sum += val;
+        ++received;
+    }
+    return sum;
+}
+
+void test_mpmc(std::size_t num_producers, std::size_t num_consumers,
+    std::size_t count)
+{
+    // a small capacity makes producers and consumers suspend frequently
+    channel_type c(4);
+    HPX_TEST_EQ(c.capacity(), std::size_t(4));
+
+    boost::atomic<std::size_t> received(0);
+
+    std::vector<hpx::future<void> > producers;
+    for (std::size_t p = 0; p != num_producers; ++p)
+    {
+        producers.push_back(hpx::async(&produce, boost::ref(c), p * count,
+            count));
+    }
+
+    std::vector<hpx::future<std::size_t> > consumers;
+    for (std::size_t p = 0; p != num_consumers; ++p)
+    {
+        consumers.push_back(hpx::async(&consume, boost::ref(c),
+            boost::ref(received)));
+    }
+
+    hpx::wait_all(producers);
+    c.close();
+
+    std::size_t sum = 0;
+    for (std::size_t p = 0; p != num_consumers; ++p)
+        sum += consumers[p].get();
+
+    std::size_t total = num_producers * count;
+    HPX_TEST_EQ(received.load(), total);
+    HPX_TEST_EQ(sum, total * (total - 1) / 2);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_try_and_close()
+{
+    channel_type c(2);
+
+    std::size_t val = 0;
+    HPX_TEST(!c.try_receive(val));
+
+    HPX_TEST(c.try_send(1));
+    HPX_TEST(c.try_send(2));
+    HPX_TEST(!c.try_send(3));
+
+    HPX_TEST(c.try_receive(val));
+    HPX_TEST_EQ(val, std::size_t(1));
+
+    hpx::future<void> sent = c.send_async(3);
+    HPX_TEST(sent.is_ready());
+
+    c.close();
+    HPX_TEST(c.is_closed());
+
+    bool caught_exception = false;
+    try {
+        c.send(4);
+    }
+    catch (hpx::exception const&) {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    // values stored before the channel was closed are still delivered
+    HPX_TEST(c.receive(val));
+    HPX_TEST_EQ(val, std::size_t(2));
+    HPX_TEST_EQ(c.receive_async().get(), std::size_t(3));
+    HPX_TEST(!c.receive(val));
+    HPX_TEST(c.receive_async().has_exception());
+}
+
+void test_receive_async()
+{
+    channel_type c(2);
+
+    hpx::future<std::size_t> f = c.receive_async();
+    c.send(42);
+    HPX_TEST_EQ(f.get(), std::size_t(42));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// The values are encoded as producer * count + sequence number.
+void produce_async(channel_type& c, std::size_t producer, std::size_t count)
+{
+    std::vector<hpx::future<void> > sent;
+    sent.reserve(count);
+    for (std::size_t i = 0; i != count; ++i)
+        sent.push_back(c.send_async(producer * count + i));
+    hpx::wait_all(sent);
+}
+
+void test_send_async_order(std::size_t num_producers, std::size_t count)
+{
+    // a small capacity makes most of the values wait for room
+    channel_type c(2);
+
+    std::vector<hpx::future<void> > producers;
+    for (std::size_t p = 0; p != num_producers; ++p)
+    {
+        producers.push_back(hpx::async(&produce_async, boost::ref(c), p,
+            count));
+    }
+
+    // the values of each producer are received in the order they were sent
+    std::vector<std::size_t> next(num_producers, 0);
+    std::size_t val = 0;
+    for (std::size_t i = 0; i != num_producers * count; ++i)
+    {
+        HPX_TEST(c.receive(val));
+
+        std::size_t producer = val / count;
+        HPX_TEST_LT(producer, num_producers);
+        if (producer < num_producers)
+        {
+            HPX_TEST_EQ(val % count, next[producer]);
+            ++next[producer];
+        }
+    }
+
+    hpx::wait_all(producers);
+    HPX_TEST(!c.try_receive(val));
+}
+
+void test_send_async_close()
+{
+    channel_type c(2);
+    c.send(1);
+    c.send(2);
+
+    // blocked senders fail once the channel is closed
+    hpx::future<void> blocked = c.send_async(3);
+    HPX_TEST(!blocked.is_ready());
+    HPX_TEST(!c.try_send(4));
+
+    c.close();
+    HPX_TEST(blocked.has_exception());
+
+    std::size_t val = 0;
+    HPX_TEST(c.receive(val));
+    HPX_TEST_EQ(val, std::size_t(1));
+    HPX_TEST(c.receive(val));
+    HPX_TEST_EQ(val, std::size_t(2));
+    HPX_TEST(!c.receive(val));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_select(std::size_t count)
+{
+    channel_type c1(4), c2(4);
+
+    std::vector<channel_type*> channels;
+    channels.push_back(&c1);
+    channels.push_back(&c2);
+
+    hpx::future<void> p1 = hpx::async(&produce, boost::ref(c1), 0, count);
+    hpx::future<void> p2 = hpx::async(&produce, boost::ref(c2), count, count);
+
+    std::size_t received[2] = { 0, 0 };
+    std::size_t val = 0;
+    for (std::size_t i = 0; i != 2 * count; ++i)
+    {
+        std::size_t index = hpx::lcos::local::select(channels, val);
+        HPX_TEST(index < 2);
+        HPX_TEST_EQ(val / count, index);
+        ++received[index];
+    }
+
+    HPX_TEST_EQ(received[0], count);
+    HPX_TEST_EQ(received[1], count);
+
+    hpx::wait_all(p1, p2);
+
+    c1.close();
+    c2.close();
+    HPX_TEST_EQ(hpx::lcos::local::select(channels, val), std::size_t(-1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_ring_receive_buffer(std::size_t count)
+{
+    hpx::lcos::local::ring_receive_buffer<std::size_t> buffer(4);
+    HPX_TEST_EQ(buffer.capacity(), std::size_t(4));
+
+    for (std::size_t step = 0; step != count; ++step)
+    {
+        // alternate between the value arriving first and the future being
+        // retrieved first
+        if (step % 2)
+        {
+            buffer.store_received(step, std::size_t(step));
+            HPX_TEST_EQ(buffer.receive(step).get(), step);
+        }
+        else
+        {
+            hpx::future<std::size_t> f = buffer.receive(step);
+            HPX_TEST(!f.is_ready());
+            buffer.store_received(step, std::size_t(step));
+            HPX_TEST_EQ(f.get(), step);
+        }
+    }
+
+    // several steps in flight at the same time
+    std::vector<hpx::future<std::size_t> > futures;
+    for (std::size_t step = count; step != count + 4; ++step)
+        futures.push_back(buffer.receive(step));
+    for (std::size_t step = count; step != count + 4; ++step)
+        buffer.store_received(step, std::size_t(step));
+    for (std::size_t i = 0; i != futures.size(); ++i)
+        HPX_TEST_EQ(futures[i].get(), count + i);
+
+    // a step outside of the window is rejected
+    hpx::future<std::size_t> f = buffer.receive(0);
+    bool caught_exception = false;
+    try {
+        buffer.receive(4);
+    }
+    catch (hpx::exception const&) {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    buffer.store_received(0, std::size_t(0));
+    HPX_TEST_EQ(f.get(), std::size_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    std::size_t count = vm["count"].as<std::size_t>();
+
+    test_mpmc(1, 1, count);
+    test_mpmc(4, 1, count);
+    test_mpmc(1, 4, count);
+    test_mpmc(4, 4, count);
+
+    test_try_and_close();
+    test_receive_async();
+    test_send_async_order(1, count);
+    test_send_async_order(4, count);
+    test_send_async_close();
+    test_select(count);
+    test_ring_receive_buffer(count);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace boost::program_options;
+
+    // Configure application-specific options
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("count", value<std::size_t>()->default_value(1000),
+            "the number of values sent by each producer")
+        ;
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv), 0,
+      "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
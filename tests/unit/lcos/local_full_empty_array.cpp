@@ -0,0 +1,183 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/local_lcos.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <vector>
+
+#include <boost/cstdint.hpp>
+
+typedef hpx::lcos::local::full_empty_array<boost::uint64_t> array_type;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_states()
+{
+    array_type a(4);
+    HPX_TEST_EQ(a.size(), std::size_t(4));
+
+    for (std::size_t i = 0; i != a.size(); ++i)
+        HPX_TEST(a.is_empty(i));
+
+    a.write(0, 42);
+    HPX_TEST(!a.is_empty(0));
+    HPX_TEST_EQ(a.read(0), boost::uint64_t(42));
+    HPX_TEST(!a.is_empty(0));
+    HPX_TEST_EQ(a.read_and_empty(0), boost::uint64_t(42));
+    HPX_TEST(a.is_empty(0));
+
+    a.set(1, 1);
+    a.set(1, 2);
+    HPX_TEST_EQ(a.read(1), boost::uint64_t(2));
+
+    a.set_empty(1);
+    HPX_TEST(a.is_empty(1));
+    a.set_full(1);
+    HPX_TEST_EQ(a.read(1), boost::uint64_t(2));
+
+    array_type b(2, true);
+    HPX_TEST(!b.is_empty(0));
+    HPX_TEST_EQ(b.read_and_empty(1), boost::uint64_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Each producer fills its four elements in turn with consecutive values, a
+// consumer empties them again. Both sides block on the elements which are
+// not in the state they need.
+void produce(array_type& a, std::size_t first, std::size_t count)
+{
+    for (std::size_t i = 0; i != count; ++i)
+        a.write(first + i % 4, first + i);
+}
+
+boost::uint64_t consume(array_type& a, std::size_t first, std::size_t count)
+{
+    boost::uint64_t sum = 0;
+    for (std::size_t i = 0; i != count; ++i)
+        sum += a.read_and_empty(first + i % 4);
+    return sum;
+}
+
+void test_producer_consumer(std::size_t num_pairs, std::size_t count)
+{
+    array_type a(num_pairs * 4);
+
+    std::vector<hpx::future<void> > producers;
+    std::vector<hpx::future<boost::uint64_t> > consumers;
+    for (std::size_t p = 0; p != num_pairs; ++p)
+    {
+        consumers.push_back(hpx::async(&consume, boost::ref(a), p * 4,
+            count));
+        producers.push_back(hpx::async(&produce, boost::ref(a), p * 4,
+            count));
+    }
+
+    hpx::wait_all(producers);
+
+    for (std::size_t p = 0; p != num_pairs; ++p)
+    {
+        // the sum of the values p * 4 ... p * 4 + count - 1
+        boost::uint64_t first = p * 4;
+        boost::uint64_t expected = count * first + count * (count - 1) / 2;
+        HPX_TEST_EQ(consumers[p].get(), expected);
+    }
+
+    for (std::size_t i = 0; i != a.size(); ++i)
+        HPX_TEST(a.is_empty(i));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// All readers waiting for an element are released once it is filled
+boost::uint64_t read_element(array_type& a, std::size_t i)
+{
+    return a.read(i);
+}
+
+void test_waiting_readers(std::size_t num_readers)
+{
+    array_type a(1);
+
+    std::vector<hpx::future<boost::uint64_t> > readers;
+    for (std::size_t i = 0; i != num_readers; ++i)
+        readers.push_back(hpx::async(&read_element, boost::ref(a), 0));
+
+    hpx::this_thread::yield();
+    a.write(0, 7);
+
+    for (std::size_t i = 0; i != num_readers; ++i)
+        HPX_TEST_EQ(readers[i].get(), boost::uint64_t(7));
+
+    HPX_TEST(!a.is_empty(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Changing the state without storing a value releases the waiting threads
+void write_element(array_type& a, std::size_t i, boost::uint64_t val)
+{
+    a.write(i, val);
+}
+
+void test_state_change_releases_waiters()
+{
+    array_type a(2);
+    a.set(0, 5);
+    a.set_empty(0);
+
+    hpx::future<boost::uint64_t> reader =
+        hpx::async(&read_element, boost::ref(a), 0);
+
+    hpx::this_thread::yield();
+    HPX_TEST(!reader.is_ready());
+
+    a.set_full(0);
+    HPX_TEST_EQ(reader.get(), boost::uint64_t(5));
+
+    a.set(1, 1);
+    hpx::future<void> writer =
+        hpx::async(&write_element, boost::ref(a), 1, 2);
+
+    hpx::this_thread::yield();
+    HPX_TEST(!writer.is_ready());
+
+    a.set_empty(1);
+    writer.get();
+    HPX_TEST_EQ(a.read(1), boost::uint64_t(2));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    std::size_t count = vm["count"].as<std::size_t>();
+
+    test_states();
+    test_waiting_readers(16);
+    test_state_change_releases_waiters();
+    test_producer_consumer(1, count);
+    test_producer_consumer(8, count);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace boost::program_options;
+
+    // Configure application-specific options
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("count", value<std::size_t>()->default_value(1000),
+            "the number of values passed by each producer")
+        ;
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv), 0,
+      "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
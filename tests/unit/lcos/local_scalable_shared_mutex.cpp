@@ -0,0 +1,175 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/local_lcos.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <vector>
+
+#include <boost/atomic.hpp>
+#include <boost/thread/locks.hpp>
+
+typedef hpx::lcos::local::scalable_shared_mutex mutex_type;
+
+///////////////////////////////////////////////////////////////////////////////
+// The writers keep both values equal while holding the lock, readers verify
+// that they never observe a partial update.
+struct shared_data
+{
+    shared_data()
+      : first_(0), second_(0), readers_(0), writers_(0)
+    {}
+
+    mutex_type mtx_;
+    std::size_t first_;
+    std::size_t second_;
+
+    boost::atomic<std::size_t> readers_;
+    boost::atomic<std::size_t> writers_;
+};
+
+void reader(shared_data& data, std::size_t iterations)
+{
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        boost::shared_lock<mutex_type> l(data.mtx_);
+
+        ++data.readers_;
+        HPX_TEST_EQ(data.writers_.load(), std::size_t(0));
+        HPX_TEST_EQ(data.first_, data.second_);
+
+        // give other threads the chance to interleave
+        if (i % 16 == 0)
+            hpx::this_thread::yield();
+
+        --data.readers_;
+    }
+}
+
+void writer(shared_data& data, std::size_t iterations)
+{
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        boost::unique_lock<mutex_type> l(data.mtx_);
+
+        HPX_TEST_EQ(++data.writers_, std::size_t(1));
+        HPX_TEST_EQ(data.readers_.load(), std::size_t(0));
+
+        ++data.first_;
+        hpx::this_thread::yield();
+        ++data.second_;
+
+        --data.writers_;
+    }
+}
+
+void test_readers_and_writers(std::size_t num_readers,
+    std::size_t num_writers, std::size_t iterations)
+{
+    shared_data data;
+
+    std::vector<hpx::future<void> > threads;
+    for (std::size_t i = 0; i != num_readers; ++i)
+    {
+        threads.push_back(hpx::async(&reader, boost::ref(data),
+            iterations));
+    }
+    for (std::size_t i = 0; i != num_writers; ++i)
+    {
+        threads.push_back(hpx::async(&writer, boost::ref(data),
+            iterations / 10));
+    }
+    hpx::wait_all(threads);
+
+    HPX_TEST_EQ(data.first_, num_writers * (iterations / 10));
+    HPX_TEST_EQ(data.second_, data.first_);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_try_lock()
+{
+    mutex_type mtx;
+
+    HPX_TEST(mtx.try_lock_shared());
+    HPX_TEST(mtx.try_lock_shared());
+    HPX_TEST(!mtx.try_lock());
+    mtx.unlock_shared();
+    mtx.unlock_shared();
+
+    HPX_TEST(mtx.try_lock());
+    HPX_TEST(!mtx.try_lock());
+    HPX_TEST(!mtx.try_lock_shared());
+    mtx.unlock();
+
+    HPX_TEST(mtx.try_lock_shared());
+    mtx.unlock_shared();
+}
+
+// Readers arriving while a writer holds the lock are suspended and get in
+// once the writer releases it.
+void hold_shared(mutex_type& mtx, boost::atomic<std::size_t>& count)
+{
+    boost::shared_lock<mutex_type> l(mtx);
+    ++count;
+}
+
+void test_waiting_readers(std::size_t num_readers)
+{
+    mutex_type mtx;
+    boost::atomic<std::size_t> count(0);
+
+    std::vector<hpx::future<void> > readers;
+    {
+        boost::unique_lock<mutex_type> l(mtx);
+        for (std::size_t i = 0; i != num_readers; ++i)
+        {
+            readers.push_back(hpx::async(&hold_shared, boost::ref(mtx),
+                boost::ref(count)));
+        }
+
+        hpx::this_thread::yield();
+        HPX_TEST_EQ(count.load(), std::size_t(0));
+    }
+
+    hpx::wait_all(readers);
+    HPX_TEST_EQ(count.load(), num_readers);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    std::size_t iterations = vm["iterations"].as<std::size_t>();
+
+    test_try_lock();
+    test_waiting_readers(16);
+
+    test_readers_and_writers(8, 0, iterations);
+    test_readers_and_writers(8, 1, iterations);
+    test_readers_and_writers(8, 4, iterations);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace boost::program_options;
+
+    // Configure application-specific options
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("iterations", value<std::size_t>()->default_value(10000),
+            "the number of times each reader acquires the lock")
+        ;
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv), 0,
+      "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
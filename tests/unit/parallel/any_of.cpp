@@ -8,6 +8,7 @@
 #include <hpx/include/parallel_all_any_none_of.hpp>
 #include <hpx/util/lightweight_test.hpp>
 
+#include <boost/atomic.hpp>
 #include <boost/range/functions.hpp>
 
 #include "test_utils.hpp"
@@ -129,6 +130,37 @@ void any_of_test()
 //     test_any_of_exec<std::input_iterator_tag>();
 }
 
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_any_of_early_exit(ExPolicy const& policy)
+{
+    BOOST_STATIC_ASSERT(hpx::parallel::is_execution_policy<ExPolicy>::value);
+
+    // the only match is the very first element, the algorithm should stop
+    // long before having looked at all elements
+    std::vector<std::size_t> c(100007, 0);
+    c[0] = 1;
+
+    boost::atomic<std::size_t> invoked(0);
+    bool result =
+        hpx::parallel::any_of(policy, boost::begin(c), boost::end(c),
+            [&invoked](std::size_t v) {
+                ++invoked;
+                return v != 0;
+            });
+
+    HPX_TEST(result);
+    HPX_TEST_LT(invoked.load(), c.size() / 2);
+}
+
+void any_of_early_exit_test()
+{
+    using namespace hpx::parallel;
+
+    test_any_of_early_exit(seq);
+    test_any_of_early_exit(par);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename ExPolicy, typename IteratorTag>
 void test_any_of_exception(ExPolicy const& policy, IteratorTag)
@@ -342,6 +374,7 @@ int hpx_main(boost::program_options::variables_map& vm)
     std::srand(seed);
 
     any_of_test();
+    any_of_early_exit_test();
     any_of_exception_test();
     any_of_bad_alloc_test();
     return hpx::finalize();
@@ -0,0 +1,151 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/thread_executors.hpp>
+#include <hpx/include/parallel_for_each.hpp>
+#include <hpx/include/parallel_memory.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/range/functions.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_numa_executor()
+{
+    hpx::threads::executors::numa_executor exec;
+
+    // every worker thread is used exactly once
+    std::size_t num_threads = hpx::get_os_thread_count();
+    std::vector<std::size_t> workers;
+    for (std::size_t i = 0; i != num_threads; ++i)
+        workers.push_back(exec.get_worker_thread(i));
+
+    std::sort(boost::begin(workers), boost::end(workers));
+    for (std::size_t i = 0; i != num_threads; ++i)
+        HPX_TEST_EQ(workers[i], i);
+
+    // the assignment wraps around
+    HPX_TEST_EQ(exec.get_worker_thread(num_threads), exec.get_worker_thread(0));
+
+    // all tasks get executed
+    std::vector<hpx::future<std::size_t> > results;
+    for (std::size_t i = 0; i != 2 * num_threads; ++i)
+        results.push_back(hpx::async(exec, [i]() { return i; }));
+
+    for (std::size_t i = 0; i != results.size(); ++i)
+        HPX_TEST_EQ(results[i].get(), i);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_numa_allocator(std::size_t size, std::size_t chunk_size)
+{
+    typedef hpx::parallel::util::numa_allocator<std::size_t> allocator_type;
+
+    hpx::threads::executors::numa_executor exec;
+    allocator_type alloc(exec, chunk_size);
+
+    std::vector<std::size_t, allocator_type> c(size, std::size_t(0), alloc);
+    HPX_TEST_EQ(c.size(), size);
+
+    std::size_t chunk = chunk_size;
+    if (chunk == 0)
+    {
+        std::size_t num_threads = hpx::get_os_thread_count();
+        chunk = (size + num_threads - 1) / num_threads;
+    }
+
+    exec.reset();
+    hpx::parallel::for_each(hpx::parallel::par(exec, chunk),
+        boost::begin(c), boost::end(c),
+        [](std::size_t& v) { v = 42; });
+
+    HPX_TEST_EQ(std::count(boost::begin(c), boost::end(c), std::size_t(42)),
+        std::ptrdiff_t(size));
+
+    // allocators compare equal and can be rebound
+    hpx::parallel::util::numa_allocator<double> alloc2(alloc);
+    HPX_TEST(alloc2 == alloc);
+    HPX_TEST_EQ(alloc2.chunk_size(), chunk_size);
+
+    std::vector<double, hpx::parallel::util::numa_allocator<double> >
+        d(size, 1.0, alloc2);
+    HPX_TEST_EQ(std::accumulate(boost::begin(d), boost::end(d), 0.0),
+        double(size));
+}
+
+void test_empty_allocation()
+{
+    typedef hpx::parallel::util::numa_allocator<std::size_t> allocator_type;
+
+    hpx::threads::executors::numa_executor exec;
+    allocator_type alloc(exec);
+
+    allocator_type::pointer p = alloc.allocate(0);
+    HPX_TEST(p == 0);
+    alloc.deallocate(p, 0);
+
+    std::vector<std::size_t, allocator_type> c(alloc);
+    c.resize(0);
+    HPX_TEST(c.empty());
+}
+
+// a default constructed allocator touches the memory following the
+// assignment of a default constructed numa_executor
+void test_default_allocator(std::size_t size)
+{
+    typedef hpx::parallel::util::numa_allocator<std::size_t> allocator_type;
+
+    allocator_type alloc;
+    HPX_TEST(!alloc.executor());
+    HPX_TEST_EQ(alloc.chunk_size(), std::size_t(0));
+
+    std::vector<std::size_t, allocator_type> c(size, std::size_t(1), alloc);
+    HPX_TEST_EQ(std::accumulate(boost::begin(c), boost::end(c), std::size_t(0)),
+        size);
+
+    hpx::parallel::util::numa_allocator<double> alloc2(alloc);
+    HPX_TEST(!alloc2.executor());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_numa_executor();
+
+    test_numa_allocator(10007, 0);
+    test_numa_allocator(10007, 100);
+    test_numa_allocator(1000007, 0);
+    test_numa_allocator(1000007, 4096);
+    test_numa_allocator(1, 0);
+    test_empty_allocation();
+    test_default_allocator(10007);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // default constructing an allocator does not require the runtime
+    {
+        hpx::parallel::util::numa_allocator<std::size_t> alloc;
+        HPX_TEST(!alloc.executor());
+    }
+
+    // By default this test should run on all available cores
+    std::vector<std::string> cfg;
+    cfg.push_back("hpx.os_threads=" +
+        boost::lexical_cast<std::string>(hpx::threads::hardware_concurrency()));
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
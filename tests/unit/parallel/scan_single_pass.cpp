@@ -0,0 +1,304 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_scan.hpp>
+#include <hpx/include/parallel_transform_scan.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/range/functions.hpp>
+
+#include "test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// Composition of affine functions x -> a*x + b is associative but not
+// commutative, which verifies that partial results are combined in order.
+struct affine
+{
+    affine() : a(1), b(0) {}
+    affine(boost::uint64_t a_, boost::uint64_t b_) : a(a_), b(b_) {}
+
+    boost::uint64_t a;
+    boost::uint64_t b;
+
+    friend bool operator==(affine const& lhs, affine const& rhs)
+    {
+        return lhs.a == rhs.a && lhs.b == rhs.b;
+    }
+};
+
+struct compose
+{
+    affine operator()(affine const& f, affine const& g) const
+    {
+        return affine(f.a * g.a, f.b * g.a + g.b);
+    }
+};
+
+std::vector<affine> make_input(std::size_t size)
+{
+    std::vector<affine> c(size);
+    for (affine& f: c)
+        f = affine(std::rand() % 7 + 1, std::rand() % 11);
+    return c;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename IteratorTag>
+void test_inclusive_scan(ExPolicy const& policy, IteratorTag)
+{
+    BOOST_STATIC_ASSERT(hpx::parallel::is_execution_policy<ExPolicy>::value);
+
+    typedef std::vector<affine>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<affine> c = make_input(100007);
+    std::vector<affine> d(c.size());
+
+    hpx::parallel::inclusive_scan(policy,
+        iterator(boost::begin(c)), iterator(boost::end(c)), boost::begin(d),
+        affine(3, 5), compose());
+
+    // verify values
+    std::vector<affine> e(c.size());
+    hpx::parallel::detail::sequential_inclusive_scan(
+        boost::begin(c), boost::end(c), boost::begin(e), affine(3, 5),
+        compose());
+
+    HPX_TEST(std::equal(boost::begin(d), boost::end(d), boost::begin(e)));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_exclusive_scan(ExPolicy const& policy, IteratorTag)
+{
+    BOOST_STATIC_ASSERT(hpx::parallel::is_execution_policy<ExPolicy>::value);
+
+    typedef std::vector<affine>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<affine> c = make_input(100007);
+    std::vector<affine> e(c.size());
+    hpx::parallel::detail::sequential_exclusive_scan(
+        boost::begin(c), boost::end(c), boost::begin(e), affine(3, 5),
+        compose());
+
+    // scan in place
+    hpx::parallel::exclusive_scan(policy,
+        iterator(boost::begin(c)), iterator(boost::end(c)), boost::begin(c),
+        affine(3, 5), compose());
+
+    HPX_TEST(std::equal(boost::begin(c), boost::end(c), boost::begin(e)));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_transform_scans(ExPolicy const& policy, IteratorTag)
+{
+    BOOST_STATIC_ASSERT(hpx::parallel::is_execution_policy<ExPolicy>::value);
+
+    typedef std::vector<std::size_t>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<std::size_t> c(100007);
+    std::iota(boost::begin(c), boost::end(c), std::rand());
+    std::vector<std::size_t> d(c.size());
+    std::vector<std::size_t> e(c.size());
+
+    auto conv = [](std::size_t v) { return v % 13; };
+    auto op = [](std::size_t v1, std::size_t v2) { return v1 + v2; };
+
+    hpx::parallel::transform_inclusive_scan(policy,
+        iterator(boost::begin(c)), iterator(boost::end(c)), boost::begin(d),
+        conv, std::size_t(42), op);
+    hpx::parallel::detail::sequential_transform_inclusive_scan(
+        boost::begin(c), boost::end(c), boost::begin(e), conv,
+        std::size_t(42), op);
+    HPX_TEST(std::equal(boost::begin(d), boost::end(d), boost::begin(e)));
+
+    hpx::parallel::transform_exclusive_scan(policy,
+        iterator(boost::begin(c)), iterator(boost::end(c)), boost::begin(d),
+        conv, std::size_t(42), op);
+    hpx::parallel::detail::sequential_transform_exclusive_scan(
+        boost::begin(c), boost::end(c), boost::begin(e), conv,
+        std::size_t(42), op);
+    HPX_TEST(std::equal(boost::begin(d), boost::end(d), boost::begin(e)));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_scan_async(ExPolicy const& p, IteratorTag)
+{
+    typedef std::vector<affine>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<affine> c = make_input(100007);
+    std::vector<affine> d(c.size());
+
+    hpx::future<base_iterator> f =
+        hpx::parallel::inclusive_scan(p,
+            iterator(boost::begin(c)), iterator(boost::end(c)),
+            boost::begin(d), affine(3, 5), compose());
+    HPX_TEST(f.get() == boost::end(d));
+
+    // verify values
+    std::vector<affine> e(c.size());
+    hpx::parallel::detail::sequential_inclusive_scan(
+        boost::begin(c), boost::end(c), boost::begin(e), affine(3, 5),
+        compose());
+
+    HPX_TEST(std::equal(boost::begin(d), boost::end(d), boost::begin(e)));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_scan_empty(ExPolicy const& policy, IteratorTag)
+{
+    typedef std::vector<affine>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<affine> c;
+    std::vector<affine> d;
+
+    base_iterator result = hpx::parallel::inclusive_scan(policy,
+        iterator(boost::begin(c)), iterator(boost::end(c)), boost::begin(d),
+        affine(3, 5), compose());
+    HPX_TEST(result == boost::end(d));
+
+    result = hpx::parallel::exclusive_scan(policy,
+        iterator(boost::begin(c)), iterator(boost::end(c)), boost::begin(d),
+        affine(3, 5), compose());
+    HPX_TEST(result == boost::end(d));
+}
+
+template <typename IteratorTag>
+void test_scan_single_pass()
+{
+    using namespace hpx::parallel;
+
+    HPX_TEST(!par.is_single_pass());
+    HPX_TEST(par(single_pass).is_single_pass());
+    HPX_TEST(par(single_pass)(100).is_single_pass());
+    HPX_TEST(par(single_pass)(task).is_single_pass());
+    HPX_TEST(par(task)(single_pass).is_single_pass());
+
+    test_inclusive_scan(par(single_pass), IteratorTag());
+    test_inclusive_scan(par(single_pass)(100), IteratorTag());
+    test_inclusive_scan(execution_policy(par(single_pass)), IteratorTag());
+
+    // the three-step scan is still used if not requested otherwise
+    test_inclusive_scan(par, IteratorTag());
+
+    test_exclusive_scan(par(single_pass), IteratorTag());
+    test_exclusive_scan(par(single_pass)(100), IteratorTag());
+    test_exclusive_scan(execution_policy(par(single_pass)), IteratorTag());
+
+    test_transform_scans(par(single_pass), IteratorTag());
+    test_transform_scans(par(single_pass)(100), IteratorTag());
+    test_transform_scans(execution_policy(par(task)(single_pass)),
+        IteratorTag());
+
+    test_scan_async(par(task)(single_pass), IteratorTag());
+    test_scan_async(par(single_pass)(task)(100), IteratorTag());
+
+    test_scan_empty(par(single_pass), IteratorTag());
+}
+
+void scan_single_pass_test()
+{
+    test_scan_single_pass<std::random_access_iterator_tag>();
+    test_scan_single_pass<std::forward_iterator_tag>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename IteratorTag>
+void test_scan_single_pass_exception(ExPolicy const& policy, IteratorTag)
+{
+    BOOST_STATIC_ASSERT(hpx::parallel::is_execution_policy<ExPolicy>::value);
+
+    typedef std::vector<std::size_t>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<std::size_t> c(100007);
+    std::vector<std::size_t> d(c.size());
+    std::fill(boost::begin(c), boost::end(c), std::size_t(1));
+
+    // throw from a single partition only, all partitions to its right have
+    // to give up looking back instead of waiting forever
+    bool caught_exception = false;
+    try {
+        hpx::parallel::inclusive_scan(policy,
+            iterator(boost::begin(c)), iterator(boost::end(c)),
+            boost::begin(d), std::size_t(0),
+            [](std::size_t v1, std::size_t v2)
+            {
+                if (v1 == 1000)
+                    throw std::runtime_error("test");
+                return v1 + v2;
+            });
+
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const&) {
+        caught_exception = true;
+    }
+    catch (...) {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+template <typename IteratorTag>
+void test_scan_single_pass_exception()
+{
+    using namespace hpx::parallel;
+
+    test_scan_single_pass_exception(par(single_pass), IteratorTag());
+    test_scan_single_pass_exception(par(single_pass)(100), IteratorTag());
+}
+
+void scan_single_pass_exception_test()
+{
+    test_scan_single_pass_exception<std::random_access_iterator_tag>();
+    test_scan_single_pass_exception<std::forward_iterator_tag>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int)std::time(0);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    scan_single_pass_test();
+    scan_single_pass_exception_test();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> cfg;
+    cfg.push_back("hpx.os_threads=" +
+        boost::lexical_cast<std::string>(hpx::threads::hardware_concurrency()));
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,294 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_copy.hpp>
+#include <hpx/include/parallel_for_each.hpp>
+#include <hpx/include/parallel_reduce.hpp>
+#include <hpx/include/parallel_view.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/atomic.hpp>
+#include <boost/range/functions.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include "test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename IteratorTag>
+void test_transform_view(ExPolicy const& policy, IteratorTag)
+{
+    BOOST_STATIC_ASSERT(hpx::parallel::is_execution_policy<ExPolicy>::value);
+
+    typedef std::vector<std::size_t>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    namespace view = hpx::parallel::view;
+
+    std::vector<std::size_t> c(10007);
+    std::iota(boost::begin(c), boost::end(c), std::rand());
+
+    auto rng = view::transform(
+        boost::make_iterator_range(
+            iterator(boost::begin(c)), iterator(boost::end(c))),
+        [](std::size_t v) { return 2 * v; });
+
+    std::size_t r1 = hpx::parallel::reduce(policy,
+        boost::begin(rng), boost::end(rng), std::size_t(0));
+
+    // verify values
+    std::size_t r2 = 2 * std::accumulate(
+        boost::begin(c), boost::end(c), std::size_t(0));
+    HPX_TEST_EQ(r1, r2);
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_transform_view_async(ExPolicy const& p, IteratorTag)
+{
+    typedef std::vector<std::size_t>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    namespace view = hpx::parallel::view;
+
+    std::vector<std::size_t> c(10007);
+    std::iota(boost::begin(c), boost::end(c), std::rand());
+
+    auto rng = view::transform(
+        boost::make_iterator_range(
+            iterator(boost::begin(c)), iterator(boost::end(c))),
+        [](std::size_t v) { return 2 * v; });
+
+    hpx::future<std::size_t> f = hpx::parallel::reduce(p,
+        boost::begin(rng), boost::end(rng), std::size_t(0));
+    f.wait();
+
+    // verify values
+    std::size_t r2 = 2 * std::accumulate(
+        boost::begin(c), boost::end(c), std::size_t(0));
+    HPX_TEST_EQ(f.get(), r2);
+}
+
+template <typename IteratorTag>
+void test_transform_view()
+{
+    using namespace hpx::parallel;
+
+    test_transform_view(seq, IteratorTag());
+    test_transform_view(par, IteratorTag());
+    test_transform_view(par_vec, IteratorTag());
+
+    test_transform_view_async(seq(task), IteratorTag());
+    test_transform_view_async(par(task), IteratorTag());
+}
+
+void transform_view_test()
+{
+    test_transform_view<std::random_access_iterator_tag>();
+    test_transform_view<std::forward_iterator_tag>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_filter_transform_view(ExPolicy const& policy)
+{
+    BOOST_STATIC_ASSERT(hpx::parallel::is_execution_policy<ExPolicy>::value);
+
+    namespace view = hpx::parallel::view;
+
+    std::vector<std::size_t> c(10007);
+    std::iota(boost::begin(c), boost::end(c), std::rand());
+
+    auto is_odd = [](std::size_t v) { return (v % 2) != 0; };
+    auto square = [](std::size_t v) { return v * v; };
+
+    // a single pass copies the squares of all odd elements
+    auto rng = view::transform(view::filter(c, is_odd), square);
+    BOOST_STATIC_ASSERT(view::is_filtered_range<decltype(rng)>::value);
+    BOOST_STATIC_ASSERT(
+        !view::is_filtered_range<std::vector<std::size_t> >::value);
+
+    std::vector<std::size_t> d(c.size());
+    std::vector<std::size_t>::iterator end = hpx::parallel::copy(policy,
+        rng, boost::begin(d));
+
+    // verify values
+    std::vector<std::size_t> expected;
+    for (std::size_t v : c)
+    {
+        if (is_odd(v))
+            expected.push_back(square(v));
+    }
+
+    HPX_TEST_EQ(std::size_t(std::distance(boost::begin(d), end)),
+        expected.size());
+    HPX_TEST(std::equal(boost::begin(expected), boost::end(expected),
+        boost::begin(d)));
+}
+
+template <typename ExPolicy>
+void test_filter_reduce_view(ExPolicy const& policy)
+{
+    BOOST_STATIC_ASSERT(hpx::parallel::is_execution_policy<ExPolicy>::value);
+
+    namespace view = hpx::parallel::view;
+
+    std::vector<std::size_t> c(10007);
+    std::iota(boost::begin(c), boost::end(c), std::rand());
+
+    // the predicate is evaluated exactly once for each element
+    boost::atomic<std::size_t> calls(0);
+    auto is_odd =
+        [&calls](std::size_t v)
+        {
+            ++calls;
+            return (v % 2) != 0;
+        };
+    auto twice = [](std::size_t v) { return 2 * v; };
+
+    auto odd = view::transform(view::filter(c, is_odd), twice);
+
+    std::size_t r1 = hpx::parallel::reduce(policy, odd, std::size_t(0));
+    HPX_TEST_EQ(calls.load(), c.size());
+
+    // verify values
+    std::size_t r2 = 0;
+    for (std::size_t v : c)
+    {
+        if (is_odd(v))
+            r2 += twice(v);
+    }
+    HPX_TEST_EQ(r1, r2);
+
+    // for_each sees the same elements
+    calls = 0;
+    boost::atomic<std::size_t> r3(0);
+    hpx::parallel::for_each(policy, odd,
+        [&r3](std::size_t v) { r3 += v; });
+    HPX_TEST_EQ(calls.load(), c.size());
+    HPX_TEST_EQ(r3.load(), r2);
+}
+
+template <typename ExPolicy>
+void test_filter_reduce_view_async(ExPolicy const& p)
+{
+    namespace view = hpx::parallel::view;
+
+    std::vector<std::size_t> c(10007);
+    std::iota(boost::begin(c), boost::end(c), std::rand());
+
+    auto is_odd = [](std::size_t v) { return (v % 2) != 0; };
+
+    hpx::future<std::size_t> f = hpx::parallel::reduce(p,
+        view::filter(c, is_odd), std::size_t(0));
+    f.wait();
+
+    // verify values
+    std::size_t r = 0;
+    for (std::size_t v : c)
+    {
+        if (is_odd(v))
+            r += v;
+    }
+    HPX_TEST_EQ(f.get(), r);
+}
+
+void filter_transform_view_test()
+{
+    using namespace hpx::parallel;
+
+    test_filter_transform_view(seq);
+    test_filter_transform_view(par);
+    test_filter_transform_view(par_vec);
+
+    test_filter_reduce_view(seq);
+    test_filter_reduce_view(par);
+    test_filter_reduce_view(par_vec);
+
+    test_filter_reduce_view_async(seq(task));
+    test_filter_reduce_view_async(par(task));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_zip_enumerate_view(ExPolicy const& policy)
+{
+    BOOST_STATIC_ASSERT(hpx::parallel::is_execution_policy<ExPolicy>::value);
+
+    namespace view = hpx::parallel::view;
+    using hpx::util::get;
+
+    std::vector<std::size_t> c(10007);
+    std::vector<std::size_t> d(c.size());
+    std::iota(boost::begin(c), boost::end(c), std::rand());
+
+    // write through the zipped view
+    auto zipped = view::zip(c, d);
+    hpx::parallel::for_each(policy, boost::begin(zipped), boost::end(zipped),
+        [](hpx::util::tuple<std::size_t&, std::size_t&> t)
+        {
+            get<1>(t) = get<0>(t) + 1;
+        });
+
+    // enumerate provides the index of each element
+    boost::atomic<std::size_t> count(0);
+    auto enumerated = view::enumerate(d);
+    hpx::parallel::for_each(policy,
+        boost::begin(enumerated), boost::end(enumerated),
+        [&c, &count](hpx::util::tuple<std::size_t const&, std::size_t&> t)
+        {
+            HPX_TEST_EQ(get<1>(t), c[get<0>(t)] + 1);
+            ++count;
+        });
+
+    HPX_TEST_EQ(count.load(), c.size());
+}
+
+void zip_enumerate_view_test()
+{
+    using namespace hpx::parallel;
+
+    test_zip_enumerate_view(seq);
+    test_zip_enumerate_view(par);
+}
+
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int)std::time(0);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    transform_view_test();
+    filter_transform_view_test();
+    zip_enumerate_view_test();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+    //By default run on all available cores
+    std::vector<std::string> cfg;
+    cfg.push_back("hpx.os_threads=" +
+        boost::lexical_cast<std::string>(hpx::threads::hardware_concurrency()));
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -91,12 +91,40 @@ void test_stateful_allocator(hpx::id_type dest, char* send_buffer,
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// A buffer created in 'copy' mode from non-const data has to own a copy of
+// the data, leaving the caller's memory alone.
+void test_copy_mode(std::size_t size)
+{
+    std::unique_ptr<char[]> data(new char[size]);
+    for (std::size_t i = 0; i != size; ++i)
+        data[i] = char(i);
+
+    {
+        buffer_plain_type buffer(data.get(), size, buffer_plain_type::copy);
+        HPX_TEST_EQ(buffer.size(), size);
+        HPX_TEST(buffer.data() != data.get());
+        HPX_TEST(0 == memcmp(buffer.data(), data.get(), size));
+
+        // modifying the copy does not change the original data
+        buffer[0] = char(~data[0]);
+        HPX_TEST(buffer[0] != data[0]);
+    }
+
+    // the original data is still valid after the buffer went away
+    for (std::size_t i = 0; i != size; ++i)
+        HPX_TEST_EQ(data[i], char(i));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(int argc, char* argv[])
 {
     std::size_t const max_size = 1 << 22;
     std::unique_ptr<char[]> send_buffer(new char[max_size]);
 
+    for (std::size_t size = 1; size <= 1024; size *= 2)
+        test_copy_mode(size);
+
     for (hpx::id_type const& loc : hpx::find_all_localities())
     {
         for (std::size_t size = 1; size <= max_size; size *= 2)
@@ -0,0 +1,126 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/util/size_class_memory_pool.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstring>
+#include <vector>
+
+#include <boost/atomic.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+boost::atomic<std::size_t> registered(0);
+
+struct counting_registration
+{
+    void register_memory(char*, std::size_t size)
+    {
+        registered += size;
+    }
+    void deregister_memory(char*, std::size_t size)
+    {
+        registered -= size;
+    }
+};
+
+typedef hpx::util::size_class_memory_pool<counting_registration> pool_type;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_reuse()
+{
+    pool_type pool(4096, 16);
+    HPX_TEST_EQ(pool.chunk_size_, std::size_t(4096));
+
+    // the first allocation acquires a slab, all others are served from the
+    // blocks of this slab
+    char* p = pool.allocate(100);
+    HPX_TEST(p != 0);
+    HPX_TEST_EQ(pool.get_slab_allocation_count(), std::size_t(1));
+    HPX_TEST_EQ(pool.get_chunk_address(p, 100).second, std::size_t(128));
+    std::memset(p, 0xcd, 100);
+
+    pool.deallocate(p, 100);
+    char* q = pool.allocate(128);
+    HPX_TEST_EQ(p, q);
+    pool.deallocate(q, 128);
+
+    HPX_TEST_EQ(pool.get_slab_allocation_count(), std::size_t(1));
+    HPX_TEST_EQ(pool.get_allocation_count(), std::size_t(2));
+    HPX_TEST_EQ(pool.get_hit_rate(), 0.5);
+
+    // requests beyond the largest size class are forwarded to the system
+    char* large = pool.allocate(8192);
+    HPX_TEST_EQ(pool.get_fallback_allocation_count(), std::size_t(1));
+    HPX_TEST_EQ(pool.get_chunk_address(large, 8192).second, std::size_t(8192));
+    pool.deallocate(large, 8192);
+}
+
+void test_registration()
+{
+    {
+        pool_type pool(1024, 16);
+
+        char* p = pool.allocate(1000);
+        HPX_TEST_EQ(registered.load(), std::size_t(1024 * pool_type::blocks_per_slab));
+
+        char* large = pool.allocate(2000);
+        HPX_TEST_EQ(registered.load(),
+            std::size_t(1024 * pool_type::blocks_per_slab + 2000));
+
+        pool.deallocate(large, 2000);
+        pool.deallocate(p, 1000);
+        HPX_TEST_EQ(registered.load(), std::size_t(1024 * pool_type::blocks_per_slab));
+    }
+
+    // all slabs are deregistered once the pool is gone
+    HPX_TEST_EQ(registered.load(), std::size_t(0));
+}
+
+void allocate_many(pool_type& pool, std::size_t size)
+{
+    std::vector<char*> blocks;
+    for (std::size_t i = 0; i != 100; ++i)
+    {
+        char* p = pool.allocate(size);
+        std::memset(p, int(i), size);
+        blocks.push_back(p);
+    }
+
+    for (std::size_t i = 0; i != blocks.size(); ++i)
+    {
+        HPX_TEST_EQ(blocks[i][0], char(i));
+        HPX_TEST_EQ(blocks[i][size - 1], char(i));
+        pool.deallocate(blocks[i], size);
+    }
+}
+
+void test_concurrent()
+{
+    pool_type pool(4096, 64);
+
+    std::vector<hpx::future<void> > futures;
+    for (std::size_t i = 0; i != 64; ++i)
+    {
+        futures.push_back(hpx::async(&allocate_many,
+            boost::ref(pool), std::size_t(64) << (i % 7)));
+    }
+    hpx::wait_all(futures);
+
+    HPX_TEST_EQ(pool.get_allocation_count(), std::size_t(6400));
+    HPX_TEST_EQ(pool.get_fallback_allocation_count(), std::size_t(0));
+}
+
+int main()
+{
+    test_reuse();
+    test_registration();
+    test_concurrent();
+
+    return hpx::util::report_errors();
+}